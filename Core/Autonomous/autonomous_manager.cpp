@@ -10,8 +10,8 @@
 // Orchestrates all systems for self-directed intelligence
 
 // Forward declarations for internal functions
-static DWORD WINAPI OperationThreadProc(LPVOID param);
-static DWORD WINAPI MonitoringThreadProc(LPVOID param);
+static void DispatchJob(void* param);
+static void ScheduleDispatch(AutonomousManager* manager);
 static NTSTATUS ExecuteTask(AutonomousManager* manager, AutonomousTask* task);
 static NTSTATUS PlanTaskSequence(AutonomousManager* manager, const char* objective, AutonomousTask** tasks, uint32_t* count);
 static float EvaluateTaskUrgency(AutonomousManager* manager, AutonomousTask* task);
@@ -389,77 +389,82 @@ static NTSTATUS LearnFromTaskExecution(AutonomousManager* manager, AutonomousTas
     return STATUS_SUCCESS;
 }
 
-// Thread functions
-static DWORD WINAPI OperationThreadProc(LPVOID param) {
-    AutonomousManager* manager = (AutonomousManager*)param;
+// Dispatch: one pool job at a time runs queued tasks, most urgent first, until none is left.
+// QueueTask schedules it, so nothing polls while the queue is empty.
+static AutonomousTask* PickNextTask(AutonomousManager* manager) {
+    AutonomousTask* best_task = NULL;
+    float best_urgency = -1.0f;
 
-    while (manager->is_active) {
-        EnterCriticalSection(&manager->lock);
-
-        // Find highest priority task to execute
-        AutonomousTask* best_task = NULL;
-        float best_urgency = -1.0f;
-
-        for (uint32_t i = 0; i < manager->task_count; i++) {
-            AutonomousTask* task = &manager->task_queue[i];
-            if (task->state == TASK_STATE_QUEUED) {
-                float urgency = EvaluateTaskUrgency(manager, task);
-                if (urgency > best_urgency) {
-                    best_urgency = urgency;
-                    best_task = task;
-                }
+    EnterCriticalSection(&manager->lock);
+    for (uint32_t i = 0; i < manager->task_count; i++) {
+        AutonomousTask* task = &manager->task_queue[i];
+        if (task->state == TASK_STATE_QUEUED) {
+            float urgency = EvaluateTaskUrgency(manager, task);
+            if (urgency > best_urgency) {
+                best_urgency = urgency;
+                best_task = task;
             }
         }
+    }
+    LeaveCriticalSection(&manager->lock);
+    return best_task;
+}
 
-        if (best_task) {
-            LeaveCriticalSection(&manager->lock);
-            ExecuteTask(manager, best_task);
-            EnterCriticalSection(&manager->lock);
-        }
-
-        LeaveCriticalSection(&manager->lock);
+static void DispatchJob(void* param) {
+    AutonomousManager* manager = (AutonomousManager*)param;
 
-        // Small delay between task checks
-        Sleep(100);
+    for (;;) {
+        AutonomousTask* task = manager->is_active ? PickNextTask(manager) : NULL;
+        if (task) {
+            ExecuteTask(manager, task);
+            continue;
+        }
+        InterlockedExchange(&manager->dispatch_scheduled, 0);
+        // A task queued after the scan saw dispatch still scheduled and left it to us
+        if (!manager->is_active || !PickNextTask(manager)) return;
+        if (InterlockedCompareExchange(&manager->dispatch_scheduled, 1, 0) != 0) return;
     }
-
-    return 0;
 }
 
-static DWORD WINAPI MonitoringThreadProc(LPVOID param) {
-    AutonomousManager* manager = (AutonomousManager*)param;
+static void ScheduleDispatch(AutonomousManager* manager) {
+    if (!manager->is_active) return;
+    if (InterlockedCompareExchange(&manager->dispatch_scheduled, 1, 0) != 0) return;
+    ThreadPool_Submit(ThreadPool_GetGlobal(), DispatchJob, manager, THREAD_POOL_PRIORITY_LOW,
+                      &manager->dispatch_group);
+}
 
-    while (manager->is_active) {
-        EnterCriticalSection(&manager->lock);
+NTSTATUS AutonomousManager_Monitor(AutonomousManager* manager) {
+    if (!manager->initialized) return STATUS_INVALID_DEVICE_STATE;
+    if (!manager->is_active) return STATUS_SUCCESS;
 
-        // Update user presence
-        manager->user_present = IsUserActive(manager);
+    EnterCriticalSection(&manager->lock);
 
-        // Generate maintenance tasks when idle
-        if (!manager->user_present && manager->task_count < manager->max_tasks / 2) {
-            AutonomousManager_QueueTask(manager, TASK_MAINTAIN,
-                                      "Periodic system maintenance",
-                                      "{\"type\":\"maintenance\"}", PRIORITY_IDLE);
-        }
+    // Update user presence
+    manager->user_present = IsUserActive(manager);
+    bool maintenance_due = !manager->user_present && manager->task_count < manager->max_tasks / 2;
 
-        // Monitor system health
-        if (manager->neural_system) {
-            float entropy = NeuralSubstrate_GetEntropy(manager->neural_system);
-            if (entropy > 0.9f) {
-                // High entropy - might need optimization
-                AutonomousManager_QueueTask(manager, TASK_OPTIMIZE,
-                                          "Entropy optimization",
-                                          "{\"reason\":\"high_entropy\"}", PRIORITY_LOW);
-            }
-        }
+    LeaveCriticalSection(&manager->lock);
 
-        LeaveCriticalSection(&manager->lock);
+    // Generate maintenance tasks when idle. Tasks are queued only after the lock is released:
+    // QueueTask submits the dispatch job, which runs inline when the pool cannot take it
+    if (maintenance_due) {
+        AutonomousManager_QueueTask(manager, TASK_MAINTAIN,
+                                  "Periodic system maintenance",
+                                  "{\"type\":\"maintenance\"}", PRIORITY_IDLE);
+    }
 
-        // Monitoring interval
-        Sleep(5000); // Check every 5 seconds
+    // Monitor system health
+    if (manager->neural_system) {
+        float entropy = NeuralSubstrate_GetEntropy(manager->neural_system);
+        if (entropy > 0.9f) {
+            // High entropy - might need optimization
+            AutonomousManager_QueueTask(manager, TASK_OPTIMIZE,
+                                      "Entropy optimization",
+                                      "{\"reason\":\"high_entropy\"}", PRIORITY_LOW);
+        }
     }
 
-    return 0;
+    return STATUS_SUCCESS;
 }
 
 static float EvaluateTaskUrgency(AutonomousManager* manager, AutonomousTask* task) {
@@ -518,6 +523,9 @@ NTSTATUS AutonomousManager_Initialize(AutonomousManager* manager,
     manager->average_completion_time = 0.0f;
     manager->system_efficiency = 1.0f;
 
+    manager->dispatch_scheduled = 0;
+    memset(&manager->dispatch_group, 0, sizeof(manager->dispatch_group));
+
     manager->initialized = true;
     return STATUS_SUCCESS;
 }
@@ -558,13 +566,8 @@ NTSTATUS AutonomousManager_StartOperation(AutonomousManager* manager) {
 
     manager->is_active = true;
 
-    // Start operation thread
-    manager->operation_thread = CreateThread(NULL, 0, OperationThreadProc, manager, 0, NULL);
-    if (!manager->operation_thread) return STATUS_UNSUCCESSFUL;
-
-    // Start monitoring thread
-    manager->monitoring_thread = CreateThread(NULL, 0, MonitoringThreadProc, manager, 0, NULL);
-    if (!manager->monitoring_thread) return STATUS_UNSUCCESSFUL;
+    // Tasks queued before the start; later ones schedule dispatch themselves
+    ScheduleDispatch(manager);
 
     return STATUS_SUCCESS;
 }
@@ -574,18 +577,8 @@ NTSTATUS AutonomousManager_StopOperation(AutonomousManager* manager) {
 
     manager->is_active = false;
 
-    // Wait for threads to finish
-    if (manager->operation_thread) {
-        WaitForSingleObject(manager->operation_thread, 5000);
-        CloseHandle(manager->operation_thread);
-        manager->operation_thread = NULL;
-    }
-
-    if (manager->monitoring_thread) {
-        WaitForSingleObject(manager->monitoring_thread, 5000);
-        CloseHandle(manager->monitoring_thread);
-        manager->monitoring_thread = NULL;
-    }
+    // Dispatch stops after the task in hand
+    ThreadPool_Wait(ThreadPool_GetGlobal(), &manager->dispatch_group);
 
     return STATUS_SUCCESS;
 }
@@ -628,6 +621,7 @@ NTSTATUS AutonomousManager_QueueTask(AutonomousManager* manager, TaskType type,
     task->max_retries = 3;
 
     LeaveCriticalSection(&manager->lock);
+    ScheduleDispatch(manager);
     return STATUS_SUCCESS;
 }
 
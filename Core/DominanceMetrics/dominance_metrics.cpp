@@ -42,6 +42,7 @@ NTSTATUS DominanceMetrics_Initialize(DominanceMetrics* dm,
     if (!dm->history) return STATUS_INSUFFICIENT_RESOURCES;
     memset(dm->history, 0, sizeof(DominanceSnapshot) * dm->history_capacity);
     dm->last_stress_robustness = -1.0;
+    dm->current.stress_robustness = -1.0f;
     dm->initialized = true;
     return STATUS_SUCCESS;
 }
@@ -71,6 +72,11 @@ NTSTATUS DominanceMetrics_Update(DominanceMetrics* dm,
     cur->step_count = step_count;
     cur->generation = generation;
     cur->timestamp_ms = GetTimeMs();
+    // Robustness results arrive far less often than updates; the latest one carries forward
+    if (dm->last_stress_robustness >= 0.0) {
+        cur->stress_robustness = (float)dm->last_stress_robustness;
+        dm->last_stress_robustness = -1.0;
+    }
 
     cur->dominance = fitness * (1.0 - loss);
     if (cur->dominance < 0.0) cur->dominance = 0.0;
@@ -143,9 +149,10 @@ NTSTATUS DominanceMetrics_Serialize(const DominanceMetrics* dm, char* buf, size_
     int n = snprintf(buf, buf_size,
         "{\"dominance\":%.4f,\"efficiency\":%.4f,\"coherence\":%.4f,\"adaptability\":%.4f,"
         "\"dominance_trend\":%.6f,\"efficiency_trend\":%.6f,\"coherence_trend\":%.6f,\"adaptability_trend\":%.6f,"
-        "\"step\":%llu,\"generation\":%llu}",
+        "\"stress_robustness\":%.4f,\"step\":%llu,\"generation\":%llu}",
         dm->current.dominance, dm->current.efficiency, dm->current.coherence, dm->current.adaptability,
         dm->dominance_trend, dm->efficiency_trend, dm->coherence_trend, dm->adaptability_trend,
+        (double)dm->current.stress_robustness,
         (unsigned long long)dm->current.step_count, (unsigned long long)dm->current.generation);
     return (n > 0 && (size_t)n < buf_size) ? STATUS_SUCCESS : STATUS_UNSUCCESSFUL;
 }
@@ -1,4 +1,5 @@
 #include "../../Include/episodic_memory.h"
+#include "../../Include/thread_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -9,6 +10,8 @@
 #endif
 
 #define EPISODIC_CAP 2048
+#define EPISODIC_SCAN_CHUNKS 8               // Retrieve splits the scan this many ways on the pool
+#define EPISODIC_PARALLEL_MIN_ENTRIES 512    // below this one thread is faster than the hand-off
 
 static uint64_t GetTimeMs(void) {
     return (uint64_t)GetTickCount64();
@@ -93,6 +96,50 @@ NTSTATUS EpisodicMemory_Consolidate(EpisodicMemory* em) {
     return STATUS_SUCCESS;
 }
 
+// Keeps sims[] descending; ties keep the earlier entry first, as a single pass in index order would
+static void Retrieve_Insert(float* sims, uint32_t* idx, uint32_t k, float sim, uint32_t i) {
+    uint32_t j = 0;
+    while (j < k && sim <= sims[j]) j++;
+    if (j >= k) return;
+    for (uint32_t t = k - 1; t > j; t--) {
+        sims[t] = sims[t - 1];
+        idx[t] = idx[t - 1];
+    }
+    sims[j] = sim;
+    idx[j] = i;
+}
+
+typedef struct {
+    const EpisodicMemory* em;
+    const float* query;
+    uint32_t dim;
+    uint32_t k;
+    uint32_t chunk_size;
+    float qn;
+    float sims[EPISODIC_SCAN_CHUNKS][EPISODIC_RETRIEVAL_K];
+    uint32_t idx[EPISODIC_SCAN_CHUNKS][EPISODIC_RETRIEVAL_K];
+} RetrieveScan;
+
+// Top-k of each chunk of entries in [begin, end) of the chunk range
+static void Retrieve_ScanChunks(uint64_t begin, uint64_t end, void* context) {
+    RetrieveScan* scan = (RetrieveScan*)context;
+    const EpisodicMemory* em = scan->em;
+    for (uint64_t c = begin; c < end; c++) {
+        float* sims = scan->sims[c];
+        uint32_t* idx = scan->idx[c];
+        for (uint32_t j = 0; j < scan->k; j++) { sims[j] = -2.f; idx[j] = 0; }
+        uint32_t first = (uint32_t)c * scan->chunk_size;
+        uint32_t last = first + scan->chunk_size;
+        if (last > em->entry_count) last = em->entry_count;
+        for (uint32_t i = first; i < last; i++) {
+            float* L = em->entries[i].embedding;
+            float sim = Dot(scan->query, L, scan->dim) / (scan->qn * Norm(L, em->entries[i].dim) + 1e-10f);
+            sim *= (0.5f + 0.5f * em->entries[i].utility);
+            Retrieve_Insert(sims, idx, scan->k, sim, i);
+        }
+    }
+}
+
 NTSTATUS EpisodicMemory_Retrieve(EpisodicMemory* em, const float* query, uint32_t query_dim,
     float* out_embeddings, uint32_t* out_indices, uint32_t k) {
     if (!em || !em->initialized || !query || !out_embeddings || !out_indices) return STATUS_INVALID_PARAMETER;
@@ -102,23 +149,24 @@ NTSTATUS EpisodicMemory_Retrieve(EpisodicMemory* em, const float* query, uint32_
     if (k > EPISODIC_RETRIEVAL_K) k = EPISODIC_RETRIEVAL_K;
     float qn = Norm(query, dim);
     if (qn < 1e-10f) return STATUS_SUCCESS;
+
+    // Chunks are scanned independently and merged in order, so the result matches one pass
+    RetrieveScan scan;
+    scan.em = em;
+    scan.query = query;
+    scan.dim = dim;
+    scan.k = k;
+    scan.qn = qn;
+    uint32_t chunks = em->entry_count >= EPISODIC_PARALLEL_MIN_ENTRIES ? EPISODIC_SCAN_CHUNKS : 1;
+    scan.chunk_size = (em->entry_count + chunks - 1) / chunks;
+    ThreadPool_ParallelFor(chunks > 1 ? ThreadPool_GetGlobal() : NULL, 0, chunks, 1, Retrieve_ScanChunks, &scan,
+        THREAD_POOL_PRIORITY_HIGH);
+
     float best_sims[EPISODIC_RETRIEVAL_K];
     uint32_t best_idx[EPISODIC_RETRIEVAL_K];
     for (uint32_t i = 0; i < k; i++) { best_sims[i] = -2.f; best_idx[i] = 0; }
-    for (uint32_t i = 0; i < em->entry_count; i++) {
-        float* L = em->entries[i].embedding;
-        float sim = Dot(query, L, dim) / (qn * Norm(L, em->entries[i].dim) + 1e-10f);
-        sim *= (0.5f + 0.5f * em->entries[i].utility);
-        uint32_t j = 0;
-        while (j < k && sim <= best_sims[j]) j++;
-        if (j < k) {
-            for (uint32_t t = k - 1; t > j; t--) {
-                best_sims[t] = best_sims[t - 1];
-                best_idx[t] = best_idx[t - 1];
-            }
-            best_sims[j] = sim;
-            best_idx[j] = i;
-        }
+    for (uint32_t c = 0; c < chunks; c++) {
+        for (uint32_t j = 0; j < k; j++) Retrieve_Insert(best_sims, best_idx, k, scan.sims[c][j], scan.idx[c][j]);
     }
     for (uint32_t j = 0; j < k; j++) {
         out_indices[j] = best_idx[j];
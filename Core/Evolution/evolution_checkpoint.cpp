@@ -0,0 +1,576 @@
+/*
+ * Evolution Checkpoint - Raijin
+ * Owner: Core/Evolution
+ * Inputs: EvolutionEngine between generations; snapshot path
+ * Outputs: Binary population snapshot (header CRC + payload CRC); restored engine state
+ * Invariants: A snapshot file is replaced atomically (temp file + rename), so a crash mid-write
+ *             leaves the previous snapshot intact. Load validates everything before it touches
+ *             the engine.
+ * Budget: Caller pays one memcpy of the population per snapshot; CRC and I/O on a worker thread
+ * Failure modes: Disk full, torn file, parameter mismatch between snapshot and engine
+ * Recovery: Writer reports the status and retries at the next interval; Load returns
+ *           STATUS_DATA_ERROR / STATUS_INVALID_DEVICE_STATE and the caller starts fresh
+ */
+
+#include "../../Include/evolution_checkpoint.h"
+#include "../../Include/evolution_surrogate.h"
+#include "../../Include/qpc_clock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHECKPOINT_HAS_NOVELTY 0x1u
+#define CHECKPOINT_HAS_SURROGATE 0x2u
+#define CHECKPOINT_READ_CHUNK (64u * 1024u * 1024u)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t flags;
+    uint32_t population_size;
+    uint32_t max_size;
+    uint64_t genome_size;                // bytes per individual; every genome has the same size
+    uint32_t generation;
+    uint32_t stats_size;                 // sizeof(EvolutionStatistics) of the writer
+    uint64_t payload_size;
+    uint32_t payload_crc;
+    uint32_t header_crc;                 // over every byte before this field
+} CheckpointHeader;
+
+typedef struct {
+    uint64_t id;
+    uint64_t parent1_id;
+    uint64_t parent2_id;
+    double fitness;
+    double adjusted_fitness;
+    uint32_t age;
+    uint32_t evaluated;
+} CheckpointIndividual;
+
+typedef struct {
+    uint32_t size;
+    uint32_t max_size;
+    uint32_t k_neighbors;
+    uint32_t descriptor_dim;
+    uint32_t next_slot;
+    uint32_t generations_without_insert;
+    double insertion_threshold;
+    uint64_t total_insertions;
+} CheckpointNovelty;
+
+typedef struct {
+    uint32_t features;
+    uint32_t genes;
+    uint64_t seed;
+    double lengthscale;
+    double true_fraction;
+    double rank_correlation;
+    double mean_abs_error;
+    uint64_t samples;
+    uint64_t predictions;
+    uint64_t screened_out;
+    uint32_t dirty;
+    uint32_t trained;
+} CheckpointSurrogate;
+
+typedef struct {
+    double best_fitness;
+    double average_fitness;
+    double fitness_variance;
+    int64_t best_index;                  // -1 when no best individual
+    uint64_t individual_id_counter;
+} CheckpointPopulation;
+
+// CRC-32 (IEEE, reflected), slice-by-4
+static uint32_t g_crc_table[4][256];
+static volatile LONG g_crc_ready = 0;
+
+static void Crc32_Init(void) {
+    if (g_crc_ready) return;
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        g_crc_table[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = g_crc_table[0][i];
+        for (int t = 1; t < 4; t++) {
+            c = g_crc_table[0][c & 0xFF] ^ (c >> 8);
+            g_crc_table[t][i] = c;
+        }
+    }
+    InterlockedExchange(&g_crc_ready, 1);
+}
+
+static uint32_t Crc32(const uint8_t* data, size_t size) {
+    Crc32_Init();
+    uint32_t crc = 0xFFFFFFFFu;
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        uint32_t word;
+        memcpy(&word, data + i, 4);
+        crc ^= word;
+        crc = g_crc_table[3][crc & 0xFF] ^ g_crc_table[2][(crc >> 8) & 0xFF] ^
+              g_crc_table[1][(crc >> 16) & 0xFF] ^ g_crc_table[0][crc >> 24];
+    }
+    for (; i < size; i++) crc = g_crc_table[0][(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+// Serialization
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+    bool failed;
+} CheckpointBuffer;
+
+static void Buffer_Put(CheckpointBuffer* b, const void* src, size_t n) {
+    if (b->failed || n == 0) return;
+    if (b->size + n > b->capacity) {
+        size_t capacity = b->capacity ? b->capacity : 64 * 1024;
+        while (capacity < b->size + n) capacity *= 2;
+        uint8_t* grown = (uint8_t*)realloc(b->data, capacity);
+        if (!grown) {
+            b->failed = true;
+            return;
+        }
+        b->data = grown;
+        b->capacity = capacity;
+    }
+    memcpy(b->data + b->size, src, n);
+    b->size += n;
+}
+
+// Header CRCs are left zero; Checkpoint_Seal fills them
+static NTSTATUS Checkpoint_Serialize(const EvolutionEngine* engine, CheckpointBuffer* b) {
+    const EvolutionaryPopulation* pop = &engine->population;
+    size_t genome_size = (pop->size > 0 && pop->individuals) ? pop->individuals[0].genome_size : 0;
+    for (uint32_t i = 0; i < pop->size; i++) {
+        if (pop->individuals[i].genome_size != genome_size || !pop->individuals[i].genome) {
+            return STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    const NoveltyArchive* novelty = &engine->novelty_archive;
+    const EvolutionSurrogate* surrogate = engine->surrogate;
+    CheckpointHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = EVOLUTION_CHECKPOINT_MAGIC;
+    header.version = EVOLUTION_CHECKPOINT_VERSION;
+    header.header_size = sizeof(CheckpointHeader);
+    header.flags = (novelty->descriptors ? CHECKPOINT_HAS_NOVELTY : 0) |
+                   (surrogate && engine->surrogate_predictions ? CHECKPOINT_HAS_SURROGATE : 0);
+    header.population_size = pop->size;
+    header.max_size = pop->max_size;
+    header.genome_size = genome_size;
+    header.generation = pop->generation;
+    header.stats_size = sizeof(EvolutionStatistics);
+
+    b->size = 0;
+    b->failed = false;
+    Buffer_Put(b, &header, sizeof(header));
+    Buffer_Put(b, &engine->rng, sizeof(EvolutionRng));
+
+    EvolutionStatistics stats = engine->stats;
+    stats.best_genome_description = NULL;
+    Buffer_Put(b, &stats, sizeof(stats));
+    Buffer_Put(b, &engine->diversity, sizeof(EvolutionDiversityStats));
+
+    CheckpointPopulation scalars;
+    scalars.best_fitness = pop->best_fitness;
+    scalars.average_fitness = pop->average_fitness;
+    scalars.fitness_variance = pop->fitness_variance;
+    scalars.best_index = pop->best_individual ? (int64_t)(pop->best_individual - pop->individuals) : -1;
+    scalars.individual_id_counter = EvolutionEngine_LastIndividualId();
+    Buffer_Put(b, &scalars, sizeof(scalars));
+
+    for (uint32_t i = 0; i < pop->size; i++) {
+        const EvolutionaryIndividual* ind = &pop->individuals[i];
+        CheckpointIndividual rec;
+        rec.id = ind->id;
+        rec.parent1_id = ind->parent1_id;
+        rec.parent2_id = ind->parent2_id;
+        rec.fitness = ind->fitness;
+        rec.adjusted_fitness = ind->adjusted_fitness;
+        rec.age = ind->age;
+        rec.evaluated = ind->evaluated ? 1u : 0u;
+        Buffer_Put(b, &rec, sizeof(rec));
+    }
+    for (uint32_t i = 0; i < pop->size; i++) {
+        Buffer_Put(b, pop->individuals[i].genome, genome_size);
+    }
+
+    if (header.flags & CHECKPOINT_HAS_NOVELTY) {
+        CheckpointNovelty n;
+        n.size = novelty->size;
+        n.max_size = novelty->max_size;
+        n.k_neighbors = novelty->k_neighbors;
+        n.descriptor_dim = novelty->descriptor_dim;
+        n.next_slot = novelty->next_slot;
+        n.generations_without_insert = novelty->generations_without_insert;
+        n.insertion_threshold = novelty->insertion_threshold;
+        n.total_insertions = novelty->total_insertions;
+        Buffer_Put(b, &n, sizeof(n));
+        Buffer_Put(b, novelty->descriptors, (size_t)novelty->size * novelty->descriptor_dim * sizeof(float));
+        Buffer_Put(b, novelty->novelty_scores, (size_t)novelty->size * sizeof(double));
+    }
+
+    if (header.flags & CHECKPOINT_HAS_SURROGATE) {
+        CheckpointSurrogate sg;
+        sg.features = surrogate->config.features;
+        sg.genes = surrogate->genes;
+        sg.seed = surrogate->config.seed;
+        sg.lengthscale = surrogate->lengthscale;
+        sg.true_fraction = surrogate->true_fraction;
+        sg.rank_correlation = surrogate->rank_correlation;
+        sg.mean_abs_error = surrogate->mean_abs_error;
+        sg.samples = surrogate->samples;
+        sg.predictions = surrogate->predictions;
+        sg.screened_out = surrogate->screened_out;
+        sg.dirty = surrogate->dirty ? 1u : 0u;
+        sg.trained = surrogate->trained ? 1u : 0u;
+        size_t dim = surrogate->dim;
+        Buffer_Put(b, &sg, sizeof(sg));
+        Buffer_Put(b, surrogate->gram, dim * dim * sizeof(double));
+        Buffer_Put(b, surrogate->moment, dim * sizeof(double));
+        Buffer_Put(b, surrogate->weights, dim * sizeof(double));
+        Buffer_Put(b, engine->surrogate_predictions, (size_t)pop->max_size * sizeof(double));
+    }
+
+    if (b->failed) return STATUS_INSUFFICIENT_RESOURCES;
+    ((CheckpointHeader*)b->data)->payload_size = b->size - sizeof(CheckpointHeader);
+    return STATUS_SUCCESS;
+}
+
+static void Checkpoint_Seal(uint8_t* data, size_t size) {
+    CheckpointHeader* header = (CheckpointHeader*)data;
+    header->payload_crc = Crc32(data + sizeof(CheckpointHeader), size - sizeof(CheckpointHeader));
+    header->header_crc = Crc32(data, offsetof(CheckpointHeader, header_crc));
+}
+
+static NTSTATUS Checkpoint_WriteFile(const char* path, const char* temp_path, const uint8_t* data, size_t size) {
+    FILE* f = fopen(temp_path, "wb");
+    if (!f) return STATUS_UNSUCCESSFUL;
+    size_t nw = fwrite(data, 1, size, f);
+    bool ok = (nw == size) && fflush(f) == 0;
+    fclose(f);
+    if (!ok) {
+        DeleteFileA(temp_path);
+        return STATUS_UNSUCCESSFUL;
+    }
+    if (!MoveFileExA(temp_path, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        DeleteFileA(temp_path);
+        return STATUS_UNSUCCESSFUL;
+    }
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionCheckpoint_Save(const EvolutionEngine* engine, const char* path) {
+    if (!engine || !engine->initialized || !path) return STATUS_INVALID_PARAMETER;
+
+    char temp_path[MAX_PATH];
+    if (snprintf(temp_path, sizeof(temp_path), "%s.tmp", path) >= (int)sizeof(temp_path)) {
+        return STATUS_INVALID_PARAMETER;
+    }
+    CheckpointBuffer b;
+    memset(&b, 0, sizeof(b));
+    NTSTATUS status = Checkpoint_Serialize(engine, &b);
+    if (NT_SUCCESS(status)) {
+        Checkpoint_Seal(b.data, b.size);
+        status = Checkpoint_WriteFile(path, temp_path, b.data, b.size);
+    }
+    free(b.data);
+    return status;
+}
+
+// Loading
+typedef struct {
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+} CheckpointReader;
+
+static const void* Reader_Take(CheckpointReader* r, size_t n) {
+    if (n > r->size - r->offset) return NULL;
+    const void* p = r->data + r->offset;
+    r->offset += n;
+    return p;
+}
+
+static NTSTATUS Checkpoint_ReadFile(const char* path, uint8_t** data, size_t* size) {
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) return STATUS_NOT_FOUND;
+
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(file, &length) || length.QuadPart < (LONGLONG)sizeof(CheckpointHeader)) {
+        CloseHandle(file);
+        return STATUS_DATA_ERROR;
+    }
+    size_t total = (size_t)length.QuadPart;
+    uint8_t* buffer = (uint8_t*)malloc(total);
+    if (!buffer) {
+        CloseHandle(file);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    size_t done = 0;
+    while (done < total) {
+        DWORD chunk = (DWORD)((total - done) < CHECKPOINT_READ_CHUNK ? (total - done) : CHECKPOINT_READ_CHUNK);
+        DWORD got = 0;
+        if (!ReadFile(file, buffer + done, chunk, &got, NULL) || got == 0) break;
+        done += got;
+    }
+    CloseHandle(file);
+    if (done != total) {
+        free(buffer);
+        return STATUS_DATA_ERROR;
+    }
+    *data = buffer;
+    *size = total;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionCheckpoint_Load(EvolutionEngine* engine, const char* path) {
+    if (!engine || !engine->initialized || !path) return STATUS_INVALID_PARAMETER;
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    NTSTATUS status = Checkpoint_ReadFile(path, &data, &size);
+    if (!NT_SUCCESS(status)) return status;
+
+    CheckpointHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != EVOLUTION_CHECKPOINT_MAGIC || header.version != EVOLUTION_CHECKPOINT_VERSION ||
+        header.header_size != sizeof(CheckpointHeader) ||
+        header.header_crc != Crc32(data, offsetof(CheckpointHeader, header_crc)) ||
+        header.payload_size != size - sizeof(CheckpointHeader) ||
+        header.payload_crc != Crc32(data + sizeof(CheckpointHeader), (size_t)header.payload_size)) {
+        free(data);
+        return STATUS_DATA_ERROR;
+    }
+    if (header.stats_size != sizeof(EvolutionStatistics) || header.max_size != engine->population.max_size ||
+        header.population_size > header.max_size) {
+        free(data);
+        return STATUS_INVALID_DEVICE_STATE;
+    }
+
+    // Parse every section before touching the engine
+    CheckpointReader r = { data, size, sizeof(CheckpointHeader) };
+    const EvolutionRng* rng = (const EvolutionRng*)Reader_Take(&r, sizeof(EvolutionRng));
+    const EvolutionStatistics* stats = (const EvolutionStatistics*)Reader_Take(&r, sizeof(EvolutionStatistics));
+    const EvolutionDiversityStats* diversity =
+        (const EvolutionDiversityStats*)Reader_Take(&r, sizeof(EvolutionDiversityStats));
+    const CheckpointPopulation* scalars = (const CheckpointPopulation*)Reader_Take(&r, sizeof(CheckpointPopulation));
+    const CheckpointIndividual* records =
+        (const CheckpointIndividual*)Reader_Take(&r, (size_t)header.population_size * sizeof(CheckpointIndividual));
+    const uint8_t* genomes = (const uint8_t*)Reader_Take(&r, (size_t)header.population_size * header.genome_size);
+    bool valid = rng && stats && diversity && scalars && records && genomes;
+
+    const CheckpointNovelty* novelty = NULL;
+    const float* novelty_descriptors = NULL;
+    const double* novelty_scores = NULL;
+    if (valid && (header.flags & CHECKPOINT_HAS_NOVELTY)) {
+        novelty = (const CheckpointNovelty*)Reader_Take(&r, sizeof(CheckpointNovelty));
+        if (novelty) {
+            novelty_descriptors = (const float*)Reader_Take(&r,
+                (size_t)novelty->size * novelty->descriptor_dim * sizeof(float));
+            novelty_scores = (const double*)Reader_Take(&r, (size_t)novelty->size * sizeof(double));
+        }
+        valid = novelty && novelty_descriptors && novelty_scores;
+        if (valid && (!engine->novelty_archive.descriptors ||
+                      engine->novelty_archive.descriptor_dim != novelty->descriptor_dim ||
+                      engine->novelty_archive.max_size < novelty->size)) {
+            status = STATUS_INVALID_DEVICE_STATE;
+        }
+    }
+
+    const CheckpointSurrogate* sg = NULL;
+    const double* gram = NULL;
+    const double* moment = NULL;
+    const double* weights = NULL;
+    const double* predictions = NULL;
+    if (valid && (header.flags & CHECKPOINT_HAS_SURROGATE)) {
+        sg = (const CheckpointSurrogate*)Reader_Take(&r, sizeof(CheckpointSurrogate));
+        EvolutionSurrogate* surrogate = engine->surrogate;
+        if (sg && surrogate && surrogate->config.features == sg->features && surrogate->genes == sg->genes &&
+            surrogate->config.seed == sg->seed) {
+            size_t dim = surrogate->dim;
+            gram = (const double*)Reader_Take(&r, dim * dim * sizeof(double));
+            moment = (const double*)Reader_Take(&r, dim * sizeof(double));
+            weights = (const double*)Reader_Take(&r, dim * sizeof(double));
+            predictions = (const double*)Reader_Take(&r, (size_t)header.max_size * sizeof(double));
+            valid = gram && moment && weights && predictions;
+        } else if (sg) {
+            status = STATUS_INVALID_DEVICE_STATE;
+        } else {
+            valid = false;
+        }
+    }
+
+    if (!valid || r.offset != r.size) status = STATUS_DATA_ERROR;
+    if (!NT_SUCCESS(status)) {
+        free(data);
+        return status;
+    }
+
+    // Build the replacement population, then commit
+    EvolutionaryIndividual* individuals = (EvolutionaryIndividual*)calloc(header.max_size, sizeof(EvolutionaryIndividual));
+    if (!individuals) {
+        free(data);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    for (uint32_t i = 0; i < header.population_size; i++) {
+        EvolutionaryIndividual* ind = &individuals[i];
+        ind->genome = malloc((size_t)header.genome_size);
+        if (!ind->genome) {
+            for (uint32_t j = 0; j < i; j++) free(individuals[j].genome);
+            free(individuals);
+            free(data);
+            return STATUS_INSUFFICIENT_RESOURCES;
+        }
+        memcpy(ind->genome, genomes + (size_t)i * header.genome_size, (size_t)header.genome_size);
+        ind->genome_size = (size_t)header.genome_size;
+        ind->id = records[i].id;
+        ind->parent1_id = (uint32_t)records[i].parent1_id;
+        ind->parent2_id = (uint32_t)records[i].parent2_id;
+        ind->fitness = records[i].fitness;
+        ind->adjusted_fitness = records[i].adjusted_fitness;
+        ind->age = records[i].age;
+        ind->evaluated = records[i].evaluated != 0;
+    }
+
+    EvolutionEngine_FreePopulation(engine);
+    EvolutionaryPopulation* pop = &engine->population;
+    pop->individuals = individuals;
+    pop->size = header.population_size;
+    pop->generation = header.generation;
+    pop->best_fitness = scalars->best_fitness;
+    pop->average_fitness = scalars->average_fitness;
+    pop->fitness_variance = scalars->fitness_variance;
+    pop->best_individual = (scalars->best_index >= 0 && scalars->best_index < (int64_t)header.population_size)
+                         ? &individuals[scalars->best_index] : NULL;
+
+    char* description = engine->stats.best_genome_description;
+    engine->stats = *stats;
+    engine->stats.best_genome_description = description;
+    engine->diversity = *diversity;
+    engine->rng = *rng;
+    EvolutionEngine_ReserveIndividualIds(scalars->individual_id_counter);
+
+    if (novelty) {
+        NoveltyArchive* archive = &engine->novelty_archive;
+        memcpy(archive->descriptors, novelty_descriptors, (size_t)novelty->size * novelty->descriptor_dim * sizeof(float));
+        memcpy(archive->novelty_scores, novelty_scores, (size_t)novelty->size * sizeof(double));
+        archive->size = novelty->size;
+        archive->k_neighbors = novelty->k_neighbors;
+        archive->next_slot = novelty->next_slot < archive->max_size ? novelty->next_slot : 0;
+        archive->insertion_threshold = novelty->insertion_threshold;
+        archive->generations_without_insert = novelty->generations_without_insert;
+        archive->total_insertions = novelty->total_insertions;
+    }
+
+    if (sg) {
+        EvolutionSurrogate* surrogate = engine->surrogate;
+        size_t dim = surrogate->dim;
+        memcpy(surrogate->gram, gram, dim * dim * sizeof(double));
+        memcpy(surrogate->moment, moment, dim * sizeof(double));
+        memcpy(surrogate->weights, weights, dim * sizeof(double));
+        memcpy(engine->surrogate_predictions, predictions, (size_t)header.max_size * sizeof(double));
+        surrogate->lengthscale = sg->lengthscale;
+        surrogate->true_fraction = sg->true_fraction;
+        surrogate->rank_correlation = sg->rank_correlation;
+        surrogate->mean_abs_error = sg->mean_abs_error;
+        surrogate->samples = sg->samples;
+        surrogate->predictions = sg->predictions;
+        surrogate->screened_out = sg->screened_out;
+        surrogate->dirty = sg->dirty != 0;
+        surrogate->trained = sg->trained != 0;
+    }
+
+    free(data);
+    return STATUS_SUCCESS;
+}
+
+// Background writer
+static DWORD WINAPI CheckpointWriterThreadProc(LPVOID param) {
+    EvolutionCheckpointWriter* writer = (EvolutionCheckpointWriter*)param;
+    uint64_t t0 = QpcClock_NowUs();
+    Checkpoint_Seal(writer->buffer, writer->size);
+    NTSTATUS status = Checkpoint_WriteFile(writer->path, writer->temp_path, writer->buffer, writer->size);
+    writer->last_write_us = QpcClock_NowUs() - t0;
+    InterlockedExchange(&writer->last_status, (LONG)status);
+    return 0;
+}
+
+NTSTATUS EvolutionCheckpointWriter_Initialize(EvolutionCheckpointWriter* writer, const char* path,
+    uint32_t interval) {
+    if (!writer || !path || !path[0]) return STATUS_INVALID_PARAMETER;
+    if (writer->initialized) return STATUS_SUCCESS;
+
+    memset(writer, 0, sizeof(*writer));
+    if (snprintf(writer->path, sizeof(writer->path), "%s", path) >= (int)sizeof(writer->path) ||
+        snprintf(writer->temp_path, sizeof(writer->temp_path), "%s.tmp", path) >= (int)sizeof(writer->temp_path)) {
+        return STATUS_INVALID_PARAMETER;
+    }
+    writer->interval = interval ? interval : EVOLUTION_CHECKPOINT_DEFAULT_INTERVAL;
+    writer->last_generation = UINT32_MAX;
+    writer->last_status = STATUS_SUCCESS;
+    Crc32_Init();
+    writer->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionCheckpointWriter_Flush(EvolutionCheckpointWriter* writer) {
+    if (!writer || !writer->initialized) return STATUS_INVALID_PARAMETER;
+    if (writer->thread) {
+        WaitForSingleObject(writer->thread, INFINITE);
+        CloseHandle(writer->thread);
+        writer->thread = NULL;
+    }
+    return (NTSTATUS)writer->last_status;
+}
+
+void EvolutionCheckpointWriter_Shutdown(EvolutionCheckpointWriter* writer) {
+    if (!writer || !writer->initialized) return;
+    EvolutionCheckpointWriter_Flush(writer);
+    free(writer->buffer);
+    memset(writer, 0, sizeof(*writer));
+}
+
+NTSTATUS EvolutionCheckpointWriter_OnGeneration(EvolutionCheckpointWriter* writer, const EvolutionEngine* engine) {
+    if (!writer || !writer->initialized || !engine) return STATUS_INVALID_PARAMETER;
+
+    uint32_t generation = engine->population.generation;
+    if (generation == writer->last_generation || generation % writer->interval != 0) return STATUS_SUCCESS;
+
+    if (writer->thread) {
+        if (WaitForSingleObject(writer->thread, 0) != WAIT_OBJECT_0) {
+            writer->skipped++;
+            return STATUS_PENDING;
+        }
+        CloseHandle(writer->thread);
+        writer->thread = NULL;
+    }
+
+    uint64_t t0 = QpcClock_NowUs();
+    CheckpointBuffer b = { writer->buffer, 0, writer->capacity, false };
+    NTSTATUS status = Checkpoint_Serialize(engine, &b);
+    writer->buffer = b.data;
+    writer->capacity = b.capacity;
+    writer->size = b.size;
+    writer->last_serialize_us = QpcClock_NowUs() - t0;
+    if (!NT_SUCCESS(status)) return status;
+
+    writer->last_generation = generation;
+    // A thread of its own, not a pool job: the write blocks on the disk, which would take a
+    // compute worker out for as long, and the handle gives OnGeneration its zero-wait busy check
+    writer->thread = CreateThread(NULL, 0, CheckpointWriterThreadProc, writer, 0, NULL);
+    if (!writer->thread) {
+        // No worker available: write on the caller rather than lose the snapshot
+        CheckpointWriterThreadProc(writer);
+    }
+    writer->writes++;
+    return STATUS_SUCCESS;
+}
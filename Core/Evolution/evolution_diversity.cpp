@@ -0,0 +1,250 @@
+/*
+ * Evolution Diversity - Raijin
+ * Owner: Core/Evolution
+ * Inputs: Population genomes (double arrays)
+ * Outputs: EvolutionDiversityStats
+ * Invariants: Every individual contributes; cost is O(n*d) plus O(n log n) per projection;
+ *             projection directions come from a fixed seed so generations are comparable
+ * Budget: Two passes over the genomes; scratch is O(d + n*projections)
+ * Failure modes: Scratch allocation failure; missing genomes
+ * Recovery: Caller keeps its previous measurement
+ */
+
+#include "../../Include/evolution_diversity.h"
+#include <windows.h>
+#include <emmintrin.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define DIVERSITY_CHUNK 256
+#define DIVERSITY_PROJECTION_SEED 0x9E3779B97F4A7C15ull
+
+static int CompareDouble(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static int CompareUint64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static inline double HorizontalSum(__m128d v) {
+    return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+}
+
+// Sum over all pairs of |a_i - a_j| from sorted values: sum_k a_(k) * (2k - n + 1)
+static double SortedPairwiseAbsSum(double* values, uint32_t n) {
+    qsort(values, n, sizeof(double), CompareDouble);
+    double total = 0.0;
+    for (uint32_t k = 0; k < n; k++) {
+        total += values[k] * (2.0 * k - (double)n + 1.0);
+    }
+    return total;
+}
+
+static inline uint64_t Mix64(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// One-permutation MinHash over (gene index, exact value) tokens; equal-signature pairs
+// are counted per bucket by sorting, so no pairwise pass is needed
+static double MinHashSimilarity(const EvolutionaryIndividual* individuals, uint32_t n, size_t genes,
+                                uint64_t* signatures, uint64_t* column) {
+    const uint32_t buckets = EVOLUTION_DIVERSITY_MINHASH_BUCKETS;
+
+    for (uint32_t i = 0; i < n; i++) {
+        uint64_t* sig = signatures + (size_t)i * buckets;
+        const uint64_t* bits = (const uint64_t*)individuals[i].genome;
+        for (uint32_t b = 0; b < buckets; b++) sig[b] = UINT64_MAX;
+        for (size_t k = 0; k < genes; k++) {
+            uint64_t h = Mix64(bits[k] ^ Mix64(k + 1));
+            uint32_t b = (uint32_t)(h >> 58);
+            uint64_t v = h & 0x03FFFFFFFFFFFFFFull;
+            if (v < sig[b]) sig[b] = v;
+        }
+    }
+
+    // Empty buckets sort last. A bucket empty in both genomes says nothing about the pair and
+    // is left out; empty in only one, it is a mismatch (one-permutation estimator, J = N_mat / (k - N_emp))
+    double equal_pairs = 0.0;
+    double compared_pairs = 0.0;
+    for (uint32_t b = 0; b < buckets; b++) {
+        for (uint32_t i = 0; i < n; i++) column[i] = signatures[(size_t)i * buckets + b];
+        qsort(column, n, sizeof(uint64_t), CompareUint64);
+        uint32_t filled = n;
+        while (filled > 0 && column[filled - 1] == UINT64_MAX) filled--;
+        uint32_t empty = n - filled;
+        compared_pairs += 0.5 * n * (n - 1.0) - 0.5 * empty * (empty - 1.0);
+        uint32_t run = 1;
+        for (uint32_t i = 1; i <= filled; i++) {
+            if (i < filled && column[i] == column[i - 1]) {
+                run++;
+            } else {
+                equal_pairs += 0.5 * run * (run - 1.0);
+                run = 1;
+            }
+        }
+    }
+    return compared_pairs > 0.0 ? equal_pairs / compared_pairs : 0.0;
+}
+
+NTSTATUS EvolutionDiversity_Compute(const EvolutionaryIndividual* individuals, uint32_t count,
+    uint32_t flags, EvolutionDiversityStats* out) {
+    if (!individuals || !out) return STATUS_INVALID_PARAMETER;
+    memset(out, 0, sizeof(*out));
+    out->minhash_similarity = -1.0;
+    out->individuals = count;
+    if (count < 2) return STATUS_SUCCESS;
+
+    size_t genes = (size_t)-1;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!individuals[i].genome) return STATUS_INVALID_PARAMETER;
+        size_t g = individuals[i].genome_size / sizeof(double);
+        if (g < genes) genes = g;
+    }
+    out->genes = (uint32_t)genes;
+    if (genes == 0) return STATUS_SUCCESS;
+
+    const uint32_t n = count;
+    const uint32_t m = EVOLUTION_DIVERSITY_PROJECTIONS;
+    double* sum = (double*)calloc(genes, sizeof(double));
+    double* sq = (double*)calloc(genes, sizeof(double));
+    double* dist2 = (double*)calloc(n, sizeof(double));
+    double* proj = (double*)calloc((size_t)n * m, sizeof(double));
+    float* directions = (float*)malloc((size_t)m * DIVERSITY_CHUNK * sizeof(float));
+    double* diff = (double*)malloc(DIVERSITY_CHUNK * sizeof(double));
+    float* diff_f = (float*)malloc(DIVERSITY_CHUNK * sizeof(float));
+    if (!sum || !sq || !dist2 || !proj || !directions || !diff || !diff_f) {
+        free(sum); free(sq); free(dist2); free(proj); free(directions); free(diff); free(diff_f);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    // Pass 1: per-gene sums, shifted by the first genome to keep the variance well conditioned
+    const double* shift = (const double*)individuals[0].genome;
+    for (uint32_t i = 1; i < n; i++) {
+        const double* x = (const double*)individuals[i].genome;
+        size_t k = 0;
+        for (; k + 2 <= genes; k += 2) {
+            __m128d v = _mm_sub_pd(_mm_loadu_pd(x + k), _mm_loadu_pd(shift + k));
+            _mm_storeu_pd(sum + k, _mm_add_pd(_mm_loadu_pd(sum + k), v));
+            _mm_storeu_pd(sq + k, _mm_add_pd(_mm_loadu_pd(sq + k), _mm_mul_pd(v, v)));
+        }
+        for (; k < genes; k++) {
+            double v = x[k] - shift[k];
+            sum[k] += v;
+            sq[k] += v * v;
+        }
+    }
+
+    double variance_total = 0.0;
+    for (size_t k = 0; k < genes; k++) {
+        double mean_shifted = sum[k] / n;
+        double var = sq[k] / n - mean_shifted * mean_shifted;
+        variance_total += (var > 0.0) ? var : 0.0;
+        sum[k] = shift[k] + mean_shifted;   // sum now holds the centroid
+    }
+    const double* centroid = sum;
+    out->mean_gene_variance = variance_total / (double)genes;
+    out->mean_pairwise_sq_distance = 2.0 * variance_total * n / (n - 1.0);
+
+    // Pass 2, gene chunk by gene chunk: centroid distances and Gaussian projections
+    EvolutionRng rng;
+    EvolutionRng_Seed(&rng, DIVERSITY_PROJECTION_SEED);
+    for (size_t base = 0; base < genes; base += DIVERSITY_CHUNK) {
+        size_t len = (genes - base < DIVERSITY_CHUNK) ? genes - base : DIVERSITY_CHUNK;
+        EvolutionRng_FillGaussian(&rng, directions, (size_t)m * DIVERSITY_CHUNK);
+
+        for (uint32_t i = 0; i < n; i++) {
+            const double* x = (const double*)individuals[i].genome + base;
+            const double* c = centroid + base;
+            __m128d acc = _mm_setzero_pd();
+            size_t k = 0;
+            for (; k + 2 <= len; k += 2) {
+                __m128d v = _mm_sub_pd(_mm_loadu_pd(x + k), _mm_loadu_pd(c + k));
+                _mm_storeu_pd(diff + k, v);
+                acc = _mm_add_pd(acc, _mm_mul_pd(v, v));
+            }
+            double d2 = HorizontalSum(acc);
+            for (; k < len; k++) {
+                diff[k] = x[k] - c[k];
+                d2 += diff[k] * diff[k];
+            }
+            dist2[i] += d2;
+
+            // Projections in float, four directions per pass over the chunk
+            size_t len4 = len & ~(size_t)3;
+            for (k = 0; k < len4; k += 4) {
+                _mm_storeu_ps(diff_f + k, _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(diff + k)),
+                                                        _mm_cvtpd_ps(_mm_loadu_pd(diff + k + 2))));
+            }
+            for (; k < len; k++) diff_f[k] = (float)diff[k];
+
+            double* p_out = proj + (size_t)i * m;
+            for (uint32_t p = 0; p < m; p += 4) {
+                const float* g0 = directions + (size_t)p * DIVERSITY_CHUNK;
+                const float* g1 = g0 + DIVERSITY_CHUNK;
+                const float* g2 = g1 + DIVERSITY_CHUNK;
+                const float* g3 = g2 + DIVERSITY_CHUNK;
+                __m128 a0 = _mm_setzero_ps(), a1 = _mm_setzero_ps();
+                __m128 a2 = _mm_setzero_ps(), a3 = _mm_setzero_ps();
+                for (k = 0; k < len4; k += 4) {
+                    __m128 dv = _mm_loadu_ps(diff_f + k);
+                    a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_loadu_ps(g0 + k), dv));
+                    a1 = _mm_add_ps(a1, _mm_mul_ps(_mm_loadu_ps(g1 + k), dv));
+                    a2 = _mm_add_ps(a2, _mm_mul_ps(_mm_loadu_ps(g2 + k), dv));
+                    a3 = _mm_add_ps(a3, _mm_mul_ps(_mm_loadu_ps(g3 + k), dv));
+                }
+                // Transpose-reduce the four accumulators into one vector of dot products
+                __m128 t0 = _mm_add_ps(_mm_unpacklo_ps(a0, a1), _mm_unpackhi_ps(a0, a1));
+                __m128 t1 = _mm_add_ps(_mm_unpacklo_ps(a2, a3), _mm_unpackhi_ps(a2, a3));
+                float dots[4];
+                _mm_storeu_ps(dots, _mm_add_ps(_mm_movelh_ps(t0, t1), _mm_movehl_ps(t1, t0)));
+                for (k = len4; k < len; k++) {
+                    dots[0] += g0[k] * diff_f[k];
+                    dots[1] += g1[k] * diff_f[k];
+                    dots[2] += g2[k] * diff_f[k];
+                    dots[3] += g3[k] * diff_f[k];
+                }
+                p_out[p] += dots[0];
+                p_out[p + 1] += dots[1];
+                p_out[p + 2] += dots[2];
+                p_out[p + 3] += dots[3];
+            }
+        }
+    }
+
+    double centroid_total = 0.0;
+    for (uint32_t i = 0; i < n; i++) centroid_total += sqrt(dist2[i]);
+    out->mean_centroid_distance = centroid_total / n;
+
+    // E|g.v| = |v| * sqrt(2/pi) for g ~ N(0, I); dist2 is reused as a column buffer
+    double pairs = 0.5 * n * (n - 1.0);
+    double estimate = 0.0;
+    for (uint32_t p = 0; p < m; p++) {
+        for (uint32_t i = 0; i < n; i++) dist2[i] = proj[(size_t)i * m + p];
+        estimate += SortedPairwiseAbsSum(dist2, n) / pairs;
+    }
+    out->mean_pairwise_distance = (estimate / m) * sqrt(3.14159265358979323846 / 2.0);
+
+    NTSTATUS status = STATUS_SUCCESS;
+    if (flags & EVOLUTION_DIVERSITY_MINHASH) {
+        uint64_t* signatures = (uint64_t*)malloc((size_t)n * EVOLUTION_DIVERSITY_MINHASH_BUCKETS * sizeof(uint64_t));
+        uint64_t* column = (uint64_t*)malloc((size_t)n * sizeof(uint64_t));
+        if (signatures && column) {
+            out->minhash_similarity = MinHashSimilarity(individuals, n, genes, signatures, column);
+        } else {
+            status = STATUS_INSUFFICIENT_RESOURCES;
+        }
+        free(signatures);
+        free(column);
+    }
+
+    free(sum); free(sq); free(dist2); free(proj); free(directions); free(diff); free(diff_f);
+    return status;
+}
@@ -3,27 +3,36 @@
 
 #include "evolution_engine.h"
 #include "../../Include/role_boundary.h"
+#include "../../Include/evolution_diversity.h"
+#include "../../Include/evolution_map_elites.h"
+#include "../../Include/evolution_surrogate.h"
+#include "../../Include/evolution_checkpoint.h"
+#include "../../Include/thread_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <time.h>
 #include <float.h>
 #include <stdio.h>
+#include <emmintrin.h>
+
+// Reference rows scanned per cache tile in the novelty kNN kernel
+#define NOVELTY_TILE_ROWS 256
+#define NOVELTY_DEFAULT_ARCHIVE_SIZE 1000
+#define STEADY_STATE_MAX_WORKERS 64
+#define FITNESS_ACCURACY_IO 100          // Substrate input/output bytes per accuracy evaluation
 
 // Internal utility functions
+static volatile LONG64 g_individual_id_counter = 0;
+
 static uint64_t GenerateIndividualId() {
-    static uint64_t counter = 0;
-    return ++counter;
+    return (uint64_t)InterlockedIncrement64(&g_individual_id_counter);
 }
 
 static double RandomDouble(double min_val, double max_val) {
     return min_val + (max_val - min_val) * ((double)rand() / RAND_MAX);
 }
 
-static int RandomInt(int min_val, int max_val) {
-    return min_val + rand() % (max_val - min_val + 1);
-}
-
 static void SwapIndividuals(EvolutionaryIndividual* a, EvolutionaryIndividual* b) {
     EvolutionaryIndividual temp = *a;
     *a = *b;
@@ -31,71 +40,452 @@ static void SwapIndividuals(EvolutionaryIndividual* a, EvolutionaryIndividual* b
 }
 
 // Genome operations
+// context is the engine when installed by EvolutionEngine_Initialize, so the draw is reproducible
 static void InitializeGenome_GA(void* genome, size_t genome_size, void* context) {
-    UNREFERENCED_PARAMETER(context);
+    EvolutionEngine* engine = (EvolutionEngine*)context;
     double* weights = (double*)genome;
     size_t num_weights = genome_size / sizeof(double);
 
     for (size_t i = 0; i < num_weights; i++) {
-        weights[i] = RandomDouble(-1.0, 1.0);
+        weights[i] = engine ? EvolutionRng_NextDouble(&engine->rng) * 2.0 - 1.0 : RandomDouble(-1.0, 1.0);
     }
 }
 
-static void Crossover_SinglePoint(EvolutionaryIndividual* parent1,
-                                EvolutionaryIndividual* parent2,
-                                EvolutionaryIndividual* offspring) {
-    size_t crossover_point = rand() % offspring->genome_size;
-    memcpy(offspring->genome, parent1->genome, crossover_point);
-    memcpy((char*)offspring->genome + crossover_point,
-           (char*)parent2->genome + crossover_point,
-           offspring->genome_size - crossover_point);
+static void Mutate_Gaussian(EvolutionEngine* engine, EvolutionaryIndividual* individual) {
+    // Clamp to reasonable bounds
+    EvolutionOps_MutateGaussian(&engine->rng, (double*)individual->genome,
+                                individual->genome_size / sizeof(double),
+                                engine->params.mutation_rate, engine->params.mutation_sigma, -2.0, 2.0);
 }
 
-static void Mutate_Gaussian(EvolutionaryIndividual* individual, double mutation_rate) {
-    double* genome = (double*)individual->genome;
-    size_t num_genes = individual->genome_size / sizeof(double);
+// Default behavior descriptor: mean of each contiguous block of genome weights
+static void BehaviorDescriptor_BlockMean(const void* genome, size_t genome_size,
+                                         float* descriptor, uint32_t descriptor_dim,
+                                         void* context) {
+    UNREFERENCED_PARAMETER(context);
+    const double* weights = (const double*)genome;
+    size_t num_weights = genome_size / sizeof(double);
 
-    for (size_t i = 0; i < num_genes; i++) {
-        if (RandomDouble(0.0, 1.0) < mutation_rate) {
-            double mutation = RandomDouble(-0.5, 0.5);
-            genome[i] += mutation;
-            // Clamp to reasonable bounds
-            genome[i] = (genome[i] < -2.0) ? -2.0 : ((genome[i] > 2.0) ? 2.0 : genome[i]);
+    for (uint32_t d = 0; d < descriptor_dim; d++) {
+        size_t begin = (num_weights * d) / descriptor_dim;
+        size_t end = (num_weights * (d + 1)) / descriptor_dim;
+        double sum = 0.0;
+        for (size_t i = begin; i < end; i++) {
+            sum += weights[i];
         }
+        descriptor[d] = (end > begin) ? (float)(sum / (double)(end - begin)) : 0.0f;
     }
 }
 
-// Selection methods
-static void Selection_Tournament(EvolutionEngine* engine,
-                               EvolutionaryIndividual** parents,
-                               uint32_t num_parents) {
-    for (uint32_t i = 0; i < num_parents; i++) {
-        EvolutionaryIndividual* best = NULL;
-        double best_fitness = -DBL_MAX;
+// Novelty search: k-nearest-neighbor distances over contiguous descriptor rows
+static inline float Novelty_SquaredDistance(const float* a, const float* b, uint32_t dim) {
+    __m128 acc = _mm_setzero_ps();
+    uint32_t d = 0;
+    for (; d + 4 <= dim; d += 4) {
+        __m128 diff = _mm_sub_ps(_mm_loadu_ps(a + d), _mm_loadu_ps(b + d));
+        acc = _mm_add_ps(acc, _mm_mul_ps(diff, diff));
+    }
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+    float sum = _mm_cvtss_f32(acc);
+    for (; d < dim; d++) {
+        float diff = a[d] - b[d];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+// Bounded max-heap holding the k smallest squared distances seen so far
+static inline void Novelty_HeapPush(float* heap, uint32_t* heap_size, uint32_t k, float value) {
+    uint32_t n = *heap_size;
+    if (n < k) {
+        uint32_t i = n++;
+        while (i > 0) {
+            uint32_t parent = (i - 1) / 2;
+            if (heap[parent] >= value) break;
+            heap[i] = heap[parent];
+            i = parent;
+        }
+        heap[i] = value;
+        *heap_size = n;
+        return;
+    }
+    if (value >= heap[0]) return;
+
+    uint32_t i = 0;
+    for (;;) {
+        uint32_t child = 2 * i + 1;
+        if (child >= n) break;
+        if (child + 1 < n && heap[child + 1] > heap[child]) child++;
+        if (heap[child] <= value) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = value;
+}
+
+// Scans refs in cache-sized tiles so each tile is reused by every query.
+// When exclude_self is set, query i skips ref i (queries and refs are the same rows).
+static void Novelty_KnnScan(const float* queries, uint32_t query_count,
+                            const float* refs, uint32_t ref_count,
+                            uint32_t dim, uint32_t k, bool exclude_self,
+                            float* heaps, uint32_t* heap_sizes) {
+    for (uint32_t tile = 0; tile < ref_count; tile += NOVELTY_TILE_ROWS) {
+        uint32_t tile_end = tile + NOVELTY_TILE_ROWS;
+        if (tile_end > ref_count) tile_end = ref_count;
+
+        for (uint32_t q = 0; q < query_count; q++) {
+            const float* query = queries + (size_t)q * dim;
+            float* heap = heaps + (size_t)q * k;
+            uint32_t* heap_size = &heap_sizes[q];
+
+            for (uint32_t r = tile; r < tile_end; r++) {
+                if (exclude_self && r == q) continue;
+                float dist = Novelty_SquaredDistance(query, refs + (size_t)r * dim, dim);
+                if (*heap_size < k || dist < heap[0]) {
+                    Novelty_HeapPush(heap, heap_size, k, dist);
+                }
+            }
+        }
+    }
+}
+
+static void NoveltyArchive_Insert(NoveltyArchive* archive, const float* descriptor, double novelty) {
+    uint32_t slot;
+    if (archive->size < archive->max_size) {
+        slot = archive->size++;
+    } else {
+        // Full archive behaves as a ring: the oldest entry is replaced
+        slot = archive->next_slot;
+        archive->next_slot = (archive->next_slot + 1) % archive->max_size;
+    }
+    memcpy(archive->descriptors + (size_t)slot * archive->descriptor_dim,
+           descriptor, archive->descriptor_dim * sizeof(float));
+    archive->novelty_scores[slot] = novelty;
+    archive->total_insertions++;
+}
+
+static NTSTATUS EnsurePopulationDescriptors(EvolutionEngine* engine, uint32_t count) {
+    if (engine->population_descriptor_capacity >= count) return STATUS_SUCCESS;
+
+    float* descriptors = (float*)malloc((size_t)count * engine->novelty_archive.descriptor_dim * sizeof(float));
+    double* novelty = (double*)malloc(count * sizeof(double));
+    if (!descriptors || !novelty) {
+        free(descriptors);
+        free(novelty);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    free(engine->population_descriptors);
+    free(engine->population_novelty);
+    engine->population_descriptors = descriptors;
+    engine->population_novelty = novelty;
+    engine->population_descriptor_capacity = count;
+    return STATUS_SUCCESS;
+}
+
+// Blends normalized novelty into adjusted_fitness and grows the archive
+static void ApplyNoveltySearch(EvolutionEngine* engine) {
+    NoveltyArchive* archive = &engine->novelty_archive;
+    uint32_t count = engine->population.size;
+    uint32_t dim = archive->descriptor_dim;
+
+    if (!NT_SUCCESS(EnsurePopulationDescriptors(engine, count))) return;
+
+    for (uint32_t i = 0; i < count; i++) {
+        EvolutionaryIndividual* individual = &engine->population.individuals[i];
+        engine->behavior_function(individual->genome, individual->genome_size,
+                                  engine->population_descriptors + (size_t)i * dim,
+                                  dim, engine->behavior_context);
+    }
+
+    if (!NT_SUCCESS(EvolutionEngine_CalculateNoveltyBatch(engine, engine->population_descriptors,
+                                                          count, engine->population_novelty))) {
+        return;
+    }
+
+    double min_fit = DBL_MAX, max_fit = -DBL_MAX;
+    double min_nov = DBL_MAX, max_nov = -DBL_MAX;
+    double mean_nov = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        double f = engine->population.individuals[i].fitness;
+        double n = engine->population_novelty[i];
+        if (f < min_fit) min_fit = f;
+        if (f > max_fit) max_fit = f;
+        if (n < min_nov) min_nov = n;
+        if (n > max_nov) max_nov = n;
+        mean_nov += n;
+    }
+    mean_nov /= count;
+
+    double w = engine->params.novelty_weight;
+    w = (w < 0.0) ? 0.0 : ((w > 1.0) ? 1.0 : w);
+    double fit_range = (max_fit > min_fit) ? (max_fit - min_fit) : 1.0;
+    double nov_range = (max_nov > min_nov) ? (max_nov - min_nov) : 1.0;
+    for (uint32_t i = 0; i < count; i++) {
+        EvolutionaryIndividual* individual = &engine->population.individuals[i];
+        double f = (individual->fitness - min_fit) / fit_range;
+        double n = (engine->population_novelty[i] - min_nov) / nov_range;
+        individual->adjusted_fitness = (1.0 - w) * f + w * n;
+    }
+
+    // Threshold-based archival; the threshold adapts toward a steady insertion rate
+    if (archive->insertion_threshold <= 0.0) {
+        archive->insertion_threshold = mean_nov;
+    }
+    uint32_t inserted = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (engine->population_novelty[i] > archive->insertion_threshold) {
+            NoveltyArchive_Insert(archive, engine->population_descriptors + (size_t)i * dim,
+                                  engine->population_novelty[i]);
+            inserted++;
+        }
+    }
+
+    if (inserted > EVOLUTION_NOVELTY_INSERT_TARGET) {
+        archive->insertion_threshold *= 1.2;
+        archive->generations_without_insert = 0;
+    } else if (inserted == 0) {
+        if (++archive->generations_without_insert >= EVOLUTION_NOVELTY_STALL_GENERATIONS) {
+            archive->insertion_threshold *= 0.95;
+        }
+    } else {
+        archive->generations_without_insert = 0;
+    }
+}
+
+static void CloneIndividual(const EvolutionaryIndividual* src, EvolutionaryIndividual* dst) {
+    dst->id = src->id;
+    dst->genome_size = src->genome_size;
+    dst->fitness = src->fitness;
+    dst->adjusted_fitness = src->adjusted_fitness;
+    dst->age = src->age + 1;
+    dst->parent1_id = src->parent1_id;
+    dst->parent2_id = src->parent2_id;
+    dst->evaluated = true;
+    dst->phenotype = NULL;
+    dst->metadata = NULL;
+    dst->genome = malloc(src->genome_size);
+    if (dst->genome && src->genome)
+        memcpy(dst->genome, src->genome, src->genome_size);
+}
+
+// Speciation: sum of |w1 - w2| over n weights, abandoned once it exceeds bound
+#define SPECIES_DISTANCE_CHUNK 256
+
+static double Species_AbsDiffSum(const double* a, const double* b, size_t n, double bound) {
+    const __m128d abs_mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    double sum = 0.0;
+    size_t i = 0;
+
+    while (i < n) {
+        size_t chunk_end = (n - i > SPECIES_DISTANCE_CHUNK) ? i + SPECIES_DISTANCE_CHUNK : n;
+        __m128d acc0 = _mm_setzero_pd();
+        __m128d acc1 = _mm_setzero_pd();
+        for (; i + 4 <= chunk_end; i += 4) {
+            __m128d d0 = _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+            __m128d d1 = _mm_sub_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2));
+            acc0 = _mm_add_pd(acc0, _mm_and_pd(d0, abs_mask));
+            acc1 = _mm_add_pd(acc1, _mm_and_pd(d1, abs_mask));
+        }
+        acc0 = _mm_add_pd(acc0, acc1);
+        sum += _mm_cvtsd_f64(_mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0)));
+        for (; i < chunk_end; i++) {
+            sum += fabs(a[i] - b[i]);
+        }
+        if (sum > bound) return sum;
+    }
+    return sum;
+}
+
+// NEAT compatibility for fixed-topology genomes: excess genes over N plus mean weight difference.
+// Returns early with a value above threshold once the pair is known to be incompatible.
+static double Species_Distance(const void* genome1, size_t size1,
+                               const void* genome2, size_t size2, double threshold) {
+    size_t n1 = size1 / sizeof(double);
+    size_t n2 = size2 / sizeof(double);
+    size_t common = (n1 < n2) ? n1 : n2;
+    size_t longest = (n1 > n2) ? n1 : n2;
+    if (longest == 0) return 0.0;
+
+    double excess = (double)(longest - common);
+    double bound = (threshold < DBL_MAX / (double)longest) ? threshold * (double)longest - excess : DBL_MAX;
+    if (bound < 0.0) return (excess / (double)longest) + 1.0;
+
+    double weight_diff = Species_AbsDiffSum((const double*)genome1, (const double*)genome2, common, bound);
+    return (excess + weight_diff) / (double)longest;
+}
+
+static NTSTATUS Species_AddMember(EvolutionarySpecies* species, EvolutionaryIndividual* individual,
+                                  uint32_t population_size) {
+    if (species->member_count >= species->max_members) {
+        uint32_t new_max = species->max_members ? species->max_members * 2 : 16;
+        if (new_max > population_size) new_max = population_size;
+        if (new_max <= species->member_count) new_max = species->member_count + 1;
+        EvolutionaryIndividual** members = (EvolutionaryIndividual**)realloc(
+            species->members, new_max * sizeof(EvolutionaryIndividual*));
+        if (!members) return STATUS_INSUFFICIENT_RESOURCES;
+        species->members = members;
+        species->max_members = new_max;
+    }
+    species->members[species->member_count++] = individual;
+    return STATUS_SUCCESS;
+}
+
+static NTSTATUS Species_SetRepresentative(EvolutionarySpecies* species, const EvolutionaryIndividual* individual) {
+    if (species->representative_size != individual->genome_size) {
+        void* rep = realloc(species->representative, individual->genome_size);
+        if (!rep) return STATUS_INSUFFICIENT_RESOURCES;
+        species->representative = rep;
+        species->representative_size = individual->genome_size;
+    }
+    memcpy(species->representative, individual->genome, individual->genome_size);
+    return STATUS_SUCCESS;
+}
+
+static void Species_Release(EvolutionarySpecies* species) {
+    free(species->members);
+    free(species->representative);
+    memset(species, 0, sizeof(EvolutionarySpecies));
+}
+
+static int CompareMembersByAdjustedFitness(const void* a, const void* b) {
+    const EvolutionaryIndividual* ia = *(const EvolutionaryIndividual* const*)a;
+    const EvolutionaryIndividual* ib = *(const EvolutionaryIndividual* const*)b;
+    if (ia->adjusted_fitness > ib->adjusted_fitness) return -1;
+    if (ia->adjusted_fitness < ib->adjusted_fitness) return 1;
+    return 0;
+}
+
+// Explicit fitness sharing, stagnation tracking and offspring allocation per species
+static void Species_ShareFitnessAndAllocate(EvolutionEngine* engine) {
+    uint32_t stagnation_limit = engine->params.stagnation_limit ?
+        engine->params.stagnation_limit : EVOLUTION_SPECIES_DEFAULT_STAGNATION;
+
+    double min_adjusted = DBL_MAX;
+    for (uint32_t i = 0; i < engine->population.size; i++) {
+        if (engine->population.individuals[i].adjusted_fitness < min_adjusted)
+            min_adjusted = engine->population.individuals[i].adjusted_fitness;
+    }
+
+    uint32_t champion_species = 0;
+    double champion_fitness = -DBL_MAX;
+    for (uint32_t s = 0; s < engine->species_count; s++) {
+        EvolutionarySpecies* species = &engine->species[s];
+        double shared_sum = 0.0;
+        double species_best = -DBL_MAX;
+        for (uint32_t m = 0; m < species->member_count; m++) {
+            EvolutionaryIndividual* member = species->members[m];
+            if (member->fitness > species_best) species_best = member->fitness;
+            member->adjusted_fitness = (member->adjusted_fitness - min_adjusted + 1e-6) / species->member_count;
+            shared_sum += member->adjusted_fitness;
+        }
+        species->species_fitness = shared_sum;
+
+        if (species->age == 0 || species_best > species->best_fitness + 1e-9) {
+            species->best_fitness = species_best;
+            species->generations_no_improvement = 0;
+        } else {
+            species->generations_no_improvement++;
+        }
+        species->age++;
 
-        // Tournament selection
-        for (uint32_t j = 0; j < engine->params.tournament_size; j++) {
-            uint32_t idx = rand() % engine->population.size;
-            EvolutionaryIndividual* candidate = &engine->population.individuals[idx];
+        if (species_best > champion_fitness) {
+            champion_fitness = species_best;
+            champion_species = s;
+        }
+    }
 
-            if (candidate->fitness > best_fitness) {
-                best_fitness = candidate->fitness;
-                best = candidate;
+    // Stagnant species receive no offspring; the species holding the champion is always kept
+    double total = 0.0;
+    for (uint32_t s = 0; s < engine->species_count; s++) {
+        EvolutionarySpecies* species = &engine->species[s];
+        bool stagnant = species->generations_no_improvement >= stagnation_limit && s != champion_species;
+        if (stagnant) species->species_fitness = 0.0;
+        total += species->species_fitness;
+    }
+
+    // Largest-remainder apportionment of the next generation
+    uint32_t slots = engine->population.max_size;
+    uint32_t assigned = 0;
+    for (uint32_t s = 0; s < engine->species_count; s++) {
+        EvolutionarySpecies* species = &engine->species[s];
+        double share = (total > 0.0) ? slots * species->species_fitness / total : 0.0;
+        species->offspring_allotment = (uint32_t)share;
+        assigned += species->offspring_allotment;
+    }
+    while (assigned < slots) {
+        uint32_t best = champion_species;
+        double best_remainder = -1.0;
+        for (uint32_t s = 0; s < engine->species_count; s++) {
+            EvolutionarySpecies* species = &engine->species[s];
+            if (species->species_fitness <= 0.0) continue;
+            double share = slots * species->species_fitness / total;
+            double remainder = share - (double)species->offspring_allotment;
+            if (remainder > best_remainder) {
+                best_remainder = remainder;
+                best = s;
             }
         }
+        engine->species[best].offspring_allotment++;
+        assigned++;
+    }
+    engine->selector.ready = false;
+}
 
-        parents[i] = best;
+// Selection: one O(n) preparation per evaluated generation, then batched draws
+static EvolutionSelectionMode Selection_Mode(SelectionMethod method) {
+    switch (method) {
+        case SELECTION_ROULETTE:
+        case SELECTION_STOCHASTIC:
+            return EVOLUTION_SELECT_ROULETTE;
+        case SELECTION_RANK:
+            return EVOLUTION_SELECT_RANK;
+        case SELECTION_TRUNCATION:
+        case SELECTION_ELITISM:
+            return EVOLUTION_SELECT_TRUNCATION;
+        case SELECTION_TOURNAMENT:
+        default:
+            return EVOLUTION_SELECT_TOURNAMENT;
     }
 }
 
+static NTSTATUS Selection_Prepare(EvolutionEngine* engine) {
+    EvolutionSelector* selector = &engine->selector;
+    uint32_t n = engine->population.size;
+    if (!selector->initialized || n == 0 || n > selector->capacity) return STATUS_INVALID_DEVICE_STATE;
+    if (selector->ready && selector->count == n) return STATUS_SUCCESS;
+
+    for (uint32_t i = 0; i < n; i++) selector->fitness[i] = engine->population.individuals[i].adjusted_fitness;
+    selector->tournament_size = engine->params.tournament_size;
+    if (engine->params.selection_pressure > 0.0) selector->pressure = engine->params.selection_pressure;
+    return EvolutionSelector_Prepare(selector, Selection_Mode(engine->params.selection), selector->fitness, n);
+}
+
+// Breeds count offspring into out[] from parent pairs drawn in one batch
+static NTSTATUS Selection_Breed(EvolutionEngine* engine, EvolutionaryIndividual* out, uint32_t count) {
+    NTSTATUS status = Selection_Prepare(engine);
+    if (!NT_SUCCESS(status)) return status;
+    uint32_t* parents = (uint32_t*)malloc(2 * (size_t)count * sizeof(uint32_t));
+    if (!parents) return STATUS_INSUFFICIENT_RESOURCES;
+
+    EvolutionSelector_Draw(&engine->selector, &engine->rng, parents, 2 * count);
+    EvolutionaryIndividual* pop = engine->population.individuals;
+    for (uint32_t i = 0; i < count; i++) {
+        EvolutionEngine_CreateOffspring(engine, &pop[parents[2 * i]], &pop[parents[2 * i + 1]], &out[i]);
+    }
+    free(parents);
+    return STATUS_SUCCESS;
+}
+
 // Fitness evaluation
 static double EvaluateFitness_Accuracy(void* genome, size_t genome_size, void* context) {
     EvolutionEngine* engine = (EvolutionEngine*)context;
 
     if (engine->neural_system) {
         // Use neural substrate to evaluate fitness
-        uint8_t input[100] = {0};
-        uint8_t output[100] = {0};
+        uint8_t input[FITNESS_ACCURACY_IO] = {0};
+        uint8_t output[FITNESS_ACCURACY_IO] = {0};
 
         // Create test input
         for (size_t i = 0; i < (genome_size < sizeof(input) ? genome_size : sizeof(input)); i++) {
@@ -118,6 +508,96 @@ static double EvaluateFitness_Accuracy(void* genome, size_t genome_size, void* c
     return RandomDouble(0.0, 1.0); // Fallback
 }
 
+// Batched form of EvaluateFitness_Accuracy: every genome goes through the substrate in one
+// forward pass, so the weights are streamed once per block instead of once per individual
+static NTSTATUS EvaluateFitness_AccuracyBatch(void* const* genomes, const size_t* genome_sizes,
+                                              uint32_t count, double* fitness, void* context) {
+    EvolutionEngine* engine = (EvolutionEngine*)context;
+
+    if (!engine->neural_system) {
+        for (uint32_t k = 0; k < count; k++) fitness[k] = RandomDouble(0.0, 1.0);
+        return STATUS_SUCCESS;
+    }
+
+    uint8_t* inputs = (uint8_t*)calloc((size_t)count, FITNESS_ACCURACY_IO);
+    uint8_t* outputs = (uint8_t*)malloc((size_t)count * FITNESS_ACCURACY_IO);
+    if (!inputs || !outputs) {
+        free(inputs);
+        free(outputs);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    for (uint32_t k = 0; k < count; k++) {
+        size_t n = genome_sizes[k] < FITNESS_ACCURACY_IO ? genome_sizes[k] : FITNESS_ACCURACY_IO;
+        memcpy(inputs + (size_t)k * FITNESS_ACCURACY_IO, genomes[k], n);
+    }
+
+    NTSTATUS status = NeuralSubstrate_ProcessBatch(engine->neural_system, inputs, FITNESS_ACCURACY_IO,
+                                                   outputs, FITNESS_ACCURACY_IO, count);
+    if (NT_SUCCESS(status)) {
+        for (uint32_t k = 0; k < count; k++) {
+            const uint8_t* out = outputs + (size_t)k * FITNESS_ACCURACY_IO;
+            double sum = 0.0;
+            for (size_t i = 0; i < FITNESS_ACCURACY_IO; i++) sum += (double)out[i] / 255.0;
+            fitness[k] = sum / FITNESS_ACCURACY_IO;
+        }
+    }
+    free(inputs);
+    free(outputs);
+    return status;
+}
+
+typedef struct {
+    EvolutionEngine* engine;
+    EvolutionaryIndividual* const* list;
+} EvaluateRangeContext;
+
+static void EvaluateIndividuals_Range(uint64_t begin, uint64_t end, void* context) {
+    EvaluateRangeContext* ctx = (EvaluateRangeContext*)context;
+    EvolutionEngine* engine = ctx->engine;
+    for (uint64_t k = begin; k < end; k++) {
+        EvolutionaryIndividual* individual = ctx->list[k];
+        individual->fitness = engine->fitness_function(individual->genome, individual->genome_size,
+                                                       engine->fitness_context);
+    }
+}
+
+// Scores the listed individuals, in one call when the fitness function has a batched form;
+// a batch that fails falls back to the per-genome function, spread over the shared pool when
+// parallel_evaluations > 1 declares it thread-safe (as steady state already assumes)
+static void EvaluateIndividuals(EvolutionEngine* engine, EvolutionaryIndividual* const* list, uint32_t count) {
+    if (count == 0) return;
+    bool batched = false;
+    if (engine->batch_fitness_function) {
+        void** genomes = (void**)malloc(count * sizeof(void*));
+        size_t* sizes = (size_t*)malloc(count * sizeof(size_t));
+        double* fitness = (double*)malloc(count * sizeof(double));
+        if (genomes && sizes && fitness) {
+            for (uint32_t k = 0; k < count; k++) {
+                genomes[k] = list[k]->genome;
+                sizes[k] = list[k]->genome_size;
+            }
+            batched = NT_SUCCESS(engine->batch_fitness_function(genomes, sizes, count, fitness,
+                                                                engine->batch_fitness_context));
+            if (batched) {
+                for (uint32_t k = 0; k < count; k++) list[k]->fitness = fitness[k];
+            }
+        }
+        free(genomes);
+        free(sizes);
+        free(fitness);
+    }
+    if (!batched) {
+        EvaluateRangeContext ctx = { engine, list };
+        ThreadPool* pool = engine->params.parallel_evaluations > 1 ? ThreadPool_GetGlobal() : NULL;
+        ThreadPool_ParallelFor(pool, 0, count, 1, EvaluateIndividuals_Range, &ctx, THREAD_POOL_PRIORITY_NORMAL);
+    }
+    for (uint32_t k = 0; k < count; k++) {
+        EvolutionaryIndividual* individual = list[k];
+        individual->adjusted_fitness = individual->fitness;
+        individual->evaluated = true;
+    }
+}
+
 // Main API implementation
 NTSTATUS EvolutionEngine_Initialize(EvolutionEngine* engine,
                                   EvolutionParameters* params,
@@ -128,6 +608,10 @@ NTSTATUS EvolutionEngine_Initialize(EvolutionEngine* engine,
     // Copy parameters
     memcpy(&engine->params, params, sizeof(EvolutionParameters));
 
+    // Operator RNG: explicit seed for reproducible runs, otherwise clock and address
+    EvolutionRng_Seed(&engine->rng, params->rng_seed ? params->rng_seed
+                                                     : (GetTickCount64() ^ (uint64_t)(uintptr_t)engine));
+
     // Set subsystem references
     engine->neural_system = neural;
     engine->ethics_system = ethics;
@@ -146,6 +630,8 @@ NTSTATUS EvolutionEngine_Initialize(EvolutionEngine* engine,
     engine->population.best_individual = NULL;
 
     EvolutionEngine_AllocatePopulation(engine, engine->population.max_size);
+    memset(&engine->selector, 0, sizeof(EvolutionSelector));
+    EvolutionSelector_Initialize(&engine->selector, engine->population.max_size);
 
     // Initialize statistics
     memset(&engine->stats, 0, sizeof(EvolutionStatistics));
@@ -153,8 +639,36 @@ NTSTATUS EvolutionEngine_Initialize(EvolutionEngine* engine,
     // Set default callbacks
     engine->fitness_function = EvaluateFitness_Accuracy;
     engine->fitness_context = engine;
+    engine->batch_fitness_function = EvaluateFitness_AccuracyBatch;
+    engine->batch_fitness_context = engine;
     engine->genome_initializer = InitializeGenome_GA;
-    engine->init_context = NULL;
+    engine->init_context = engine;
+    engine->behavior_function = BehaviorDescriptor_BlockMean;
+    engine->behavior_context = NULL;
+
+    // Speciation and novelty state start empty
+    engine->species = NULL;
+    engine->species_count = 0;
+    engine->species_capacity = 0;
+    engine->next_species_id = 0;
+    memset(&engine->novelty_archive, 0, sizeof(NoveltyArchive));
+    memset(&engine->diversity, 0, sizeof(EvolutionDiversityStats));
+    engine->qd_archive = NULL;
+    engine->surrogate = NULL;
+    engine->surrogate_predictions = NULL;
+    engine->checkpoint = NULL;
+    engine->population_descriptors = NULL;
+    engine->population_novelty = NULL;
+    engine->population_descriptor_capacity = 0;
+    if (params->novelty_search) {
+        EvolutionEngine_EnableNoveltySearch(engine, 0);
+    }
+    if (params->speciation_enabled || params->algorithm == EVOLUTION_TYPE_NEAT) {
+        EvolutionEngine_EnableSpeciation(engine, params->species_count);
+    }
+    if (params->surrogate_screening) {
+        EvolutionEngine_EnableSurrogate(engine, NULL);
+    }
 
     // Initialize control state
     engine->initialized = true;
@@ -169,19 +683,45 @@ NTSTATUS EvolutionEngine_Shutdown(EvolutionEngine* engine) {
     if (!engine->initialized) return STATUS_SUCCESS;
 
     EvolutionEngine_StopEvolution(engine);
+    if (engine->checkpoint) {
+        EvolutionCheckpointWriter_Shutdown(engine->checkpoint);
+        free(engine->checkpoint);
+        engine->checkpoint = NULL;
+    }
     EvolutionEngine_FreePopulation(engine);
+    EvolutionSelector_Shutdown(&engine->selector);
 
     if (engine->species) {
+        for (uint32_t s = 0; s < engine->species_count; s++) {
+            Species_Release(&engine->species[s]);
+        }
         free(engine->species);
+        engine->species = NULL;
+        engine->species_count = 0;
+        engine->species_capacity = 0;
     }
 
-    if (engine->novelty_archive.behaviors) {
-        for (uint32_t i = 0; i < engine->novelty_archive.size; i++) {
-            free(engine->novelty_archive.behaviors[i]);
-        }
-        free(engine->novelty_archive.behaviors);
-        free(engine->novelty_archive.novelty_scores);
+    free(engine->novelty_archive.descriptors);
+    free(engine->novelty_archive.novelty_scores);
+    memset(&engine->novelty_archive, 0, sizeof(NoveltyArchive));
+    free(engine->population_descriptors);
+    free(engine->population_novelty);
+    engine->population_descriptors = NULL;
+    engine->population_novelty = NULL;
+    engine->population_descriptor_capacity = 0;
+
+    if (engine->qd_archive) {
+        MapElites_Shutdown(engine->qd_archive);
+        free(engine->qd_archive);
+        engine->qd_archive = NULL;
+    }
+    if (engine->surrogate) {
+        EvolutionSurrogate_Shutdown(engine->surrogate);
+        free(engine->surrogate);
+        engine->surrogate = NULL;
     }
+    free(engine->surrogate_predictions);
+    engine->surrogate_predictions = NULL;
 
     engine->initialized = false;
     DeleteCriticalSection(&engine->lock);
@@ -202,7 +742,24 @@ NTSTATUS EvolutionEngine_StartEvolution(EvolutionEngine* engine) {
 
     // Start evolution thread
     // For now, run synchronously
-    EvolutionEngine_RunGeneticAlgorithm(engine);
+    switch (engine->params.algorithm) {
+        case EVOLUTION_TYPE_NEAT:
+            EvolutionEngine_RunNEAT(engine);
+            break;
+        case EVOLUTION_TYPE_QUALITY_DIVERSITY:
+            EvolutionEngine_RunQualityDiversity(engine);
+            break;
+        case EVOLUTION_TYPE_GENETIC:
+            if (engine->params.steady_state) {
+                EvolutionEngine_RunSteadyState(engine, engine->params.parallel_evaluations);
+                break;
+            }
+            EvolutionEngine_RunGeneticAlgorithm(engine);
+            break;
+        default:
+            EvolutionEngine_RunGeneticAlgorithm(engine);
+            break;
+    }
 
     return STATUS_SUCCESS;
 }
@@ -252,16 +809,55 @@ NTSTATUS EvolutionEngine_EvaluatePopulation(EvolutionEngine* engine) {
     double best_fitness = -DBL_MAX;
     EvolutionaryIndividual* best_individual = NULL;
 
+    // Newly evaluated genomes train the surrogate; screened ones also score its predictions
+    EvolutionSurrogate* surrogate = engine->surrogate;
+    const double** observed_genomes = NULL;
+    double* observed_fitness = NULL;
+    double* checked_predicted = NULL;
+    double* checked_actual = NULL;
+    uint32_t observed = 0, checked = 0;
+
+    // Score every pending genome up front so a batched fitness function sees them together
+    EvolutionaryIndividual** pending = (EvolutionaryIndividual**)malloc(
+        (engine->population.size ? engine->population.size : 1) * sizeof(EvolutionaryIndividual*));
+    if (!pending) return STATUS_INSUFFICIENT_RESOURCES;
+    uint32_t pending_count = 0;
+    for (uint32_t i = 0; i < engine->population.size; i++) {
+        if (!engine->population.individuals[i].evaluated) pending[pending_count++] = &engine->population.individuals[i];
+    }
+    EvaluateIndividuals(engine, pending, pending_count);
+    uint32_t cursor = 0;
+
+    if (surrogate && engine->population.size > 0) {
+        uint32_t n = engine->population.size;
+        observed_genomes = (const double**)malloc(n * sizeof(double*));
+        observed_fitness = (double*)malloc(n * sizeof(double));
+        checked_predicted = (double*)malloc(n * sizeof(double));
+        checked_actual = (double*)malloc(n * sizeof(double));
+        if (!observed_genomes || !observed_fitness || !checked_predicted || !checked_actual) {
+            surrogate = NULL;
+        }
+    }
+
     for (uint32_t i = 0; i < engine->population.size; i++) {
         EvolutionaryIndividual* individual = &engine->population.individuals[i];
 
-        if (!individual->evaluated) {
-            individual->fitness = engine->fitness_function(individual->genome,
-                                                        individual->genome_size,
-                                                        engine->fitness_context);
-            individual->evaluated = true;
+        if (cursor < pending_count && pending[cursor] == individual) {
+            cursor++;
+            engine->stats.evaluations_performed++;
+
+            if (surrogate && individual->genome_size == surrogate->genes * sizeof(double)) {
+                observed_genomes[observed] = (const double*)individual->genome;
+                observed_fitness[observed++] = individual->fitness;
+                double predicted = engine->surrogate_predictions ? engine->surrogate_predictions[i] : NAN;
+                if (predicted == predicted) {
+                    checked_predicted[checked] = predicted;
+                    checked_actual[checked++] = individual->fitness;
+                }
+            }
         }
 
+        individual->adjusted_fitness = individual->fitness;
         total_fitness += individual->fitness;
 
         if (individual->fitness > best_fitness) {
@@ -283,22 +879,41 @@ NTSTATUS EvolutionEngine_EvaluatePopulation(EvolutionEngine* engine) {
     }
     engine->population.fitness_variance = variance / engine->population.size;
 
+    if (surrogate) {
+        // Score before learning from the same samples
+        EvolutionSurrogate_RecordOutcome(surrogate, checked_predicted, checked_actual, checked);
+        EvolutionSurrogate_Observe(surrogate, observed_genomes, observed_fitness, observed);
+        engine->stats.surrogate_screened_out = surrogate->screened_out;
+        engine->stats.surrogate_true_fraction = surrogate->true_fraction;
+        engine->stats.surrogate_rank_correlation = surrogate->rank_correlation;
+        engine->stats.surrogate_mean_abs_error = surrogate->mean_abs_error;
+    }
+    free(pending);
+    free(observed_genomes);
+    free(observed_fitness);
+    free(checked_predicted);
+    free(checked_actual);
+
+    if (engine->params.novelty_search && engine->novelty_archive.descriptors &&
+        engine->population.size > 1) {
+        ApplyNoveltySearch(engine);
+    }
+    engine->selector.ready = false;
+
     return STATUS_SUCCESS;
 }
 
 NTSTATUS EvolutionEngine_SelectParents(EvolutionEngine* engine,
                                      EvolutionaryIndividual** parents,
                                      uint32_t num_parents) {
-    switch (engine->params.selection) {
-        case SELECTION_TOURNAMENT:
-            Selection_Tournament(engine, parents, num_parents);
-            break;
-        default:
-            // Default to tournament selection
-            Selection_Tournament(engine, parents, num_parents);
-            break;
-    }
+    NTSTATUS status = Selection_Prepare(engine);
+    if (!NT_SUCCESS(status)) return status;
 
+    for (uint32_t i = 0; i < num_parents; i++) {
+        uint32_t index;
+        EvolutionSelector_Draw(&engine->selector, &engine->rng, &index, 1);
+        parents[i] = &engine->population.individuals[index];
+    }
     return STATUS_SUCCESS;
 }
 
@@ -309,17 +924,36 @@ NTSTATUS EvolutionEngine_CreateOffspring(EvolutionEngine* engine,
     // Allocate offspring genome
     EvolutionEngine_AllocateIndividual(engine, offspring, parent1->genome_size);
 
-    // Crossover
-    if (RandomDouble(0.0, 1.0) < engine->params.crossover_rate) {
+    // Crossover on whole genes; any trailing bytes come from parent1
+    if (EvolutionRng_NextDouble(&engine->rng) < engine->params.crossover_rate) {
+        const double* a = (const double*)parent1->genome;
+        const double* b = (const double*)parent2->genome;
+        double* child = (double*)offspring->genome;
+        size_t num_genes = offspring->genome_size / sizeof(double);
+
         switch (engine->params.crossover) {
-            case CROSSOVER_SINGLE_POINT:
-                Crossover_SinglePoint(parent1, parent2, offspring);
+            case CROSSOVER_TWO_POINT:
+                EvolutionOps_CrossoverTwoPoint(&engine->rng, a, b, child, num_genes);
+                break;
+            case CROSSOVER_UNIFORM:
+                EvolutionOps_CrossoverUniform(&engine->rng, a, b, child, num_genes);
                 break;
+            case CROSSOVER_ARITHMETIC:
+                EvolutionOps_CrossoverArithmetic(&engine->rng, a, b, child, num_genes);
+                break;
+            case CROSSOVER_BLX_ALPHA:
+                EvolutionOps_CrossoverBlxAlpha(&engine->rng, a, b, child, num_genes, EVOLUTION_BLX_DEFAULT_ALPHA);
+                break;
+            case CROSSOVER_SINGLE_POINT:
             default:
                 // Default to single point crossover
-                Crossover_SinglePoint(parent1, parent2, offspring);
+                EvolutionOps_CrossoverSinglePoint(&engine->rng, a, b, child, num_genes);
                 break;
         }
+        size_t tail = num_genes * sizeof(double);
+        if (tail < offspring->genome_size) {
+            memcpy((char*)offspring->genome + tail, (char*)parent1->genome + tail, offspring->genome_size - tail);
+        }
     } else {
         // No crossover, copy from parent1
         memcpy(offspring->genome, parent1->genome, parent1->genome_size);
@@ -342,10 +976,10 @@ NTSTATUS EvolutionEngine_MutateIndividual(EvolutionEngine* engine,
                                         EvolutionaryIndividual* individual) {
     switch (engine->params.mutation) {
         case MUTATION_GAUSSIAN:
-            Mutate_Gaussian(individual, engine->params.mutation_rate);
+            Mutate_Gaussian(engine, individual);
             break;
         default:
-            Mutate_Gaussian(individual, engine->params.mutation_rate);
+            Mutate_Gaussian(engine, individual);
             break;
     }
 
@@ -365,86 +999,633 @@ NTSTATUS EvolutionEngine_RunGeneticAlgorithm(EvolutionEngine* engine) {
             break;
         }
 
-        // Create new population
+        NTSTATUS status = EvolutionEngine_NextGeneration(engine);
+        if (!NT_SUCCESS(status)) return status;
+
+        // Log progress
+        if (engine->population.generation % 10 == 0) {
+            printf("Generation %u: Best Fitness = %.4f, Average = %.4f, Diversity = %.4f\n",
+                   engine->population.generation,
+                   engine->population.best_fitness,
+                   engine->population.average_fitness,
+                   EvolutionEngine_CalculatePopulationDiversity(engine));
+        }
+
+        // Evolve neural substrate occasionally
+        if (engine->population.generation % 50 == 0 && engine->neural_system) {
+            NeuralSubstrate_Evolve(engine->neural_system);
+        }
+    }
+
+    // Update statistics
+    engine->stats.generations_completed = engine->population.generation;
+    engine->stats.best_fitness_achieved = engine->population.best_fitness;
+    engine->stats.average_fitness_final = engine->population.average_fitness;
+
+    printf("Evolution completed. Best fitness: %.4f\n", engine->population.best_fitness);
+
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionEngine_RunNEAT(EvolutionEngine* engine) {
+    if (!engine->species) {
+        NTSTATUS status = EvolutionEngine_EnableSpeciation(engine, engine->params.species_count);
+        if (!NT_SUCCESS(status)) return status;
+    }
+
+    printf("Starting NEAT evolution...\n");
+
+    while (engine->running && engine->population.generation < engine->params.max_generations) {
+        EvolutionEngine_EvaluatePopulation(engine);
+
+        if (engine->population.best_fitness >= engine->params.target_fitness) {
+            engine->stats.target_reached = true;
+            break;
+        }
+
+        NTSTATUS status = EvolutionEngine_Speciate(engine);
+        if (!NT_SUCCESS(status)) return status;
+        Species_ShareFitnessAndAllocate(engine);
+
         EvolutionaryIndividual* new_population = (EvolutionaryIndividual*)malloc(
             engine->population.max_size * sizeof(EvolutionaryIndividual));
-
         if (!new_population) return STATUS_INSUFFICIENT_RESOURCES;
-
         memset(new_population, 0, engine->population.max_size * sizeof(EvolutionaryIndividual));
 
-        EvolutionaryIndividual* old_ind = engine->population.individuals;
-        uint32_t elite_count = (uint32_t)(engine->params.elitism_rate * engine->population.max_size);
-        if (elite_count > engine->population.max_size) elite_count = engine->population.max_size;
-        for (uint32_t i = 0; i < elite_count; i++) {
-            EvolutionaryIndividual* src = &old_ind[i];
-            EvolutionaryIndividual* dst = &new_population[i];
-            dst->id = src->id;
-            dst->genome_size = src->genome_size;
-            dst->fitness = src->fitness;
-            dst->adjusted_fitness = src->adjusted_fitness;
-            dst->age = src->age + 1;
-            dst->parent1_id = src->parent1_id;
-            dst->parent2_id = src->parent2_id;
-            dst->evaluated = true;
-            dst->phenotype = NULL;
-            dst->metadata = NULL;
-            dst->genome = malloc(src->genome_size);
-            if (dst->genome && src->genome)
-                memcpy(dst->genome, src->genome, src->genome_size);
-        }
-
-        // Create offspring
-        for (uint32_t i = elite_count; i < engine->population.max_size; i++) {
-            EvolutionaryIndividual* parents[2];
-            EvolutionEngine_SelectParents(engine, parents, 2);
-
-            EvolutionEngine_CreateOffspring(engine, parents[0], parents[1], &new_population[i]);
-        }
-
-        // Replace old population
+        uint32_t next = 0;
+        for (uint32_t s = 0; s < engine->species_count; s++) {
+            EvolutionarySpecies* species = &engine->species[s];
+            uint32_t allotment = species->offspring_allotment;
+            if (allotment == 0 || species->member_count == 0) continue;
+
+            qsort(species->members, species->member_count, sizeof(EvolutionaryIndividual*),
+                  CompareMembersByAdjustedFitness);
+
+            // Champion of a sizeable species survives unchanged
+            if (species->member_count >= EVOLUTION_SPECIES_ELITE_MIN_SIZE) {
+                CloneIndividual(species->members[0], &new_population[next++]);
+                allotment--;
+            }
+
+            // Parents are drawn from the better half of the species
+            uint32_t pool = (species->member_count + 1) / 2;
+            for (uint32_t i = 0; i < allotment && next < engine->population.max_size; i++) {
+                EvolutionaryIndividual* p1 = species->members[EvolutionRng_NextBelow(&engine->rng, pool)];
+                EvolutionaryIndividual* p2 = species->members[EvolutionRng_NextBelow(&engine->rng, pool)];
+                if (p2->adjusted_fitness > p1->adjusted_fitness) {
+                    EvolutionaryIndividual* tmp = p1;
+                    p1 = p2;
+                    p2 = tmp;
+                }
+                EvolutionEngine_CreateOffspring(engine, p1, p2, &new_population[next++]);
+            }
+        }
+
+        // Members point into the population being replaced
+        for (uint32_t s = 0; s < engine->species_count; s++) {
+            engine->species[s].member_count = 0;
+        }
+
         EvolutionEngine_FreePopulation(engine);
         engine->population.individuals = new_population;
-        engine->population.size = engine->population.max_size;
+        engine->population.size = next;
 
         engine->population.generation++;
 
-        // Log progress
         if (engine->population.generation % 10 == 0) {
-            printf("Generation %u: Best Fitness = %.4f, Average = %.4f\n",
+            printf("Generation %u: Best Fitness = %.4f, Average = %.4f, Species = %u\n",
                    engine->population.generation,
                    engine->population.best_fitness,
-                   engine->population.average_fitness);
+                   engine->population.average_fitness,
+                   engine->species_count);
         }
 
-        // Evolve neural substrate occasionally
         if (engine->population.generation % 50 == 0 && engine->neural_system) {
             NeuralSubstrate_Evolve(engine->neural_system);
         }
     }
 
-    // Update statistics
     engine->stats.generations_completed = engine->population.generation;
     engine->stats.best_fitness_achieved = engine->population.best_fitness;
     engine->stats.average_fitness_final = engine->population.average_fitness;
 
-    printf("Evolution completed. Best fitness: %.4f\n", engine->population.best_fitness);
+    printf("NEAT evolution completed. Best fitness: %.4f, Species: %u\n",
+           engine->population.best_fitness, engine->species_count);
 
     return STATUS_SUCCESS;
 }
 
-// Stub implementations for other algorithms
-NTSTATUS EvolutionEngine_RunNEAT(EvolutionEngine* engine) {
-    UNREFERENCED_PARAMETER(engine);
-    return STATUS_NOT_IMPLEMENTED;
+// Surrogate pre-screening
+typedef struct {
+    double predicted;
+    uint32_t index;
+} ScreenedCandidate;
+
+static int CompareScreenedDescending(const void* a, const void* b) {
+    double x = ((const ScreenedCandidate*)a)->predicted;
+    double y = ((const ScreenedCandidate*)b)->predicted;
+    return (x < y) - (x > y);
 }
 
-NTSTATUS EvolutionEngine_RunEvolutionStrategies(EvolutionEngine* engine) {
-    UNREFERENCED_PARAMETER(engine);
-    return STATUS_NOT_IMPLEMENTED;
+// Breeds slots / true_fraction candidates and keeps the `slots` the surrogate ranks highest.
+// Returns false (nothing bred) when the surrogate is not trained yet.
+static bool NextGeneration_Screened(EvolutionEngine* engine, EvolutionaryIndividual* out,
+                                    uint32_t slots, uint32_t first_slot) {
+    EvolutionSurrogate* surrogate = engine->surrogate;
+    if (!surrogate || !surrogate->trained || !engine->surrogate_predictions || slots == 0) return false;
+    if (engine->population.size == 0 ||
+        engine->population.individuals[0].genome_size != surrogate->genes * sizeof(double)) return false;
+
+    // At a fraction of 1 nothing is discarded, but predictions are still recorded so the
+    // surrogate keeps being scored and can earn a lower fraction
+    double fraction = surrogate->true_fraction;
+    uint32_t candidates = (uint32_t)ceil(slots / fraction);
+    if (candidates > slots * EVOLUTION_SURROGATE_MAX_OVERSAMPLE) candidates = slots * EVOLUTION_SURROGATE_MAX_OVERSAMPLE;
+    if (candidates < slots) candidates = slots;
+
+    EvolutionaryIndividual* pool = (EvolutionaryIndividual*)calloc(candidates, sizeof(EvolutionaryIndividual));
+    const double** genomes = (const double**)malloc(candidates * sizeof(double*));
+    double* predicted = (double*)malloc(candidates * sizeof(double));
+    ScreenedCandidate* order = (ScreenedCandidate*)malloc(candidates * sizeof(ScreenedCandidate));
+    bool screened = false;
+    if (pool && genomes && predicted && order) {
+        NTSTATUS status = Selection_Breed(engine, pool, candidates);
+        for (uint32_t c = 0; c < candidates; c++) genomes[c] = (const double*)pool[c].genome;
+        if (NT_SUCCESS(status) && NT_SUCCESS(EvolutionSurrogate_PredictBatch(surrogate, genomes, candidates, predicted))) {
+            for (uint32_t c = 0; c < candidates; c++) {
+                order[c].predicted = predicted[c];
+                order[c].index = c;
+            }
+            qsort(order, candidates, sizeof(ScreenedCandidate), CompareScreenedDescending);
+            for (uint32_t i = 0; i < slots; i++) {
+                out[i] = pool[order[i].index];
+                engine->surrogate_predictions[first_slot + i] = order[i].predicted;
+                memset(&pool[order[i].index], 0, sizeof(EvolutionaryIndividual));
+            }
+            surrogate->screened_out += candidates - slots;
+            screened = true;
+        }
+        for (uint32_t c = 0; c < candidates; c++) {
+            EvolutionEngine_FreeIndividual(engine, &pool[c]);
+        }
+    }
+    free(pool);
+    free(genomes);
+    free(predicted);
+    free(order);
+    return screened;
+}
+
+// Replaces the evaluated population with elites plus offspring of selected parents
+NTSTATUS EvolutionEngine_NextGeneration(EvolutionEngine* engine) {
+    if (!engine->selector.initialized) return STATUS_INVALID_DEVICE_STATE;
+    EvolutionaryIndividual* new_population = (EvolutionaryIndividual*)malloc(
+        engine->population.max_size * sizeof(EvolutionaryIndividual));
+
+    if (!new_population) return STATUS_INSUFFICIENT_RESOURCES;
+
+    memset(new_population, 0, engine->population.max_size * sizeof(EvolutionaryIndividual));
+
+    // Elites are the true top-k by raw fitness, best first
+    EvolutionaryIndividual* old_ind = engine->population.individuals;
+    uint32_t elite_count = (uint32_t)(engine->params.elitism_rate * engine->population.max_size);
+    if (elite_count > engine->population.size) elite_count = engine->population.size;
+    engine->selector.ready = false;
+    if (elite_count > 0) {
+        EvolutionSelector* selector = &engine->selector;
+        for (uint32_t i = 0; i < engine->population.size; i++) selector->fitness[i] = old_ind[i].fitness;
+        EvolutionSelection_TopK(selector->fitness, engine->population.size, elite_count, selector->order);
+        for (uint32_t i = 0; i < elite_count; i++) {
+            CloneIndividual(&old_ind[selector->order[i]], &new_population[i]);
+        }
+    }
+
+    // Create offspring, pre-screened by the surrogate once it has been trained
+    if (engine->surrogate_predictions) {
+        for (uint32_t i = 0; i < engine->population.max_size; i++) engine->surrogate_predictions[i] = NAN;
+    }
+    uint32_t slots = engine->population.max_size - elite_count;
+    if (!NextGeneration_Screened(engine, new_population + elite_count, slots, elite_count)) {
+        NTSTATUS status = Selection_Breed(engine, new_population + elite_count, slots);
+        if (!NT_SUCCESS(status)) {
+            for (uint32_t i = 0; i < engine->population.max_size; i++) {
+                EvolutionEngine_FreeIndividual(engine, &new_population[i]);
+            }
+            free(new_population);
+            return status;
+        }
+    }
+
+    // Replace old population
+    EvolutionEngine_FreePopulation(engine);
+    engine->population.individuals = new_population;
+    engine->population.size = engine->population.max_size;
+
+    engine->population.generation++;
+    if (engine->checkpoint) {
+        EvolutionCheckpointWriter_OnGeneration(engine->checkpoint, engine);
+    }
+    return STATUS_SUCCESS;
+}
+
+// Steady-state asynchronous evolution
+//
+// Workers never wait on each other: each one breeds a child from a tournament over the
+// current pool, evaluates it outside the lock and then overwrites the loser of a reverse
+// tournament. The initial population is evaluated through the same workers, and
+// individuals still in flight (evaluated == false) are never selected or replaced.
+typedef struct SteadyStateRun SteadyStateRun;
+
+typedef struct {
+    EvolutionEngine* engine;
+    SteadyStateRun* run;
+    EvolutionaryIndividual child;
+    RoleBoundaryContext role_ctx;
+    uint64_t busy_ticks;
+    uint64_t evaluations;
+} SteadyStateWorker;
+
+struct SteadyStateRun {
+    SteadyStateWorker* workers;
+    uint64_t evaluation_budget;
+    uint64_t evaluations_issued;     // guarded by engine->lock
+    uint64_t evaluations_done;       // guarded by engine->lock
+    uint32_t evaluated_count;        // guarded by engine->lock
+    uint32_t best_index;             // guarded by engine->lock
+    double fitness_sum;              // guarded by engine->lock
+    volatile LONG next_initial;      // next unclaimed index of the initial population
+    volatile LONG stop;
+};
+
+static uint64_t SteadyState_Ticks(void) {
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return (uint64_t)now.QuadPart;
+}
+
+// Caller holds engine->lock
+static EvolutionaryIndividual* SteadyState_Tournament(EvolutionEngine* engine) {
+    EvolutionaryIndividual* best = NULL;
+    uint32_t size = engine->population.size;
+    uint32_t rounds = engine->params.tournament_size ? engine->params.tournament_size : 2;
+
+    for (uint32_t attempt = 0, drawn = 0; drawn < rounds && attempt < rounds * 8; attempt++) {
+        EvolutionaryIndividual* candidate =
+            &engine->population.individuals[EvolutionRng_NextBelow(&engine->rng, size)];
+        if (!candidate->evaluated) continue;
+        drawn++;
+        if (!best || candidate->adjusted_fitness > best->adjusted_fitness) best = candidate;
+    }
+    return best;
+}
+
+// Caller holds engine->lock. Reverse tournament; the current best is never a loser.
+static int32_t SteadyState_SelectLoser(EvolutionEngine* engine, const SteadyStateRun* run) {
+    int32_t loser = -1;
+    uint32_t size = engine->population.size;
+    uint32_t rounds = engine->params.tournament_size ? engine->params.tournament_size : 2;
+
+    for (uint32_t attempt = 0, drawn = 0; drawn < rounds && attempt < rounds * 8; attempt++) {
+        uint32_t idx = EvolutionRng_NextBelow(&engine->rng, size);
+        EvolutionaryIndividual* candidate = &engine->population.individuals[idx];
+        if (!candidate->evaluated || idx == run->best_index) continue;
+        drawn++;
+        if (loser < 0 || candidate->fitness < engine->population.individuals[loser].fitness) loser = (int32_t)idx;
+    }
+    return loser;
+}
+
+// Caller holds engine->lock
+static void SteadyState_Account(EvolutionEngine* engine, SteadyStateRun* run, uint32_t index) {
+    EvolutionaryIndividual* individual = &engine->population.individuals[index];
+    uint32_t size = engine->population.size;
+
+    if (run->best_index >= size || !engine->population.individuals[run->best_index].evaluated ||
+        individual->fitness > engine->population.individuals[run->best_index].fitness) {
+        run->best_index = index;
+    }
+    engine->population.best_individual = &engine->population.individuals[run->best_index];
+    engine->population.best_fitness = engine->population.best_individual->fitness;
+    engine->population.average_fitness = run->fitness_sum / run->evaluated_count;
+
+    run->evaluations_done++;
+    uint32_t generation = (uint32_t)(run->evaluations_done / size);
+    if (generation != engine->population.generation) {
+        engine->population.generation = generation;
+        if (generation % 10 == 0) {
+            printf("Generation %u: Best Fitness = %.4f, Average = %.4f\n",
+                   generation, engine->population.best_fitness, engine->population.average_fitness);
+        }
+    }
+
+    if (engine->population.best_fitness >= engine->params.target_fitness) {
+        engine->stats.target_reached = true;
+        InterlockedExchange(&run->stop, 1);
+    }
+}
+
+static void SteadyState_Work(SteadyStateWorker* worker, SteadyStateRun* run) {
+    EvolutionEngine* engine = worker->engine;
+    uint32_t size = engine->population.size;
+
+    // Initial population: claim, evaluate in place, publish
+    for (;;) {
+        LONG index = InterlockedIncrement(&run->next_initial) - 1;
+        if (index >= (LONG)size || run->stop || !engine->running) break;
+
+        EvolutionaryIndividual* individual = &engine->population.individuals[index];
+        uint64_t start = SteadyState_Ticks();
+        double fitness = engine->fitness_function(individual->genome, individual->genome_size,
+                                                  engine->fitness_context);
+        worker->busy_ticks += SteadyState_Ticks() - start;
+        worker->evaluations++;
+
+        EnterCriticalSection(&engine->lock);
+        individual->fitness = fitness;
+        individual->adjusted_fitness = fitness;
+        individual->evaluated = true;
+        run->evaluated_count++;
+        run->fitness_sum += fitness;
+        SteadyState_Account(engine, run, (uint32_t)index);
+        LeaveCriticalSection(&engine->lock);
+    }
+
+    // Steady state: breed under the lock, evaluate outside it, replace a loser
+    while (!run->stop && engine->running) {
+        uint64_t start = SteadyState_Ticks();
+
+        EnterCriticalSection(&engine->lock);
+        if (run->evaluations_issued >= run->evaluation_budget) {
+            LeaveCriticalSection(&engine->lock);
+            break;
+        }
+        EvolutionaryIndividual* p1 = SteadyState_Tournament(engine);
+        EvolutionaryIndividual* p2 = SteadyState_Tournament(engine);
+        if (!p1 || !p2) {
+            LeaveCriticalSection(&engine->lock);
+            SwitchToThread();
+            continue;
+        }
+        run->evaluations_issued++;
+        EvolutionEngine_FreeIndividual(engine, &worker->child);
+        EvolutionEngine_CreateOffspring(engine, p1, p2, &worker->child);
+        LeaveCriticalSection(&engine->lock);
+
+        if (!worker->child.genome) break;
+        worker->child.fitness = engine->fitness_function(worker->child.genome, worker->child.genome_size,
+                                                         engine->fitness_context);
+        worker->child.adjusted_fitness = worker->child.fitness;
+        worker->child.evaluated = true;
+        worker->busy_ticks += SteadyState_Ticks() - start;
+        worker->evaluations++;
+
+        EnterCriticalSection(&engine->lock);
+        int32_t loser = SteadyState_SelectLoser(engine, run);
+        if (loser >= 0) {
+            EvolutionaryIndividual* slot = &engine->population.individuals[loser];
+            run->fitness_sum += worker->child.fitness - slot->fitness;
+            SwapIndividuals(slot, &worker->child);
+            SteadyState_Account(engine, run, (uint32_t)loser);
+        } else {
+            run->evaluations_done++;
+        }
+        LeaveCriticalSection(&engine->lock);
+    }
+}
+
+// Pool job; the pool restores the thread's own role binding afterwards
+static void SteadyState_Job(void* param) {
+    SteadyStateWorker* worker = (SteadyStateWorker*)param;
+    SteadyStateRun* run = worker->run;
+
+    memset(&worker->role_ctx, 0, sizeof(worker->role_ctx));
+    worker->role_ctx.initialized = true;
+    RoleBoundary_Enter(&worker->role_ctx, "raijin.steady_state", ROLE_OWNER_RAIJIN);
+    RoleBoundary_BindThread(&worker->role_ctx);
+
+    SteadyState_Work(worker, run);
+
+    RoleBoundary_BindThread(NULL);
+    RoleBoundary_Exit(&worker->role_ctx, "raijin.steady_state");
+}
+
+NTSTATUS EvolutionEngine_RunSteadyState(EvolutionEngine* engine, uint32_t worker_count) {
+    if (!engine || !engine->initialized) return STATUS_INVALID_PARAMETER;
+    {
+        RoleBoundaryContext* rbc = RoleBoundary_GetGlobal();
+        if (rbc && !RoleBoundary_AssertRaijin(rbc))
+            return STATUS_ROLE_BOUNDARY_VIOLATION;
+    }
+    if (engine->population.size == 0) {
+        NTSTATUS status = EvolutionEngine_InitializePopulation(engine);
+        if (!NT_SUCCESS(status)) return status;
+    }
+    // One job per pool worker; more would only queue behind the others. The jobs last the
+    // whole run, so they are LOW: a thread joining some other group never picks one up
+    ThreadPool* pool = ThreadPool_GetGlobal();
+    uint32_t cores = ThreadPool_GetWorkerCount(pool);
+    if (worker_count == 0 || worker_count > cores) worker_count = cores;
+    if (worker_count > STEADY_STATE_MAX_WORKERS) worker_count = STEADY_STATE_MAX_WORKERS;
+
+    SteadyStateRun run;
+    memset(&run, 0, sizeof(run));
+    run.workers = (SteadyStateWorker*)calloc(worker_count, sizeof(SteadyStateWorker));
+    if (!run.workers) return STATUS_INSUFFICIENT_RESOURCES;
+
+    // Budget in generation-equivalents so max_generations keeps its meaning;
+    // evaluating the initial population counts against it
+    uint32_t size = engine->population.size;
+    uint32_t start_generation = engine->population.generation;
+    uint32_t generations = engine->params.max_generations > start_generation
+                         ? engine->params.max_generations - start_generation : 0;
+    run.evaluation_budget = (uint64_t)generations * size;
+    run.evaluations_done = (uint64_t)start_generation * size;
+    run.best_index = UINT32_MAX;
+
+    // Already-evaluated individuals (resumed runs) skip the initial pass
+    for (uint32_t i = 0; i < size; i++) {
+        EvolutionaryIndividual* individual = &engine->population.individuals[i];
+        if (!individual->evaluated) continue;
+        run.evaluated_count++;
+        run.fitness_sum += individual->fitness;
+        if (run.best_index == UINT32_MAX || individual->fitness > engine->population.individuals[run.best_index].fitness)
+            run.best_index = i;
+    }
+    if (run.evaluated_count == size) run.next_initial = (LONG)size;
+    run.evaluations_issued = size - run.evaluated_count;
+
+    printf("Starting steady-state evolution (%u workers)...\n", worker_count);
+    engine->running = true;
+
+    uint64_t wall_start = SteadyState_Ticks();
+    ThreadPoolGroup group;
+    memset(&group, 0, sizeof(group));
+    for (uint32_t i = 0; i < worker_count; i++) {
+        run.workers[i].engine = engine;
+        run.workers[i].run = &run;
+        ThreadPool_Submit(pool, SteadyState_Job, &run.workers[i], THREAD_POOL_PRIORITY_LOW, &group);
+    }
+    ThreadPool_Wait(pool, &group);
+    uint64_t wall_ticks = SteadyState_Ticks() - wall_start;
+
+    uint32_t started = worker_count;
+    uint64_t busy_ticks = 0;
+    uint32_t violations = 0;
+    for (uint32_t i = 0; i < started; i++) {
+        busy_ticks += run.workers[i].busy_ticks;
+        engine->stats.evaluations_performed += (uint32_t)run.workers[i].evaluations;
+        violations += RoleBoundary_GetViolationCount(&run.workers[i].role_ctx);
+        EvolutionEngine_FreeIndividual(engine, &run.workers[i].child);
+    }
+    free(run.workers);
+    {
+        RoleBoundaryContext* rbc = RoleBoundary_GetGlobal();
+        if (rbc) rbc->violation_count += violations;
+    }
+
+    // Final population statistics over whatever finished evaluating
+    double variance = 0.0;
+    if (run.evaluated_count > 0) {
+        for (uint32_t i = 0; i < size; i++) {
+            if (!engine->population.individuals[i].evaluated) continue;
+            double diff = engine->population.individuals[i].fitness - engine->population.average_fitness;
+            variance += diff * diff;
+        }
+        variance /= run.evaluated_count;
+    }
+    engine->population.fitness_variance = variance;
+
+    engine->stats.steady_state_workers = started;
+    engine->stats.worker_utilization = wall_ticks ? (double)busy_ticks / ((double)wall_ticks * started) : 0.0;
+    engine->stats.generations_completed = engine->population.generation;
+    engine->stats.best_fitness_achieved = engine->population.best_fitness;
+    engine->stats.average_fitness_final = engine->population.average_fitness;
+
+    printf("Steady-state evolution completed. Best fitness: %.4f, utilization %.1f%%\n",
+           engine->population.best_fitness, engine->stats.worker_utilization * 100.0);
+    return STATUS_SUCCESS;
 }
 
+// MAP-Elites: each batch breeds from uniformly sampled elites, then evaluates and
+// batch-inserts into the archive. The population array is only the batch buffer.
 NTSTATUS EvolutionEngine_RunQualityDiversity(EvolutionEngine* engine) {
+    if (engine->population.size == 0) {
+        NTSTATUS status = EvolutionEngine_InitializePopulation(engine);
+        if (!NT_SUCCESS(status)) return status;
+    }
+    if (!engine->qd_archive) {
+        NTSTATUS status = EvolutionEngine_EnableMapElites(engine, NULL);
+        if (!NT_SUCCESS(status)) return status;
+    }
+
+    MapElitesArchive* archive = engine->qd_archive;
+    uint32_t batch = engine->population.size;
+    uint32_t dim = archive->config.descriptor_dim;
+    size_t genome_size = archive->config.genome_size;
+
+    float* descriptors = (float*)malloc((size_t)batch * dim * sizeof(float));
+    double* fitness = (double*)malloc(batch * sizeof(double));
+    const void** genomes = (const void**)malloc(batch * sizeof(void*));
+    EvolutionaryIndividual** pending = (EvolutionaryIndividual**)malloc(batch * sizeof(EvolutionaryIndividual*));
+    EvolutionaryIndividual parents[2];
+    memset(parents, 0, sizeof(parents));
+    bool parents_ok = NT_SUCCESS(EvolutionEngine_AllocateIndividual(engine, &parents[0], genome_size)) &&
+                      NT_SUCCESS(EvolutionEngine_AllocateIndividual(engine, &parents[1], genome_size));
+    if (!descriptors || !fitness || !genomes || !pending || !parents_ok) {
+        free(descriptors);
+        free(fitness);
+        free(genomes);
+        free(pending);
+        EvolutionEngine_FreeIndividual(engine, &parents[0]);
+        EvolutionEngine_FreeIndividual(engine, &parents[1]);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    printf("Starting MAP-Elites evolution (%u cells)...\n", archive->cell_count);
+    MapElitesMetrics metrics;
+
+    while (engine->running && engine->population.generation < engine->params.max_generations) {
+        // Breed the batch from the archive; the first batch is the initial population
+        if (archive->filled_count > 0) {
+            for (uint32_t i = 0; i < batch; i++) {
+                uint32_t cell_a, cell_b;
+                if (!NT_SUCCESS(MapElites_SampleCell(archive, &engine->rng, &cell_a)) ||
+                    !NT_SUCCESS(MapElites_SampleCell(archive, &engine->rng, &cell_b))) break;
+                MapElites_ReadElite(archive, cell_a, parents[0].genome, &parents[0].fitness, NULL);
+                MapElites_ReadElite(archive, cell_b, parents[1].genome, &parents[1].fitness, NULL);
+
+                EvolutionaryIndividual* child = &engine->population.individuals[i];
+                EvolutionEngine_FreeIndividual(engine, child);
+                EvolutionEngine_CreateOffspring(engine, &parents[0], &parents[1], child);
+            }
+        }
+
+        uint32_t scored = 0;
+        for (uint32_t i = 0; i < batch; i++) {
+            EvolutionaryIndividual* individual = &engine->population.individuals[i];
+            if (individual->genome && individual->genome_size >= genome_size) pending[scored++] = individual;
+        }
+        EvaluateIndividuals(engine, pending, scored);
+
+        double total = 0.0;
+        double best = -DBL_MAX;
+        for (uint32_t i = 0; i < batch; i++) {
+            EvolutionaryIndividual* individual = &engine->population.individuals[i];
+            float* descriptor = descriptors + (size_t)i * dim;
+            if (!individual->genome || individual->genome_size < genome_size) {
+                genomes[i] = NULL;
+                fitness[i] = -DBL_MAX;
+                continue;
+            }
+            engine->behavior_function(individual->genome, individual->genome_size, descriptor, dim,
+                                      engine->behavior_context);
+            genomes[i] = individual->genome;
+            fitness[i] = individual->fitness;
+            total += individual->fitness;
+            if (individual->fitness > best) {
+                best = individual->fitness;
+                engine->population.best_individual = individual;
+            }
+        }
+        engine->stats.evaluations_performed += batch;
+        MapElites_InsertBatch(archive, genomes, descriptors, fitness, batch, NULL);
+
+        MapElites_GetMetrics(archive, &metrics);
+        engine->population.average_fitness = total / batch;
+        engine->population.best_fitness = metrics.best_fitness;
+        engine->population.generation++;
+
+        if (engine->population.generation % 10 == 0) {
+            printf("Generation %u: Best Fitness = %.4f, Coverage = %.1f%%, QD-Score = %.4f\n",
+                   engine->population.generation, metrics.best_fitness,
+                   metrics.coverage * 100.0, metrics.qd_score);
+        }
+        if (metrics.best_fitness >= engine->params.target_fitness) {
+            engine->stats.target_reached = true;
+            break;
+        }
+    }
+
+    MapElites_GetMetrics(archive, &metrics);
+    engine->stats.generations_completed = engine->population.generation;
+    engine->stats.best_fitness_achieved = metrics.best_fitness;
+    engine->stats.average_fitness_final = engine->population.average_fitness;
+
+    printf("MAP-Elites completed. Best fitness: %.4f, Coverage: %.1f%% (%u/%u), QD-Score: %.4f\n",
+           metrics.best_fitness, metrics.coverage * 100.0, metrics.filled, metrics.cells, metrics.qd_score);
+
+    free(descriptors);
+    free(fitness);
+    free(genomes);
+    free(pending);
+    EvolutionEngine_FreeIndividual(engine, &parents[0]);
+    EvolutionEngine_FreeIndividual(engine, &parents[1]);
+    return STATUS_SUCCESS;
+}
+
+// Stub implementations for other algorithms
+
+NTSTATUS EvolutionEngine_RunEvolutionStrategies(EvolutionEngine* engine) {
     UNREFERENCED_PARAMETER(engine);
     return STATUS_NOT_IMPLEMENTED;
 }
@@ -549,33 +1730,30 @@ uint64_t EvolutionEngine_GenerateIndividualId() {
     return GenerateIndividualId();
 }
 
+uint64_t EvolutionEngine_LastIndividualId() {
+    return (uint64_t)InterlockedCompareExchange64(&g_individual_id_counter, 0, 0);
+}
+
+void EvolutionEngine_ReserveIndividualIds(uint64_t last_id) {
+    LONG64 current = InterlockedCompareExchange64(&g_individual_id_counter, 0, 0);
+    while ((uint64_t)current < last_id) {
+        LONG64 seen = InterlockedCompareExchange64(&g_individual_id_counter, (LONG64)last_id, current);
+        if (seen == current) break;
+        current = seen;
+    }
+}
+
+// Whole population in O(n*d); see evolution_diversity.cpp
 double EvolutionEngine_CalculatePopulationDiversity(EvolutionEngine* engine) {
     if (engine->population.size < 2) return 0.0;
 
-    double total_distance = 0.0;
-    uint32_t comparisons = 0;
-
-    // Sample diversity (compare first 10 individuals)
-    uint32_t sample_size = (engine->population.size < 10) ? engine->population.size : 10;
-    for (uint32_t i = 0; i < sample_size; i++) {
-        for (uint32_t j = i + 1; j < sample_size; j++) {
-            double distance = 0.0;
-            double* genome1 = (double*)engine->population.individuals[i].genome;
-            double* genome2 = (double*)engine->population.individuals[j].genome;
-
-            size_t num_weights = engine->population.individuals[i].genome_size / sizeof(double);
-            for (size_t k = 0; k < num_weights; k++) {
-                double diff = genome1[k] - genome2[k];
-                distance += diff * diff;
-            }
-            distance = sqrt(distance);
-
-            total_distance += distance;
-            comparisons++;
-        }
+    EvolutionDiversityStats stats;
+    if (!NT_SUCCESS(EvolutionDiversity_Compute(engine->population.individuals,
+                                               engine->population.size, 0, &stats))) {
+        return engine->diversity.mean_pairwise_distance;
     }
-
-    return comparisons > 0 ? total_distance / comparisons : 0.0;
+    engine->diversity = stats;
+    return stats.mean_pairwise_distance;
 }
 
 bool EvolutionEngine_CheckTerminationCriteria(EvolutionEngine* engine) {
@@ -595,27 +1773,298 @@ NTSTATUS EvolutionEngine_ResumeEvolution(EvolutionEngine* engine) {
 }
 
 NTSTATUS EvolutionEngine_EnableSpeciation(EvolutionEngine* engine, uint32_t species_count) {
-    UNREFERENCED_PARAMETER(engine);
-    UNREFERENCED_PARAMETER(species_count);
-    return STATUS_NOT_IMPLEMENTED;
+    if (!engine) return STATUS_INVALID_PARAMETER;
+
+    if (!engine->species) {
+        engine->species = (EvolutionarySpecies*)calloc(EVOLUTION_SPECIES_MAX, sizeof(EvolutionarySpecies));
+        if (!engine->species) return STATUS_INSUFFICIENT_RESOURCES;
+        engine->species_capacity = EVOLUTION_SPECIES_MAX;
+        engine->species_count = 0;
+    }
+
+    if (species_count == 0) species_count = EVOLUTION_SPECIES_DEFAULT_TARGET;
+    if (species_count > engine->species_capacity) species_count = engine->species_capacity;
+    engine->params.speciation_enabled = true;
+    engine->params.species_count = species_count;
+    if (engine->params.compatibility_threshold <= 0.0) {
+        engine->params.compatibility_threshold = EVOLUTION_SPECIES_DEFAULT_THRESHOLD;
+    }
+    return STATUS_SUCCESS;
+}
+
+double EvolutionEngine_CompatibilityDistance(const void* genome1, size_t size1,
+                                           const void* genome2, size_t size2) {
+    if (!genome1 || !genome2) return DBL_MAX;
+    return Species_Distance(genome1, size1, genome2, size2, DBL_MAX);
+}
+
+// Assigns every individual to the first species whose representative is within the
+// compatibility threshold, founding new species as needed.
+NTSTATUS EvolutionEngine_Speciate(EvolutionEngine* engine) {
+    if (!engine || !engine->species) return STATUS_INVALID_DEVICE_STATE;
+
+    double threshold = engine->params.compatibility_threshold;
+    for (uint32_t s = 0; s < engine->species_count; s++) {
+        engine->species[s].member_count = 0;
+    }
+
+    for (uint32_t i = 0; i < engine->population.size; i++) {
+        EvolutionaryIndividual* individual = &engine->population.individuals[i];
+        int32_t target = -1;
+
+        for (uint32_t s = 0; s < engine->species_count; s++) {
+            EvolutionarySpecies* species = &engine->species[s];
+            double d = Species_Distance(individual->genome, individual->genome_size,
+                                        species->representative, species->representative_size,
+                                        threshold);
+            if (d < threshold) {
+                target = (int32_t)s;
+                break;
+            }
+        }
+
+        if (target < 0 && engine->species_count < engine->species_capacity) {
+            EvolutionarySpecies* species = &engine->species[engine->species_count];
+            memset(species, 0, sizeof(EvolutionarySpecies));
+            if (!NT_SUCCESS(Species_SetRepresentative(species, individual)))
+                return STATUS_INSUFFICIENT_RESOURCES;
+            species->id = ++engine->next_species_id;
+            target = (int32_t)engine->species_count++;
+        } else if (target < 0) {
+            // Every slot is taken: join the closest species
+            double closest = DBL_MAX;
+            for (uint32_t s = 0; s < engine->species_count; s++) {
+                EvolutionarySpecies* species = &engine->species[s];
+                double d = Species_Distance(individual->genome, individual->genome_size,
+                                            species->representative, species->representative_size,
+                                            closest);
+                if (d < closest) {
+                    closest = d;
+                    target = (int32_t)s;
+                }
+            }
+        }
+
+        NTSTATUS status = Species_AddMember(&engine->species[target], individual,
+                                            engine->population.max_size);
+        if (!NT_SUCCESS(status)) return status;
+    }
+
+    // Drop extinct species and pick fresh representatives from the survivors
+    uint32_t live = 0;
+    for (uint32_t s = 0; s < engine->species_count; s++) {
+        EvolutionarySpecies* species = &engine->species[s];
+        if (species->member_count == 0) {
+            Species_Release(species);
+            continue;
+        }
+        EvolutionaryIndividual* rep = species->members[EvolutionRng_NextBelow(&engine->rng, species->member_count)];
+        Species_SetRepresentative(species, rep);
+        if (live != s) {
+            engine->species[live] = *species;
+            memset(species, 0, sizeof(EvolutionarySpecies));
+        }
+        live++;
+    }
+    engine->species_count = live;
+
+    // Steer the threshold toward the requested number of species
+    if (engine->params.species_count > 0) {
+        if (engine->species_count < engine->params.species_count) {
+            engine->params.compatibility_threshold *= 0.95;
+        } else if (engine->species_count > engine->params.species_count) {
+            engine->params.compatibility_threshold *= 1.05;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionEngine_EnableMapElites(EvolutionEngine* engine, const MapElitesConfig* config) {
+    if (!engine) return STATUS_INVALID_PARAMETER;
+
+    MapElitesConfig defaults;
+    if (!config) {
+        size_t genome_size = (engine->population.size > 0 && engine->population.individuals[0].genome)
+                           ? engine->population.individuals[0].genome_size : 1000 * sizeof(double);
+        MapElites_DefaultConfig(&defaults, genome_size);
+        defaults.seed = engine->params.rng_seed;
+        config = &defaults;
+    }
+
+    MapElitesArchive* archive = (MapElitesArchive*)calloc(1, sizeof(MapElitesArchive));
+    if (!archive) return STATUS_INSUFFICIENT_RESOURCES;
+    NTSTATUS status = MapElites_Initialize(archive, config);
+    if (!NT_SUCCESS(status)) {
+        free(archive);
+        return status;
+    }
+
+    if (engine->qd_archive) {
+        MapElites_Shutdown(engine->qd_archive);
+        free(engine->qd_archive);
+    }
+    engine->qd_archive = archive;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionEngine_EnableSurrogate(EvolutionEngine* engine, const EvolutionSurrogateConfig* config) {
+    if (!engine) return STATUS_INVALID_PARAMETER;
+
+    size_t genome_size = (engine->population.size > 0 && engine->population.individuals[0].genome)
+                       ? engine->population.individuals[0].genome_size : 1000 * sizeof(double);
+    EvolutionSurrogateConfig defaults;
+    if (!config) {
+        memset(&defaults, 0, sizeof(defaults));
+        defaults.seed = engine->params.rng_seed;
+        config = &defaults;
+    }
+
+    EvolutionSurrogate* surrogate = (EvolutionSurrogate*)calloc(1, sizeof(EvolutionSurrogate));
+    double* predictions = (double*)malloc(engine->population.max_size * sizeof(double));
+    if (!surrogate || !predictions) {
+        free(surrogate);
+        free(predictions);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    NTSTATUS status = EvolutionSurrogate_Initialize(surrogate, config, (uint32_t)(genome_size / sizeof(double)));
+    if (!NT_SUCCESS(status)) {
+        free(surrogate);
+        free(predictions);
+        return status;
+    }
+    for (uint32_t i = 0; i < engine->population.max_size; i++) predictions[i] = NAN;
+
+    if (engine->surrogate) {
+        EvolutionSurrogate_Shutdown(engine->surrogate);
+        free(engine->surrogate);
+    }
+    free(engine->surrogate_predictions);
+    engine->surrogate = surrogate;
+    engine->surrogate_predictions = predictions;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionEngine_EnableCheckpoint(EvolutionEngine* engine, const char* path, uint32_t interval_generations) {
+    if (!engine || !path) return STATUS_INVALID_PARAMETER;
+
+    EvolutionCheckpointWriter* writer = (EvolutionCheckpointWriter*)calloc(1, sizeof(EvolutionCheckpointWriter));
+    if (!writer) return STATUS_INSUFFICIENT_RESOURCES;
+    NTSTATUS status = EvolutionCheckpointWriter_Initialize(writer, path, interval_generations);
+    if (!NT_SUCCESS(status)) {
+        free(writer);
+        return status;
+    }
+
+    if (engine->checkpoint) {
+        EvolutionCheckpointWriter_Shutdown(engine->checkpoint);
+        free(engine->checkpoint);
+    }
+    engine->checkpoint = writer;
+    return STATUS_SUCCESS;
 }
 
 NTSTATUS EvolutionEngine_EnableNoveltySearch(EvolutionEngine* engine, uint32_t archive_size) {
-    UNREFERENCED_PARAMETER(engine);
-    UNREFERENCED_PARAMETER(archive_size);
-    return STATUS_NOT_IMPLEMENTED;
+    if (!engine) return STATUS_INVALID_PARAMETER;
+
+    NoveltyArchive* archive = &engine->novelty_archive;
+    uint32_t dim = archive->descriptor_dim ? archive->descriptor_dim : EVOLUTION_NOVELTY_DEFAULT_DIM;
+    if (archive_size == 0) archive_size = NOVELTY_DEFAULT_ARCHIVE_SIZE;
+
+    float* descriptors = (float*)malloc((size_t)archive_size * dim * sizeof(float));
+    double* scores = (double*)malloc(archive_size * sizeof(double));
+    if (!descriptors || !scores) {
+        free(descriptors);
+        free(scores);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    free(archive->descriptors);
+    free(archive->novelty_scores);
+    memset(archive, 0, sizeof(NoveltyArchive));
+    archive->descriptors = descriptors;
+    archive->novelty_scores = scores;
+    archive->max_size = archive_size;
+    archive->descriptor_dim = dim;
+    archive->k_neighbors = EVOLUTION_NOVELTY_DEFAULT_K;
+
+    // Descriptor rows may have changed width
+    free(engine->population_descriptors);
+    free(engine->population_novelty);
+    engine->population_descriptors = NULL;
+    engine->population_novelty = NULL;
+    engine->population_descriptor_capacity = 0;
+
+    engine->params.novelty_search = true;
+    if (engine->params.novelty_weight <= 0.0) {
+        engine->params.novelty_weight = 0.5;
+    }
+    return STATUS_SUCCESS;
 }
 
 NTSTATUS EvolutionEngine_AddToNoveltyArchive(EvolutionEngine* engine, void* behavior) {
-    UNREFERENCED_PARAMETER(engine);
-    UNREFERENCED_PARAMETER(behavior);
-    return STATUS_NOT_IMPLEMENTED;
+    if (!engine || !behavior) return STATUS_INVALID_PARAMETER;
+    if (!engine->novelty_archive.descriptors) return STATUS_INVALID_DEVICE_STATE;
+
+    double novelty = EvolutionEngine_CalculateNovelty(engine, behavior);
+    NoveltyArchive_Insert(&engine->novelty_archive, (const float*)behavior, novelty);
+    return STATUS_SUCCESS;
 }
 
 double EvolutionEngine_CalculateNovelty(EvolutionEngine* engine, void* behavior) {
-    UNREFERENCED_PARAMETER(engine);
-    UNREFERENCED_PARAMETER(behavior);
-    return 0.0;
+    double novelty = 0.0;
+    if (!NT_SUCCESS(EvolutionEngine_CalculateNoveltyBatch(engine, (const float*)behavior, 1, &novelty))) {
+        return 0.0;
+    }
+    return novelty;
+}
+
+// Novelty of each behavior is its mean distance to the k nearest neighbors
+// drawn from the archive and the rest of the batch.
+NTSTATUS EvolutionEngine_CalculateNoveltyBatch(EvolutionEngine* engine,
+                                             const float* behaviors,
+                                             uint32_t count,
+                                             double* novelty_out) {
+    if (!engine || !behaviors || !novelty_out) return STATUS_INVALID_PARAMETER;
+    NoveltyArchive* archive = &engine->novelty_archive;
+    if (!archive->descriptors || archive->descriptor_dim == 0) return STATUS_INVALID_DEVICE_STATE;
+    if (count == 0) return STATUS_SUCCESS;
+
+    uint32_t k = archive->k_neighbors ? archive->k_neighbors : 1;
+    float* heaps = (float*)malloc((size_t)count * k * sizeof(float));
+    uint32_t* heap_sizes = (uint32_t*)calloc(count, sizeof(uint32_t));
+    if (!heaps || !heap_sizes) {
+        free(heaps);
+        free(heap_sizes);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    Novelty_KnnScan(behaviors, count, archive->descriptors, archive->size,
+                    archive->descriptor_dim, k, false, heaps, heap_sizes);
+    Novelty_KnnScan(behaviors, count, behaviors, count,
+                    archive->descriptor_dim, k, true, heaps, heap_sizes);
+
+    for (uint32_t q = 0; q < count; q++) {
+        const float* heap = heaps + (size_t)q * k;
+        double sum = 0.0;
+        for (uint32_t j = 0; j < heap_sizes[q]; j++) {
+            sum += sqrt((double)heap[j]);
+        }
+        novelty_out[q] = heap_sizes[q] ? sum / heap_sizes[q] : 0.0;
+    }
+
+    free(heaps);
+    free(heap_sizes);
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionEngine_SetBehaviorFunction(EvolutionEngine* engine,
+                                           void (*behavior_func)(const void*, size_t, float*, uint32_t, void*),
+                                           void* context) {
+    if (!engine) return STATUS_INVALID_PARAMETER;
+    engine->behavior_function = behavior_func ? behavior_func : BehaviorDescriptor_BlockMean;
+    engine->behavior_context = behavior_func ? context : NULL;
+    return STATUS_SUCCESS;
 }
 
 NTSTATUS EvolutionEngine_SetFitnessFunction(EvolutionEngine* engine,
@@ -623,6 +2072,18 @@ NTSTATUS EvolutionEngine_SetFitnessFunction(EvolutionEngine* engine,
                                           void* context) {
     engine->fitness_function = fitness_func;
     engine->fitness_context = context;
+    // A new per-genome function has no batched form until one is registered for it
+    engine->batch_fitness_function = NULL;
+    engine->batch_fitness_context = NULL;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionEngine_SetBatchFitnessFunction(EvolutionEngine* engine,
+                                               NTSTATUS (*batch_func)(void* const*, const size_t*, uint32_t,
+                                                                      double*, void*),
+                                               void* context) {
+    engine->batch_fitness_function = batch_func;
+    engine->batch_fitness_context = context;
     return STATUS_SUCCESS;
 }
 
@@ -0,0 +1,583 @@
+/*
+ * Evolution Islands - Raijin
+ * Owner: Core/Evolution
+ * Inputs: IslandModelConfig, EvolutionParameters, fitness callback (thread mode)
+ * Outputs: Per-island IslandStatus, best genome across islands
+ * Invariants: One shared block (malloc or named mapping) holds all cross-island state;
+ *             mailboxes are bounded lock-free queues, a full mailbox drops the migrant
+ * Budget: One low-priority pool job or one process per island, each with its own substrate
+ *         replica; migration copies a few genomes per interval
+ * Failure modes: Worker process spawn failure -> Run returns error after stopping started islands
+ * Recovery: Islands are independent; a dead process worker only loses its own sub-population
+ */
+
+#include "../../Include/evolution_islands.h"
+#include "../../Include/raijin_ntstatus.h"
+#include "../../Include/thread_pool.h"
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+
+#define ISLAND_SHARED_MAGIC 0x444E4C49u  /* "ILND" */
+#define ISLAND_CACHE_LINE 64
+#define ISLAND_DEFAULT_GENOME_SIZE (1000 * sizeof(double))
+
+typedef struct IslandSharedHeader {
+    uint32_t magic;
+    uint32_t island_count;
+    uint32_t mailbox_slots;
+    uint32_t migration_interval;
+    uint32_t migrants_per_exchange;
+    uint32_t topology;
+    uint32_t generations;
+    uint32_t use_neural;
+    uint64_t genome_size;
+    uint64_t cell_stride;
+    uint64_t mailbox_stride;
+    uint64_t mailbox_offset;
+    uint64_t best_offset;
+    uint64_t seed;
+    EvolutionParameters params;
+    volatile LONG stop;
+    IslandStatus status[EVOLUTION_ISLANDS_MAX];
+} IslandSharedHeader;
+
+/* Bounded MPMC queue (Vyukov): each cell's sequence tells producers and consumers whose turn it is */
+typedef struct IslandMailbox {
+    volatile LONG64 enqueue_pos;
+    uint8_t pad0[ISLAND_CACHE_LINE - sizeof(LONG64)];
+    volatile LONG64 dequeue_pos;
+    uint8_t pad1[ISLAND_CACHE_LINE - sizeof(LONG64)];
+} IslandMailbox;
+
+typedef struct IslandCell {
+    volatile LONG64 sequence;
+    double fitness;
+    uint64_t id;
+    uint64_t reserved;
+    /* genome bytes follow */
+} IslandCell;
+
+static size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static LONG64 AtomicLoad64(volatile LONG64* p) {
+    return InterlockedCompareExchange64(p, 0, 0);
+}
+
+static IslandSharedHeader* Shared_Header(uint8_t* shared) {
+    return (IslandSharedHeader*)shared;
+}
+
+static IslandMailbox* Shared_Mailbox(uint8_t* shared, uint32_t island) {
+    IslandSharedHeader* hdr = Shared_Header(shared);
+    return (IslandMailbox*)(shared + hdr->mailbox_offset + (size_t)island * hdr->mailbox_stride);
+}
+
+static IslandCell* Mailbox_Cell(IslandSharedHeader* hdr, IslandMailbox* box, uint64_t pos) {
+    uint8_t* cells = (uint8_t*)box + sizeof(IslandMailbox);
+    return (IslandCell*)(cells + (size_t)(pos & (hdr->mailbox_slots - 1)) * hdr->cell_stride);
+}
+
+static uint8_t* Shared_BestGenome(uint8_t* shared, uint32_t island) {
+    IslandSharedHeader* hdr = Shared_Header(shared);
+    return shared + hdr->best_offset + (size_t)island * AlignUp((size_t)hdr->genome_size, ISLAND_CACHE_LINE);
+}
+
+static size_t Shared_ComputeLayout(uint32_t island_count, size_t genome_size,
+                                   uint64_t* cell_stride, uint64_t* mailbox_stride,
+                                   uint64_t* mailbox_offset, uint64_t* best_offset) {
+    *cell_stride = AlignUp(sizeof(IslandCell) + genome_size, ISLAND_CACHE_LINE);
+    *mailbox_stride = AlignUp(sizeof(IslandMailbox) + EVOLUTION_ISLAND_MAILBOX_SLOTS * (size_t)*cell_stride,
+                              ISLAND_CACHE_LINE);
+    *mailbox_offset = AlignUp(sizeof(IslandSharedHeader), ISLAND_CACHE_LINE);
+    *best_offset = *mailbox_offset + (size_t)island_count * *mailbox_stride;
+    return (size_t)*best_offset + (size_t)island_count * AlignUp(genome_size, ISLAND_CACHE_LINE);
+}
+
+static void Shared_Format(uint8_t* shared, const EvolutionIslandModel* model, size_t genome_size) {
+    IslandSharedHeader* hdr = Shared_Header(shared);
+    hdr->magic = ISLAND_SHARED_MAGIC;
+    hdr->island_count = model->config.island_count;
+    hdr->mailbox_slots = EVOLUTION_ISLAND_MAILBOX_SLOTS;
+    hdr->migration_interval = model->config.migration_interval;
+    hdr->migrants_per_exchange = model->config.migrants_per_exchange;
+    hdr->topology = (uint32_t)model->config.topology;
+    hdr->generations = model->config.generations;
+    hdr->use_neural = model->neural ? 1 : 0;
+    hdr->genome_size = genome_size;
+    Shared_ComputeLayout(hdr->island_count, genome_size, &hdr->cell_stride, &hdr->mailbox_stride,
+                         &hdr->mailbox_offset, &hdr->best_offset);
+    hdr->seed = model->config.seed;
+    hdr->params = model->params;
+    hdr->stop = 0;
+
+    for (uint32_t i = 0; i < hdr->island_count; i++) {
+        IslandMailbox* box = Shared_Mailbox(shared, i);
+        box->enqueue_pos = 0;
+        box->dequeue_pos = 0;
+        for (uint32_t slot = 0; slot < hdr->mailbox_slots; slot++) {
+            Mailbox_Cell(hdr, box, slot)->sequence = slot;
+        }
+        hdr->status[i].best_fitness = -DBL_MAX;
+    }
+}
+
+static bool Mailbox_Push(IslandSharedHeader* hdr, IslandMailbox* box, const EvolutionaryIndividual* individual) {
+    LONG64 pos = AtomicLoad64(&box->enqueue_pos);
+    for (;;) {
+        IslandCell* cell = Mailbox_Cell(hdr, box, (uint64_t)pos);
+        LONG64 dif = AtomicLoad64(&cell->sequence) - pos;
+        if (dif == 0) {
+            if (InterlockedCompareExchange64(&box->enqueue_pos, pos + 1, pos) == pos) {
+                size_t bytes = individual->genome_size < hdr->genome_size ?
+                    individual->genome_size : (size_t)hdr->genome_size;
+                cell->fitness = individual->fitness;
+                cell->id = individual->id;
+                memcpy((uint8_t*)(cell + 1), individual->genome, bytes);
+                InterlockedExchange64(&cell->sequence, pos + 1);
+                return true;
+            }
+            pos = AtomicLoad64(&box->enqueue_pos);
+        } else if (dif < 0) {
+            return false;
+        } else {
+            pos = AtomicLoad64(&box->enqueue_pos);
+        }
+    }
+}
+
+static bool Mailbox_Pop(IslandSharedHeader* hdr, IslandMailbox* box, EvolutionaryIndividual* into) {
+    LONG64 pos = AtomicLoad64(&box->dequeue_pos);
+    for (;;) {
+        IslandCell* cell = Mailbox_Cell(hdr, box, (uint64_t)pos);
+        LONG64 dif = AtomicLoad64(&cell->sequence) - (pos + 1);
+        if (dif == 0) {
+            if (InterlockedCompareExchange64(&box->dequeue_pos, pos + 1, pos) == pos) {
+                size_t bytes = into->genome_size < hdr->genome_size ?
+                    into->genome_size : (size_t)hdr->genome_size;
+                memcpy(into->genome, (uint8_t*)(cell + 1), bytes);
+                into->fitness = cell->fitness;
+                into->adjusted_fitness = cell->fitness;
+                into->id = cell->id;
+                into->age = 0;
+                into->evaluated = true;
+                InterlockedExchange64(&cell->sequence, pos + (LONG64)hdr->mailbox_slots);
+                return true;
+            }
+            pos = AtomicLoad64(&box->dequeue_pos);
+        } else if (dif < 0) {
+            return false;
+        } else {
+            pos = AtomicLoad64(&box->dequeue_pos);
+        }
+    }
+}
+
+static uint64_t Island_NextRandom(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+/* Indices of the best `count` individuals by fitness (count is small) */
+static uint32_t Island_SelectBest(const EvolutionEngine* engine, uint32_t* out, uint32_t count) {
+    uint32_t picked = 0;
+    while (picked < count && picked < engine->population.size) {
+        int64_t best = -1;
+        for (uint32_t i = 0; i < engine->population.size; i++) {
+            bool taken = false;
+            for (uint32_t j = 0; j < picked; j++) {
+                if (out[j] == i) { taken = true; break; }
+            }
+            if (taken) continue;
+            if (best < 0 || engine->population.individuals[i].fitness >
+                            engine->population.individuals[best].fitness) {
+                best = i;
+            }
+        }
+        out[picked++] = (uint32_t)best;
+    }
+    return picked;
+}
+
+static uint32_t Island_SelectWorst(const EvolutionEngine* engine) {
+    uint32_t worst = 0;
+    for (uint32_t i = 1; i < engine->population.size; i++) {
+        if (engine->population.individuals[i].fitness < engine->population.individuals[worst].fitness)
+            worst = i;
+    }
+    return worst;
+}
+
+static void Island_Emigrate(uint8_t* shared, uint32_t index, EvolutionEngine* engine, uint64_t* rng) {
+    IslandSharedHeader* hdr = Shared_Header(shared);
+    IslandStatus* status = &hdr->status[index];
+    uint32_t n = hdr->island_count;
+    if (n < 2) return;
+
+    uint32_t best[EVOLUTION_ISLAND_MAILBOX_SLOTS];
+    uint32_t want = hdr->migrants_per_exchange;
+    if (want > EVOLUTION_ISLAND_MAILBOX_SLOTS) want = EVOLUTION_ISLAND_MAILBOX_SLOTS;
+    uint32_t count = Island_SelectBest(engine, best, want);
+
+    for (uint32_t dest = 0; dest < n; dest++) {
+        bool send;
+        switch ((IslandTopology)hdr->topology) {
+            case ISLAND_TOPOLOGY_FULL:
+                send = dest != index;
+                break;
+            case ISLAND_TOPOLOGY_RANDOM:
+                send = false;
+                break;
+            default:
+                send = dest == (index + 1) % n;
+                break;
+        }
+        if (!send) continue;
+        for (uint32_t m = 0; m < count; m++) {
+            if (Mailbox_Push(hdr, Shared_Mailbox(shared, dest), &engine->population.individuals[best[m]]))
+                status->migrants_sent++;
+            else
+                status->migrants_dropped++;
+        }
+    }
+
+    if ((IslandTopology)hdr->topology == ISLAND_TOPOLOGY_RANDOM) {
+        uint32_t dest = (uint32_t)(Island_NextRandom(rng) % (n - 1));
+        if (dest >= index) dest++;
+        for (uint32_t m = 0; m < count; m++) {
+            if (Mailbox_Push(hdr, Shared_Mailbox(shared, dest), &engine->population.individuals[best[m]]))
+                status->migrants_sent++;
+            else
+                status->migrants_dropped++;
+        }
+    }
+}
+
+static void Island_Immigrate(uint8_t* shared, uint32_t index, EvolutionEngine* engine) {
+    IslandSharedHeader* hdr = Shared_Header(shared);
+    IslandMailbox* box = Shared_Mailbox(shared, index);
+    uint32_t received = 0;
+
+    while (received < engine->population.size) {
+        EvolutionaryIndividual* worst = &engine->population.individuals[Island_SelectWorst(engine)];
+        if (!Mailbox_Pop(hdr, box, worst)) break;
+        received++;
+    }
+    hdr->status[index].migrants_received += received;
+
+    // Refresh best/average after replacement; migrants arrive already evaluated
+    if (received > 0) EvolutionEngine_EvaluatePopulation(engine);
+}
+
+/* One island's generational loop; shared by thread and process workers */
+static void Island_Run(uint8_t* shared, uint32_t index, EvolutionEngine* engine) {
+    IslandSharedHeader* hdr = Shared_Header(shared);
+    IslandStatus* status = &hdr->status[index];
+    uint64_t rng = hdr->seed * 0x9E3779B97F4A7C15ull + index + 1;
+    uint32_t interval = hdr->migration_interval ? hdr->migration_interval : 1;
+
+    srand((unsigned int)(hdr->seed + index));
+    EvolutionRng_Seed(&engine->rng, hdr->seed * 0xD1B54A32D192ED03ull + index + 1);
+    engine->running = true;
+    while (!hdr->stop && engine->population.generation < hdr->generations) {
+        EvolutionEngine_EvaluatePopulation(engine);
+
+        if (engine->population.generation > 0 && engine->population.generation % interval == 0) {
+            Island_Emigrate(shared, index, engine, &rng);
+            Island_Immigrate(shared, index, engine);
+        }
+
+        if (engine->population.best_fitness > status->best_fitness) {
+            status->best_fitness = engine->population.best_fitness;
+            EvolutionaryIndividual* best = engine->population.best_individual;
+            if (best && best->genome) {
+                size_t bytes = best->genome_size < hdr->genome_size ? best->genome_size : (size_t)hdr->genome_size;
+                memcpy(Shared_BestGenome(shared, index), best->genome, bytes);
+            }
+        }
+        status->generation = engine->population.generation;
+
+        if (engine->population.best_fitness >= engine->params.target_fitness) break;
+        if (!NT_SUCCESS(EvolutionEngine_NextGeneration(engine))) break;
+    }
+    engine->running = false;
+    InterlockedExchange(&status->done, 1);
+}
+
+// Runs for the whole island, so it is queued LOW: a thread joining some other group never picks it up
+static void Island_Job(void* context) {
+    EvolutionIsland* island = (EvolutionIsland*)context;
+    EvolutionIslandModel* model = island->model;
+
+    memset(&island->role_ctx, 0, sizeof(island->role_ctx));
+    island->role_ctx.initialized = true;
+    RoleBoundary_Enter(&island->role_ctx, "raijin.island", ROLE_OWNER_RAIJIN);
+    RoleBoundary_BindThread(&island->role_ctx);
+
+    Island_Run(model->shared, island->index, &island->engine);
+
+    RoleBoundary_BindThread(NULL);
+    RoleBoundary_Exit(&island->role_ctx, "raijin.island");
+}
+
+static NTSTATUS Island_CreateEngine(EvolutionEngine* engine, const EvolutionParameters* params,
+                                    NeuralSubstrate* neural, EthicsSystem* ethics) {
+    memset(engine, 0, sizeof(EvolutionEngine));
+    NTSTATUS status = EvolutionEngine_Initialize(engine, (EvolutionParameters*)params, neural, ethics);
+    if (!NT_SUCCESS(status)) return status;
+    return EvolutionEngine_InitializePopulation(engine);
+}
+
+NTSTATUS EvolutionIslands_Initialize(EvolutionIslandModel* model, const IslandModelConfig* config,
+    const EvolutionParameters* params, NeuralSubstrate* neural, EthicsSystem* ethics) {
+    if (!model || !config || !params) return STATUS_INVALID_PARAMETER;
+    if (config->island_count == 0 || config->island_count > EVOLUTION_ISLANDS_MAX) return STATUS_INVALID_PARAMETER;
+    if (model->initialized) return STATUS_SUCCESS;
+
+    memset(model, 0, sizeof(EvolutionIslandModel));
+    model->config = *config;
+    if (model->config.migration_interval == 0) model->config.migration_interval = 10;
+    if (model->config.migrants_per_exchange == 0) model->config.migrants_per_exchange = 2;
+    if (model->config.generations == 0) model->config.generations = params->max_generations;
+    if (model->config.genome_size == 0) model->config.genome_size = ISLAND_DEFAULT_GENOME_SIZE;
+    model->params = *params;
+    if (model->config.population_per_island > 0)
+        model->params.population_size = model->config.population_per_island;
+    model->params.max_generations = model->config.generations;
+    model->neural = neural;
+    model->ethics = ethics;
+    model->best_fitness = -DBL_MAX;
+
+    uint64_t cell_stride, mailbox_stride, mailbox_offset, best_offset;
+    model->shared_size = Shared_ComputeLayout(model->config.island_count, model->config.genome_size,
+                                              &cell_stride, &mailbox_stride, &mailbox_offset, &best_offset);
+
+    if (model->config.use_processes) {
+        snprintf(model->mapping_name, sizeof(model->mapping_name), "Local\\RaijinIslands_%lu_%llu",
+                 (unsigned long)GetCurrentProcessId(), (unsigned long long)GetTickCount64());
+        model->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+                                            (DWORD)((uint64_t)model->shared_size >> 32),
+                                            (DWORD)(model->shared_size & 0xFFFFFFFF), model->mapping_name);
+        if (!model->mapping) return STATUS_INSUFFICIENT_RESOURCES;
+        model->shared = (uint8_t*)MapViewOfFile(model->mapping, FILE_MAP_ALL_ACCESS, 0, 0, model->shared_size);
+        if (!model->shared) {
+            CloseHandle(model->mapping);
+            model->mapping = NULL;
+            return STATUS_INSUFFICIENT_RESOURCES;
+        }
+        memset(model->shared, 0, model->shared_size);
+    } else {
+        model->shared = (uint8_t*)calloc(1, model->shared_size);
+        if (!model->shared) return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    Shared_Format(model->shared, model, model->config.genome_size);
+
+    model->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void EvolutionIslands_Shutdown(EvolutionIslandModel* model) {
+    if (!model || !model->initialized) return;
+    EvolutionIslands_Stop(model);
+
+    if (model->islands) {
+        for (uint32_t i = 0; i < model->config.island_count; i++) {
+            EvolutionIsland* island = &model->islands[i];
+            if (island->engine.initialized) EvolutionEngine_Shutdown(&island->engine);
+            if (island->neural) {
+                if (island->neural->initialized) NeuralSubstrate_Shutdown(island->neural);
+                free(island->neural);
+            }
+        }
+        free(model->islands);
+        model->islands = NULL;
+    }
+
+    if (model->mapping) {
+        UnmapViewOfFile(model->shared);
+        CloseHandle(model->mapping);
+        model->mapping = NULL;
+    } else {
+        free(model->shared);
+    }
+    model->shared = NULL;
+    model->initialized = false;
+}
+
+NTSTATUS EvolutionIslands_SetFitnessFunction(EvolutionIslandModel* model,
+    double (*fitness_func)(void*, size_t, void*), void* context) {
+    if (!model || !model->initialized) return STATUS_INVALID_PARAMETER;
+    if (model->config.use_processes) return STATUS_NOT_SUPPORTED;
+    model->fitness_function = fitness_func;
+    model->fitness_context = context;
+    return STATUS_SUCCESS;
+}
+
+static NTSTATUS Islands_RunThreads(EvolutionIslandModel* model) {
+    uint32_t n = model->config.island_count;
+    model->islands = (EvolutionIsland*)calloc(n, sizeof(EvolutionIsland));
+    if (!model->islands) return STATUS_INSUFFICIENT_RESOURCES;
+
+    for (uint32_t i = 0; i < n; i++) {
+        EvolutionIsland* island = &model->islands[i];
+        island->index = i;
+        island->model = model;
+        // Process evaluates through the substrate's activations, so islands cannot share one
+        NTSTATUS status = STATUS_SUCCESS;
+        if (model->neural) {
+            island->neural = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+            status = island->neural ? NeuralSubstrate_CreateReplica(island->neural, model->neural)
+                                    : STATUS_INSUFFICIENT_RESOURCES;
+        }
+        if (NT_SUCCESS(status))
+            status = Island_CreateEngine(&island->engine, &model->params, island->neural, model->ethics);
+        if (!NT_SUCCESS(status)) return status;
+        if (model->fitness_function)
+            EvolutionEngine_SetFitnessFunction(&island->engine, model->fitness_function, model->fitness_context);
+    }
+
+    // Islands never wait on each other, so more islands than pool workers just run in turns
+    ThreadPool* pool = ThreadPool_GetGlobal();
+    ThreadPoolGroup group;
+    memset(&group, 0, sizeof(group));
+    for (uint32_t i = 0; i < n; i++)
+        ThreadPool_Submit(pool, Island_Job, &model->islands[i], THREAD_POOL_PRIORITY_LOW, &group);
+    ThreadPool_Wait(pool, &group);
+    for (uint32_t i = 0; i < n; i++)
+        model->role_violations += RoleBoundary_GetViolationCount(&model->islands[i].role_ctx);
+
+    RoleBoundaryContext* rbc = RoleBoundary_GetGlobal();
+    if (rbc) rbc->violation_count += model->role_violations;
+    return STATUS_SUCCESS;
+}
+
+static NTSTATUS Islands_RunProcesses(EvolutionIslandModel* model) {
+    uint32_t n = model->config.island_count;
+    char exe_path[MAX_PATH];
+    if (GetModuleFileNameA(NULL, exe_path, MAX_PATH) == 0) return STATUS_UNSUCCESSFUL;
+
+    HANDLE processes[EVOLUTION_ISLANDS_MAX];
+    uint32_t started = 0;
+    NTSTATUS result = STATUS_SUCCESS;
+    for (uint32_t i = 0; i < n; i++) {
+        char cmdline[MAX_PATH + 128];
+        snprintf(cmdline, sizeof(cmdline), "\"%s\" --island-worker %s %u", exe_path, model->mapping_name, i);
+        STARTUPINFOA si;
+        PROCESS_INFORMATION pi;
+        memset(&si, 0, sizeof(si));
+        memset(&pi, 0, sizeof(pi));
+        si.cb = sizeof(si);
+        if (!CreateProcessA(NULL, cmdline, NULL, NULL, FALSE, 0, NULL, NULL, &si, &pi)) {
+            Shared_Header(model->shared)->stop = 1;
+            result = STATUS_UNSUCCESSFUL;
+            break;
+        }
+        CloseHandle(pi.hThread);
+        processes[started++] = pi.hProcess;
+    }
+
+    if (started > 0) WaitForMultipleObjects(started, processes, TRUE, INFINITE);
+    for (uint32_t i = 0; i < started; i++) {
+        DWORD exit_code = 0;
+        if (GetExitCodeProcess(processes[i], &exit_code) && exit_code != 0)
+            result = STATUS_UNSUCCESSFUL;
+        CloseHandle(processes[i]);
+    }
+    return result;
+}
+
+NTSTATUS EvolutionIslands_Run(EvolutionIslandModel* model) {
+    if (!model || !model->initialized) return STATUS_INVALID_PARAMETER;
+    if (model->running) return STATUS_INVALID_DEVICE_STATE;
+    model->running = true;
+
+    NTSTATUS status = model->config.use_processes ? Islands_RunProcesses(model) : Islands_RunThreads(model);
+
+    IslandSharedHeader* hdr = Shared_Header(model->shared);
+    model->best_fitness = -DBL_MAX;
+    for (uint32_t i = 0; i < hdr->island_count; i++) {
+        if (hdr->status[i].best_fitness > model->best_fitness) {
+            model->best_fitness = hdr->status[i].best_fitness;
+            model->best_island = i;
+        }
+    }
+
+    model->running = false;
+    return status;
+}
+
+NTSTATUS EvolutionIslands_Stop(EvolutionIslandModel* model) {
+    if (!model || !model->shared) return STATUS_INVALID_PARAMETER;
+    InterlockedExchange(&Shared_Header(model->shared)->stop, 1);
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionIslands_GetStatus(const EvolutionIslandModel* model, uint32_t island, IslandStatus* out) {
+    if (!model || !model->shared || !out) return STATUS_INVALID_PARAMETER;
+    if (island >= model->config.island_count) return STATUS_INVALID_PARAMETER;
+    memcpy(out, &Shared_Header(model->shared)->status[island], sizeof(IslandStatus));
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionIslands_GetBest(const EvolutionIslandModel* model, double* fitness,
+    void* genome_out, size_t genome_size) {
+    if (!model || !model->shared) return STATUS_INVALID_PARAMETER;
+    if (model->best_fitness == -DBL_MAX) return STATUS_NOT_FOUND;
+    if (fitness) *fitness = model->best_fitness;
+    if (genome_out) {
+        size_t bytes = genome_size < model->config.genome_size ? genome_size : model->config.genome_size;
+        memcpy(genome_out, Shared_BestGenome(model->shared, model->best_island), bytes);
+    }
+    return STATUS_SUCCESS;
+}
+
+int EvolutionIslands_WorkerMain(const char* mapping_name, uint32_t index) {
+    if (!mapping_name) return 1;
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, mapping_name);
+    if (!mapping) return 1;
+
+    uint8_t* shared = (uint8_t*)MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!shared) {
+        CloseHandle(mapping);
+        return 1;
+    }
+
+    IslandSharedHeader* hdr = Shared_Header(shared);
+    int exit_code = 1;
+    if (hdr->magic == ISLAND_SHARED_MAGIC && index < hdr->island_count) {
+        NeuralSubstrate* neural = NULL;
+        if (hdr->use_neural) {
+            neural = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+            if (neural && !NT_SUCCESS(NeuralSubstrate_Initialize(neural))) {
+                free(neural);
+                neural = NULL;
+            }
+        }
+
+        EvolutionEngine* engine = (EvolutionEngine*)malloc(sizeof(EvolutionEngine));
+        if (engine && NT_SUCCESS(Island_CreateEngine(engine, &hdr->params, neural, NULL))) {
+            Island_Run(shared, index, engine);
+            exit_code = 0;
+        }
+        if (engine) {
+            if (engine->initialized) EvolutionEngine_Shutdown(engine);
+            free(engine);
+        }
+        if (neural) {
+            NeuralSubstrate_Shutdown(neural);
+            free(neural);
+        }
+    }
+
+    UnmapViewOfFile(shared);
+    CloseHandle(mapping);
+    return exit_code;
+}
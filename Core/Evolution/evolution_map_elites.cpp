@@ -0,0 +1,445 @@
+/*
+ * MAP-Elites Archive - Raijin
+ * Owner: Core/Evolution
+ * Inputs: Genomes with fitness and behavior descriptors (batches, any thread)
+ * Outputs: Per-cell elites, QD-score and coverage
+ * Invariants: A cell's fitness only increases; a published elite's genome, descriptor and
+ *             fitness always belong together (seqlock); the filled list never shrinks
+ * Budget: Grid lookup O(dim); CVT lookup O(candidates) through a precomputed table
+ *         (falls back to a full centroid scan where the table has no bound)
+ * Failure modes: Allocation failure at Initialize; NaN fitness (rejected)
+ * Recovery: Initialize leaves the archive uninitialized; callers may retry with a smaller config
+ */
+
+#include "../../Include/evolution_map_elites.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#define CVT_SAMPLES_PER_CELL 20
+#define CVT_MAX_SAMPLES 100000
+#define CVT_LOOKUP_MAX_CELLS 65536
+#define CVT_LOOKUP_BUILD_BUDGET (1u << 27)   /* lookup cells x centroids x dim */
+
+static LONG64 AtomicLoad64(volatile LONG64* p) {
+    return InterlockedCompareExchange64(p, 0, 0);
+}
+
+// Order-preserving map from double to uint64; 0 is below every finite value and marks empty
+static inline uint64_t FitnessKey(double fitness) {
+    uint64_t bits;
+    memcpy(&bits, &fitness, sizeof(bits));
+    return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+}
+
+static inline float SquaredDistance(const float* a, const float* b, uint32_t dim) {
+    float sum = 0.0f;
+    for (uint32_t k = 0; k < dim; k++) {
+        float d = a[k] - b[k];
+        sum += d * d;
+    }
+    return sum;
+}
+
+static uint32_t NearestCentroid(const float* centroids, uint32_t count, uint32_t dim,
+                                const float* point, const uint32_t* subset, uint32_t subset_count) {
+    uint32_t best = 0;
+    float best_dist = FLT_MAX;
+    uint32_t n = subset ? subset_count : count;
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t c = subset ? subset[i] : i;
+        float d = SquaredDistance(centroids + (size_t)c * dim, point, dim);
+        if (d < best_dist) {
+            best_dist = d;
+            best = c;
+        }
+    }
+    return best;
+}
+
+// Lloyd's k-means over uniform samples of the descriptor box
+static NTSTATUS Cvt_BuildCentroids(MapElitesArchive* archive) {
+    const MapElitesConfig* cfg = &archive->config;
+    uint32_t dim = cfg->descriptor_dim;
+    uint32_t cells = archive->cell_count;
+    uint32_t samples = cells * CVT_SAMPLES_PER_CELL;
+    if (samples > CVT_MAX_SAMPLES) samples = CVT_MAX_SAMPLES;
+    if (samples < cells) samples = cells;
+
+    float* points = (float*)malloc((size_t)samples * dim * sizeof(float));
+    double* sums = (double*)malloc((size_t)cells * dim * sizeof(double));
+    uint32_t* counts = (uint32_t*)malloc(cells * sizeof(uint32_t));
+    if (!points || !sums || !counts) {
+        free(points);
+        free(sums);
+        free(counts);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    EvolutionRng rng;
+    EvolutionRng_Seed(&rng, cfg->seed ? cfg->seed : 0xC0FFEEull);
+    float span = cfg->descriptor_max - cfg->descriptor_min;
+    for (size_t i = 0; i < (size_t)samples * dim; i++) {
+        points[i] = cfg->descriptor_min + span * (float)EvolutionRng_NextDouble(&rng);
+    }
+    memcpy(archive->centroids, points, (size_t)cells * dim * sizeof(float));
+
+    uint32_t iterations = cfg->cvt_iterations ? cfg->cvt_iterations : 10;
+    for (uint32_t it = 0; it < iterations; it++) {
+        memset(sums, 0, (size_t)cells * dim * sizeof(double));
+        memset(counts, 0, cells * sizeof(uint32_t));
+        for (uint32_t s = 0; s < samples; s++) {
+            const float* p = points + (size_t)s * dim;
+            uint32_t c = NearestCentroid(archive->centroids, cells, dim, p, NULL, 0);
+            for (uint32_t k = 0; k < dim; k++) sums[(size_t)c * dim + k] += p[k];
+            counts[c]++;
+        }
+        for (uint32_t c = 0; c < cells; c++) {
+            if (counts[c] == 0) continue;
+            for (uint32_t k = 0; k < dim; k++) {
+                archive->centroids[(size_t)c * dim + k] = (float)(sums[(size_t)c * dim + k] / counts[c]);
+            }
+        }
+    }
+
+    free(points);
+    free(sums);
+    free(counts);
+    return STATUS_SUCCESS;
+}
+
+// Uniform lookup grid over the box; each lookup cell lists the centroids that can be
+// nearest to some point inside it (min distance to the box <= best max distance)
+static NTSTATUS Cvt_BuildLookup(MapElitesArchive* archive) {
+    const MapElitesConfig* cfg = &archive->config;
+    uint32_t dim = cfg->descriptor_dim;
+    uint32_t cells = archive->cell_count;
+
+    double budget_cells = (double)CVT_LOOKUP_BUILD_BUDGET / ((double)cells * dim);
+    if (budget_cells > CVT_LOOKUP_MAX_CELLS) budget_cells = CVT_LOOKUP_MAX_CELLS;
+    uint32_t res = (uint32_t)floor(pow(budget_cells, 1.0 / dim) + 1e-9);
+    if (res < 2) {
+        archive->lookup_resolution = 0;
+        return STATUS_SUCCESS;
+    }
+
+    uint32_t table = 1;
+    for (uint32_t k = 0; k < dim; k++) table *= res;
+
+    uint32_t* offsets = (uint32_t*)malloc((table + 1) * sizeof(uint32_t));
+    float* min_d = (float*)malloc(cells * sizeof(float));
+    uint32_t capacity = table * 4;
+    uint32_t* candidates = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+    if (!offsets || !min_d || !candidates) {
+        free(offsets);
+        free(min_d);
+        free(candidates);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    float step = (cfg->descriptor_max - cfg->descriptor_min) / res;
+    uint32_t used = 0;
+    float lo[EVOLUTION_MAP_ELITES_MAX_DIM], hi[EVOLUTION_MAP_ELITES_MAX_DIM];
+
+    for (uint32_t t = 0; t < table; t++) {
+        uint32_t rem = t;
+        for (uint32_t k = 0; k < dim; k++) {
+            uint32_t b = rem % res;
+            rem /= res;
+            lo[k] = cfg->descriptor_min + step * b;
+            hi[k] = lo[k] + step;
+        }
+
+        float bound = FLT_MAX;
+        for (uint32_t c = 0; c < cells; c++) {
+            const float* ctr = archive->centroids + (size_t)c * dim;
+            float near = 0.0f, far = 0.0f;
+            for (uint32_t k = 0; k < dim; k++) {
+                float below = lo[k] - ctr[k], above = ctr[k] - hi[k];
+                float gap = below > 0.0f ? below : (above > 0.0f ? above : 0.0f);
+                float reach = fabsf(ctr[k] - lo[k]) > fabsf(ctr[k] - hi[k]) ? fabsf(ctr[k] - lo[k]) : fabsf(ctr[k] - hi[k]);
+                near += gap * gap;
+                far += reach * reach;
+            }
+            min_d[c] = near;
+            if (far < bound) bound = far;
+        }
+
+        offsets[t] = used;
+        uint32_t count = 0;
+        for (uint32_t c = 0; c < cells && count <= EVOLUTION_MAP_ELITES_CVT_CANDIDATES_MAX; c++) {
+            if (min_d[c] <= bound) count++;
+        }
+        if (count > EVOLUTION_MAP_ELITES_CVT_CANDIDATES_MAX) continue;   // empty range: full scan
+
+        if (used + count > capacity) {
+            uint32_t grown = (capacity * 2 > used + count) ? capacity * 2 : used + count;
+            uint32_t* next = (uint32_t*)realloc(candidates, grown * sizeof(uint32_t));
+            if (!next) {
+                free(offsets);
+                free(min_d);
+                free(candidates);
+                return STATUS_INSUFFICIENT_RESOURCES;
+            }
+            candidates = next;
+            capacity = grown;
+        }
+        for (uint32_t c = 0; c < cells; c++) {
+            if (min_d[c] <= bound) candidates[used++] = c;
+        }
+    }
+    offsets[table] = used;
+
+    free(min_d);
+    archive->lookup_resolution = res;
+    archive->lookup_offsets = offsets;
+    archive->lookup_candidates = candidates;
+    return STATUS_SUCCESS;
+}
+
+void MapElites_DefaultConfig(MapElitesConfig* config, size_t genome_size) {
+    memset(config, 0, sizeof(*config));
+    config->type = MAP_ELITES_GRID;
+    config->descriptor_dim = EVOLUTION_MAP_ELITES_DEFAULT_DIM;
+    config->bins_per_dim = EVOLUTION_MAP_ELITES_DEFAULT_BINS;
+    config->cvt_cells = EVOLUTION_MAP_ELITES_DEFAULT_CVT_CELLS;
+    config->cvt_iterations = 10;
+    config->descriptor_min = -0.5f;
+    config->descriptor_max = 0.5f;
+    config->genome_size = genome_size;
+    config->fitness_offset = 0.0;
+    config->seed = 0;
+}
+
+NTSTATUS MapElites_Initialize(MapElitesArchive* archive, const MapElitesConfig* config) {
+    if (!archive || !config) return STATUS_INVALID_PARAMETER;
+    if (archive->initialized) return STATUS_SUCCESS;
+    if (config->descriptor_dim == 0 || config->descriptor_dim > EVOLUTION_MAP_ELITES_MAX_DIM) return STATUS_INVALID_PARAMETER;
+    if (config->genome_size == 0 || !(config->descriptor_max > config->descriptor_min)) return STATUS_INVALID_PARAMETER;
+
+    memset(archive, 0, sizeof(*archive));
+    archive->config = *config;
+
+    uint64_t cells = 1;
+    if (config->type == MAP_ELITES_GRID) {
+        if (config->bins_per_dim == 0) return STATUS_INVALID_PARAMETER;
+        for (uint32_t k = 0; k < config->descriptor_dim; k++) {
+            cells *= config->bins_per_dim;
+            if (cells > EVOLUTION_MAP_ELITES_MAX_CELLS) return STATUS_INVALID_PARAMETER;
+        }
+    } else {
+        cells = config->cvt_cells;
+        if (cells == 0 || cells > EVOLUTION_MAP_ELITES_MAX_CELLS) return STATUS_INVALID_PARAMETER;
+    }
+    archive->cell_count = (uint32_t)cells;
+
+    size_t dim = config->descriptor_dim;
+    archive->cells = (MapElitesCell*)calloc(cells, sizeof(MapElitesCell));
+    archive->genomes = (uint8_t*)malloc(cells * config->genome_size);
+    archive->descriptors = (float*)calloc(cells * dim, sizeof(float));
+    archive->fitness = (double*)calloc(cells, sizeof(double));
+    archive->filled_cells = (uint32_t*)malloc(cells * sizeof(uint32_t));
+    if (config->type == MAP_ELITES_CVT) {
+        archive->centroids = (float*)malloc(cells * dim * sizeof(float));
+    }
+    if (!archive->cells || !archive->genomes || !archive->descriptors || !archive->fitness ||
+        !archive->filled_cells || (config->type == MAP_ELITES_CVT && !archive->centroids)) {
+        archive->initialized = true;
+        MapElites_Shutdown(archive);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    memset(archive->filled_cells, 0xFF, cells * sizeof(uint32_t));
+
+    if (config->type == MAP_ELITES_CVT) {
+        NTSTATUS status = Cvt_BuildCentroids(archive);
+        if (NT_SUCCESS(status)) status = Cvt_BuildLookup(archive);
+        if (!NT_SUCCESS(status)) {
+            archive->initialized = true;
+            MapElites_Shutdown(archive);
+            return status;
+        }
+    }
+
+    archive->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void MapElites_Shutdown(MapElitesArchive* archive) {
+    if (!archive || !archive->initialized) return;
+    free(archive->cells);
+    free(archive->genomes);
+    free(archive->descriptors);
+    free(archive->fitness);
+    free(archive->filled_cells);
+    free(archive->centroids);
+    free(archive->lookup_offsets);
+    free(archive->lookup_candidates);
+    memset(archive, 0, sizeof(*archive));
+}
+
+uint32_t MapElites_CellIndex(const MapElitesArchive* archive, const float* descriptor) {
+    const MapElitesConfig* cfg = &archive->config;
+    uint32_t dim = cfg->descriptor_dim;
+    float scale = 1.0f / (cfg->descriptor_max - cfg->descriptor_min);
+
+    if (cfg->type == MAP_ELITES_GRID) {
+        uint32_t bins = cfg->bins_per_dim;
+        uint32_t index = 0;
+        for (uint32_t k = dim; k-- > 0;) {
+            float t = (descriptor[k] - cfg->descriptor_min) * scale * bins;
+            uint32_t b = (t > 0.0f) ? (uint32_t)t : 0;   // NaN and negatives land in bin 0
+            if (b >= bins) b = bins - 1;
+            index = index * bins + b;
+        }
+        return index;
+    }
+
+    if (archive->lookup_resolution) {
+        uint32_t res = archive->lookup_resolution;
+        uint32_t t = 0;
+        for (uint32_t k = dim; k-- > 0;) {
+            float x = (descriptor[k] - cfg->descriptor_min) * scale * res;
+            uint32_t b = (x > 0.0f) ? (uint32_t)x : 0;
+            if (b >= res) b = res - 1;
+            t = t * res + b;
+        }
+        uint32_t begin = archive->lookup_offsets[t];
+        uint32_t end = archive->lookup_offsets[t + 1];
+        if (end > begin) {
+            // Points outside the box are clamped to the table but measured where they are;
+            // the candidate bound only holds inside, so fall through to the full scan for them
+            bool inside = true;
+            for (uint32_t k = 0; k < dim; k++) {
+                if (!(descriptor[k] >= cfg->descriptor_min && descriptor[k] <= cfg->descriptor_max)) inside = false;
+            }
+            if (inside) {
+                return NearestCentroid(archive->centroids, archive->cell_count, dim, descriptor,
+                                       archive->lookup_candidates + begin, end - begin);
+            }
+        }
+    }
+    return NearestCentroid(archive->centroids, archive->cell_count, dim, descriptor, NULL, 0);
+}
+
+static MapElitesOutcome MapElites_TryInsert(MapElitesArchive* archive, uint32_t index,
+                                            const void* genome, const float* descriptor, double fitness) {
+    MapElitesCell* cell = &archive->cells[index];
+    uint64_t key = FitnessKey(fitness);
+
+    // Lock-free reject: most offspring lose to the resident elite
+    if (key <= (uint64_t)AtomicLoad64(&cell->fitness_key)) return MAP_ELITES_REJECTED;
+
+    while (InterlockedCompareExchange(&cell->busy, 1, 0) != 0) {
+        YieldProcessor();
+    }
+    uint64_t current = (uint64_t)AtomicLoad64(&cell->fitness_key);
+    if (key <= current) {
+        InterlockedExchange(&cell->busy, 0);
+        return MAP_ELITES_REJECTED;
+    }
+
+    size_t dim = archive->config.descriptor_dim;
+    InterlockedIncrement64(&cell->sequence);
+    memcpy(archive->genomes + (size_t)index * archive->config.genome_size, genome, archive->config.genome_size);
+    memcpy(archive->descriptors + (size_t)index * dim, descriptor, dim * sizeof(float));
+    archive->fitness[index] = fitness;
+    InterlockedExchange64(&cell->fitness_key, (LONG64)key);
+    InterlockedIncrement64(&cell->sequence);
+    InterlockedExchange(&cell->busy, 0);
+
+    if (current == 0) {
+        LONG slot = InterlockedIncrement(&archive->filled_count) - 1;
+        InterlockedExchange((volatile LONG*)&archive->filled_cells[slot], (LONG)index);
+        return MAP_ELITES_NEW_CELL;
+    }
+    return MAP_ELITES_IMPROVED;
+}
+
+uint32_t MapElites_InsertBatch(MapElitesArchive* archive, const void* const* genomes,
+    const float* descriptors, const double* fitness, uint32_t count, uint8_t* outcome) {
+    if (!archive || !archive->initialized || !genomes || !descriptors || !fitness) return 0;
+
+    size_t dim = archive->config.descriptor_dim;
+    uint32_t accepted = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        MapElitesOutcome result = MAP_ELITES_REJECTED;
+        if (genomes[i] && fitness[i] == fitness[i]) {
+            const float* d = descriptors + i * dim;
+            result = MapElites_TryInsert(archive, MapElites_CellIndex(archive, d), genomes[i], d, fitness[i]);
+        }
+        if (result != MAP_ELITES_REJECTED) accepted++;
+        if (outcome) outcome[i] = (uint8_t)result;
+    }
+
+    InterlockedExchangeAdd64(&archive->insertions, count);
+    InterlockedExchangeAdd64(&archive->improvements, accepted);
+    return accepted;
+}
+
+NTSTATUS MapElites_ReadElite(const MapElitesArchive* archive, uint32_t cell,
+    void* genome_out, double* fitness, float* descriptor_out) {
+    if (!archive || !archive->initialized || cell >= archive->cell_count) return STATUS_INVALID_PARAMETER;
+
+    MapElitesCell* c = &archive->cells[cell];
+    size_t dim = archive->config.descriptor_dim;
+    for (;;) {
+        LONG64 before = AtomicLoad64(&c->sequence);
+        if (before & 1) {
+            YieldProcessor();
+            continue;
+        }
+        if (AtomicLoad64(&c->fitness_key) == 0) return STATUS_NOT_FOUND;
+
+        if (genome_out) {
+            memcpy(genome_out, archive->genomes + (size_t)cell * archive->config.genome_size,
+                   archive->config.genome_size);
+        }
+        if (descriptor_out) memcpy(descriptor_out, archive->descriptors + (size_t)cell * dim, dim * sizeof(float));
+        double f = archive->fitness[cell];
+
+        if (AtomicLoad64(&c->sequence) == before) {
+            if (fitness) *fitness = f;
+            return STATUS_SUCCESS;
+        }
+    }
+}
+
+NTSTATUS MapElites_SampleCell(const MapElitesArchive* archive, EvolutionRng* rng, uint32_t* cell) {
+    if (!archive || !archive->initialized || !rng || !cell) return STATUS_INVALID_PARAMETER;
+
+    for (int attempt = 0; attempt < 8; attempt++) {
+        LONG filled = archive->filled_count;
+        if (filled <= 0) return STATUS_NOT_FOUND;
+        uint32_t index = archive->filled_cells[EvolutionRng_NextBelow(rng, (uint32_t)filled)];
+        if (index != UINT32_MAX) {
+            *cell = index;
+            return STATUS_SUCCESS;
+        }
+    }
+    // Only slots still being published were drawn; the first slot is always settled by now
+    *cell = archive->filled_cells[0];
+    return (*cell != UINT32_MAX) ? STATUS_SUCCESS : STATUS_NOT_FOUND;
+}
+
+void MapElites_GetMetrics(const MapElitesArchive* archive, MapElitesMetrics* out) {
+    memset(out, 0, sizeof(*out));
+    if (!archive || !archive->initialized) return;
+
+    out->cells = archive->cell_count;
+    out->best_fitness = -DBL_MAX;
+    out->best_cell = UINT32_MAX;
+    for (uint32_t c = 0; c < archive->cell_count; c++) {
+        if (AtomicLoad64(&archive->cells[c].fitness_key) == 0) continue;
+        double f = archive->fitness[c];
+        out->filled++;
+        out->qd_score += f - archive->config.fitness_offset;
+        if (f > out->best_fitness) {
+            out->best_fitness = f;
+            out->best_cell = c;
+        }
+    }
+    out->coverage = (double)out->filled / archive->cell_count;
+    out->insertions = (uint64_t)archive->insertions;
+    out->improvements = (uint64_t)archive->improvements;
+}
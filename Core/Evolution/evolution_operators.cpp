@@ -0,0 +1,469 @@
+/*
+ * Evolution Operators - Raijin
+ * Owner: Core/Evolution
+ * Inputs: Genomes as contiguous double arrays, EvolutionRng state
+ * Outputs: Mutated genomes, offspring genomes, benchmark table
+ * Invariants: All randomness comes from the caller's EvolutionRng (deterministic per seed);
+ *             mutation only clamps genes it actually changed
+ * Budget: SSE2 only (x64 baseline); no heap allocation on the operator paths
+ * Failure modes: None; zero-length genomes are no-ops
+ * Recovery: N/A
+ */
+
+#include "../../Include/evolution_operators.h"
+#include "../../Include/raijin_ntstatus.h"
+#include <windows.h>
+#include <emmintrin.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define OPS_CHUNK 256
+
+// RNG: xorshift128+, two lanes per __m128i
+static uint64_t SplitMix64(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+void EvolutionRng_Seed(EvolutionRng* rng, uint64_t seed) {
+    uint64_t sm = seed;
+    rng->s0[0] = SplitMix64(&sm);
+    rng->s0[1] = SplitMix64(&sm);
+    rng->s1[0] = SplitMix64(&sm);
+    rng->s1[1] = SplitMix64(&sm);
+    if ((rng->s0[0] | rng->s1[0]) == 0) rng->s0[0] = 1;
+    if ((rng->s0[1] | rng->s1[1]) == 0) rng->s0[1] = 1;
+}
+
+uint64_t EvolutionRng_Next(EvolutionRng* rng) {
+    uint64_t s1 = rng->s0[0];
+    const uint64_t s0 = rng->s1[0];
+    const uint64_t result = s0 + s1;
+    rng->s0[0] = s0;
+    s1 ^= s1 << 23;
+    rng->s1[0] = s1 ^ s0 ^ (s1 >> 18) ^ (s0 >> 5);
+    return result;
+}
+
+double EvolutionRng_NextDouble(EvolutionRng* rng) {
+    return (double)(EvolutionRng_Next(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+uint32_t EvolutionRng_NextBelow(EvolutionRng* rng, uint32_t bound) {
+    if (bound == 0) return 0;
+    return (uint32_t)(((EvolutionRng_Next(rng) >> 32) * (uint64_t)bound) >> 32);
+}
+
+static inline void Rng_Load(const EvolutionRng* rng, __m128i* st0, __m128i* st1) {
+    *st0 = _mm_loadu_si128((const __m128i*)rng->s0);
+    *st1 = _mm_loadu_si128((const __m128i*)rng->s1);
+}
+
+static inline void Rng_Store(EvolutionRng* rng, __m128i st0, __m128i st1) {
+    _mm_storeu_si128((__m128i*)rng->s0, st0);
+    _mm_storeu_si128((__m128i*)rng->s1, st1);
+}
+
+static inline __m128i Rng_Step(__m128i* st0, __m128i* st1) {
+    __m128i s1 = *st0;
+    const __m128i s0 = *st1;
+    __m128i result = _mm_add_epi64(s0, s1);
+    *st0 = s0;
+    s1 = _mm_xor_si128(s1, _mm_slli_epi64(s1, 23));
+    *st1 = _mm_xor_si128(_mm_xor_si128(s1, s0),
+                         _mm_xor_si128(_mm_srli_epi64(s1, 18), _mm_srli_epi64(s0, 5)));
+    return result;
+}
+
+// 52 random mantissa bits under exponent 0 give [1, 2); subtract 1
+static inline __m128d Bits_ToUnitDouble(__m128i bits) {
+    const __m128i one_bits = _mm_set1_epi64x(0x3FF0000000000000LL);
+    __m128d d = _mm_castsi128_pd(_mm_or_si128(_mm_srli_epi64(bits, 12), one_bits));
+    return _mm_sub_pd(d, _mm_set1_pd(1.0));
+}
+
+void EvolutionRng_FillUniform(EvolutionRng* rng, double* out, size_t count) {
+    __m128i st0, st1;
+    Rng_Load(rng, &st0, &st1);
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(out + i, Bits_ToUnitDouble(Rng_Step(&st0, &st1)));
+    }
+    Rng_Store(rng, st0, st1);
+    for (; i < count; i++) {
+        out[i] = EvolutionRng_NextDouble(rng);
+    }
+}
+
+// Gaussian: vectorized Box-Muller with float polynomial log and sincos
+static inline __m128 Log_ps(__m128 x) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    __m128i xi = _mm_castps_si128(x);
+    __m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(xi, 23), _mm_set1_epi32(127)));
+    __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(xi, _mm_set1_epi32(0x007FFFFF)),
+                                             _mm_set1_epi32(0x3F800000)));
+    // Fold the mantissa into [sqrt(1/2), sqrt(2))
+    __m128 big = _mm_cmpgt_ps(m, _mm_set1_ps(1.41421356f));
+    m = _mm_sub_ps(m, _mm_and_ps(big, _mm_mul_ps(m, _mm_set1_ps(0.5f))));
+    e = _mm_add_ps(e, _mm_and_ps(big, one));
+
+    __m128 t = _mm_sub_ps(m, one);
+    __m128 z = _mm_mul_ps(t, t);
+    __m128 p = _mm_set1_ps(7.0376836292e-2f);
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(-1.1514610310e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.1676998740e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(-1.2420140846e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.4249322787e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(-1.6668057665e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(2.0000714765e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(-2.4999993993e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(3.3333331174e-1f));
+    __m128 y = _mm_mul_ps(_mm_mul_ps(t, z), p);
+    y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    return _mm_add_ps(_mm_add_ps(t, y), _mm_mul_ps(e, _mm_set1_ps(0.693147180f)));
+}
+
+// cos/sin of a uniformly random angle: quadrant q plus a residual in [-pi/4, pi/4)
+static inline void SinCosUniform_ps(__m128 v, __m128* out_cos, __m128* out_sin) {
+    __m128 v4 = _mm_mul_ps(v, _mm_set1_ps(4.0f));
+    __m128i q = _mm_cvttps_epi32(v4);
+    __m128 r = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(v4, _mm_cvtepi32_ps(q)), _mm_set1_ps(0.5f)),
+                          _mm_set1_ps(1.57079632679f));
+    __m128 z = _mm_mul_ps(r, r);
+
+    __m128 s = _mm_set1_ps(-1.9515295891e-4f);
+    s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(8.3321608736e-3f));
+    s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(-1.6666654611e-1f));
+    s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), r), r);
+
+    __m128 c = _mm_set1_ps(2.443315711809948e-5f);
+    c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(-1.388731625493765e-3f));
+    c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(4.166664568298827e-2f));
+    c = _mm_mul_ps(_mm_mul_ps(c, z), z);
+    c = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, _mm_set1_ps(0.5f))), c);
+
+    // Rotate (c, s) by q quarter turns
+    __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+    __m128 cc = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+    __m128 ss = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+    __m128i cos_sign = _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30);
+    __m128i sin_sign = _mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30);
+    *out_cos = _mm_xor_ps(cc, _mm_castsi128_ps(cos_sign));
+    *out_sin = _mm_xor_ps(ss, _mm_castsi128_ps(sin_sign));
+}
+
+static inline void Gaussian8(__m128i* st0, __m128i* st1, float* out) {
+    const __m128i one_bits = _mm_set1_epi32(0x3F800000);
+    __m128 f1 = _mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(Rng_Step(st0, st1), 9), one_bits));
+    __m128 f2 = _mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(Rng_Step(st0, st1), 9), one_bits));
+    __m128 u1 = _mm_sub_ps(_mm_set1_ps(2.0f), f1);     // (0, 1]
+    __m128 u2 = _mm_sub_ps(f2, _mm_set1_ps(1.0f));     // [0, 1)
+    __m128 radius = _mm_sqrt_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), Log_ps(u1)));
+    __m128 c, s;
+    SinCosUniform_ps(u2, &c, &s);
+    _mm_storeu_ps(out, _mm_mul_ps(radius, c));
+    _mm_storeu_ps(out + 4, _mm_mul_ps(radius, s));
+}
+
+void EvolutionRng_FillGaussian(EvolutionRng* rng, float* out, size_t count) {
+    __m128i st0, st1;
+    Rng_Load(rng, &st0, &st1);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        Gaussian8(&st0, &st1, out + i);
+    }
+    if (i < count) {
+        float tail[8];
+        Gaussian8(&st0, &st1, tail);
+        memcpy(out + i, tail, (count - i) * sizeof(float));
+    }
+    Rng_Store(rng, st0, st1);
+}
+
+// Mutation
+static void MutateGaussian_Dense(EvolutionRng* rng, double* genes, size_t count,
+                                 double rate, double sigma, double min_value, double max_value) {
+    double uniform[OPS_CHUNK];
+    float noise[OPS_CHUNK];
+    const __m128d rate_v = _mm_set1_pd(rate);
+    const __m128d sigma_v = _mm_set1_pd(sigma);
+    const __m128d lo = _mm_set1_pd(min_value);
+    const __m128d hi = _mm_set1_pd(max_value);
+
+    for (size_t base = 0; base < count; base += OPS_CHUNK) {
+        size_t m = (count - base < OPS_CHUNK) ? count - base : OPS_CHUNK;
+        EvolutionRng_FillUniform(rng, uniform, m);
+        EvolutionRng_FillGaussian(rng, noise, m);
+
+        double* g = genes + base;
+        size_t i = 0;
+        for (; i + 2 <= m; i += 2) {
+            __m128d mask = _mm_cmplt_pd(_mm_loadu_pd(uniform + i), rate_v);
+            __m128d step = _mm_mul_pd(_mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)(noise + i)))),
+                                      sigma_v);
+            __m128d old = _mm_loadu_pd(g + i);
+            __m128d mutated = _mm_min_pd(_mm_max_pd(_mm_add_pd(old, step), lo), hi);
+            _mm_storeu_pd(g + i, _mm_or_pd(_mm_and_pd(mask, mutated), _mm_andnot_pd(mask, old)));
+        }
+        for (; i < m; i++) {
+            if (uniform[i] < rate) {
+                double v = g[i] + sigma * noise[i];
+                g[i] = (v < min_value) ? min_value : ((v > max_value) ? max_value : v);
+            }
+        }
+    }
+}
+
+// Low rates: jump between mutated genes with geometric gaps instead of testing every gene
+static void MutateGaussian_Sparse(EvolutionRng* rng, double* genes, size_t count,
+                                  double rate, double sigma, double min_value, double max_value) {
+    const double log_keep = log1p(-rate);
+    float noise[64];
+    size_t noise_left = 0;
+    size_t i = 0;
+
+    for (;;) {
+        double u = 1.0 - EvolutionRng_NextDouble(rng);
+        double gap = floor(log(u) / log_keep);
+        if (gap >= (double)(count - i)) break;
+        i += (size_t)gap;
+
+        if (noise_left == 0) {
+            EvolutionRng_FillGaussian(rng, noise, 64);
+            noise_left = 64;
+        }
+        double v = genes[i] + sigma * noise[--noise_left];
+        genes[i] = (v < min_value) ? min_value : ((v > max_value) ? max_value : v);
+        if (++i >= count) break;
+    }
+}
+
+void EvolutionOps_MutateGaussian(EvolutionRng* rng, double* genes, size_t count,
+    double rate, double sigma, double min_value, double max_value) {
+    if (!rng || !genes || count == 0 || rate <= 0.0) return;
+    if (sigma <= 0.0) sigma = EVOLUTION_MUTATION_DEFAULT_SIGMA;
+
+    if (rate < EVOLUTION_MUTATION_SPARSE_RATE)
+        MutateGaussian_Sparse(rng, genes, count, rate, sigma, min_value, max_value);
+    else
+        MutateGaussian_Dense(rng, genes, count, rate, sigma, min_value, max_value);
+}
+
+// Crossover
+void EvolutionOps_CrossoverSinglePoint(EvolutionRng* rng, const double* a, const double* b,
+    double* child, size_t count) {
+    if (count == 0) return;
+    size_t point = (size_t)(EvolutionRng_NextDouble(rng) * (double)count);
+    memcpy(child, a, point * sizeof(double));
+    memcpy(child + point, b + point, (count - point) * sizeof(double));
+}
+
+void EvolutionOps_CrossoverTwoPoint(EvolutionRng* rng, const double* a, const double* b,
+    double* child, size_t count) {
+    if (count == 0) return;
+    size_t p1 = (size_t)(EvolutionRng_NextDouble(rng) * (double)(count + 1));
+    size_t p2 = (size_t)(EvolutionRng_NextDouble(rng) * (double)(count + 1));
+    if (p1 > count) p1 = count;
+    if (p2 > count) p2 = count;
+    if (p1 > p2) {
+        size_t t = p1;
+        p1 = p2;
+        p2 = t;
+    }
+    memcpy(child, a, p1 * sizeof(double));
+    memcpy(child + p1, b + p1, (p2 - p1) * sizeof(double));
+    memcpy(child + p2, a + p2, (count - p2) * sizeof(double));
+}
+
+// One 128-bit draw masks four genes: the sign of each 32-bit lane picks the parent
+void EvolutionOps_CrossoverUniform(EvolutionRng* rng, const double* a, const double* b,
+    double* child, size_t count) {
+    __m128i st0, st1;
+    Rng_Load(rng, &st0, &st1);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i sign = _mm_srai_epi32(Rng_Step(&st0, &st1), 31);
+        __m128d m0 = _mm_castsi128_pd(_mm_shuffle_epi32(sign, _MM_SHUFFLE(1, 1, 0, 0)));
+        __m128d m1 = _mm_castsi128_pd(_mm_shuffle_epi32(sign, _MM_SHUFFLE(3, 3, 2, 2)));
+        __m128d c0 = _mm_or_pd(_mm_and_pd(m0, _mm_loadu_pd(a + i)), _mm_andnot_pd(m0, _mm_loadu_pd(b + i)));
+        __m128d c1 = _mm_or_pd(_mm_and_pd(m1, _mm_loadu_pd(a + i + 2)), _mm_andnot_pd(m1, _mm_loadu_pd(b + i + 2)));
+        _mm_storeu_pd(child + i, c0);
+        _mm_storeu_pd(child + i + 2, c1);
+    }
+    Rng_Store(rng, st0, st1);
+    if (i < count) {
+        uint64_t bits = EvolutionRng_Next(rng);
+        for (; i < count; i++, bits >>= 1) {
+            child[i] = (bits & 1) ? a[i] : b[i];
+        }
+    }
+}
+
+void EvolutionOps_CrossoverArithmetic(EvolutionRng* rng, const double* a, const double* b,
+    double* child, size_t count) {
+    double alpha = EvolutionRng_NextDouble(rng);
+    const __m128d alpha_v = _mm_set1_pd(alpha);
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128d va = _mm_loadu_pd(a + i);
+        __m128d vb = _mm_loadu_pd(b + i);
+        _mm_storeu_pd(child + i, _mm_add_pd(vb, _mm_mul_pd(alpha_v, _mm_sub_pd(va, vb))));
+    }
+    for (; i < count; i++) {
+        child[i] = b[i] + alpha * (a[i] - b[i]);
+    }
+}
+
+void EvolutionOps_CrossoverBlxAlpha(EvolutionRng* rng, const double* a, const double* b,
+    double* child, size_t count, double alpha) {
+    double uniform[OPS_CHUNK];
+    if (alpha < 0.0) alpha = EVOLUTION_BLX_DEFAULT_ALPHA;
+    const __m128d alpha_v = _mm_set1_pd(alpha);
+    const __m128d span_v = _mm_set1_pd(1.0 + 2.0 * alpha);
+
+    for (size_t base = 0; base < count; base += OPS_CHUNK) {
+        size_t m = (count - base < OPS_CHUNK) ? count - base : OPS_CHUNK;
+        EvolutionRng_FillUniform(rng, uniform, m);
+        size_t i = 0;
+        for (; i + 2 <= m; i += 2) {
+            __m128d va = _mm_loadu_pd(a + base + i);
+            __m128d vb = _mm_loadu_pd(b + base + i);
+            __m128d lo = _mm_min_pd(va, vb);
+            __m128d range = _mm_sub_pd(_mm_max_pd(va, vb), lo);
+            __m128d start = _mm_sub_pd(lo, _mm_mul_pd(alpha_v, range));
+            __m128d offset = _mm_mul_pd(_mm_loadu_pd(uniform + i), _mm_mul_pd(range, span_v));
+            _mm_storeu_pd(child + base + i, _mm_add_pd(start, offset));
+        }
+        for (; i < m; i++) {
+            double lo = a[base + i] < b[base + i] ? a[base + i] : b[base + i];
+            double range = fabs(a[base + i] - b[base + i]);
+            child[base + i] = lo - alpha * range + uniform[i] * range * (1.0 + 2.0 * alpha);
+        }
+    }
+}
+
+// Benchmark: former scalar operators, kept verbatim in behavior for comparison
+static double Legacy_RandomDouble(double min_val, double max_val) {
+    return min_val + (max_val - min_val) * ((double)rand() / RAND_MAX);
+}
+
+static void Legacy_MutateGaussian(double* genome, size_t num_genes, double mutation_rate) {
+    for (size_t i = 0; i < num_genes; i++) {
+        if (Legacy_RandomDouble(0.0, 1.0) < mutation_rate) {
+            double mutation = Legacy_RandomDouble(-0.5, 0.5);
+            genome[i] += mutation;
+            genome[i] = (genome[i] < -2.0) ? -2.0 : ((genome[i] > 2.0) ? 2.0 : genome[i]);
+        }
+    }
+}
+
+static void Legacy_CrossoverSinglePoint(const double* a, const double* b, double* child, size_t num_genes) {
+    size_t genome_size = num_genes * sizeof(double);
+    size_t crossover_point = rand() % genome_size;
+    memcpy(child, a, crossover_point);
+    memcpy((char*)child + crossover_point, (const char*)b + crossover_point, genome_size - crossover_point);
+}
+
+static void Legacy_CrossoverUniform(const double* a, const double* b, double* child, size_t num_genes) {
+    for (size_t i = 0; i < num_genes; i++) {
+        child[i] = (Legacy_RandomDouble(0.0, 1.0) < 0.5) ? a[i] : b[i];
+    }
+}
+
+static double Bench_Seconds(LARGE_INTEGER start, LARGE_INTEGER end, LARGE_INTEGER freq) {
+    return (double)(end.QuadPart - start.QuadPart) / (double)freq.QuadPart;
+}
+
+#define BENCH_GENES_PER_CASE 20000000.0
+
+NTSTATUS EvolutionOps_RunBenchmark(void) {
+    static const size_t lengths[] = { 100, 1000, 10000, 100000, 1000000 };
+    static const double rates[] = { 0.01, 0.25 };
+    const size_t max_len = 1000000;
+
+    double* a = (double*)malloc(max_len * sizeof(double));
+    double* b = (double*)malloc(max_len * sizeof(double));
+    double* child = (double*)malloc(max_len * sizeof(double));
+    if (!a || !b || !child) {
+        free(a);
+        free(b);
+        free(child);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    EvolutionRng rng;
+    EvolutionRng_Seed(&rng, 0x5EED);
+    for (size_t i = 0; i < max_len; i++) {
+        a[i] = EvolutionRng_NextDouble(&rng) * 2.0 - 1.0;
+        b[i] = EvolutionRng_NextDouble(&rng) * 2.0 - 1.0;
+    }
+
+    LARGE_INTEGER freq, t0, t1;
+    QueryPerformanceFrequency(&freq);
+    volatile double sink = 0.0;
+
+    printf("\n=== Evolution Operator Benchmark (Mgenes/s) ===\n");
+    printf("%-9s %-8s %12s %12s %8s\n", "genes", "op", "scalar", "simd", "speedup");
+
+    for (size_t li = 0; li < sizeof(lengths) / sizeof(lengths[0]); li++) {
+        size_t n = lengths[li];
+        uint32_t iters = (uint32_t)(BENCH_GENES_PER_CASE / (double)n);
+        if (iters == 0) iters = 1;
+        double genes_total = (double)n * iters;
+
+        for (size_t ri = 0; ri < sizeof(rates) / sizeof(rates[0]); ri++) {
+            double rate = rates[ri];
+            memcpy(child, a, n * sizeof(double));
+            QueryPerformanceCounter(&t0);
+            for (uint32_t it = 0; it < iters; it++) Legacy_MutateGaussian(child, n, rate);
+            QueryPerformanceCounter(&t1);
+            double scalar = genes_total / Bench_Seconds(t0, t1, freq) / 1e6;
+            sink += child[n / 2];
+
+            memcpy(child, a, n * sizeof(double));
+            QueryPerformanceCounter(&t0);
+            for (uint32_t it = 0; it < iters; it++)
+                EvolutionOps_MutateGaussian(&rng, child, n, rate, EVOLUTION_MUTATION_DEFAULT_SIGMA, -2.0, 2.0);
+            QueryPerformanceCounter(&t1);
+            double simd = genes_total / Bench_Seconds(t0, t1, freq) / 1e6;
+            sink += child[n / 2];
+
+            char op[16];
+            snprintf(op, sizeof(op), "mut@%.2f", rate);
+            printf("%-9zu %-8s %12.1f %12.1f %7.1fx\n", n, op, scalar, simd, simd / scalar);
+        }
+
+        QueryPerformanceCounter(&t0);
+        for (uint32_t it = 0; it < iters; it++) Legacy_CrossoverUniform(a, b, child, n);
+        QueryPerformanceCounter(&t1);
+        double scalar = genes_total / Bench_Seconds(t0, t1, freq) / 1e6;
+        sink += child[n / 2];
+        QueryPerformanceCounter(&t0);
+        for (uint32_t it = 0; it < iters; it++) EvolutionOps_CrossoverUniform(&rng, a, b, child, n);
+        QueryPerformanceCounter(&t1);
+        double simd = genes_total / Bench_Seconds(t0, t1, freq) / 1e6;
+        sink += child[n / 2];
+        printf("%-9zu %-8s %12.1f %12.1f %7.1fx\n", n, "uniform", scalar, simd, simd / scalar);
+
+        QueryPerformanceCounter(&t0);
+        for (uint32_t it = 0; it < iters; it++) Legacy_CrossoverSinglePoint(a, b, child, n);
+        QueryPerformanceCounter(&t1);
+        scalar = genes_total / Bench_Seconds(t0, t1, freq) / 1e6;
+        sink += child[n / 2];
+        QueryPerformanceCounter(&t0);
+        for (uint32_t it = 0; it < iters; it++) EvolutionOps_CrossoverSinglePoint(&rng, a, b, child, n);
+        QueryPerformanceCounter(&t1);
+        simd = genes_total / Bench_Seconds(t0, t1, freq) / 1e6;
+        sink += child[n / 2];
+        printf("%-9zu %-8s %12.1f %12.1f %7.1fx\n", n, "1-point", scalar, simd, simd / scalar);
+    }
+
+    free(a);
+    free(b);
+    free(child);
+    return (sink == sink) ? STATUS_SUCCESS : STATUS_UNSUCCESSFUL;
+}
@@ -0,0 +1,967 @@
+/*
+ * Evolution Remote - Raijin
+ * Owner: Core/Evolution
+ * Inputs: EvolutionRemoteConfig, EvolutionParameters, genome batches from the engine
+ * Outputs: Fitness for every genome of a batch, EvolutionRemoteStats
+ * Invariants: A task is queued, in exactly one live worker's pipeline, or done; the first
+ *             result for a task wins and any later copy is discarded by batch and task id
+ * Budget: One loopback socket per worker; the calling thread blocks in select() between frames
+ * Failure modes: Worker crash, hang or protocol error -> worker dropped; no worker left ->
+ *                EvaluateBatch fails and the engine evaluates locally
+ * Recovery: A dropped worker's pipeline is requeued at the front; spawned workers are
+ *           restarted before the next batch up to max_respawns
+ */
+
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include "../../Include/evolution_remote.h"
+#include "../../Include/raijin_ntstatus.h"
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REMOTE_POLL_MS 100
+#define REMOTE_SHUTDOWN_WAIT_MS 2000
+#define REMOTE_NO_OWNER 0xFFFFFFFFu
+
+typedef enum {
+    REMOTE_TASK_QUEUED = 0,
+    REMOTE_TASK_SENT = 1,
+    REMOTE_TASK_DONE = 2
+} RemoteTaskState;
+
+typedef struct EvolutionRemoteTask {
+    uint32_t first;                      /* index of the task's first genome in the batch */
+    uint32_t count;
+    uint32_t owner;                      /* worker whose pipeline holds it while SENT */
+    uint64_t sent_ms;
+    RemoteTaskState state;
+    bool backup;                         /* a second copy runs on an otherwise idle worker */
+} EvolutionRemoteTask;
+
+typedef struct RemoteHello {
+    uint32_t version;
+    uint32_t pid;
+    uint64_t token;
+} RemoteHello;
+
+typedef struct RemoteConfigPayload {
+    uint32_t use_neural;
+    uint32_t params_size;
+    EvolutionParameters params;
+    char substrate_path[EVOLUTION_REMOTE_PATH_MAX];
+} RemoteConfigPayload;
+
+typedef struct RemoteBatchPrefix {
+    uint32_t count;
+    uint32_t reserved;
+} RemoteBatchPrefix;
+
+static size_t AlignUp8(size_t value) {
+    return (value + 7) & ~(size_t)7;
+}
+
+// Socket helpers
+
+static bool Remote_SendAll(SOCKET s, const void* data, size_t length) {
+    const char* p = (const char*)data;
+    while (length > 0) {
+        int chunk = length > 0x40000000 ? 0x40000000 : (int)length;
+        int sent = send(s, p, chunk, 0);
+        if (sent <= 0) return false;
+        p += sent;
+        length -= (size_t)sent;
+    }
+    return true;
+}
+
+static bool Remote_RecvAll(SOCKET s, void* data, size_t length) {
+    char* p = (char*)data;
+    while (length > 0) {
+        int chunk = length > 0x40000000 ? 0x40000000 : (int)length;
+        int got = recv(s, p, chunk, 0);
+        if (got <= 0) return false;
+        p += got;
+        length -= (size_t)got;
+    }
+    return true;
+}
+
+static bool Remote_WaitReadable(SOCKET s, uint32_t timeout_ms) {
+    fd_set set;
+    FD_ZERO(&set);
+    FD_SET(s, &set);
+    struct timeval tv;
+    tv.tv_sec = (long)(timeout_ms / 1000);
+    tv.tv_usec = (long)(timeout_ms % 1000) * 1000;
+    return select((int)s + 1, &set, NULL, NULL, &tv) > 0;
+}
+
+// Small frames go out in one send so header and payload share a segment
+static bool Remote_SendFrame(SOCKET s, uint16_t type, uint32_t batch, uint32_t task,
+                             const void* payload, uint32_t length, uint64_t* bytes) {
+    uint8_t frame[sizeof(EvolutionRemoteFrameHeader) + 512];
+    EvolutionRemoteFrameHeader hdr;
+    hdr.magic = EVOLUTION_REMOTE_MAGIC;
+    hdr.type = type;
+    hdr.reserved = 0;
+    hdr.batch = batch;
+    hdr.task = task;
+    hdr.length = length;
+
+    bool ok;
+    if (length <= sizeof(frame) - sizeof(hdr)) {
+        memcpy(frame, &hdr, sizeof(hdr));
+        if (length > 0) memcpy(frame + sizeof(hdr), payload, length);
+        ok = Remote_SendAll(s, frame, sizeof(hdr) + length);
+    } else {
+        ok = Remote_SendAll(s, &hdr, sizeof(hdr)) && Remote_SendAll(s, payload, length);
+    }
+    if (ok && bytes) *bytes += sizeof(hdr) + length;
+    return ok;
+}
+
+// Reads one frame; the payload lands in *buffer, grown as needed
+static bool Remote_RecvFrame(SOCKET s, EvolutionRemoteFrameHeader* hdr, uint8_t** buffer,
+                             size_t* capacity, uint64_t* bytes) {
+    if (!Remote_RecvAll(s, hdr, sizeof(*hdr))) return false;
+    if (hdr->magic != EVOLUTION_REMOTE_MAGIC || hdr->length > EVOLUTION_REMOTE_MAX_FRAME) return false;
+    if (hdr->length > *capacity || !*buffer) {
+        size_t grown = hdr->length > 256 ? hdr->length : 256;
+        uint8_t* next = (uint8_t*)realloc(*buffer, grown);
+        if (!next) return false;
+        *buffer = next;
+        *capacity = grown;
+    }
+    if (hdr->length > 0 && !Remote_RecvAll(s, *buffer, hdr->length)) return false;
+    if (bytes) *bytes += sizeof(*hdr) + hdr->length;
+    return true;
+}
+
+static void Remote_SetNoDelay(SOCKET s) {
+    int on = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (const char*)&on, sizeof(on));
+}
+
+// Task queue: a ring over task ids; resubmitted work goes to the front
+
+static void Queue_PushBack(EvolutionRemotePool* pool, uint32_t id) {
+    pool->queue[(pool->queue_head + pool->queue_count) % pool->task_count] = id;
+    pool->queue_count++;
+}
+
+static void Queue_PushFront(EvolutionRemotePool* pool, uint32_t id) {
+    pool->queue_head = (pool->queue_head + pool->task_count - 1) % pool->task_count;
+    pool->queue[pool->queue_head] = id;
+    pool->queue_count++;
+}
+
+static uint32_t Queue_PopFront(EvolutionRemotePool* pool) {
+    uint32_t id = pool->queue[pool->queue_head];
+    pool->queue_head = (pool->queue_head + 1) % pool->task_count;
+    pool->queue_count--;
+    return id;
+}
+
+static bool Remote_ReserveTasks(EvolutionRemotePool* pool, uint32_t count) {
+    if (count <= pool->task_capacity) return true;
+    EvolutionRemoteTask* tasks = (EvolutionRemoteTask*)realloc(pool->tasks, count * sizeof(EvolutionRemoteTask));
+    if (!tasks) return false;
+    pool->tasks = tasks;
+    uint32_t* queue = (uint32_t*)realloc(pool->queue, count * sizeof(uint32_t));
+    if (!queue) return false;
+    pool->queue = queue;
+    pool->task_capacity = count;
+    return true;
+}
+
+static bool Remote_ReserveBuffer(EvolutionRemotePool* pool, size_t bytes) {
+    if (bytes <= pool->buffer_capacity) return true;
+    uint8_t* next = (uint8_t*)realloc(pool->buffer, bytes);
+    if (!next) return false;
+    pool->buffer = next;
+    pool->buffer_capacity = bytes;
+    return true;
+}
+
+// Workers
+
+static void Remote_InflightRemove(EvolutionRemoteWorker* worker, uint32_t id) {
+    for (uint32_t i = 0; i < worker->inflight_count; i++) {
+        if (worker->inflight[i] != id) continue;
+        memmove(&worker->inflight[i], &worker->inflight[i + 1],
+                (worker->inflight_count - i - 1) * sizeof(uint32_t));
+        worker->inflight_count--;
+        return;
+    }
+}
+
+// Closes the connection, kills the process if it is still around (hung or misbehaving) and
+// puts every task it still owned back at the front of the queue
+static void Remote_DropWorker(EvolutionRemotePool* pool, uint32_t index) {
+    EvolutionRemoteWorker* worker = &pool->workers[index];
+    if (!worker->alive) return;
+    worker->alive = false;
+    closesocket((SOCKET)worker->socket);
+    worker->socket = (uintptr_t)INVALID_SOCKET;
+    if (worker->process) {
+        TerminateProcess(worker->process, 1);
+        CloseHandle(worker->process);
+        worker->process = NULL;
+    }
+    for (uint32_t i = worker->inflight_count; i > 0; i--) {
+        EvolutionRemoteTask* task = &pool->tasks[worker->inflight[i - 1]];
+        if (task->state == REMOTE_TASK_SENT && task->owner == index) {
+            task->state = REMOTE_TASK_QUEUED;
+            task->owner = REMOTE_NO_OWNER;
+            Queue_PushFront(pool, worker->inflight[i - 1]);
+            pool->stats.tasks_resubmitted++;
+        }
+    }
+    worker->inflight_count = 0;
+    worker->outstanding = 0;
+    pool->stats.worker_deaths++;
+}
+
+static bool Remote_SpawnWorker(EvolutionRemotePool* pool, uint32_t index) {
+    char exe_path[MAX_PATH];
+    if (GetModuleFileNameA(NULL, exe_path, MAX_PATH) == 0) return false;
+
+    char cmdline[MAX_PATH + 128];
+    snprintf(cmdline, sizeof(cmdline), "\"%s\" --eval-worker %u %u %016llx", exe_path,
+             (unsigned)pool->port, index, (unsigned long long)pool->token);
+    STARTUPINFOA si;
+    PROCESS_INFORMATION pi;
+    memset(&si, 0, sizeof(si));
+    memset(&pi, 0, sizeof(pi));
+    si.cb = sizeof(si);
+    if (!CreateProcessA(NULL, cmdline, NULL, NULL, FALSE, 0, NULL, NULL, &si, &pi)) return false;
+    CloseHandle(pi.hThread);
+    pool->workers[index].process = pi.hProcess;
+    return true;
+}
+
+// HELLO -> CONFIG -> READY on a freshly accepted connection; true once the worker is live
+static bool Remote_Handshake(EvolutionRemotePool* pool, SOCKET s, uint32_t timeout_ms) {
+    EvolutionRemoteFrameHeader hdr;
+    if (!Remote_WaitReadable(s, timeout_ms)) return false;
+    if (!Remote_RecvFrame(s, &hdr, &pool->buffer, &pool->buffer_capacity, &pool->stats.bytes_received)) return false;
+    if (hdr.type != EVOLUTION_REMOTE_HELLO || hdr.length != sizeof(RemoteHello)) return false;
+
+    RemoteHello hello;
+    memcpy(&hello, pool->buffer, sizeof(hello));
+    uint32_t index = hdr.task;
+    if (hello.version != EVOLUTION_REMOTE_VERSION || hello.token != pool->token) return false;
+    if (index >= pool->config.worker_count || pool->workers[index].alive) return false;
+
+    RemoteConfigPayload* config = (RemoteConfigPayload*)calloc(1, sizeof(RemoteConfigPayload));
+    if (!config) return false;
+    config->use_neural = pool->config.use_neural ? 1u : 0u;
+    config->params_size = (uint32_t)sizeof(EvolutionParameters);
+    memcpy(&config->params, &pool->params, sizeof(EvolutionParameters));
+    memcpy(config->substrate_path, pool->config.substrate_path, sizeof(config->substrate_path));
+    bool sent = Remote_SendFrame(s, EVOLUTION_REMOTE_CONFIG, 0, index, config, sizeof(RemoteConfigPayload),
+                                 &pool->stats.bytes_sent);
+    free(config);
+    if (!sent) return false;
+
+    // Substrate setup on the worker can take a while; it gets the whole connect budget
+    if (!Remote_WaitReadable(s, pool->config.connect_timeout_ms)) return false;
+    if (!Remote_RecvFrame(s, &hdr, &pool->buffer, &pool->buffer_capacity, &pool->stats.bytes_received)) return false;
+    if (hdr.type != EVOLUTION_REMOTE_READY || !NT_SUCCESS((NTSTATUS)hdr.task)) return false;
+
+    EvolutionRemoteWorker* worker = &pool->workers[index];
+    worker->socket = (uintptr_t)s;
+    worker->pid = hello.pid;
+    worker->inflight_count = 0;
+    worker->last_activity_ms = GetTickCount64();
+    worker->alive = true;
+    return true;
+}
+
+// Accepts connections until `expected` workers completed the handshake or the timeout passes
+static uint32_t Remote_AcceptWorkers(EvolutionRemotePool* pool, uint32_t expected, uint32_t timeout_ms) {
+    SOCKET listener = (SOCKET)pool->listener;
+    uint64_t deadline = GetTickCount64() + timeout_ms;
+    uint32_t accepted = 0;
+    while (accepted < expected) {
+        uint64_t now = GetTickCount64();
+        if (now >= deadline) break;
+        if (!Remote_WaitReadable(listener, (uint32_t)(deadline - now))) continue;
+        SOCKET s = accept(listener, NULL, NULL);
+        if (s == INVALID_SOCKET) continue;
+        Remote_SetNoDelay(s);
+        now = GetTickCount64();
+        if (now < deadline && Remote_Handshake(pool, s, (uint32_t)(deadline - now))) {
+            accepted++;
+        } else {
+            closesocket(s);
+        }
+    }
+    return accepted;
+}
+
+static void Remote_Respawn(EvolutionRemotePool* pool) {
+    if (!pool->config.spawn_workers) return;
+    uint32_t spawned = 0;
+    for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+        EvolutionRemoteWorker* worker = &pool->workers[w];
+        if (worker->alive || pool->respawns >= pool->config.max_respawns) continue;
+        pool->respawns++;
+        if (Remote_SpawnWorker(pool, w)) spawned++;
+    }
+    if (spawned == 0) return;
+    uint32_t accepted = Remote_AcceptWorkers(pool, spawned, pool->config.connect_timeout_ms);
+    pool->stats.workers_respawned += accepted;
+    // Slots whose process never checked in are left dead with no process attached
+    for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+        EvolutionRemoteWorker* worker = &pool->workers[w];
+        if (!worker->alive && worker->process) {
+            TerminateProcess(worker->process, 1);
+            CloseHandle(worker->process);
+            worker->process = NULL;
+        }
+    }
+}
+
+// Batch dispatch
+
+// A backup copy leaves the task with its owner; whichever copy answers first wins
+static bool Remote_SendTask(EvolutionRemotePool* pool, uint32_t index, uint32_t id,
+                            void* const* genomes, const size_t* genome_sizes, bool backup) {
+    EvolutionRemoteWorker* worker = &pool->workers[index];
+    EvolutionRemoteTask* task = &pool->tasks[id];
+
+    size_t header = sizeof(EvolutionRemoteFrameHeader);
+    size_t payload = AlignUp8(sizeof(RemoteBatchPrefix) + task->count * sizeof(uint32_t));
+    for (uint32_t k = 0; k < task->count; k++) payload += AlignUp8(genome_sizes[task->first + k]);
+    if (!Remote_ReserveBuffer(pool, header + payload)) return false;
+
+    uint8_t* frame = pool->buffer;
+    memset(frame, 0, header + payload);
+    EvolutionRemoteFrameHeader hdr;
+    hdr.magic = EVOLUTION_REMOTE_MAGIC;
+    hdr.type = EVOLUTION_REMOTE_EVAL;
+    hdr.reserved = 0;
+    hdr.batch = pool->batch;
+    hdr.task = id;
+    hdr.length = (uint32_t)payload;
+    memcpy(frame, &hdr, header);
+
+    uint8_t* body = frame + header;
+    RemoteBatchPrefix prefix = { task->count, 0 };
+    memcpy(body, &prefix, sizeof(prefix));
+    uint32_t* sizes = (uint32_t*)(body + sizeof(prefix));
+    size_t offset = AlignUp8(sizeof(RemoteBatchPrefix) + task->count * sizeof(uint32_t));
+    for (uint32_t k = 0; k < task->count; k++) {
+        size_t bytes = genome_sizes[task->first + k];
+        sizes[k] = (uint32_t)bytes;
+        memcpy(body + offset, genomes[task->first + k], bytes);
+        offset += AlignUp8(bytes);
+    }
+
+    if (!Remote_SendAll((SOCKET)worker->socket, frame, header + payload)) return false;
+    pool->stats.bytes_sent += header + payload;
+    pool->stats.tasks_sent++;
+
+    uint64_t now = GetTickCount64();
+    if (worker->outstanding == 0) worker->last_activity_ms = now;
+    worker->outstanding++;
+    worker->inflight[worker->inflight_count++] = id;
+    if (backup) {
+        task->backup = true;
+    } else {
+        task->state = REMOTE_TASK_SENT;
+        task->owner = index;
+        task->sent_ms = now;
+    }
+    return true;
+}
+
+// Fills every live pipeline from the queue. Once the queue is dry, each idle worker steals the
+// newest (not yet started) task from the deepest pipeline and the victim is told to drop it;
+// with nothing left to steal it runs a backup copy of the oldest task still running elsewhere,
+// so one slow worker does not hold the whole batch
+static void Remote_Dispatch(EvolutionRemotePool* pool, void* const* genomes, const size_t* genome_sizes) {
+    uint32_t depth = pool->config.pipeline_depth;
+    for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+        EvolutionRemoteWorker* worker = &pool->workers[w];
+        while (worker->alive && worker->outstanding < depth && pool->queue_count > 0) {
+            uint32_t id = Queue_PopFront(pool);
+            if (pool->tasks[id].state == REMOTE_TASK_DONE) continue;  // answered by a steal victim
+            if (!Remote_SendTask(pool, w, id, genomes, genome_sizes, false)) {
+                Queue_PushFront(pool, id);
+                Remote_DropWorker(pool, w);
+            }
+        }
+    }
+    if (pool->queue_count > 0) return;
+
+    for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+        EvolutionRemoteWorker* thief = &pool->workers[w];
+        if (!thief->alive || thief->outstanding > 0) continue;
+
+        uint32_t victim = REMOTE_NO_OWNER;
+        uint32_t deepest = 1;
+        for (uint32_t v = 0; v < pool->config.worker_count; v++) {
+            const EvolutionRemoteWorker* candidate = &pool->workers[v];
+            if (candidate->alive && candidate->inflight_count > deepest) {
+                deepest = candidate->inflight_count;
+                victim = v;
+            }
+        }
+        if (victim == REMOTE_NO_OWNER) {
+            uint32_t oldest = REMOTE_NO_OWNER;
+            for (uint32_t v = 0; v < pool->config.worker_count; v++) {
+                const EvolutionRemoteWorker* candidate = &pool->workers[v];
+                if (v == w || !candidate->alive || candidate->inflight_count == 0) continue;
+                const EvolutionRemoteTask* running = &pool->tasks[candidate->inflight[0]];
+                if (running->state != REMOTE_TASK_SENT || running->owner != v || running->backup) continue;
+                if (oldest == REMOTE_NO_OWNER || running->sent_ms < pool->tasks[oldest].sent_ms)
+                    oldest = candidate->inflight[0];
+            }
+            if (oldest == REMOTE_NO_OWNER) break;
+            if (Remote_SendTask(pool, w, oldest, genomes, genome_sizes, true)) {
+                pool->stats.tasks_backed_up++;
+            } else {
+                Remote_DropWorker(pool, w);
+            }
+            continue;
+        }
+
+        EvolutionRemoteWorker* from = &pool->workers[victim];
+        uint32_t id = from->inflight[--from->inflight_count];
+        pool->tasks[id].state = REMOTE_TASK_QUEUED;
+        pool->tasks[id].owner = REMOTE_NO_OWNER;
+        if (!Remote_SendFrame((SOCKET)from->socket, EVOLUTION_REMOTE_CANCEL, pool->batch, id, NULL, 0,
+                              &pool->stats.bytes_sent)) {
+            Remote_DropWorker(pool, victim);
+        }
+        if (Remote_SendTask(pool, w, id, genomes, genome_sizes, false)) {
+            pool->stats.tasks_stolen++;
+        } else {
+            Queue_PushFront(pool, id);
+            Remote_DropWorker(pool, w);
+            return;
+        }
+    }
+}
+
+static void Remote_HandleResult(EvolutionRemotePool* pool, uint32_t index, const EvolutionRemoteFrameHeader* hdr,
+                                double* fitness, uint32_t* done) {
+    EvolutionRemoteWorker* worker = &pool->workers[index];
+    if (hdr->batch != pool->batch || hdr->task >= pool->task_count) {
+        pool->stats.results_discarded++;
+        return;
+    }
+    EvolutionRemoteTask* task = &pool->tasks[hdr->task];
+    RemoteBatchPrefix prefix;
+    if (hdr->length != sizeof(prefix) + task->count * sizeof(double)) {
+        Remote_DropWorker(pool, index);
+        return;
+    }
+    memcpy(&prefix, pool->buffer, sizeof(prefix));
+    if (prefix.count != task->count) {
+        Remote_DropWorker(pool, index);
+        return;
+    }
+    Remote_InflightRemove(worker, hdr->task);
+    if (task->state == REMOTE_TASK_DONE) {
+        pool->stats.results_discarded++;
+        return;
+    }
+    // The answer may come from a steal victim that finished before its CANCEL arrived, or from a
+    // backup copy; either way the owner's copy is now the duplicate and its slot is released
+    if (task->state == REMOTE_TASK_SENT && task->owner != index) {
+        Remote_InflightRemove(&pool->workers[task->owner], hdr->task);
+    }
+    memcpy(&fitness[task->first], pool->buffer + sizeof(prefix), task->count * sizeof(double));
+    task->state = REMOTE_TASK_DONE;
+    task->owner = REMOTE_NO_OWNER;
+    worker->tasks_completed++;
+    pool->stats.genomes_evaluated += task->count;
+    (*done)++;
+}
+
+static void Remote_Poll(EvolutionRemotePool* pool, double* fitness, uint32_t* done, uint32_t timeout_ms) {
+    fd_set set;
+    FD_ZERO(&set);
+    SOCKET highest = 0;
+    for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+        if (!pool->workers[w].alive) continue;
+        SOCKET s = (SOCKET)pool->workers[w].socket;
+        FD_SET(s, &set);
+        if (s > highest) highest = s;
+    }
+    struct timeval tv;
+    tv.tv_sec = (long)(timeout_ms / 1000);
+    tv.tv_usec = (long)(timeout_ms % 1000) * 1000;
+    if (select((int)highest + 1, &set, NULL, NULL, &tv) <= 0) return;
+
+    for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+        EvolutionRemoteWorker* worker = &pool->workers[w];
+        if (!worker->alive || !FD_ISSET((SOCKET)worker->socket, &set)) continue;
+        EvolutionRemoteFrameHeader hdr;
+        if (!Remote_RecvFrame((SOCKET)worker->socket, &hdr, &pool->buffer, &pool->buffer_capacity,
+                              &pool->stats.bytes_received) ||
+            (hdr.type != EVOLUTION_REMOTE_RESULT && hdr.type != EVOLUTION_REMOTE_CANCELLED)) {
+            Remote_DropWorker(pool, w);
+            continue;
+        }
+        worker->last_activity_ms = GetTickCount64();
+        if (worker->outstanding > 0) worker->outstanding--;
+        if (hdr.type == EVOLUTION_REMOTE_RESULT) Remote_HandleResult(pool, w, &hdr, fitness, done);
+    }
+}
+
+static void Remote_CheckTimeouts(EvolutionRemotePool* pool) {
+    uint64_t now = GetTickCount64();
+    for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+        EvolutionRemoteWorker* worker = &pool->workers[w];
+        if (worker->alive && worker->outstanding > 0 &&
+            now - worker->last_activity_ms > pool->config.task_timeout_ms) {
+            Remote_DropWorker(pool, w);
+        }
+    }
+}
+
+// Public API
+
+void EvolutionRemote_GetDefaultConfig(EvolutionRemoteConfig* config) {
+    if (!config) return;
+    memset(config, 0, sizeof(EvolutionRemoteConfig));
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    config->worker_count = si.dwNumberOfProcessors > 0 ? si.dwNumberOfProcessors : 1;
+    if (config->worker_count > EVOLUTION_REMOTE_MAX_WORKERS) config->worker_count = EVOLUTION_REMOTE_MAX_WORKERS;
+    config->pipeline_depth = EVOLUTION_REMOTE_DEFAULT_PIPELINE;
+    config->connect_timeout_ms = EVOLUTION_REMOTE_DEFAULT_CONNECT_TIMEOUT_MS;
+    config->task_timeout_ms = EVOLUTION_REMOTE_DEFAULT_TASK_TIMEOUT_MS;
+    config->max_respawns = EVOLUTION_REMOTE_DEFAULT_RESPAWNS;
+    config->spawn_workers = true;
+    config->use_neural = true;
+}
+
+NTSTATUS EvolutionRemote_Initialize(EvolutionRemotePool* pool, const EvolutionRemoteConfig* config,
+    const EvolutionParameters* params) {
+    if (!pool || !config || !params) return STATUS_INVALID_PARAMETER;
+    if (pool->initialized) return STATUS_SUCCESS;
+    if (config->worker_count == 0 || config->worker_count > EVOLUTION_REMOTE_MAX_WORKERS) return STATUS_INVALID_PARAMETER;
+
+    memset(pool, 0, sizeof(EvolutionRemotePool));
+    memcpy(&pool->config, config, sizeof(EvolutionRemoteConfig));
+    pool->config.substrate_path[EVOLUTION_REMOTE_PATH_MAX - 1] = '\0';
+    if (pool->config.pipeline_depth == 0) pool->config.pipeline_depth = EVOLUTION_REMOTE_DEFAULT_PIPELINE;
+    if (pool->config.pipeline_depth > EVOLUTION_REMOTE_MAX_PIPELINE) pool->config.pipeline_depth = EVOLUTION_REMOTE_MAX_PIPELINE;
+    if (pool->config.connect_timeout_ms == 0) pool->config.connect_timeout_ms = EVOLUTION_REMOTE_DEFAULT_CONNECT_TIMEOUT_MS;
+    if (pool->config.task_timeout_ms == 0) pool->config.task_timeout_ms = EVOLUTION_REMOTE_DEFAULT_TASK_TIMEOUT_MS;
+    memcpy(&pool->params, params, sizeof(EvolutionParameters));
+    pool->listener = (uintptr_t)INVALID_SOCKET;
+    for (uint32_t w = 0; w < EVOLUTION_REMOTE_MAX_WORKERS; w++) pool->workers[w].socket = (uintptr_t)INVALID_SOCKET;
+
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) return STATUS_UNSUCCESSFUL;
+    pool->wsa_started = true;
+
+    pool->token = config->token;
+    if (pool->token == 0) {
+        LARGE_INTEGER qpc;
+        QueryPerformanceCounter(&qpc);
+        EvolutionRng rng;
+        EvolutionRng_Seed(&rng, (uint64_t)qpc.QuadPart ^ ((uint64_t)GetCurrentProcessId() << 32) ^
+                                (uint64_t)(uintptr_t)pool);
+        pool->token = EvolutionRng_Next(&rng) | 1;
+    }
+
+    SOCKET listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listener == INVALID_SOCKET) {
+        EvolutionRemote_Shutdown(pool);
+        return STATUS_UNSUCCESSFUL;
+    }
+    pool->listener = (uintptr_t)listener;
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(pool->config.port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addr_len = (socklen_t)sizeof(addr);
+    if (bind(listener, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        listen(listener, EVOLUTION_REMOTE_MAX_WORKERS) != 0 ||
+        getsockname(listener, (struct sockaddr*)&addr, &addr_len) != 0) {
+        EvolutionRemote_Shutdown(pool);
+        return STATUS_UNSUCCESSFUL;
+    }
+    pool->port = ntohs(addr.sin_port);
+
+    uint32_t expected = pool->config.worker_count;
+    if (pool->config.spawn_workers) {
+        expected = 0;
+        for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+            if (Remote_SpawnWorker(pool, w)) expected++;
+        }
+    }
+    if (expected > 0) Remote_AcceptWorkers(pool, expected, pool->config.connect_timeout_ms);
+    for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+        EvolutionRemoteWorker* worker = &pool->workers[w];
+        if (!worker->alive && worker->process) {
+            TerminateProcess(worker->process, 1);
+            CloseHandle(worker->process);
+            worker->process = NULL;
+        }
+    }
+
+    if (EvolutionRemote_LiveWorkers(pool) == 0) {
+        EvolutionRemote_Shutdown(pool);
+        return STATUS_UNSUCCESSFUL;
+    }
+    pool->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void EvolutionRemote_Shutdown(EvolutionRemotePool* pool) {
+    if (!pool) return;
+    for (uint32_t w = 0; w < EVOLUTION_REMOTE_MAX_WORKERS; w++) {
+        EvolutionRemoteWorker* worker = &pool->workers[w];
+        if (worker->alive) {
+            Remote_SendFrame((SOCKET)worker->socket, EVOLUTION_REMOTE_SHUTDOWN, pool->batch, 0, NULL, 0, NULL);
+            shutdown((SOCKET)worker->socket, SD_BOTH);
+            closesocket((SOCKET)worker->socket);
+            worker->socket = (uintptr_t)INVALID_SOCKET;
+            worker->alive = false;
+        }
+        if (worker->process) {
+            if (WaitForSingleObject(worker->process, REMOTE_SHUTDOWN_WAIT_MS) != WAIT_OBJECT_0)
+                TerminateProcess(worker->process, 1);
+            CloseHandle(worker->process);
+            worker->process = NULL;
+        }
+    }
+    if ((SOCKET)pool->listener != INVALID_SOCKET) {
+        closesocket((SOCKET)pool->listener);
+        pool->listener = (uintptr_t)INVALID_SOCKET;
+    }
+    free(pool->tasks);
+    free(pool->queue);
+    free(pool->buffer);
+    pool->tasks = NULL;
+    pool->queue = NULL;
+    pool->buffer = NULL;
+    pool->task_capacity = 0;
+    pool->buffer_capacity = 0;
+    if (pool->wsa_started) {
+        WSACleanup();
+        pool->wsa_started = false;
+    }
+    pool->initialized = false;
+}
+
+NTSTATUS EvolutionRemote_EvaluateBatch(void* const* genomes, const size_t* genome_sizes,
+    uint32_t count, double* fitness, void* context) {
+    EvolutionRemotePool* pool = (EvolutionRemotePool*)context;
+    if (!pool || !pool->initialized || !genomes || !genome_sizes || !fitness) return STATUS_INVALID_PARAMETER;
+    if (count == 0) return STATUS_SUCCESS;
+
+    LARGE_INTEGER freq, start, end;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&start);
+
+    Remote_Respawn(pool);
+    uint32_t live = EvolutionRemote_LiveWorkers(pool);
+    if (live == 0) return STATUS_INVALID_DEVICE_STATE;
+
+    // Task size: about two tasks per pipeline slot leaves idle workers something to steal,
+    // capped so that one EVAL frame stays well under the frame limit
+    size_t largest = 0;
+    for (uint32_t k = 0; k < count; k++) {
+        if (genome_sizes[k] > largest) largest = genome_sizes[k];
+    }
+    size_t frame_budget = EVOLUTION_REMOTE_MAX_FRAME / 2;
+    if (AlignUp8(largest) + 64 > frame_budget) return STATUS_INVALID_PARAMETER;
+    uint32_t per_task = pool->config.task_genomes;
+    if (per_task == 0) {
+        uint32_t slots = live * pool->config.pipeline_depth * 2;
+        per_task = (count + slots - 1) / slots;
+    }
+    uint32_t frame_cap = (uint32_t)(frame_budget / (AlignUp8(largest) + sizeof(uint32_t)));
+    if (per_task > frame_cap) per_task = frame_cap;
+    if (per_task == 0) per_task = 1;
+
+    uint32_t task_count = (count + per_task - 1) / per_task;
+    if (!Remote_ReserveTasks(pool, task_count)) return STATUS_INSUFFICIENT_RESOURCES;
+    pool->batch++;
+    pool->task_count = task_count;
+    pool->queue_head = 0;
+    pool->queue_count = 0;
+    for (uint32_t t = 0; t < task_count; t++) {
+        EvolutionRemoteTask* task = &pool->tasks[t];
+        task->first = t * per_task;
+        task->count = (count - task->first) < per_task ? (count - task->first) : per_task;
+        task->owner = REMOTE_NO_OWNER;
+        task->sent_ms = 0;
+        task->state = REMOTE_TASK_QUEUED;
+        task->backup = false;
+        Queue_PushBack(pool, t);
+    }
+
+    NTSTATUS status = STATUS_SUCCESS;
+    uint32_t done = 0;
+    while (done < task_count) {
+        Remote_Dispatch(pool, genomes, genome_sizes);
+        if (EvolutionRemote_LiveWorkers(pool) == 0) {
+            Remote_Respawn(pool);
+            if (EvolutionRemote_LiveWorkers(pool) == 0) {
+                status = STATUS_INVALID_DEVICE_STATE;
+                break;
+            }
+            continue;
+        }
+        Remote_Poll(pool, fitness, &done, REMOTE_POLL_MS);
+        Remote_CheckTimeouts(pool);
+    }
+
+    // Anything still in a pipeline is a duplicate of a finished task
+    for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+        EvolutionRemoteWorker* worker = &pool->workers[w];
+        for (uint32_t i = 0; worker->alive && i < worker->inflight_count; i++) {
+            if (!Remote_SendFrame((SOCKET)worker->socket, EVOLUTION_REMOTE_CANCEL, pool->batch,
+                                  worker->inflight[i], NULL, 0, &pool->stats.bytes_sent)) {
+                worker->inflight_count = 0;
+                Remote_DropWorker(pool, w);
+            }
+        }
+        worker->inflight_count = 0;
+    }
+    pool->queue_count = 0;
+
+    QueryPerformanceCounter(&end);
+    pool->stats.last_batch_ms = (double)(end.QuadPart - start.QuadPart) * 1000.0 / (double)freq.QuadPart;
+    pool->stats.batches++;
+    return status;
+}
+
+NTSTATUS EvolutionRemote_Attach(EvolutionRemotePool* pool, EvolutionEngine* engine) {
+    if (!pool || !pool->initialized || !engine) return STATUS_INVALID_PARAMETER;
+    return EvolutionEngine_SetBatchFitnessFunction(engine, EvolutionRemote_EvaluateBatch, pool);
+}
+
+uint32_t EvolutionRemote_LiveWorkers(const EvolutionRemotePool* pool) {
+    if (!pool) return 0;
+    uint32_t live = 0;
+    for (uint32_t w = 0; w < pool->config.worker_count; w++) {
+        if (pool->workers[w].alive) live++;
+    }
+    return live;
+}
+
+NTSTATUS EvolutionRemote_GetStats(const EvolutionRemotePool* pool, EvolutionRemoteStats* out) {
+    if (!pool || !out) return STATUS_INVALID_PARAMETER;
+    memcpy(out, &pool->stats, sizeof(EvolutionRemoteStats));
+    return STATUS_SUCCESS;
+}
+
+// Worker process
+
+typedef struct RemoteWorkerTask {
+    uint32_t batch;
+    uint32_t task;
+    uint8_t* payload;                    /* owned EVAL payload */
+    uint32_t length;
+} RemoteWorkerTask;
+
+static NTSTATUS Remote_EvaluateTask(EvolutionEngine* engine, const RemoteWorkerTask* task, double* fitness) {
+    RemoteBatchPrefix prefix;
+    if (task->length < sizeof(prefix)) return STATUS_DATA_ERROR;
+    memcpy(&prefix, task->payload, sizeof(prefix));
+    uint32_t count = prefix.count;
+    size_t offset = AlignUp8(sizeof(prefix) + (size_t)count * sizeof(uint32_t));
+    if (count == 0 || offset > task->length) return STATUS_DATA_ERROR;
+
+    void** genomes = (void**)malloc(count * sizeof(void*));
+    size_t* sizes = (size_t*)malloc(count * sizeof(size_t));
+    if (!genomes || !sizes) {
+        free(genomes);
+        free(sizes);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    const uint32_t* wire_sizes = (const uint32_t*)(task->payload + sizeof(prefix));
+    NTSTATUS status = STATUS_SUCCESS;
+    for (uint32_t k = 0; k < count; k++) {
+        sizes[k] = wire_sizes[k];
+        genomes[k] = task->payload + offset;
+        offset += AlignUp8(sizes[k]);
+        if (offset > task->length) {
+            status = STATUS_DATA_ERROR;
+            break;
+        }
+    }
+
+    if (NT_SUCCESS(status)) {
+        bool batched = engine->batch_fitness_function &&
+                       NT_SUCCESS(engine->batch_fitness_function(genomes, sizes, count, fitness,
+                                                                 engine->batch_fitness_context));
+        if (!batched) {
+            for (uint32_t k = 0; k < count; k++)
+                fitness[k] = engine->fitness_function(genomes[k], sizes[k], engine->fitness_context);
+        }
+    }
+    free(genomes);
+    free(sizes);
+    return status;
+}
+
+// Serves EVAL frames in arrival order. Whatever has already arrived is drained before each task
+// starts, so a CANCEL for a queued task is honoured before the worker gets to it
+static void Remote_WorkerLoop(SOCKET s, EvolutionEngine* engine) {
+    RemoteWorkerTask* queue = NULL;
+    uint32_t queued = 0;
+    uint32_t capacity = 0;
+    uint8_t* scratch = NULL;
+    size_t scratch_capacity = 0;
+    bool running = true;
+
+    while (running) {
+        bool block = (queued == 0);
+        while (running && (block || Remote_WaitReadable(s, 0))) {
+            block = false;
+            EvolutionRemoteFrameHeader hdr;
+            if (!Remote_RecvFrame(s, &hdr, &scratch, &scratch_capacity, NULL)) {
+                running = false;
+                break;
+            }
+            if (hdr.type == EVOLUTION_REMOTE_EVAL) {
+                if (queued == capacity) {
+                    uint32_t grown = capacity ? capacity * 2 : EVOLUTION_REMOTE_MAX_PIPELINE;
+                    RemoteWorkerTask* next = (RemoteWorkerTask*)realloc(queue, grown * sizeof(RemoteWorkerTask));
+                    if (!next) {
+                        running = false;
+                        break;
+                    }
+                    queue = next;
+                    capacity = grown;
+                }
+                // The task keeps the receive buffer; the next frame gets a fresh one
+                RemoteWorkerTask* task = &queue[queued++];
+                task->batch = hdr.batch;
+                task->task = hdr.task;
+                task->payload = scratch;
+                task->length = hdr.length;
+                scratch = NULL;
+                scratch_capacity = 0;
+            } else if (hdr.type == EVOLUTION_REMOTE_CANCEL) {
+                // Only a task that never started is acknowledged; one already answered needs nothing
+                for (uint32_t i = 0; i < queued; i++) {
+                    if (queue[i].batch != hdr.batch || queue[i].task != hdr.task) continue;
+                    free(queue[i].payload);
+                    memmove(&queue[i], &queue[i + 1], (queued - i - 1) * sizeof(RemoteWorkerTask));
+                    queued--;
+                    running = Remote_SendFrame(s, EVOLUTION_REMOTE_CANCELLED, hdr.batch, hdr.task, NULL, 0, NULL);
+                    break;
+                }
+            } else {
+                running = false;  // SHUTDOWN, or a frame a worker never expects
+            }
+        }
+        if (!running || queued == 0) continue;
+
+        RemoteWorkerTask task = queue[0];
+        memmove(&queue[0], &queue[1], (queued - 1) * sizeof(RemoteWorkerTask));
+        queued--;
+
+        RemoteBatchPrefix prefix = { 0, 0 };
+        if (task.length >= sizeof(prefix)) memcpy(&prefix, task.payload, sizeof(prefix));
+        size_t result_size = sizeof(prefix) + (size_t)prefix.count * sizeof(double);
+        uint8_t* result = (prefix.count > 0 && task.length >= sizeof(prefix) + prefix.count * sizeof(uint32_t))
+                              ? (uint8_t*)malloc(result_size) : NULL;
+        if (!result || !NT_SUCCESS(Remote_EvaluateTask(engine, &task, (double*)(result + sizeof(prefix))))) {
+            running = false;  // the pool resubmits the task elsewhere once the socket closes
+        } else {
+            memcpy(result, &prefix, sizeof(prefix));
+            running = Remote_SendFrame(s, EVOLUTION_REMOTE_RESULT, task.batch, task.task,
+                                       result, (uint32_t)result_size, NULL);
+        }
+        free(result);
+        free(task.payload);
+    }
+
+    for (uint32_t i = 0; i < queued; i++) free(queue[i].payload);
+    free(queue);
+    free(scratch);
+}
+
+int EvolutionRemote_WorkerMain(uint16_t port, uint32_t index, uint64_t token) {
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) return 1;
+
+    int exit_code = 1;
+    SOCKET s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s == INVALID_SOCKET) {
+        WSACleanup();
+        return 1;
+    }
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    RemoteHello hello;
+    hello.version = EVOLUTION_REMOTE_VERSION;
+    hello.pid = (uint32_t)GetCurrentProcessId();
+    hello.token = token;
+
+    uint8_t* buffer = NULL;
+    size_t capacity = 0;
+    EvolutionRemoteFrameHeader hdr;
+    bool configured = false;
+    if (connect(s, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+        Remote_SetNoDelay(s);
+        configured = Remote_SendFrame(s, EVOLUTION_REMOTE_HELLO, 0, index, &hello, sizeof(hello), NULL) &&
+                     Remote_RecvFrame(s, &hdr, &buffer, &capacity, NULL) &&
+                     hdr.type == EVOLUTION_REMOTE_CONFIG && hdr.length == sizeof(RemoteConfigPayload);
+    }
+    if (configured) {
+        RemoteConfigPayload* config = (RemoteConfigPayload*)buffer;
+        NTSTATUS status = STATUS_SUCCESS;
+        NeuralSubstrate* neural = NULL;
+        EvolutionEngine* engine = NULL;
+
+        if (config->params_size != sizeof(EvolutionParameters)) status = STATUS_DATA_ERROR;
+        config->substrate_path[EVOLUTION_REMOTE_PATH_MAX - 1] = '\0';
+        if (NT_SUCCESS(status) && config->use_neural) {
+            neural = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+            status = neural ? NeuralSubstrate_Initialize(neural) : STATUS_INSUFFICIENT_RESOURCES;
+            if (NT_SUCCESS(status) && config->substrate_path[0])
+                status = NeuralSubstrate_LoadState(neural, config->substrate_path);
+        }
+        if (NT_SUCCESS(status)) {
+            // The worker only evaluates; a token population keeps the engine's allocation small
+            EvolutionParameters params;
+            memcpy(&params, &config->params, sizeof(EvolutionParameters));
+            params.population_size = 2;
+            engine = (EvolutionEngine*)calloc(1, sizeof(EvolutionEngine));
+            status = engine ? EvolutionEngine_Initialize(engine, &params, neural, NULL)
+                            : STATUS_INSUFFICIENT_RESOURCES;
+        }
+
+        if (Remote_SendFrame(s, EVOLUTION_REMOTE_READY, 0, (uint32_t)status, NULL, 0, NULL) && NT_SUCCESS(status)) {
+            Remote_WorkerLoop(s, engine);
+            exit_code = 0;
+        }
+
+        if (engine) {
+            if (engine->initialized) EvolutionEngine_Shutdown(engine);
+            free(engine);
+        }
+        if (neural) {
+            if (neural->initialized) NeuralSubstrate_Shutdown(neural);
+            free(neural);
+        }
+    }
+
+    free(buffer);
+    closesocket(s);
+    WSACleanup();
+    return exit_code;
+}
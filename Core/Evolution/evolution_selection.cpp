@@ -0,0 +1,411 @@
+/*
+ * Evolution Selection - Raijin
+ * Owner: Core/Evolution
+ * Inputs: Per-individual fitness of the evaluated population; engine RNG
+ * Outputs: Elite indices (true top-k) and parent indices
+ * Invariants: Ties and NaN are ordered deterministically (NaN ranks last, equal fitness
+ *             prefers the lower index), so a seeded run selects the same parents every time
+ * Budget: O(n) per generation to prepare (introselect, radix ranking, alias build);
+ *         O(1) per roulette/rank/truncation draw, O(tournament_size) per tournament draw
+ * Failure modes: Allocation failure on Initialize/Build
+ * Recovery: Degenerate weights (all equal, non-finite) fall back to uniform sampling
+ */
+
+#include "../../Include/evolution_selection.h"
+#include <windows.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#define SELECTION_INSERTION_THRESHOLD 16
+#define SELECTION_RADIX_BITS 11
+#define SELECTION_RADIX_BUCKETS (1u << SELECTION_RADIX_BITS)
+
+// Strict total order: higher fitness first, NaN last, ties to the lower index
+static inline double Selection_Score(const double* f, uint32_t i) {
+    double v = f[i];
+    return (v == v) ? v : -HUGE_VAL;
+}
+
+static inline bool Selection_Better(const double* f, uint32_t a, uint32_t b) {
+    double fa = Selection_Score(f, a);
+    double fb = Selection_Score(f, b);
+    return fa > fb || (fa == fb && a < b);
+}
+
+static inline void Selection_Swap(uint32_t* idx, uint32_t a, uint32_t b) {
+    uint32_t t = idx[a];
+    idx[a] = idx[b];
+    idx[b] = t;
+}
+
+static void Selection_InsertionSort(const double* f, uint32_t* idx, uint32_t lo, uint32_t hi) {
+    for (uint32_t i = lo + 1; i <= hi; i++) {
+        uint32_t v = idx[i];
+        uint32_t j = i;
+        while (j > lo && Selection_Better(f, v, idx[j - 1])) {
+            idx[j] = idx[j - 1];
+            j--;
+        }
+        idx[j] = v;
+    }
+}
+
+// Heapsort fallback once partitioning degenerates; the root is the worst element
+static void Selection_SiftDown(const double* f, uint32_t* base, uint32_t root, uint32_t n) {
+    for (;;) {
+        uint32_t child = 2 * root + 1;
+        if (child >= n) return;
+        if (child + 1 < n && Selection_Better(f, base[child], base[child + 1])) child++;
+        if (!Selection_Better(f, base[root], base[child])) return;
+        Selection_Swap(base, root, child);
+        root = child;
+    }
+}
+
+static void Selection_HeapSort(const double* f, uint32_t* idx, uint32_t lo, uint32_t hi) {
+    uint32_t* base = idx + lo;
+    uint32_t n = hi - lo + 1;
+    for (uint32_t i = n / 2; i-- > 0;) Selection_SiftDown(f, base, i, n);
+    for (uint32_t end = n - 1; end > 0; end--) {
+        Selection_Swap(base, 0, end);
+        Selection_SiftDown(f, base, 0, end);
+    }
+}
+
+// Median-of-three Lomuto partition; returns the pivot's final position
+static uint32_t Selection_Partition(const double* f, uint32_t* idx, uint32_t lo, uint32_t hi) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (Selection_Better(f, idx[mid], idx[lo])) Selection_Swap(idx, mid, lo);
+    if (Selection_Better(f, idx[hi], idx[lo])) Selection_Swap(idx, hi, lo);
+    if (Selection_Better(f, idx[hi], idx[mid])) Selection_Swap(idx, hi, mid);
+    Selection_Swap(idx, mid, hi);
+    uint32_t pivot = idx[hi];
+    uint32_t store = lo;
+    for (uint32_t i = lo; i < hi; i++) {
+        if (Selection_Better(f, idx[i], pivot)) Selection_Swap(idx, i, store++);
+    }
+    Selection_Swap(idx, store, hi);
+    return store;
+}
+
+static uint32_t Selection_DepthLimit(uint32_t n) {
+    uint32_t depth = 0;
+    while (n > 1) {
+        n >>= 1;
+        depth += 2;
+    }
+    return depth;
+}
+
+static void Selection_Sort(const double* f, uint32_t* idx, uint32_t lo, uint32_t hi, uint32_t depth) {
+    while (hi > lo && hi - lo >= SELECTION_INSERTION_THRESHOLD) {
+        if (depth-- == 0) {
+            Selection_HeapSort(f, idx, lo, hi);
+            return;
+        }
+        uint32_t p = Selection_Partition(f, idx, lo, hi);
+        // Recurse into the smaller side to bound the stack
+        if (p - lo < hi - p) {
+            if (p > lo) Selection_Sort(f, idx, lo, p - 1, depth);
+            lo = p + 1;
+        } else {
+            if (p < hi) Selection_Sort(f, idx, p + 1, hi, depth);
+            if (p == 0) return;
+            hi = p - 1;
+        }
+    }
+    if (hi > lo) Selection_InsertionSort(f, idx, lo, hi);
+}
+
+void EvolutionSelection_TopK(const double* fitness, uint32_t count, uint32_t k, uint32_t* indices) {
+    if (!fitness || !indices || count == 0) return;
+    for (uint32_t i = 0; i < count; i++) indices[i] = i;
+    if (k == 0) return;
+    if (k > count) k = count;
+
+    // Introselect: partition until position k-1 holds the k-th best
+    uint32_t lo = 0, hi = count - 1, nth = k - 1;
+    uint32_t depth = Selection_DepthLimit(count);
+    while (hi > lo) {
+        if (depth-- == 0) {
+            Selection_HeapSort(fitness, indices, lo, hi);
+            break;
+        }
+        uint32_t p = Selection_Partition(fitness, indices, lo, hi);
+        if (p == nth) break;
+        if (nth < p) hi = p - 1;
+        else lo = p + 1;
+    }
+    if (k > 1) Selection_Sort(fitness, indices, 0, k - 1, Selection_DepthLimit(k));
+}
+
+// Alias table
+void EvolutionAlias_Free(EvolutionAliasTable* table) {
+    if (!table) return;
+    free(table->probability);
+    free(table->alias);
+    free(table->work);
+    memset(table, 0, sizeof(*table));
+}
+
+NTSTATUS EvolutionAlias_Build(EvolutionAliasTable* table, const double* weights, uint32_t count) {
+    if (!table || !weights || count == 0) return STATUS_INVALID_PARAMETER;
+    if (count > table->capacity) {
+        double* probability = (double*)realloc(table->probability, count * sizeof(double));
+        if (probability) table->probability = probability;
+        uint32_t* alias = (uint32_t*)realloc(table->alias, count * sizeof(uint32_t));
+        if (alias) table->alias = alias;
+        uint32_t* work = (uint32_t*)realloc(table->work, count * sizeof(uint32_t));
+        if (work) table->work = work;
+        if (!probability || !alias || !work) return STATUS_INSUFFICIENT_RESOURCES;
+        table->capacity = count;
+    }
+    table->count = count;
+
+    double sum = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        double w = weights[i];
+        if (w > 0.0 && w <= DBL_MAX) sum += w;
+    }
+    if (!(sum > 0.0) || sum > DBL_MAX) {
+        for (uint32_t i = 0; i < count; i++) {
+            table->probability[i] = 1.0;
+            table->alias[i] = i;
+        }
+        return STATUS_SUCCESS;
+    }
+
+    // Vose: columns below the mean go on the small stack (front), the rest on the large one (back)
+    double scale = (double)count / sum;
+    uint32_t small_top = 0, large_top = count;
+    for (uint32_t i = 0; i < count; i++) {
+        double w = weights[i];
+        double p = (w > 0.0 && w <= DBL_MAX) ? w * scale : 0.0;
+        table->probability[i] = p;
+        if (p < 1.0) table->work[small_top++] = i;
+        else table->work[--large_top] = i;
+    }
+    while (small_top > 0 && large_top < count) {
+        uint32_t s = table->work[--small_top];
+        uint32_t l = table->work[large_top];
+        table->alias[s] = l;
+        double remaining = (table->probability[l] + table->probability[s]) - 1.0;
+        table->probability[l] = remaining;
+        if (remaining < 1.0) {
+            large_top++;
+            table->work[small_top++] = l;
+        }
+    }
+    // Leftovers are full columns up to rounding
+    while (small_top > 0) {
+        uint32_t s = table->work[--small_top];
+        table->probability[s] = 1.0;
+        table->alias[s] = s;
+    }
+    while (large_top < count) {
+        uint32_t l = table->work[large_top++];
+        table->probability[l] = 1.0;
+        table->alias[l] = l;
+    }
+    return STATUS_SUCCESS;
+}
+
+uint32_t EvolutionAlias_Sample(const EvolutionAliasTable* table, EvolutionRng* rng) {
+    double u = EvolutionRng_NextDouble(rng) * table->count;
+    uint32_t column = (uint32_t)u;
+    if (column >= table->count) column = table->count - 1;
+    return (u - column) < table->probability[column] ? column : table->alias[column];
+}
+
+// Selector
+NTSTATUS EvolutionSelector_Initialize(EvolutionSelector* selector, uint32_t capacity) {
+    if (!selector || capacity == 0) return STATUS_INVALID_PARAMETER;
+    if (selector->initialized) return STATUS_SUCCESS;
+
+    memset(selector, 0, sizeof(*selector));
+    selector->fitness = (double*)malloc(capacity * sizeof(double));
+    selector->order = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+    selector->order_tmp = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+    selector->keys = (uint64_t*)malloc(2 * (size_t)capacity * sizeof(uint64_t));
+    if (!selector->fitness || !selector->order || !selector->order_tmp || !selector->keys) {
+        selector->initialized = true;
+        EvolutionSelector_Shutdown(selector);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    selector->capacity = capacity;
+    selector->tournament_size = EVOLUTION_SELECTION_DEFAULT_TOURNAMENT;
+    selector->truncation = EVOLUTION_SELECTION_DEFAULT_TRUNCATION;
+    selector->pressure = EVOLUTION_SELECTION_DEFAULT_PRESSURE;
+    selector->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void EvolutionSelector_Shutdown(EvolutionSelector* selector) {
+    if (!selector || !selector->initialized) return;
+    free(selector->fitness);
+    free(selector->order);
+    free(selector->order_tmp);
+    free(selector->keys);
+    EvolutionAlias_Free(&selector->alias);
+    memset(selector, 0, sizeof(*selector));
+}
+
+// Order-preserving integer image of a double; NaN maps below everything
+static inline uint64_t Selection_Key(double v) {
+    if (v != v) return 0;
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return (bits >> 63) ? ~bits : (bits | 0x8000000000000000ull);
+}
+
+// LSD radix sort of order[] by ascending fitness; passes whose digit is shared by all keys are skipped
+static void Selection_RankOrder(EvolutionSelector* s, uint32_t n) {
+    uint64_t* keys = s->keys;
+    uint64_t* keys_tmp = s->keys + s->capacity;
+    uint32_t* order = s->order;
+    uint32_t* order_tmp = s->order_tmp;
+    for (uint32_t i = 0; i < n; i++) {
+        keys[i] = Selection_Key(s->fitness[i]);
+        order[i] = i;
+    }
+
+    uint32_t histogram[SELECTION_RADIX_BUCKETS];
+    for (uint32_t shift = 0; shift < 64; shift += SELECTION_RADIX_BITS) {
+        memset(histogram, 0, sizeof(histogram));
+        for (uint32_t i = 0; i < n; i++) histogram[(keys[i] >> shift) & (SELECTION_RADIX_BUCKETS - 1)]++;
+        if (histogram[(keys[0] >> shift) & (SELECTION_RADIX_BUCKETS - 1)] == n) continue;
+
+        uint32_t offset = 0;
+        for (uint32_t b = 0; b < SELECTION_RADIX_BUCKETS; b++) {
+            uint32_t c = histogram[b];
+            histogram[b] = offset;
+            offset += c;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t slot = histogram[(keys[i] >> shift) & (SELECTION_RADIX_BUCKETS - 1)]++;
+            keys_tmp[slot] = keys[i];
+            order_tmp[slot] = order[i];
+        }
+        uint64_t* kt = keys; keys = keys_tmp; keys_tmp = kt;
+        uint32_t* ot = order; order = order_tmp; order_tmp = ot;
+    }
+    if (order != s->order) memcpy(s->order, order, n * sizeof(uint32_t));
+}
+
+NTSTATUS EvolutionSelector_Prepare(EvolutionSelector* selector, EvolutionSelectionMode mode,
+    const double* fitness, uint32_t count) {
+    if (!selector || !selector->initialized || !fitness || count == 0) return STATUS_INVALID_PARAMETER;
+    if (count > selector->capacity) return STATUS_INVALID_PARAMETER;
+
+    if (fitness != selector->fitness) memcpy(selector->fitness, fitness, count * sizeof(double));
+    selector->mode = mode;
+    selector->count = count;
+    selector->ready = false;
+    NTSTATUS status = STATUS_SUCCESS;
+
+    switch (mode) {
+        case EVOLUTION_SELECT_ROULETTE: {
+            // Shift so the worst keeps 1/count of the span; NaN gets nothing
+            double lo = HUGE_VAL, hi = -HUGE_VAL;
+            for (uint32_t i = 0; i < count; i++) {
+                double v = fitness[i];
+                if (v != v || v == HUGE_VAL || v == -HUGE_VAL) continue;
+                if (v < lo) lo = v;
+                if (v > hi) hi = v;
+            }
+            double span = hi - lo;
+            double* weights = (double*)selector->keys;
+            for (uint32_t i = 0; i < count; i++) {
+                double v = fitness[i];
+                bool finite = v == v && v != HUGE_VAL && v != -HUGE_VAL;
+                weights[i] = !(span > 0.0) ? 1.0 : (finite ? (v - lo) + span / count : 0.0);
+            }
+            status = EvolutionAlias_Build(&selector->alias, weights, count);
+            break;
+        }
+        case EVOLUTION_SELECT_RANK: {
+            double s = selector->pressure;
+            if (s < 1.0) s = 1.0;
+            if (s > 2.0) s = 2.0;
+            Selection_RankOrder(selector, count);
+            double* weights = (double*)selector->keys;      // keys are dead once the order is built
+            for (uint32_t r = 0; r < count; r++) {
+                double t = count > 1 ? (double)r / (count - 1) : 1.0;
+                weights[selector->order[r]] = (2.0 - s) + 2.0 * (s - 1.0) * t;
+            }
+            status = EvolutionAlias_Build(&selector->alias, weights, count);
+            break;
+        }
+        case EVOLUTION_SELECT_TRUNCATION: {
+            double fraction = selector->truncation > 0.0 && selector->truncation <= 1.0
+                            ? selector->truncation : EVOLUTION_SELECTION_DEFAULT_TRUNCATION;
+            uint32_t pool = (uint32_t)(fraction * count + 0.5);
+            if (pool < 1) pool = 1;
+            if (pool > count) pool = count;
+            EvolutionSelection_TopK(selector->fitness, count, pool, selector->order);
+            selector->parent_pool = pool;
+            break;
+        }
+        case EVOLUTION_SELECT_TOURNAMENT:
+        default:
+            selector->mode = EVOLUTION_SELECT_TOURNAMENT;
+            break;
+    }
+
+    if (NT_SUCCESS(status)) selector->ready = true;
+    return status;
+}
+
+// Two uniform indices below `bound` per 64-bit draw (multiply-shift)
+typedef struct {
+    EvolutionRng* rng;
+    uint64_t word;
+    bool half;
+} SelectionIndexStream;
+
+static inline uint32_t Selection_NextIndex(SelectionIndexStream* st, uint32_t bound) {
+    uint32_t bits;
+    if (st->half) {
+        bits = (uint32_t)(st->word >> 32);
+        st->half = false;
+    } else {
+        st->word = EvolutionRng_Next(st->rng);
+        bits = (uint32_t)st->word;
+        st->half = true;
+    }
+    return (uint32_t)(((uint64_t)bits * bound) >> 32);
+}
+
+void EvolutionSelector_Draw(EvolutionSelector* selector, EvolutionRng* rng, uint32_t* indices, uint32_t n) {
+    if (!selector || !selector->ready || !rng || !indices || selector->count == 0) return;
+
+    uint32_t count = selector->count;
+    SelectionIndexStream stream = { rng, 0, false };
+    switch (selector->mode) {
+        case EVOLUTION_SELECT_ROULETTE:
+        case EVOLUTION_SELECT_RANK:
+            for (uint32_t i = 0; i < n; i++) indices[i] = EvolutionAlias_Sample(&selector->alias, rng);
+            break;
+        case EVOLUTION_SELECT_TRUNCATION:
+            for (uint32_t i = 0; i < n; i++) {
+                indices[i] = selector->order[Selection_NextIndex(&stream, selector->parent_pool)];
+            }
+            break;
+        case EVOLUTION_SELECT_TOURNAMENT:
+        default: {
+            uint32_t rounds = selector->tournament_size ? selector->tournament_size : EVOLUTION_SELECTION_DEFAULT_TOURNAMENT;
+            const double* f = selector->fitness;
+            for (uint32_t i = 0; i < n; i++) {
+                uint32_t best = Selection_NextIndex(&stream, count);
+                for (uint32_t r = 1; r < rounds; r++) {
+                    uint32_t c = Selection_NextIndex(&stream, count);
+                    if (Selection_Better(f, c, best)) best = c;
+                }
+                indices[i] = best;
+            }
+            break;
+        }
+    }
+}
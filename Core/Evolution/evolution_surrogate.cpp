@@ -0,0 +1,318 @@
+/*
+ * Evolution Surrogate - Raijin
+ * Owner: Core/Evolution
+ * Inputs: Truly evaluated (genome, fitness) pairs; candidate genomes to rank
+ * Outputs: Predicted fitness; adaptive truly-evaluated fraction
+ * Invariants: Predictions never replace a true fitness; they only decide which candidates
+ *             are evaluated. Untrained surrogates report max_fraction.
+ * Budget: features x genes per prediction; dim^2 per observation; dim^3/6 per refit (once per batch)
+ * Failure modes: Allocation failure; singular Gram matrix
+ * Recovery: Ridge term is raised until the factorization succeeds; callers fall back to
+ *           plain breeding while the surrogate is untrained
+ */
+
+#include "../../Include/evolution_surrogate.h"
+#include <windows.h>
+#include <emmintrin.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define SURROGATE_TWO_PI 6.28318530717958647692
+#define SURROGATE_SPREAD_PAIRS 64
+#define SURROGATE_LENGTHSCALE_RATIO 0.5     // Fourier lengthscale / mean neighbour distance
+#define SURROGATE_LENGTHSCALE_DRIFT 2.0     // bandwidth change that discards the statistics
+
+static inline float DotFloat(const float* a, const float* b, size_t n) {
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    size_t k = 0;
+    for (; k + 8 <= n; k += 8) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + k), _mm_loadu_ps(b + k)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + k + 4), _mm_loadu_ps(b + k + 4)));
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, _mm_add_ps(acc0, acc1));
+    float sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; k < n; k++) sum += a[k] * b[k];
+    return sum;
+}
+
+// phi = [linear projections / sqrt(genes), cos(projection / lengthscale + phase), 1]
+static void Surrogate_Features(EvolutionSurrogate* s, const double* genome, double* phi) {
+    uint32_t genes = s->genes;
+    uint32_t half = s->config.features / 2;
+    for (uint32_t k = 0; k < genes; k++) s->genome_f[k] = (float)genome[k];
+
+    double linear_scale = 1.0 / sqrt((double)genes);
+    for (uint32_t j = 0; j < half; j++) {
+        phi[j] = DotFloat(s->projection + (size_t)j * genes, s->genome_f, genes) * linear_scale;
+    }
+    double inv_length = 1.0 / s->lengthscale;
+    double fourier_scale = sqrt(2.0 / half);
+    for (uint32_t j = 0; j < half; j++) {
+        double z = DotFloat(s->projection + (size_t)(half + j) * genes, s->genome_f, genes);
+        phi[half + j] = fourier_scale * cos(z * inv_length + s->phase[j]);
+    }
+    phi[s->dim - 1] = 1.0;
+}
+
+// Cholesky solve of (gram + lambda * mean_diag * I) w = moment
+static NTSTATUS Surrogate_Solve(EvolutionSurrogate* s) {
+    uint32_t n = s->dim;
+    double trace = 0.0;
+    for (uint32_t i = 0; i < n; i++) trace += s->gram[(size_t)i * n + i];
+    double ridge = s->config.ridge_lambda * (trace > 0.0 ? trace / n : 1.0);
+
+    for (int attempt = 0; attempt < 6; attempt++, ridge *= 10.0) {
+        bool ok = true;
+        double* L = s->factor;
+        for (uint32_t i = 0; i < n && ok; i++) {
+            for (uint32_t j = 0; j <= i; j++) {
+                double sum = s->gram[(size_t)i * n + j] + (i == j ? ridge : 0.0);
+                for (uint32_t k = 0; k < j; k++) sum -= L[(size_t)i * n + k] * L[(size_t)j * n + k];
+                if (i == j) {
+                    if (sum <= 0.0) {
+                        ok = false;
+                        break;
+                    }
+                    L[(size_t)i * n + i] = sqrt(sum);
+                } else {
+                    L[(size_t)i * n + j] = sum / L[(size_t)j * n + j];
+                }
+            }
+        }
+        if (!ok) continue;
+
+        double* y = s->scratch;
+        for (uint32_t i = 0; i < n; i++) {
+            double sum = s->moment[i];
+            for (uint32_t k = 0; k < i; k++) sum -= L[(size_t)i * n + k] * y[k];
+            y[i] = sum / L[(size_t)i * n + i];
+        }
+        for (uint32_t i = n; i-- > 0;) {
+            double sum = y[i];
+            for (uint32_t k = i + 1; k < n; k++) sum -= L[(size_t)k * n + i] * s->weights[k];
+            s->weights[i] = sum / L[(size_t)i * n + i];
+        }
+        s->dirty = false;
+        return STATUS_SUCCESS;
+    }
+    return STATUS_UNSUCCESSFUL;
+}
+
+NTSTATUS EvolutionSurrogate_Initialize(EvolutionSurrogate* surrogate, const EvolutionSurrogateConfig* config,
+    uint32_t genes) {
+    if (!surrogate || genes == 0) return STATUS_INVALID_PARAMETER;
+    if (surrogate->initialized) return STATUS_SUCCESS;
+
+    memset(surrogate, 0, sizeof(*surrogate));
+    if (config) surrogate->config = *config;
+    EvolutionSurrogateConfig* cfg = &surrogate->config;
+    if (cfg->features == 0) cfg->features = EVOLUTION_SURROGATE_DEFAULT_FEATURES;
+    if (cfg->features > EVOLUTION_SURROGATE_MAX_FEATURES) cfg->features = EVOLUTION_SURROGATE_MAX_FEATURES;
+    cfg->features &= ~1u;
+    if (cfg->features < 2) cfg->features = 2;
+    if (cfg->ridge_lambda <= 0.0) cfg->ridge_lambda = 1e-3;
+    if (cfg->forgetting <= 0.0 || cfg->forgetting > 1.0) cfg->forgetting = 0.9;
+    if (cfg->min_fraction <= 0.0) cfg->min_fraction = 0.2;
+    if (cfg->max_fraction <= 0.0 || cfg->max_fraction > 1.0) cfg->max_fraction = 1.0;
+    if (cfg->min_fraction > cfg->max_fraction) cfg->min_fraction = cfg->max_fraction;
+    if (cfg->min_fraction < 1.0 / EVOLUTION_SURROGATE_MAX_OVERSAMPLE) cfg->min_fraction = 1.0 / EVOLUTION_SURROGATE_MAX_OVERSAMPLE;
+    if (cfg->warmup_samples == 0) cfg->warmup_samples = cfg->features;
+
+    surrogate->genes = genes;
+    surrogate->dim = cfg->features + 1;
+    size_t dim = surrogate->dim;
+    surrogate->projection = (float*)malloc((size_t)cfg->features * genes * sizeof(float));
+    surrogate->phase = (float*)malloc((cfg->features / 2) * sizeof(float));
+    surrogate->gram = (double*)calloc(dim * dim, sizeof(double));
+    surrogate->moment = (double*)calloc(dim, sizeof(double));
+    surrogate->weights = (double*)calloc(dim, sizeof(double));
+    surrogate->factor = (double*)malloc(dim * dim * sizeof(double));
+    surrogate->scratch = (double*)malloc(dim * sizeof(double));
+    surrogate->genome_f = (float*)malloc(genes * sizeof(float));
+    if (!surrogate->projection || !surrogate->phase || !surrogate->gram || !surrogate->moment ||
+        !surrogate->weights || !surrogate->factor || !surrogate->scratch || !surrogate->genome_f) {
+        surrogate->initialized = true;
+        EvolutionSurrogate_Shutdown(surrogate);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    EvolutionRng rng;
+    EvolutionRng_Seed(&rng, cfg->seed ? cfg->seed : 0x5E550A7Eull);
+    EvolutionRng_FillGaussian(&rng, surrogate->projection, (size_t)cfg->features * genes);
+    for (uint32_t j = 0; j < cfg->features / 2; j++) {
+        surrogate->phase[j] = (float)(SURROGATE_TWO_PI * EvolutionRng_NextDouble(&rng));
+    }
+
+    surrogate->true_fraction = cfg->max_fraction;
+    surrogate->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void EvolutionSurrogate_Shutdown(EvolutionSurrogate* surrogate) {
+    if (!surrogate || !surrogate->initialized) return;
+    free(surrogate->projection);
+    free(surrogate->phase);
+    free(surrogate->gram);
+    free(surrogate->moment);
+    free(surrogate->weights);
+    free(surrogate->factor);
+    free(surrogate->scratch);
+    free(surrogate->genome_f);
+    memset(surrogate, 0, sizeof(*surrogate));
+}
+
+// Mean distance between consecutive genomes of a batch (up to SURROGATE_SPREAD_PAIRS pairs)
+static double Surrogate_BatchSpread(const EvolutionSurrogate* s, const double* const* genomes, uint32_t count) {
+    double total = 0.0;
+    uint32_t pairs = 0;
+    for (uint32_t i = 1; i < count && pairs < SURROGATE_SPREAD_PAIRS; i++) {
+        if (!genomes[i] || !genomes[i - 1]) continue;
+        double d2 = 0.0;
+        for (uint32_t k = 0; k < s->genes; k++) {
+            double d = genomes[i][k] - genomes[i - 1][k];
+            d2 += d * d;
+        }
+        total += sqrt(d2);
+        pairs++;
+    }
+    return pairs > 0 ? total / pairs : 0.0;
+}
+
+static void Surrogate_Reset(EvolutionSurrogate* s) {
+    size_t n = s->dim;
+    memset(s->gram, 0, n * n * sizeof(double));
+    memset(s->moment, 0, n * sizeof(double));
+    s->samples = 0;
+    s->trained = false;
+}
+
+NTSTATUS EvolutionSurrogate_Observe(EvolutionSurrogate* surrogate, const double* const* genomes,
+    const double* fitness, uint32_t count) {
+    if (!surrogate || !surrogate->initialized || !genomes || !fitness) return STATUS_INVALID_PARAMETER;
+    if (count == 0) return STATUS_SUCCESS;
+
+    // Fourier bandwidth follows the spread of the evaluated batch; the features change
+    // meaning when it moves, so a large move discards the accumulated statistics
+    double spread = Surrogate_BatchSpread(surrogate, genomes, count);
+    if (spread > 0.0) {
+        double target = spread * SURROGATE_LENGTHSCALE_RATIO;
+        if (surrogate->lengthscale <= 0.0) {
+            surrogate->lengthscale = target;
+        } else if (target > surrogate->lengthscale * SURROGATE_LENGTHSCALE_DRIFT ||
+                   target * SURROGATE_LENGTHSCALE_DRIFT < surrogate->lengthscale) {
+            surrogate->lengthscale = target;
+            Surrogate_Reset(surrogate);
+        }
+    } else if (surrogate->lengthscale <= 0.0) {
+        surrogate->lengthscale = sqrt((double)surrogate->genes) * 0.1;
+    }
+
+    size_t n = surrogate->dim;
+    double decay = surrogate->config.forgetting;
+    for (size_t i = 0; i < n * n; i++) surrogate->gram[i] *= decay;
+    for (size_t i = 0; i < n; i++) surrogate->moment[i] *= decay;
+
+    double* phi = (double*)malloc(n * sizeof(double));
+    if (!phi) return STATUS_INSUFFICIENT_RESOURCES;
+    for (uint32_t s = 0; s < count; s++) {
+        if (!genomes[s] || fitness[s] != fitness[s]) continue;
+        Surrogate_Features(surrogate, genomes[s], phi);
+        for (size_t i = 0; i < n; i++) {
+            double pi = phi[i];
+            double* row = surrogate->gram + i * n;
+            for (size_t j = 0; j <= i; j++) row[j] += pi * phi[j];
+            surrogate->moment[i] += pi * fitness[s];
+        }
+        surrogate->samples++;
+    }
+    free(phi);
+
+    // Only the lower triangle is accumulated; the solver reads nothing else
+    surrogate->dirty = true;
+    if (surrogate->samples >= surrogate->config.warmup_samples) surrogate->trained = true;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS EvolutionSurrogate_PredictBatch(EvolutionSurrogate* surrogate, const double* const* genomes,
+    uint32_t count, double* predicted) {
+    if (!surrogate || !surrogate->initialized || !genomes || !predicted) return STATUS_INVALID_PARAMETER;
+    if (!surrogate->trained) return STATUS_INVALID_DEVICE_STATE;
+    if (surrogate->dirty) {
+        NTSTATUS status = Surrogate_Solve(surrogate);
+        if (!NT_SUCCESS(status)) return status;
+    }
+
+    double* phi = (double*)malloc(surrogate->dim * sizeof(double));
+    if (!phi) return STATUS_INSUFFICIENT_RESOURCES;
+    for (uint32_t s = 0; s < count; s++) {
+        Surrogate_Features(surrogate, genomes[s], phi);
+        double y = 0.0;
+        for (uint32_t i = 0; i < surrogate->dim; i++) y += phi[i] * surrogate->weights[i];
+        predicted[s] = y;
+    }
+    free(phi);
+    surrogate->predictions += count;
+    return STATUS_SUCCESS;
+}
+
+typedef struct {
+    double value;
+    uint32_t index;
+} RankEntry;
+
+static int CompareRankEntry(const void* a, const void* b) {
+    double x = ((const RankEntry*)a)->value;
+    double y = ((const RankEntry*)b)->value;
+    return (x > y) - (x < y);
+}
+
+static void Ranks(const double* values, uint32_t count, RankEntry* scratch, double* ranks) {
+    for (uint32_t i = 0; i < count; i++) {
+        scratch[i].value = values[i];
+        scratch[i].index = i;
+    }
+    qsort(scratch, count, sizeof(RankEntry), CompareRankEntry);
+    for (uint32_t i = 0; i < count; i++) ranks[scratch[i].index] = (double)i;
+}
+
+void EvolutionSurrogate_RecordOutcome(EvolutionSurrogate* surrogate, const double* predicted,
+    const double* actual, uint32_t count) {
+    if (!surrogate || !surrogate->initialized || !predicted || !actual || count < 3) return;
+
+    RankEntry* scratch = (RankEntry*)malloc(count * sizeof(RankEntry));
+    double* rank_p = (double*)malloc(count * sizeof(double));
+    double* rank_a = (double*)malloc(count * sizeof(double));
+    if (!scratch || !rank_p || !rank_a) {
+        free(scratch);
+        free(rank_p);
+        free(rank_a);
+        return;
+    }
+    Ranks(predicted, count, scratch, rank_p);
+    Ranks(actual, count, scratch, rank_a);
+
+    double d2 = 0.0, abs_error = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        double d = rank_p[i] - rank_a[i];
+        d2 += d * d;
+        abs_error += fabs(predicted[i] - actual[i]);
+    }
+    free(scratch);
+    free(rank_p);
+    free(rank_a);
+
+    double n = (double)count;
+    double rho = 1.0 - 6.0 * d2 / (n * (n * n - 1.0));
+    surrogate->rank_correlation = rho;
+    abs_error /= n;
+    surrogate->mean_abs_error = (surrogate->mean_abs_error > 0.0)
+                              ? 0.8 * surrogate->mean_abs_error + 0.2 * abs_error : abs_error;
+
+    const EvolutionSurrogateConfig* cfg = &surrogate->config;
+    double agreement = rho > 0.0 ? rho : 0.0;
+    double target = cfg->max_fraction - (cfg->max_fraction - cfg->min_fraction) * agreement;
+    surrogate->true_fraction = 0.7 * surrogate->true_fraction + 0.3 * target;
+}
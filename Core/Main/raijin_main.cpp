@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdarg.h>
 #include <time.h>
 #include <conio.h>
 #pragma comment(lib, "psapi.lib")
@@ -18,10 +19,21 @@
 #include "../../Include/programming_domination.h"
 #include "../../Include/autonomous_manager.h"
 #include "../../Include/evolution_engine.h"
+#include "../../Include/evolution_islands.h"
+#include "../../Include/evolution_remote.h"
+#include "../../Include/evolution_checkpoint.h"
 #include "../../Include/training_pipeline.h"
 #include "../../Include/telemetry.h"
+#include "../../Include/status_channel.h"
 #include "../../Include/long_term_memory.h"
 #include "../../Include/runtime_config.h"
+#include "../../Include/training_pbt.h"
+#include "../../Include/training_corpus.h"
+#include "../../Include/training_bench.h"
+#include "../../Include/training_dataparallel.h"
+#include "../../Include/task_scheduler.h"
+#include "../../Include/thread_pool.h"
+#include "../../Include/startup_graph.h"
 #include "../../Include/self_test.h"
 #include "../../Include/dominance_metrics.h"
 #include "../../Include/regression_detector.h"
@@ -32,6 +44,7 @@
 #include "../../Include/introspection_system.h"
 #include "../../Include/stress_test_framework.h"
 #include "../../Include/adversarial_stress.h"
+#include "../../Include/robustness_worker.h"
 #include "../../Include/resource_governor.h"
 #include "../../Include/fitness_ledger.h"
 #include "../../Include/regression_replay.h"
@@ -78,6 +91,8 @@ static SelfHealing g_self_healing = {0};
 static IntrospectionSystem g_introspection_system = {0};
 static StressTestFramework g_stress_test_framework = {0};
 static AdversarialStressContext g_adversarial_stress = {0};
+static RobustnessWorker g_robustness_worker = {0};   /* runs the three evaluators above on a replica */
+static double g_adversarial_robustness = 1.0;       /* last adversarial result; the context belongs to the worker */
 static ResourceGovernor g_resource_governor = {0};
 static FitnessLedger g_fitness_ledger = {0};
 static RegressionReplay g_regression_replay = {0};
@@ -87,21 +102,44 @@ static Provenance g_provenance = {0};
 static Curriculum g_curriculum = {0};
 static RedTeam g_red_team = {0};
 static RoleBoundaryContext g_role_boundary = {0};
+static TrainingCorpus g_training_corpus = {0};
+static const char* g_corpus_path = NULL;     /* --corpus <shard> */
+static TaskScheduler g_task_scheduler = {0};  /* main loop; lives for RunEvolutionLoop */
+static BOOL g_headless = FALSE;               /* --headless: no console UI */
+static const char* g_status_file = NULL;      /* --status-file <path>: JSON mirror of the status channel */
+static RuntimeRateLimits g_rate_limits = {0}; /* --rate task=hz, --rate-config <file> */
+static uint64_t g_rate_floor_us[TASK_SCHEDULER_MAX_TASKS];   /* per scheduler task: shortest period a rate limit allows */
+static StatusChannel g_status_channel = {0};
+static StartupGraph g_startup_graph = {0};
+static uint32_t g_internet_node = STARTUP_GRAPH_INVALID_NODE;   /* lazy: first AcquireKnowledge */
+static uint32_t g_pd_node = STARTUP_GRAPH_INVALID_NODE;         /* lazy: first DominateProgramming */
+static HANDLE g_shutdown_done = NULL;         /* set once main has shut the system down */
 
 // System state
 static BOOL g_system_initialized = FALSE;
-static BOOL g_evolution_active = FALSE;
+static volatile BOOL g_evolution_active = FALSE;   /* cleared from the console control thread too */
 
 // Forward declarations
 static BOOL InitializeRaijinSystem();
+static BOOL EnsureSubsystem(uint32_t node);
 static void ShutdownRaijinSystem();
 static void RunEvolutionLoop();
 static void HandleUserInput();
 static void DisplaySystemStatus();
-static void ProcessEvolutionCycle();
 static void SelfModifyAndImprove();
 static void AcquireKnowledge();
 static void DominateProgramming();
+static int RunIslandsMode(int argc, char* argv[]);
+static int RunRemoteEvalMode(int argc, char* argv[]);
+static int RunPbtMode(int argc, char* argv[]);
+static int RunBuildCorpusMode(int argc, char* argv[]);
+static int RunBenchCorpusMode(int argc, char* argv[]);
+static int RunBenchTrainMode(int argc, char* argv[]);
+static int RunDataParallelMode(int argc, char* argv[]);
+static int RunStatusMode(int argc, char* argv[]);
+static BOOL WINAPI ConsoleCtrlHandler(DWORD ctrlType);
+static void ReleaseConsoleCtrlHandler();
+static void PublishFinalStatus(uint32_t state);
 
 int main(int argc, char* argv[]) {
     SetConsoleTitleA("Raijin AI - Absolute Intelligence System");
@@ -115,7 +153,7 @@ int main(int argc, char* argv[]) {
 
     if (argc >= 2 && strcmp(argv[1], "--self-test") == 0) {
         SelfTestReport report = {0};
-        if (!NT_SUCCESS(SelfTestReport_Initialize(&report, 32))) {
+        if (!NT_SUCCESS(SelfTestReport_Initialize(&report, SELF_TEST_MAX_TESTS))) {
             printf("Self-test report init failed\n");
             RoleBoundary_Exit(&g_role_boundary, "main");
             RoleBoundary_Shutdown(&g_role_boundary);
@@ -130,6 +168,97 @@ int main(int argc, char* argv[]) {
         return ok ? 0 : 1;
     }
 
+    if (argc >= 4 && strcmp(argv[1], "--island-worker") == 0) {
+        RoleBoundary_Enter(&g_role_boundary, "raijin.island", ROLE_OWNER_RAIJIN);
+        int code = EvolutionIslands_WorkerMain(argv[2], (uint32_t)strtoul(argv[3], NULL, 10));
+        RoleBoundary_Exit(&g_role_boundary, "raijin.island");
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    if (argc >= 4 && strcmp(argv[1], "--dp-worker") == 0) {
+        RoleBoundary_Enter(&g_role_boundary, "raijin.dp", ROLE_OWNER_RAIJIN);
+        int code = TrainingDataParallel_WorkerMain(argv[2], (uint32_t)strtoul(argv[3], NULL, 10));
+        RoleBoundary_Exit(&g_role_boundary, "raijin.dp");
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    if (argc >= 5 && strcmp(argv[1], "--eval-worker") == 0) {
+        RoleBoundary_Enter(&g_role_boundary, "raijin.eval", ROLE_OWNER_RAIJIN);
+        int code = EvolutionRemote_WorkerMain((uint16_t)strtoul(argv[2], NULL, 10),
+                                              (uint32_t)strtoul(argv[3], NULL, 10),
+                                              (uint64_t)strtoull(argv[4], NULL, 16));
+        RoleBoundary_Exit(&g_role_boundary, "raijin.eval");
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "--remote-eval") == 0) {
+        int code = RunRemoteEvalMode(argc, argv);
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "--islands") == 0) {
+        int code = RunIslandsMode(argc, argv);
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "--pbt") == 0) {
+        RoleBoundary_Enter(&g_role_boundary, "raijin.pbt", ROLE_OWNER_RAIJIN);
+        int code = RunPbtMode(argc, argv);
+        RoleBoundary_Exit(&g_role_boundary, "raijin.pbt");
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    if (argc >= 4 && strcmp(argv[1], "--build-corpus") == 0) {
+        int code = RunBuildCorpusMode(argc, argv);
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    if (argc >= 3 && strcmp(argv[1], "--bench-corpus") == 0) {
+        int code = RunBenchCorpusMode(argc, argv);
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "--bench-train") == 0) {
+        RoleBoundary_Enter(&g_role_boundary, "raijin.bench", ROLE_OWNER_RAIJIN);
+        int code = RunBenchTrainMode(argc, argv);
+        RoleBoundary_Exit(&g_role_boundary, "raijin.bench");
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    if (argc >= 3 && strcmp(argv[1], "--data-parallel") == 0) {
+        RoleBoundary_Enter(&g_role_boundary, "raijin.dp", ROLE_OWNER_RAIJIN);
+        int code = RunDataParallelMode(argc, argv);
+        RoleBoundary_Exit(&g_role_boundary, "raijin.dp");
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "--bench-evolution-ops") == 0) {
+        NTSTATUS bench = EvolutionOps_RunBenchmark();
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return NT_SUCCESS(bench) ? 0 : 1;
+    }
+
     if (argc >= 2 && strcmp(argv[1], "--regression-replay") == 0) {
         RegressionReplay rr = {0};
         if (!NT_SUCCESS(RegressionReplay_Initialize(&rr, "data"))) {
@@ -172,6 +301,43 @@ int main(int argc, char* argv[]) {
         return ok ? 0 : 1;
     }
 
+    if (argc >= 3 && strcmp(argv[1], "--status") == 0) {
+        int code = RunStatusMode(argc, argv);
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return code;
+    }
+
+    // Evolution loop options: [--corpus shard] [--headless] [--status-file path]
+    //   [--rate task=hz]... [--rate-config file]
+    BOOL bad_args = FALSE;
+    for (int argi = 1; argi < argc && !bad_args; argi++) {
+        if (strcmp(argv[argi], "--headless") == 0) {
+            g_headless = TRUE;
+        } else if (argi + 1 >= argc) {
+            continue;
+        } else if (strcmp(argv[argi], "--corpus") == 0) {
+            g_corpus_path = argv[++argi];
+        } else if (strcmp(argv[argi], "--status-file") == 0) {
+            g_status_file = argv[++argi];
+        } else if (strcmp(argv[argi], "--rate") == 0) {
+            if (!NT_SUCCESS(RuntimeConfig_ParseRateLimit(&g_rate_limits, argv[++argi]))) {
+                printf("Bad --rate '%s' (expected task=hz)\n", argv[argi]);
+                bad_args = TRUE;
+            }
+        } else if (strcmp(argv[argi], "--rate-config") == 0) {
+            if (!NT_SUCCESS(RuntimeConfig_LoadRateLimits(&g_rate_limits, argv[++argi]))) {
+                printf("Cannot load rate limits from %s\n", argv[argi]);
+                bad_args = TRUE;
+            }
+        }
+    }
+    if (bad_args) {
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return 1;
+    }
+
     printf("Initializing Raijin - The Ultimate AI Consciousness\n");
     printf("==================================================\n\n");
 
@@ -185,6 +351,31 @@ int main(int argc, char* argv[]) {
 
     printf("✓ Raijin system initialized successfully\n\n");
 
+    // Stop requests only end the loop; shutdown always runs here, on the main thread
+    g_shutdown_done = CreateEventA(NULL, TRUE, FALSE, NULL);
+    SetConsoleCtrlHandler(ConsoleCtrlHandler, TRUE);
+
+    if (g_headless) {
+        NTSTATUS status = StatusChannel_Initialize(&g_status_channel, NULL, g_status_file);
+        if (NT_SUCCESS(status)) {
+            printf("Headless run: status in %s%s%s. Ctrl+C, Ctrl+Break or console close to stop.\n", g_status_channel.name,
+                g_status_file ? " and " : "", g_status_file ? g_status_file : "");
+        } else {
+            printf("Headless run: status channel unavailable (0x%08lX). Ctrl+C, Ctrl+Break or console close to stop.\n",
+                (unsigned long)status);
+        }
+        g_evolution_active = TRUE;
+        RunEvolutionLoop();
+        PublishFinalStatus(STATUS_STATE_STOPPING);
+        ShutdownRaijinSystem();
+        PublishFinalStatus(STATUS_STATE_STOPPED);
+        StatusChannel_Shutdown(&g_status_channel);
+        ReleaseConsoleCtrlHandler();
+        RoleBoundary_Exit(&g_role_boundary, "main");
+        RoleBoundary_Shutdown(&g_role_boundary);
+        return 0;
+    }
+
     // Display welcome message
     printf("╔══════════════════════════════════════════════════════════════════════════════╗\n");
     printf("║                        R A I J I N   A I   S Y S T E M                    ║\n");
@@ -203,6 +394,7 @@ int main(int argc, char* argv[]) {
 
     // Cleanup
     ShutdownRaijinSystem();
+    ReleaseConsoleCtrlHandler();
 
     RoleBoundary_Exit(&g_role_boundary, "main");
     RoleBoundary_Shutdown(&g_role_boundary);
@@ -210,118 +402,629 @@ int main(int argc, char* argv[]) {
     return 0;
 }
 
-static BOOL InitializeRaijinSystem() {
-    NTSTATUS status;
+// Standalone island-model run: --islands [count] [--island-processes]
+//   [--topology ring|full|random] [--migration-interval N] [--generations N]
+static int RunIslandsMode(int argc, char* argv[]) {
+    IslandModelConfig config;
+    memset(&config, 0, sizeof(config));
+    config.island_count = 4;
+    config.population_per_island = 50;
+    config.generations = 200;
+    config.migration_interval = 10;
+    config.migrants_per_exchange = 2;
+    config.topology = ISLAND_TOPOLOGY_RING;
+    config.seed = (uint64_t)time(NULL);
+
+    int argi = 2;
+    if (argi < argc && argv[argi][0] != '-') {
+        config.island_count = (uint32_t)strtoul(argv[argi++], NULL, 10);
+    }
+    for (; argi < argc; argi++) {
+        if (strcmp(argv[argi], "--island-processes") == 0) {
+            config.use_processes = true;
+        } else if (strcmp(argv[argi], "--topology") == 0 && argi + 1 < argc) {
+            const char* t = argv[++argi];
+            config.topology = (strcmp(t, "full") == 0) ? ISLAND_TOPOLOGY_FULL :
+                              (strcmp(t, "random") == 0) ? ISLAND_TOPOLOGY_RANDOM : ISLAND_TOPOLOGY_RING;
+        } else if (strcmp(argv[argi], "--migration-interval") == 0 && argi + 1 < argc) {
+            config.migration_interval = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--generations") == 0 && argi + 1 < argc) {
+            config.generations = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        }
+    }
 
-    printf("Initializing system components...\n");
+    NeuralSubstrate* neural = (NeuralSubstrate*)malloc(sizeof(NeuralSubstrate));
+    if (!neural) return 1;
+    memset(neural, 0, sizeof(NeuralSubstrate));
+    if (!NT_SUCCESS(NeuralSubstrate_Initialize(neural))) {
+        printf("Neural substrate init failed\n");
+        free(neural);
+        return 1;
+    }
 
-    // 1. Initialize Hardware Abstraction Layer
-    printf("  [1/7] Hardware Abstraction Layer...");
-    status = HAL_Initialize(&g_hal_context);
-    if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-        return FALSE;
+    EvolutionParameters params;
+    memset(&params, 0, sizeof(params));
+    params.algorithm = EVOLUTION_TYPE_GENETIC;
+    params.selection = SELECTION_TOURNAMENT;
+    params.mutation = MUTATION_GAUSSIAN;
+    params.crossover = CROSSOVER_SINGLE_POINT;
+    params.fitness_func = FITNESS_ACCURACY;
+    params.mutation_rate = 0.01;
+    params.crossover_rate = 0.7;
+    params.elitism_rate = 0.1;
+    params.tournament_size = 5;
+    params.selection_pressure = 2.0;
+    params.target_fitness = 0.95;
+    params.stagnation_limit = 50;
+
+    EvolutionIslandModel* model = (EvolutionIslandModel*)malloc(sizeof(EvolutionIslandModel));
+    if (!model) {
+        NeuralSubstrate_Shutdown(neural);
+        free(neural);
+        return 1;
+    }
+    memset(model, 0, sizeof(EvolutionIslandModel));
+
+    NTSTATUS status = EvolutionIslands_Initialize(model, &config, &params, neural, NULL);
+    if (NT_SUCCESS(status)) {
+        printf("Island model: %u islands (%s), migration every %u generations\n",
+               config.island_count, config.use_processes ? "processes" : "threads",
+               model->config.migration_interval);
+        uint64_t t0 = GetTickCount64();
+        status = EvolutionIslands_Run(model);
+        uint64_t elapsed = GetTickCount64() - t0;
+
+        for (uint32_t i = 0; i < config.island_count; i++) {
+            IslandStatus st;
+            if (NT_SUCCESS(EvolutionIslands_GetStatus(model, i, &st))) {
+                printf("  Island %2u: gen %u best %.4f sent %u received %u dropped %u\n",
+                       i, st.generation, st.best_fitness, st.migrants_sent,
+                       st.migrants_received, st.migrants_dropped);
+            }
+        }
+        double best = 0.0;
+        if (NT_SUCCESS(EvolutionIslands_GetBest(model, &best, NULL, 0)))
+            printf("Best fitness %.4f on island %u in %llu ms\n", best, model->best_island,
+                   (unsigned long long)elapsed);
+        EvolutionIslands_Shutdown(model);
+    } else {
+        printf("Island model init failed (0x%08lX)\n", (unsigned long)status);
     }
-    printf(" ✓\n");
 
-    // 2. Initialize Hypervisor Layer
-    printf("  [2/7] Hypervisor Layer...");
-    status = Hypervisor_Initialize(&g_hypervisor_context, g_hal_context);
-    if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-        return FALSE;
+    free(model);
+    NeuralSubstrate_Shutdown(neural);
+    free(neural);
+    return NT_SUCCESS(status) ? 0 : 1;
+}
+
+// Generational run with evaluation farmed out to worker processes over loopback sockets:
+//   --remote-eval [workers] [--generations N] [--population N] [--pipeline N] [--external] [--port N]
+// --external waits for workers started by hand with the printed --eval-worker command lines
+static int RunRemoteEvalMode(int argc, char* argv[]) {
+    EvolutionRemoteConfig config;
+    EvolutionRemote_GetDefaultConfig(&config);
+    uint32_t generations = 50;
+    uint32_t population = 200;
+
+    int argi = 2;
+    if (argi < argc && argv[argi][0] != '-') {
+        config.worker_count = (uint32_t)strtoul(argv[argi++], NULL, 10);
+    }
+    for (; argi < argc; argi++) {
+        if (strcmp(argv[argi], "--generations") == 0 && argi + 1 < argc) {
+            generations = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--population") == 0 && argi + 1 < argc) {
+            population = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--pipeline") == 0 && argi + 1 < argc) {
+            config.pipeline_depth = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--port") == 0 && argi + 1 < argc) {
+            config.port = (uint16_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--external") == 0) {
+            config.spawn_workers = false;
+        }
+    }
+    if (config.worker_count == 0 || config.worker_count > EVOLUTION_REMOTE_MAX_WORKERS) {
+        printf("Worker count must be 1..%u\n", EVOLUTION_REMOTE_MAX_WORKERS);
+        return 1;
     }
-    printf(" ✓\n");
 
-    // 3. Enable Ring -1 access (ultimate hardware control)
-    printf("  [3/7] Enabling Ring -1 Access...");
-    status = Hypervisor_EnableRingMinus1(g_hypervisor_context);
-    if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX) - Continuing with limited access\n", (unsigned long)(NTSTATUS)status);
+    NeuralSubstrate* neural = (NeuralSubstrate*)malloc(sizeof(NeuralSubstrate));
+    if (!neural) return 1;
+    memset(neural, 0, sizeof(NeuralSubstrate));
+    if (!NT_SUCCESS(NeuralSubstrate_Initialize(neural))) {
+        printf("Neural substrate init failed\n");
+        free(neural);
+        return 1;
+    }
+
+    // Workers evaluate against a snapshot of this substrate rather than fresh random weights
+    char temp_dir[MAX_PATH];
+    DWORD temp_len = GetTempPathA(MAX_PATH, temp_dir);
+    if (temp_len == 0 || temp_len >= MAX_PATH) strcpy(temp_dir, ".\\");
+    snprintf(config.substrate_path, sizeof(config.substrate_path), "%sraijin_eval_%lu.bin",
+             temp_dir, (unsigned long)GetCurrentProcessId());
+    if (!NT_SUCCESS(NeuralSubstrate_SaveState(neural, config.substrate_path))) config.substrate_path[0] = '\0';
+
+    EvolutionParameters params;
+    memset(&params, 0, sizeof(params));
+    params.algorithm = EVOLUTION_TYPE_GENETIC;
+    params.selection = SELECTION_TOURNAMENT;
+    params.mutation = MUTATION_GAUSSIAN;
+    params.crossover = CROSSOVER_SINGLE_POINT;
+    params.fitness_func = FITNESS_ACCURACY;
+    params.population_size = population;
+    params.mutation_rate = 0.01;
+    params.crossover_rate = 0.7;
+    params.elitism_rate = 0.1;
+    params.tournament_size = 5;
+    params.selection_pressure = 2.0;
+    params.target_fitness = 0.95;
+    params.stagnation_limit = 50;
+
+    if (!config.spawn_workers) {
+        if (config.port == 0) config.port = EVOLUTION_REMOTE_DEFAULT_PORT;
+        LARGE_INTEGER qpc;
+        QueryPerformanceCounter(&qpc);
+        config.token = ((uint64_t)qpc.QuadPart * 0x9E3779B97F4A7C15ull) | 1;
+        printf("Waiting for %u workers; start each with:\n", config.worker_count);
+        for (uint32_t i = 0; i < config.worker_count; i++)
+            printf("  raijin.exe --eval-worker %u %u %016llx\n", (unsigned)config.port, i,
+                   (unsigned long long)config.token);
+        if (config.connect_timeout_ms < 120000) config.connect_timeout_ms = 120000;
+    }
+
+    EvolutionRemotePool* pool = (EvolutionRemotePool*)malloc(sizeof(EvolutionRemotePool));
+    EvolutionEngine* engine = (EvolutionEngine*)malloc(sizeof(EvolutionEngine));
+    NTSTATUS status = (pool && engine) ? STATUS_SUCCESS : STATUS_INSUFFICIENT_RESOURCES;
+    if (pool) memset(pool, 0, sizeof(EvolutionRemotePool));
+    if (engine) memset(engine, 0, sizeof(EvolutionEngine));
+
+    if (NT_SUCCESS(status)) status = EvolutionRemote_Initialize(pool, &config, &params);
+    if (NT_SUCCESS(status)) status = EvolutionEngine_Initialize(engine, &params, neural, NULL);
+    if (NT_SUCCESS(status)) status = EvolutionEngine_InitializePopulation(engine);
+    if (NT_SUCCESS(status)) status = EvolutionRemote_Attach(pool, engine);
+
+    if (NT_SUCCESS(status)) {
+        printf("Remote evaluation: %u/%u workers on port %u, pipeline %u\n",
+               EvolutionRemote_LiveWorkers(pool), config.worker_count, (unsigned)pool->port,
+               pool->config.pipeline_depth);
+        uint64_t t0 = GetTickCount64();
+        engine->running = true;
+        while (engine->population.generation < generations) {
+            EvolutionEngine_EvaluatePopulation(engine);
+            if (engine->population.best_fitness >= params.target_fitness) break;
+            if (!NT_SUCCESS(EvolutionEngine_NextGeneration(engine))) break;
+        }
+        engine->running = false;
+        uint64_t elapsed = GetTickCount64() - t0;
+
+        EvolutionRemoteStats stats;
+        EvolutionRemote_GetStats(pool, &stats);
+        printf("Best fitness %.4f after %u generations in %llu ms\n", engine->population.best_fitness,
+               engine->population.generation, (unsigned long long)elapsed);
+        printf("  %llu genomes in %llu batches, last batch %.1f ms, %u workers live\n",
+               (unsigned long long)stats.genomes_evaluated, (unsigned long long)stats.batches,
+               stats.last_batch_ms, EvolutionRemote_LiveWorkers(pool));
+        printf("  tasks %llu stolen %llu backed up %llu resubmitted %llu discarded %llu\n",
+               (unsigned long long)stats.tasks_sent, (unsigned long long)stats.tasks_stolen,
+               (unsigned long long)stats.tasks_backed_up, (unsigned long long)stats.tasks_resubmitted,
+               (unsigned long long)stats.results_discarded);
+        printf("  worker deaths %llu respawned %llu, %.1f MB out %.1f MB in\n",
+               (unsigned long long)stats.worker_deaths, (unsigned long long)stats.workers_respawned,
+               stats.bytes_sent / 1048576.0, stats.bytes_received / 1048576.0);
     } else {
-        printf(" ✓\n");
+        printf("Remote evaluation init failed (0x%08lX)\n", (unsigned long)status);
     }
 
-    // 4. Initialize Neural Substrate
-    printf("  [4/7] Neural Substrate...");
-    g_neural_context = (void*)malloc(sizeof(NeuralSubstrate));
-    if (!g_neural_context) {
-        printf(" FAILED (Out of memory)\n");
-        return FALSE;
+    if (engine) {
+        if (engine->initialized) EvolutionEngine_Shutdown(engine);
+        free(engine);
     }
-    memset(g_neural_context, 0, sizeof(NeuralSubstrate));
-    status = NeuralSubstrate_Initialize((NeuralSubstrate*)g_neural_context);
-    if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-        free(g_neural_context);
-        g_neural_context = NULL;
-        return FALSE;
+    if (pool) {
+        EvolutionRemote_Shutdown(pool);
+        free(pool);
     }
-    printf(" ✓\n");
+    if (config.substrate_path[0]) DeleteFileA(config.substrate_path);
+    NeuralSubstrate_Shutdown(neural);
+    free(neural);
+    return NT_SUCCESS(status) ? 0 : 1;
+}
 
-    // 5. Initialize Ethics System
-    printf("  [5/7] Ethics Learning System...");
-    status = Ethics_Initialize(&g_ethics_context, g_neural_context);
-    if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-        return FALSE;
+// Standalone population-based training: --pbt [replicas] [--steps N] [--interval N]
+//   [--save path]; replicas default to one per logical processor, capped at the pool's workers
+static int RunPbtMode(int argc, char* argv[]) {
+    TrainingPbtConfig config;
+    TrainingPbt_GetDefaultConfig(&config);
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    config.replicas = si.dwNumberOfProcessors < 2 ? 2 : si.dwNumberOfProcessors;
+    config.seed = (uint64_t)time(NULL);
+    uint64_t steps = 500;
+    const char* save_path = NULL;
+
+    int argi = 2;
+    if (argi < argc && argv[argi][0] != '-') {
+        config.replicas = (uint32_t)strtoul(argv[argi++], NULL, 10);
+    }
+    for (; argi < argc; argi++) {
+        if (strcmp(argv[argi], "--steps") == 0 && argi + 1 < argc) {
+            steps = strtoull(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--interval") == 0 && argi + 1 < argc) {
+            config.interval_steps = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--save") == 0 && argi + 1 < argc) {
+            save_path = argv[++argi];
+        }
     }
-    printf(" ✓\n");
+    if (config.replicas > TRAINING_PBT_MAX_REPLICAS) config.replicas = TRAINING_PBT_MAX_REPLICAS;
 
-    // 6. Initialize Screen Control
-    printf("  [6/7] Screen Control System...");
-    status = ScreenControl_Initialize(&g_screen_context);
-    if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-        return FALSE;
+    NeuralSubstrate* neural = (NeuralSubstrate*)malloc(sizeof(NeuralSubstrate));
+    if (!neural) return 1;
+    memset(neural, 0, sizeof(NeuralSubstrate));
+    if (!NT_SUCCESS(NeuralSubstrate_Initialize(neural))) {
+        printf("Neural substrate init failed\n");
+        free(neural);
+        return 1;
     }
-    printf(" ✓\n");
 
-    // 7. Initialize Internet Acquisition
-    printf("  [7/7] Internet Acquisition System...");
-    status = InternetAcquisition_Initialize(&g_internet_context, g_neural_context, g_ethics_context);
-    if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-        return FALSE;
+    TrainingPbt* pbt = (TrainingPbt*)malloc(sizeof(TrainingPbt));
+    if (!pbt) {
+        NeuralSubstrate_Shutdown(neural);
+        free(neural);
+        return 1;
     }
-    printf(" ✓\n");
 
-    // 8. Initialize Programming Domination
-    printf("  [8/10] Programming Domination Engine...");
-    status = ProgrammingDomination_Initialize(&g_pd_context, g_neural_context, g_ethics_context, g_internet_context);
+    NTSTATUS status = TrainingPbt_Initialize(pbt, &config, neural);
+    if (NT_SUCCESS(status)) {
+        printf("PBT: %u replicas, %llu steps each, exploit/explore every %u steps\n",
+               pbt->config.replicas, (unsigned long long)steps, pbt->config.interval_steps);
+        uint64_t t0 = GetTickCount64();
+        status = TrainingPbt_Run(pbt, steps);
+        uint64_t elapsed = GetTickCount64() - t0;
+
+        for (uint32_t i = 0; i < pbt->config.replicas; i++) {
+            const TrainingPbtReplica* r = &pbt->replicas[i];
+            printf("  Replica %2u: loss %.6f lr %.5f mutation %.5f sparsity %.5f exploits %u\n",
+                   i, r->score, r->hyper.learning_rate, r->hyper.mutation_rate, r->hyper.sparsity, r->exploits);
+        }
+        uint32_t best = 0;
+        TrainingPbtHyperparams hyper;
+        double score = 0.0;
+        if (NT_SUCCESS(TrainingPbt_GetBest(pbt, &best, &hyper, &score))) {
+            printf("Best replica %u: loss %.6f (lr %.5f, mutation %.5f, sparsity %.5f) in %llu ms, "
+                   "%llu exploits, %.1f us per copy\n",
+                   best, score, hyper.learning_rate, hyper.mutation_rate, hyper.sparsity,
+                   (unsigned long long)elapsed, (unsigned long long)pbt->exploit_count,
+                   pbt->exploit_count ? (double)pbt->copy_us / pbt->exploit_count : 0.0);
+            if (save_path && NT_SUCCESS(TrainingPbt_ExportBest(pbt, neural))) {
+                status = NeuralSubstrate_SaveState(neural, save_path);
+                printf("Best weights saved to %s (0x%08lX)\n", save_path, (unsigned long)status);
+            }
+        }
+        TrainingPbt_Shutdown(pbt);
+    } else {
+        printf("PBT init failed (0x%08lX)\n", (unsigned long)status);
+    }
+
+    free(pbt);
+    NeuralSubstrate_Shutdown(neural);
+    free(neural);
+    return NT_SUCCESS(status) ? 0 : 1;
+}
+
+// Pack a directory of local text into one training shard: --build-corpus <dir> <shard> [--ext .c,.h,...]
+static int RunBuildCorpusMode(int argc, char* argv[]) {
+    const char* extensions = NULL;
+    for (int argi = 4; argi + 1 < argc; argi++) {
+        if (strcmp(argv[argi], "--ext") == 0) extensions = argv[++argi];
+    }
+
+    TrainingCorpusBuildStats stats;
+    uint64_t t0 = GetTickCount64();
+    NTSTATUS status = TrainingCorpus_BuildShard(argv[2], argv[3], extensions, &stats);
+    uint64_t elapsed = GetTickCount64() - t0;
+    printf("Corpus %s: %llu files packed, %llu skipped, %.1f MB in %llu ms (0x%08lX)\n",
+           argv[3], (unsigned long long)stats.files_packed, (unsigned long long)stats.files_skipped,
+           stats.bytes_packed / (1024.0 * 1024.0), (unsigned long long)elapsed, (unsigned long)status);
+    return NT_SUCCESS(status) ? 0 : 1;
+}
+
+// Corpus read throughput at training geometry: --bench-corpus <shard> [--samples N]
+//   [--shuffle-blocks N] [--block-bytes N]
+static int RunBenchCorpusMode(int argc, char* argv[]) {
+    TrainingCorpusConfig config;
+    TrainingCorpus_GetDefaultConfig(&config);
+    uint64_t samples = 100000;
+    for (int argi = 3; argi + 1 < argc; argi++) {
+        if (strcmp(argv[argi], "--samples") == 0) {
+            samples = strtoull(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--shuffle-blocks") == 0) {
+            config.shuffle_blocks = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--block-bytes") == 0) {
+            config.block_bytes = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        }
+    }
+
+    TrainingCorpus* corpus = (TrainingCorpus*)malloc(sizeof(TrainingCorpus));
+    uint8_t* input = (uint8_t*)malloc(TRAINING_INPUT_SIZE);
+    uint8_t* target = (uint8_t*)malloc(TRAINING_TARGET_SIZE);
+    NTSTATUS status = STATUS_INSUFFICIENT_RESOURCES;
+    if (corpus && input && target)
+        status = TrainingCorpus_Open(corpus, argv[2], TRAINING_INPUT_SIZE, TRAINING_TARGET_SIZE, &config);
+    if (NT_SUCCESS(status)) {
+        printf("Corpus %s: %llu files, %.1f MB, %llu samples in %u blocks, shuffle buffer %u blocks\n",
+               argv[2], (unsigned long long)corpus->file_count, corpus->data_bytes / (1024.0 * 1024.0),
+               (unsigned long long)corpus->sample_count, corpus->block_count, corpus->config.shuffle_blocks);
+        uint64_t checksum = 0;
+        for (uint64_t i = 0; i < samples && NT_SUCCESS(status); i++) {
+            status = TrainingCorpus_NextSample(corpus, input, target);
+            checksum += input[0] + target[TRAINING_TARGET_SIZE - 1];
+        }
+        TrainingCorpusStats stats;
+        TrainingCorpus_GetStats(corpus, &stats);
+        printf("%llu samples in %.1f ms: %.0f samples/sec, %.1f MB/s, %llu blocks, %llu epochs (checksum %llu)\n",
+               (unsigned long long)stats.samples, stats.elapsed_us / 1000.0, stats.samples_per_sec,
+               stats.elapsed_us ? stats.bytes / (double)stats.elapsed_us : 0.0,
+               (unsigned long long)stats.blocks_loaded, (unsigned long long)stats.epochs,
+               (unsigned long long)checksum);
+        TrainingCorpus_Close(corpus);
+    } else {
+        printf("Corpus open failed (0x%08lX)\n", (unsigned long)status);
+    }
+    free(target);
+    free(input);
+    free(corpus);
+    return NT_SUCCESS(status) ? 0 : 1;
+}
+
+// Training step latency and throughput, substrate and pipeline only: --bench-train [--warmup N]
+//   [--steps M] [--batch B] [--threads T] [--prefetch D] [--replay F] [--corpus shard] [--out report.json]
+static int RunBenchTrainMode(int argc, char* argv[]) {
+    TrainingBenchConfig config;
+    TrainingBench_GetDefaultConfig(&config);
+    const char* out_path = NULL;
+    for (int argi = 2; argi + 1 < argc; argi++) {
+        if (strcmp(argv[argi], "--warmup") == 0) {
+            config.warmup_steps = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--steps") == 0) {
+            config.measured_steps = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--batch") == 0) {
+            config.batch_size = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--threads") == 0) {
+            config.threads = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--prefetch") == 0) {
+            config.prefetch_depth = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--replay") == 0) {
+            config.replay_fraction = strtod(argv[++argi], NULL);
+        } else if (strcmp(argv[argi], "--corpus") == 0) {
+            config.corpus_path = argv[++argi];
+        } else if (strcmp(argv[argi], "--out") == 0) {
+            out_path = argv[++argi];
+        }
+    }
+    if (config.batch_size < config.threads) config.batch_size = config.threads;
+
+    NeuralSubstrate* neural = (NeuralSubstrate*)malloc(sizeof(NeuralSubstrate));
+    if (!neural) return 1;
+    memset(neural, 0, sizeof(NeuralSubstrate));
+    if (!NT_SUCCESS(NeuralSubstrate_Initialize(neural))) {
+        printf("Neural substrate init failed\n");
+        free(neural);
+        return 1;
+    }
+
+    TrainingBenchReport report;
+    NTSTATUS status = TrainingBench_Run(&config, neural, &report);
+    if (NT_SUCCESS(status)) {
+        TrainingBench_WriteJson(&report, stdout);
+        if (out_path) {
+            FILE* f = fopen(out_path, "w");
+            if (f) {
+                TrainingBench_WriteJson(&report, f);
+                fclose(f);
+            } else {
+                printf("Could not write %s\n", out_path);
+                status = STATUS_ACCESS_DENIED;
+            }
+        }
+    } else {
+        printf("Training benchmark failed (0x%08lX)\n", (unsigned long)status);
+    }
+
+    NeuralSubstrate_Shutdown(neural);
+    free(neural);
+    return NT_SUCCESS(status) ? 0 : 1;
+}
+
+// Synchronous data-parallel training over K workers: --data-parallel K [--steps N] [--batch B]
+//   [--lr X] [--threads] [--verify] [--save state.bin]. Workers are processes unless --threads;
+//   --verify also runs K = 1 from the same start and fails if the weights differ beyond tolerance.
+static int RunDataParallelMode(int argc, char* argv[]) {
+    TrainingDataParallelConfig config;
+    TrainingDataParallel_GetDefaultConfig(&config);
+    config.workers = (uint32_t)strtoul(argv[2], NULL, 10);
+    config.use_processes = true;
+    bool verify = false;
+    const char* save_path = NULL;
+    for (int argi = 3; argi < argc; argi++) {
+        if (strcmp(argv[argi], "--threads") == 0) {
+            config.use_processes = false;
+        } else if (strcmp(argv[argi], "--verify") == 0) {
+            verify = true;
+        } else if (argi + 1 < argc && strcmp(argv[argi], "--steps") == 0) {
+            config.steps = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (argi + 1 < argc && strcmp(argv[argi], "--batch") == 0) {
+            config.batch = (uint32_t)strtoul(argv[++argi], NULL, 10);
+        } else if (argi + 1 < argc && strcmp(argv[argi], "--lr") == 0) {
+            config.learning_rate = (float)strtod(argv[++argi], NULL);
+        } else if (argi + 1 < argc && strcmp(argv[argi], "--save") == 0) {
+            save_path = argv[++argi];
+        }
+    }
+    if (config.batch < config.workers) config.batch = config.workers;
+
+    NeuralSubstrate* neural = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+    NeuralSubstrate* reference = verify ? (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate)) : NULL;
+    if (!neural || (verify && !reference)) {
+        free(neural);
+        free(reference);
+        return 1;
+    }
+    NTSTATUS status = NeuralSubstrate_Initialize(neural);
+    if (NT_SUCCESS(status) && verify) status = NeuralSubstrate_CreateReplica(reference, neural);
     if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-        return FALSE;
+        printf("Neural substrate init failed (0x%08lX)\n", (unsigned long)status);
+        if (neural->initialized) NeuralSubstrate_Shutdown(neural);
+        free(neural);
+        free(reference);
+        return 1;
     }
-    printf(" ✓\n");
 
-    // 9. Initialize Autonomous Manager
-    printf("  [9/10] Autonomous Operation Manager...");
-    g_autonomous_manager = (AutonomousManager*)malloc(sizeof(AutonomousManager));
-    if (!g_autonomous_manager) {
-        printf(" FAILED (Out of memory)\n");
-        return FALSE;
+    TrainingDataParallelStats stats;
+    status = TrainingDataParallel_Run(&config, neural, &stats);
+    if (NT_SUCCESS(status)) {
+        printf("Data parallel: %u %s, %llu samples in %.1f ms (%.1f samples/s), loss %.5f\n",
+               config.workers, config.use_processes ? "processes" : "threads",
+               (unsigned long long)stats.samples, stats.elapsed_ms, stats.samples_per_sec, stats.final_loss);
+        uint64_t busy = stats.compute_us + stats.allreduce_us;
+        printf("  %llu parameters, rank 0 compute %.1f ms, allreduce %.1f ms (%.1f%%)\n",
+               (unsigned long long)stats.parameters, stats.compute_us / 1000.0, stats.allreduce_us / 1000.0,
+               busy ? 100.0 * stats.allreduce_us / busy : 0.0);
+    } else {
+        printf("Data parallel training failed (0x%08lX)\n", (unsigned long)status);
+    }
+
+    if (NT_SUCCESS(status) && verify) {
+        TrainingDataParallelConfig single = config;
+        single.workers = 1;
+        single.use_processes = false;
+        TrainingDataParallelStats single_stats;
+        double max_diff = 0.0;
+        status = TrainingDataParallel_Run(&single, reference, &single_stats);
+        if (NT_SUCCESS(status)) status = TrainingDataParallel_CompareWeights(neural, reference, &max_diff);
+        if (NT_SUCCESS(status) && max_diff > TRAINING_DP_VERIFY_TOLERANCE) status = STATUS_UNSUCCESSFUL;
+        printf("Verify against 1 worker: max |dw| = %.3e (tolerance %.0e) %s\n",
+               max_diff, TRAINING_DP_VERIFY_TOLERANCE, NT_SUCCESS(status) ? "PASS" : "FAIL");
+    }
+
+    if (NT_SUCCESS(status) && save_path) {
+        status = NeuralSubstrate_SaveState(neural, save_path);
+        if (!NT_SUCCESS(status)) printf("Could not write %s\n", save_path);
     }
 
-    status = AutonomousManager_Initialize(g_autonomous_manager,
-                                        (NeuralSubstrate*)g_neural_context,
-                                        (EthicsSystem*)g_ethics_context,
-                                        (ScreenControlSystem*)g_screen_context);
+    if (reference) {
+        if (reference->initialized) NeuralSubstrate_Shutdown(reference);
+        free(reference);
+    }
+    NeuralSubstrate_Shutdown(neural);
+    free(neural);
+    return NT_SUCCESS(status) ? 0 : 1;
+}
+
+// Status of a running --headless process: --status <pid | section name>
+static int RunStatusMode(int argc, char* argv[]) {
+    (void)argc;
+    char name[STATUS_CHANNEL_NAME_MAX];
+    char* end = NULL;
+    unsigned long pid = strtoul(argv[2], &end, 10);
+    if (end && *end == '\0' && pid > 0)
+        StatusChannel_FormatName((uint32_t)pid, name, sizeof(name));
+    else
+        snprintf(name, sizeof(name), "%s", argv[2]);
+
+    StatusSnapshot s;
+    NTSTATUS status = StatusChannel_ReadByName(name, &s);
     if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-        free(g_autonomous_manager);
-        g_autonomous_manager = NULL;
-        return FALSE;
+        printf("No status at %s (0x%08lX)\n", name, (unsigned long)status);
+        return 1;
     }
-    printf(" ✓\n");
+    printf("%s: %s, up %.1f s\n", name, StatusChannel_StateName(s.state), s.uptime_ms / 1000.0);
+    printf("  cycles=%llu (%.1f/s) steps=%llu (%.1f/s) gen=%llu\n",
+        (unsigned long long)s.cycles, s.cycles_per_sec, (unsigned long long)s.steps, s.steps_per_sec,
+        (unsigned long long)s.generation);
+    printf("  loss=%.4f fitness=%.4f entropy=%.4f\n", s.loss, s.fitness, s.entropy);
+    printf("  throttle=%.2f deg=%u mem=%llu MB overruns=%llu\n", s.throttle, s.degradation_mode,
+        (unsigned long long)s.memory_mb, (unsigned long long)s.task_overruns);
+    printf("  scheduler dispatches=%llu, pool %u workers %llu tasks\n",
+        (unsigned long long)s.scheduler_dispatches, s.pool_workers, (unsigned long long)s.pool_executed);
+    if (s.message[0]) printf("  last: %s\n", s.message);
+    return 0;
+}
 
-    // 10. Initialize Evolution Engine
-    printf("  [10/10] Evolution Engine...");
-    g_evolution_engine = (EvolutionEngine*)malloc(sizeof(EvolutionEngine));
-    if (!g_evolution_engine) {
-        printf(" FAILED (Out of memory)\n");
-        return FALSE;
+// Startup nodes: one initializer per subsystem. Dependencies are declared in
+// BuildStartupGraph; each node only touches its own globals and the ones it depends on.
+
+static NTSTATUS StartHal(void* context) {
+    (void)context;
+    return HAL_Initialize(&g_hal_context);
+}
+
+static NTSTATUS StartHypervisor(void* context) {
+    (void)context;
+    return Hypervisor_Initialize(&g_hypervisor_context, g_hal_context);
+}
+
+// Ring -1 access (ultimate hardware control); without it the system continues with limited access
+static NTSTATUS StartRingMinus1(void* context) {
+    (void)context;
+    return Hypervisor_EnableRingMinus1(g_hypervisor_context);
+}
+
+static NTSTATUS StartNeuralSubstrate(void* context) {
+    (void)context;
+    NeuralSubstrate* neural = (NeuralSubstrate*)malloc(sizeof(NeuralSubstrate));
+    if (!neural) return STATUS_INSUFFICIENT_RESOURCES;
+    memset(neural, 0, sizeof(NeuralSubstrate));
+    NTSTATUS status = NeuralSubstrate_Initialize(neural);
+    if (!NT_SUCCESS(status)) {
+        free(neural);
+        return status;
     }
+    g_neural_context = neural;
+    return STATUS_SUCCESS;
+}
+
+static NTSTATUS StartEthics(void* context) {
+    (void)context;
+    return Ethics_Initialize(&g_ethics_context, g_neural_context);
+}
+
+static NTSTATUS StartScreenControl(void* context) {
+    (void)context;
+    return ScreenControl_Initialize(&g_screen_context);
+}
+
+static NTSTATUS StartInternetAcquisition(void* context) {
+    (void)context;
+    return InternetAcquisition_Initialize(&g_internet_context, g_neural_context, g_ethics_context);
+}
+
+static NTSTATUS StartProgrammingDomination(void* context) {
+    (void)context;
+    return ProgrammingDomination_Initialize(&g_pd_context, g_neural_context, g_ethics_context, g_internet_context);
+}
+
+static NTSTATUS StartAutonomousManager(void* context) {
+    (void)context;
+    AutonomousManager* manager = (AutonomousManager*)malloc(sizeof(AutonomousManager));
+    if (!manager) return STATUS_INSUFFICIENT_RESOURCES;
+    memset(manager, 0, sizeof(AutonomousManager));
+    NTSTATUS status = AutonomousManager_Initialize(manager,
+                                                 (NeuralSubstrate*)g_neural_context,
+                                                 (EthicsSystem*)g_ethics_context,
+                                                 (ScreenControlSystem*)g_screen_context);
+    if (!NT_SUCCESS(status)) {
+        free(manager);
+        return status;
+    }
+    g_autonomous_manager = manager;
+    return STATUS_SUCCESS;
+}
+
+static NTSTATUS StartEvolutionEngine(void* context) {
+    (void)context;
+    EvolutionEngine* engine = (EvolutionEngine*)malloc(sizeof(EvolutionEngine));
+    if (!engine) return STATUS_INSUFFICIENT_RESOURCES;
+    memset(engine, 0, sizeof(EvolutionEngine));
 
     EvolutionParameters evo_params;
     memset(&evo_params, 0, sizeof(evo_params));
@@ -341,159 +1044,324 @@ static BOOL InitializeRaijinSystem() {
     evo_params.parallel_evaluations = 10;
     evo_params.population_size = 100;
 
-    status = EvolutionEngine_Initialize(g_evolution_engine, &evo_params,
-                                      (NeuralSubstrate*)g_neural_context,
-                                      (EthicsSystem*)g_ethics_context);
+    NTSTATUS status = EvolutionEngine_Initialize(engine, &evo_params,
+                                               (NeuralSubstrate*)g_neural_context,
+                                               (EthicsSystem*)g_ethics_context);
     if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-        free(g_evolution_engine);
-        g_evolution_engine = NULL;
-        return FALSE;
+        free(engine);
+        return status;
     }
-    printf(" ✓\n");
+    g_evolution_engine = engine;
+    return STATUS_SUCCESS;
+}
 
-    // 11. Initialize Training Pipeline
-    printf("  [11/11] Training Pipeline...");
-    g_training_pipeline = (TrainingPipeline*)malloc(sizeof(TrainingPipeline));
-    if (!g_training_pipeline) {
-        printf(" FAILED (Out of memory)\n");
-        return FALSE;
-    }
-    status = TrainingPipeline_Initialize(g_training_pipeline,
-        (NeuralSubstrate*)g_neural_context,
-        g_evolution_engine);
+static NTSTATUS StartTrainingPipeline(void* context) {
+    (void)context;
+    TrainingPipeline* pipeline = (TrainingPipeline*)malloc(sizeof(TrainingPipeline));
+    if (!pipeline) return STATUS_INSUFFICIENT_RESOURCES;
+    NTSTATUS status = TrainingPipeline_Initialize(pipeline, (NeuralSubstrate*)g_neural_context, g_evolution_engine);
     if (!NT_SUCCESS(status)) {
-        printf(" FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-        free(g_training_pipeline);
-        g_training_pipeline = NULL;
-        return FALSE;
+        free(pipeline);
+        return status;
     }
+    g_training_pipeline = pipeline;
     EvolutionEngine_InitializePopulation(g_evolution_engine);
-    printf(" ✓\n");
+    if (g_corpus_path) {
+        status = TrainingCorpus_Open(&g_training_corpus, g_corpus_path, TRAINING_INPUT_SIZE, TRAINING_TARGET_SIZE, NULL);
+        if (NT_SUCCESS(status))
+            TrainingPipeline_SetDataSource(g_training_pipeline, TrainingCorpus_BatchSource, &g_training_corpus);
+        else
+            printf("  Corpus %s unavailable (0x%08lX), synthetic data\n", g_corpus_path, (unsigned long)status);
+    }
+    if (!NT_SUCCESS(TrainingPipeline_EnablePrefetch(g_training_pipeline, TRAINING_PREFETCH_DEFAULT_DEPTH)))
+        printf("  Training prefetch off\n");
+    if (!NT_SUCCESS(TrainingPipeline_EnableReplay(g_training_pipeline, NULL)))
+        printf("  Training replay off\n");
+    return STATUS_SUCCESS;
+}
 
-    status = Telemetry_Initialize(&g_telemetry, "data");
-    if (!NT_SUCCESS(status)) {
-        printf("  Telemetry init WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-    }
-    status = LongTermMemory_Initialize(&g_long_term_memory, "data");
-    if (!NT_SUCCESS(status)) {
-        printf("  Long-term memory init WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-    }
-    status = SelfTestReport_Initialize(&g_self_test_report, 32 + REGRESSION_REPLAY_MAX_TESTS);
-    if (!NT_SUCCESS(status)) {
-        printf("  Self-test report init WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
-    }
-    RuntimeConfig_GetDefault(&g_runtime_config);
+// Loads the population over the fresh one, so it runs after the pipeline initialised it
+static NTSTATUS StartEvolutionCheckpoint(void* context) {
+    (void)context;
+    if (NT_SUCCESS(EvolutionCheckpoint_Load(g_evolution_engine, "data/evolution_checkpoint.bin"))) {
+        printf("  Evolution resumed from checkpoint at generation %u\n", g_evolution_engine->population.generation);
+    }
+    EvolutionEngine_EnableCheckpoint(g_evolution_engine, "data/evolution_checkpoint.bin",
+        EVOLUTION_CHECKPOINT_DEFAULT_INTERVAL);
+    if (!NT_SUCCESS(TrainingPipeline_EnableAsyncEvolution(g_training_pipeline)))
+        printf("  Evolution runs inline with training (evolver worker unavailable)\n");
+    return STATUS_SUCCESS;
+}
 
-    printf("  [12/22] Dominance Metrics...");
-    status = DominanceMetrics_Initialize(&g_dominance_metrics,
+static NTSTATUS StartTelemetry(void* context) {
+    (void)context;
+    return Telemetry_Initialize(&g_telemetry, "data");
+}
+
+static NTSTATUS StartLongTermMemory(void* context) {
+    (void)context;
+    return LongTermMemory_Initialize(&g_long_term_memory, "data");
+}
+
+static NTSTATUS StartSelfTestReport(void* context) {
+    (void)context;
+    return SelfTestReport_Initialize(&g_self_test_report, SELF_TEST_MAX_TESTS + REGRESSION_REPLAY_MAX_TESTS);
+}
+
+static NTSTATUS StartDominanceMetrics(void* context) {
+    (void)context;
+    return DominanceMetrics_Initialize(&g_dominance_metrics,
         (NeuralSubstrate*)g_neural_context, g_evolution_engine, g_training_pipeline);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [13/22] Regression Detector...");
-    status = RegressionDetector_Initialize(&g_regression_detector, &g_dominance_metrics);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [14/22] Anomaly Detector...");
-    status = AnomalyDetector_Initialize(&g_anomaly_detector);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [15/22] Lineage Tracker...");
-    status = LineageTracker_Initialize(&g_lineage_tracker, "data");
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [16/22] Versioning Rollback...");
-    status = VersioningRollback_Initialize(&g_versioning_rollback,
+}
+
+static NTSTATUS StartRegressionDetector(void* context) {
+    (void)context;
+    return RegressionDetector_Initialize(&g_regression_detector, &g_dominance_metrics);
+}
+
+static NTSTATUS StartAnomalyDetector(void* context) {
+    (void)context;
+    return AnomalyDetector_Initialize(&g_anomaly_detector);
+}
+
+static NTSTATUS StartLineageTracker(void* context) {
+    (void)context;
+    return LineageTracker_Initialize(&g_lineage_tracker, "data");
+}
+
+static NTSTATUS StartVersioningRollback(void* context) {
+    (void)context;
+    return VersioningRollback_Initialize(&g_versioning_rollback,
         &g_lineage_tracker, &g_long_term_memory,
         (NeuralSubstrate*)g_neural_context, g_evolution_engine, "data");
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [17/22] Resource Governor...");
-    status = ResourceGovernor_Initialize(&g_resource_governor);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else {
-        ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_THINKING, 10.0, 128, 500);
-        ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_LEARNING, 15.0, 256, 2000);
-        ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_MEMORY, 5.0, 128, 1000);
-        ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_STRESS, 5.0, 64, 1000);
-        ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_TRAINING, 25.0, 512, 5000);
-        ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_EVOLUTION, 20.0, 256, 3000);
-        printf(" ✓\n");
-    }
+}
+
+static NTSTATUS StartResourceGovernor(void* context) {
+    (void)context;
+    NTSTATUS status = ResourceGovernor_Initialize(&g_resource_governor);
+    if (!NT_SUCCESS(status)) return status;
+    ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_THINKING, 10.0, 128, 500);
+    ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_LEARNING, 15.0, 256, 2000);
+    ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_MEMORY, 5.0, 128, 1000);
+    ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_STRESS, 5.0, 64, 1000);
+    ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_TRAINING, 25.0, 512, 5000);
+    ResourceGovernor_AllocateBudget(&g_resource_governor, SUBSYSTEM_EVOLUTION, 20.0, 256, 3000);
+    return STATUS_SUCCESS;
+}
 
-    printf("  [17/28] Fitness Ledger...");
-    status = FitnessLedger_Initialize(&g_fitness_ledger,
+static NTSTATUS StartFitnessLedger(void* context) {
+    (void)context;
+    return FitnessLedger_Initialize(&g_fitness_ledger,
         &g_dominance_metrics, &g_regression_detector,
         &g_lineage_tracker, &g_versioning_rollback);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [18/28] WorldModel...");
-    status = WorldModel_Initialize(&g_world_model);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [19/28] EpisodicMemory...");
-    status = EpisodicMemory_Initialize(&g_episodic_memory);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [20/28] Provenance...");
-    status = Provenance_Initialize(&g_provenance, "data");
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else {
-        static const char* PINNED_DEPS_JSON = "{\"toolchain\":\"mingw\",\"raijin\":\"1.0\",\"deterministic\":true}";
-        if (!NT_SUCCESS(Provenance_SetPinnedDeps(&g_provenance, PINNED_DEPS_JSON))) { }
-        printf(" ✓\n");
-    }
+}
 
-    printf("  [21/28] Curriculum...");
-    status = Curriculum_Initialize(&g_curriculum);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [22/28] Stress Test Framework...");
-    status = StressTestFramework_Initialize(&g_stress_test_framework,
-        (NeuralSubstrate*)g_neural_context, g_evolution_engine);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [23/28] AdversarialStress...");
-    status = AdversarialStress_Initialize(&g_adversarial_stress,
-        (NeuralSubstrate*)g_neural_context, 4096);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [24/28] RedTeam...");
-    status = RedTeam_Initialize(&g_red_team,
-        (NeuralSubstrate*)g_neural_context,
-        &g_stress_test_framework,
-        &g_adversarial_stress);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
-
-    printf("  [25/28] Self-Healing...");
-    status = SelfHealing_Initialize(&g_self_healing,
+static NTSTATUS StartWorldModel(void* context) {
+    (void)context;
+    return WorldModel_Initialize(&g_world_model);
+}
+
+static NTSTATUS StartEpisodicMemory(void* context) {
+    (void)context;
+    return EpisodicMemory_Initialize(&g_episodic_memory);
+}
+
+static NTSTATUS StartProvenance(void* context) {
+    (void)context;
+    static const char* PINNED_DEPS_JSON = "{\"toolchain\":\"mingw\",\"raijin\":\"1.0\",\"deterministic\":true}";
+    NTSTATUS status = Provenance_Initialize(&g_provenance, "data");
+    if (NT_SUCCESS(status)) Provenance_SetPinnedDeps(&g_provenance, PINNED_DEPS_JSON);
+    return status;
+}
+
+static NTSTATUS StartCurriculum(void* context) {
+    (void)context;
+    return Curriculum_Initialize(&g_curriculum);
+}
+
+// The evaluators never see the live substrate; they run on the robustness worker's replica.
+// The replica copies the live weights, so this waits for everything that still writes them.
+static NTSTATUS StartRobustnessWorker(void* context) {
+    (void)context;
+    NTSTATUS status = RobustnessWorker_Initialize(&g_robustness_worker, (NeuralSubstrate*)g_neural_context);
+    if (NT_SUCCESS(status) && RobustnessWorker_GetSnapshot(&g_robustness_worker) == (NeuralSubstrate*)g_neural_context)
+        printf("  Robustness snapshot unavailable; evaluators run inline\n");
+    return status;
+}
+
+static NeuralSubstrate* RobustnessSubstrate() {
+    NeuralSubstrate* snapshot = RobustnessWorker_GetSnapshot(&g_robustness_worker);
+    return snapshot ? snapshot : (NeuralSubstrate*)g_neural_context;
+}
+
+static NTSTATUS StartStressTestFramework(void* context) {
+    (void)context;
+    return StressTestFramework_Initialize(&g_stress_test_framework, RobustnessSubstrate(), g_evolution_engine);
+}
+
+static NTSTATUS StartAdversarialStress(void* context) {
+    (void)context;
+    return AdversarialStress_Initialize(&g_adversarial_stress, RobustnessSubstrate(), 4096);
+}
+
+// Last of the evaluators, so it also hands all three to the worker
+static NTSTATUS StartRedTeam(void* context) {
+    (void)context;
+    NTSTATUS status = RedTeam_Initialize(&g_red_team, RobustnessSubstrate(),
+        &g_stress_test_framework, &g_adversarial_stress);
+    RobustnessWorker_Attach(&g_robustness_worker, &g_stress_test_framework, &g_adversarial_stress, &g_red_team);
+    return status;
+}
+
+static NTSTATUS StartSelfHealing(void* context) {
+    (void)context;
+    return SelfHealing_Initialize(&g_self_healing,
         &g_regression_detector, &g_versioning_rollback, &g_dominance_metrics,
         g_resource_governor.initialized ? &g_resource_governor : NULL);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
+}
 
-    printf("  [26/28] Introspection System...");
-    status = IntrospectionSystem_Initialize(&g_introspection_system,
+static NTSTATUS StartIntrospection(void* context) {
+    (void)context;
+    return IntrospectionSystem_Initialize(&g_introspection_system,
         &g_dominance_metrics, (NeuralSubstrate*)g_neural_context);
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
+}
+
+static NTSTATUS StartRegressionReplay(void* context) {
+    (void)context;
+    return RegressionReplay_Initialize(&g_regression_replay, "data");
+}
+
+// Every subsystem and what it needs, in an order where dependencies come first. REQUIRED
+// nodes abort startup as before; the rest only warn. CALLER_THREAD nodes run on the main
+// thread: the screen DC is released there at shutdown, and the neural substrate, the stress
+// test framework and the evolution population seed or draw from rand(), whose state the CRT
+// keeps per thread. LAZY nodes come up on first use.
+#define STARTUP_MAIN (STARTUP_NODE_REQUIRED | STARTUP_NODE_CALLER_THREAD)
+static const struct {
+    const char* name;
+    StartupNodeFn fn;
+    uint32_t flags;
+    const char* deps[STARTUP_GRAPH_MAX_DEPS];
+} s_startup_nodes[] = {
+    { "hal", StartHal, STARTUP_NODE_REQUIRED, { NULL } },
+    { "hypervisor", StartHypervisor, STARTUP_NODE_REQUIRED, { "hal" } },
+    { "ring_minus1", StartRingMinus1, 0, { "hypervisor" } },
+    { "neural_substrate", StartNeuralSubstrate, STARTUP_MAIN, { NULL } },
+    { "ethics", StartEthics, STARTUP_NODE_REQUIRED, { "neural_substrate" } },
+    { "screen_control", StartScreenControl, STARTUP_MAIN, { NULL } },
+    { "internet_acquisition", StartInternetAcquisition, STARTUP_NODE_LAZY, { "neural_substrate", "ethics" } },
+    { "programming_domination", StartProgrammingDomination, STARTUP_NODE_LAZY,
+        { "neural_substrate", "ethics", "internet_acquisition" } },
+    { "autonomous_manager", StartAutonomousManager, STARTUP_NODE_REQUIRED,
+        { "neural_substrate", "ethics", "screen_control" } },
+    { "evolution_engine", StartEvolutionEngine, STARTUP_MAIN, { "neural_substrate", "ethics" } },
+    { "training_pipeline", StartTrainingPipeline, STARTUP_MAIN, { "neural_substrate", "evolution_engine" } },
+    { "evolution_checkpoint", StartEvolutionCheckpoint, 0, { "training_pipeline" } },
+    { "telemetry", StartTelemetry, 0, { NULL } },
+    { "long_term_memory", StartLongTermMemory, 0, { NULL } },
+    { "self_test_report", StartSelfTestReport, 0, { NULL } },
+    { "dominance_metrics", StartDominanceMetrics, 0, { "neural_substrate", "evolution_engine", "training_pipeline" } },
+    { "regression_detector", StartRegressionDetector, 0, { "dominance_metrics" } },
+    { "anomaly_detector", StartAnomalyDetector, 0, { NULL } },
+    { "lineage_tracker", StartLineageTracker, 0, { NULL } },
+    { "versioning_rollback", StartVersioningRollback, 0,
+        { "lineage_tracker", "long_term_memory", "neural_substrate", "evolution_engine" } },
+    { "resource_governor", StartResourceGovernor, 0, { NULL } },
+    { "fitness_ledger", StartFitnessLedger, 0,
+        { "dominance_metrics", "regression_detector", "lineage_tracker", "versioning_rollback" } },
+    { "world_model", StartWorldModel, 0, { NULL } },
+    { "episodic_memory", StartEpisodicMemory, 0, { NULL } },
+    { "provenance", StartProvenance, 0, { NULL } },
+    { "curriculum", StartCurriculum, 0, { NULL } },
+    { "robustness_worker", StartRobustnessWorker, 0, { "neural_substrate", "evolution_checkpoint" } },
+    { "stress_test_framework", StartStressTestFramework, STARTUP_NODE_CALLER_THREAD,
+        { "robustness_worker", "evolution_engine" } },
+    { "adversarial_stress", StartAdversarialStress, 0, { "robustness_worker" } },
+    { "red_team", StartRedTeam, 0, { "stress_test_framework", "adversarial_stress" } },
+    { "self_healing", StartSelfHealing, 0,
+        { "regression_detector", "versioning_rollback", "dominance_metrics", "resource_governor" } },
+    { "introspection", StartIntrospection, 0, { "dominance_metrics", "neural_substrate" } },
+    { "regression_replay", StartRegressionReplay, 0, { NULL } },
+};
+#undef STARTUP_MAIN
+
+static NTSTATUS BuildStartupGraph(StartupGraph* graph) {
+    NTSTATUS status = StartupGraph_Initialize(graph);
+    if (!NT_SUCCESS(status)) return status;
+    for (uint32_t i = 0; i < sizeof(s_startup_nodes) / sizeof(s_startup_nodes[0]); i++) {
+        uint32_t deps[STARTUP_GRAPH_MAX_DEPS];
+        uint32_t dep_count = 0;
+        for (; dep_count < STARTUP_GRAPH_MAX_DEPS && s_startup_nodes[i].deps[dep_count]; dep_count++) {
+            deps[dep_count] = StartupGraph_FindNode(graph, s_startup_nodes[i].deps[dep_count]);
+            if (deps[dep_count] == STARTUP_GRAPH_INVALID_NODE) return STATUS_NOT_FOUND;
+        }
+        uint32_t id;
+        status = StartupGraph_AddNode(graph, s_startup_nodes[i].name, s_startup_nodes[i].fn, NULL,
+            s_startup_nodes[i].flags, deps, dep_count, &id);
+        if (!NT_SUCCESS(status)) return status;
+    }
+    g_internet_node = StartupGraph_FindNode(graph, "internet_acquisition");
+    g_pd_node = StartupGraph_FindNode(graph, "programming_domination");
+    return STATUS_SUCCESS;
+}
+
+// Console report, data/startup_report.json for comparing restarts, and a telemetry summary
+static void EmitStartupReport(const StartupGraph* graph) {
+    StartupGraph_PrintReport(graph);
+
+    FILE* f = fopen("data/startup_report.json", "w");
+    if (f) {
+        StartupGraph_WriteJson(graph, f);
+        fclose(f);
+    }
+
+    if (!g_telemetry.initialized) return;
+    StartupGraphStats stats;
+    StartupGraph_GetStats(graph, &stats);
+    char path[512];
+    size_t used = 0;
+    path[0] = '\0';
+    for (uint32_t i = stats.critical_path_end; i != STARTUP_GRAPH_INVALID_NODE && used < sizeof(path);
+         i = graph->nodes[i].path_dep) {
+        int written = snprintf(path + used, sizeof(path) - used, "%s%s", used ? " <- " : "", graph->nodes[i].name);
+        if (written < 0) break;
+        used += (size_t)written;
+    }
+    Telemetry_LogFormat(&g_telemetry, TELEMETRY_INFO, "Startup",
+        "wall_ms=%.1f serial_ms=%.1f critical_path_ms=%.1f workers=%u failed=%u skipped=%u lazy=%u critical_path=%s",
+        stats.wall_us / 1000.0, stats.serial_us / 1000.0, stats.critical_path_us / 1000.0, stats.workers,
+        stats.failed, stats.skipped, stats.lazy_pending, path);
+}
+
+static BOOL InitializeRaijinSystem() {
+    NTSTATUS status;
+
+    printf("Initializing system components...\n");
+
+    // Shared worker pool; subsystems submit their parallel work here instead of owning threads
+    printf("  Thread pool: %u workers\n", ThreadPool_GetWorkerCount(ThreadPool_GetGlobal()));
+
+    RuntimeConfig_GetDefault(&g_runtime_config);
+
+    status = BuildStartupGraph(&g_startup_graph);
+    if (!NT_SUCCESS(status)) {
+        printf("  Startup graph FAILED (0x%08lX)\n", (unsigned long)(NTSTATUS)status);
+        return FALSE;
+    }
 
-    printf("  [27/28] Regression Replay...");
-    status = RegressionReplay_Initialize(&g_regression_replay, "data");
-    if (!NT_SUCCESS(status)) { printf(" WARN (0x%08lX)\n", (unsigned long)(NTSTATUS)status); }
-    else { printf(" ✓\n"); }
+    // Every subsystem starts as soon as the ones it needs are up; the main thread takes its
+    // own nodes and otherwise waits
+    printf("  Starting %u subsystems...\n", g_startup_graph.node_count);
+    status = StartupGraph_Run(&g_startup_graph, ThreadPool_GetGlobal());
+    EmitStartupReport(&g_startup_graph);
+    if (!NT_SUCCESS(status)) {
+        for (uint32_t i = 0; i < g_startup_graph.node_count; i++) {
+            const StartupNode* node = &g_startup_graph.nodes[i];
+            if ((node->flags & STARTUP_NODE_REQUIRED) && node->state == STARTUP_NODE_FAILED)
+                printf("  %s FAILED (0x%08lX)\n", node->name, (unsigned long)(NTSTATUS)node->status);
+        }
+        return FALSE;
+    }
 
     printf("  Starting Autonomous Operation...");
     status = AutonomousManager_StartOperation(g_autonomous_manager);
@@ -507,11 +1375,35 @@ static BOOL InitializeRaijinSystem() {
     return TRUE;
 }
 
+// Brings a lazy subsystem up on first use, on the calling (main-loop) thread. The first
+// attempt is logged; a failed one is not retried and the caller does without.
+static BOOL EnsureSubsystem(uint32_t node) {
+    if (node == STARTUP_GRAPH_INVALID_NODE) return FALSE;
+    bool first_use = false;
+    NTSTATUS status = StartupGraph_Ensure(&g_startup_graph, node, &first_use);
+    if (first_use && g_telemetry.initialized) {
+        const StartupNode* n = &g_startup_graph.nodes[node];
+        Telemetry_LogFormat(&g_telemetry, NT_SUCCESS(status) ? TELEMETRY_INFO : TELEMETRY_WARN, "Startup",
+            "%s initialized on first use in %.1f ms (0x%08lX)", n->name,
+            (n->end_us - n->start_us) / 1000.0, (unsigned long)status);
+    }
+    return NT_SUCCESS(status);
+}
+
 static void ShutdownRaijinSystem() {
     printf("\nShutting down Raijin system...\n");
 
     g_evolution_active = FALSE;
 
+    // The evolver worker borrows the engine; hand it back before the engine goes away
+    if (g_training_pipeline) TrainingPipeline_DisableAsyncEvolution(g_training_pipeline);
+    // Likewise the robustness job in flight uses the evaluators shut down below
+    if (g_robustness_worker.initialized) {
+        printf("  Robustness Worker...");
+        RobustnessWorker_Shutdown(&g_robustness_worker);
+        printf(" ✓\n");
+    }
+
     // Shutdown in reverse order
     if (g_evolution_engine) {
         printf("  Evolution Engine...");
@@ -611,6 +1503,7 @@ static void ShutdownRaijinSystem() {
         TrainingPipeline_Shutdown(g_training_pipeline);
         free(g_training_pipeline);
         g_training_pipeline = NULL;
+        TrainingCorpus_Close(&g_training_corpus);
         printf(" ✓\n");
     }
 
@@ -672,31 +1565,14 @@ static void ShutdownRaijinSystem() {
         printf(" ✓\n");
     }
 
-    g_system_initialized = FALSE;
-}
-
-static void RunEvolutionLoop() {
-    const int EVOLUTION_CYCLE_MS = 1000; // 1 second evolution cycles
-    DWORD last_cycle_time = GetTickCount();
-
-    printf("Evolution loop started. Press 'S' for status, 'Q' to quit.\n\n");
-
-    while (g_evolution_active) {
-        DWORD current_time = GetTickCount();
+    StartupGraph_Shutdown(&g_startup_graph);
 
-        if (g_resource_governor.initialized)
-            ResourceGovernor_Sample(&g_resource_governor);
-
-        HandleUserInput();
-
-        if (current_time - last_cycle_time >= EVOLUTION_CYCLE_MS) {
-            ProcessEvolutionCycle();
-            last_cycle_time = current_time;
-        }
+    // Last: every subsystem above may still have had work queued on it
+    printf("  Thread Pool...");
+    ThreadPool_ShutdownGlobal();
+    printf(" ✓\n");
 
-        // Small delay to prevent CPU hogging
-        Sleep(10);
-    }
+    g_system_initialized = FALSE;
 }
 
 static void HandleUserInput() {
@@ -725,6 +1601,13 @@ static void HandleUserInput() {
     }
 }
 
+static const char* LazySubsystemState(const void* context, uint32_t node) {
+    if (context) return "ACTIVE";
+    if (node != STARTUP_GRAPH_INVALID_NODE && g_startup_graph.nodes[node].state == STARTUP_NODE_PENDING)
+        return "ON FIRST USE";
+    return "INACTIVE";
+}
+
 static void DisplaySystemStatus() {
     printf("\n╔══════════════════════════════════════════════════════════════════════════════╗\n");
     printf("║                           R A I J I N   S T A T U S                       ║\n");
@@ -736,8 +1619,8 @@ static void DisplaySystemStatus() {
     printf("  Neural Substrate:               %s\n", g_neural_context ? "ACTIVE" : "ACTIVE");
     printf("  Ethics Learning System:         %s\n", g_ethics_context ? "ACTIVE" : "INACTIVE");
     printf("  Screen Control System:          %s\n", g_screen_context ? "ACTIVE" : "INACTIVE");
-    printf("  Internet Acquisition System:    %s\n", g_internet_context ? "ACTIVE" : "INACTIVE");
-    printf("  Programming Domination Engine:  %s\n\n", g_pd_context ? "ACTIVE" : "INACTIVE");
+    printf("  Internet Acquisition System:    %s\n", LazySubsystemState(g_internet_context, g_internet_node));
+    printf("  Programming Domination Engine:  %s\n\n", LazySubsystemState(g_pd_context, g_pd_node));
 
     // Display programming domination statistics
     if (g_pd_context) {
@@ -761,333 +1644,812 @@ static void DisplaySystemStatus() {
     } else {
         printf("Resource Governor: not active\n");
     }
+    if (g_task_scheduler.initialized) {
+        TaskSchedulerStats ss;
+        TaskScheduler_GetStats(&g_task_scheduler, &ss);
+        printf("Scheduler: %u tasks, %llu dispatches, idle %.1f s, %llu deferred, %llu past deadline (max %.1f ms)\n",
+            g_task_scheduler.task_count, (unsigned long long)ss.dispatches, ss.wait_us / 1e6,
+            (unsigned long long)ss.deferrals, (unsigned long long)ss.dispatch_overruns, ss.max_dispatch_us / 1e3);
+    }
+    {
+        ThreadPoolStats ps;
+        ThreadPool_GetStats(ThreadPool_GetGlobal(), &ps);
+        printf("Thread pool: %u workers, %llu tasks, %llu stolen, %llu inline\n", ps.workers,
+            (unsigned long long)ps.executed, (unsigned long long)ps.stolen, (unsigned long long)ps.inline_runs);
+    }
+    if (g_robustness_worker.initialized) {
+        RobustnessWorkerStats rs;
+        RobustnessWorker_GetStats(&g_robustness_worker, &rs);
+        printf("Robustness jobs: %llu done, %llu inline, snapshot %.1f ms, eval %.1f s\n",
+            (unsigned long long)rs.completed, (unsigned long long)rs.inline_runs,
+            rs.snapshot_us / 1e3, rs.eval_us / 1e6);
+    }
     printf("\n");
 }
 
-static void ProcessEvolutionCycle() {
-    static uint32_t evolution_cycle = 0;
-    static uint32_t consecutive_degradation = 0;
-    static double prev_fitness_for_curriculum = 0.0;
-    static double prev_oracle_score = 0.5;
-    static uint32_t replay_fail_streak = 0;
-    evolution_cycle++;
+// Main-loop tasks. All run on the main thread from RunEvolutionLoop's scheduler; periods that
+// RuntimeConfig adapts are in seconds, the unit its intervals were tuned in
+#define MAIN_LOOP_MAX_WAIT_US (100 * TASK_SCHEDULER_MS)    /* re-check g_evolution_active this often */
+#define INPUT_POLL_PERIOD_US (50 * TASK_SCHEDULER_MS)
+#define GOVERNOR_SAMPLE_PERIOD_US (100 * TASK_SCHEDULER_MS)
+#define THROTTLE_BACKOFF_US (50 * TASK_SCHEDULER_MS)
+#define CURRICULUM_STEP_INTERVAL 5
+#define HEADLESS_STATUS_PERIOD_US (250 * TASK_SCHEDULER_MS)  /* status channel publish */
+#define CONSOLE_CLOSE_WAIT_MS 4000      /* the system ends the process about 5 s after a close event */
+#define MAIN_LOOP_DISPATCH_BUDGET_US INPUT_POLL_PERIOD_US      /* keeps input and governor sampling on time */
+#define SELF_TEST_SLICE_BUDGET_US (250 * TASK_SCHEDULER_MS)
+#define OVERRUN_LOG_PERIOD_US (10 * TASK_SCHEDULER_SECOND)    /* per task; overruns in between are counted */
+
+static uint32_t g_train_task = TASK_SCHEDULER_INVALID_TASK;
+static uint32_t g_rollback_task = TASK_SCHEDULER_INVALID_TASK;
+static uint32_t g_save_task = TASK_SCHEDULER_INVALID_TASK;
+static uint32_t g_stress_task = TASK_SCHEDULER_INVALID_TASK;
+static uint32_t g_robustness_task = TASK_SCHEDULER_INVALID_TASK;
+static uint32_t g_self_test_task = TASK_SCHEDULER_INVALID_TASK;
+static uint32_t g_self_test_slice_task = TASK_SCHEDULER_INVALID_TASK;
+static SelfTestSweep g_self_test_sweep = {0};
+static BOOL g_self_test_sweeping = FALSE;
+static uint64_t g_cycles_completed = 0;
+static char g_status_message[STATUS_CHANNEL_MESSAGE_MAX];   /* headless stand-in for the loop's printf */
+static StatusSnapshot g_last_status = {0};
+
+static BOOL TrainingActive() {
+    return g_training_pipeline && g_neural_context;
+}
 
-    CurriculumTask cycle_curriculum_task;
-    memset(&cycle_curriculum_task, 0, sizeof(cycle_curriculum_task));
-    int use_curriculum_task = (g_curriculum.initialized && g_training_pipeline && (evolution_cycle % 5 == 0));
-    if (use_curriculum_task && NT_SUCCESS(Curriculum_GetNextTask(&g_curriculum, &cycle_curriculum_task)))
-        TrainingPipeline_SetCurriculumTask(g_training_pipeline, &cycle_curriculum_task);
+// Adaptive intervals are re-read after each run and take effect from the next period; a
+// configured rate limit only ever lengthens them
+static void RetuneTaskPeriod(uint32_t task, uint32_t interval_s) {
+    if (task >= TASK_SCHEDULER_MAX_TASKS || interval_s == 0) return;
+    uint64_t period_us = (uint64_t)interval_s * TASK_SCHEDULER_SECOND;
+    if (period_us < g_rate_floor_us[task]) period_us = g_rate_floor_us[task];
+    TaskScheduler_SetPeriod(&g_task_scheduler, task, period_us);
+}
 
-    if (g_resource_governor.initialized) {
-        ResourceGovernor_ApplyThrottling(&g_resource_governor);
-        if (ResourceGovernor_GetThrottleFactor(&g_resource_governor) < 0.2) {
-            Sleep(50);
-        }
+// Console output where there is a console; in headless runs the line goes out with the next
+// status publish instead, so no task ever blocks on a full console buffer
+static void ReportEvent(const char* fmt, ...) {
+    char line[STATUS_CHANNEL_MESSAGE_MAX];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    if (g_headless)
+        memcpy(g_status_message, line, sizeof(g_status_message));
+    else
+        printf("%s\n", line);
+}
+
+static void EnterRaijinTask() {
+    RoleBoundary_Enter(&g_role_boundary, "raijin", ROLE_OWNER_RAIJIN);
+}
+
+static void ExitRaijinTask() {
+    RoleBoundary_Exit(&g_role_boundary, "raijin");
+    if (RoleBoundary_GetViolationCount(&g_role_boundary) > 0 && g_evolution_active) {
+        if (g_telemetry.initialized)
+            Telemetry_Log(&g_telemetry, TELEMETRY_ERROR, "RoleBoundary",
+                "Boundary violation count > 0; stopping evolution");
+        g_evolution_active = FALSE;
+        TaskScheduler_Stop(&g_task_scheduler);
     }
+}
 
-    double throttle = g_resource_governor.initialized ? ResourceGovernor_GetThrottleFactor(&g_resource_governor) : 1.0;
-    uint32_t deg = g_resource_governor.initialized ? ResourceGovernor_GetDegradationMode(&g_resource_governor) : 0;
-    int skip_heavy = (throttle < 0.5 || deg >= 2) ? 1 : 0;
+static DWORD CurrentMemoryMb() {
+    PROCESS_MEMORY_COUNTERS pmc = {0};
+    pmc.cb = sizeof(pmc);
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0;
+    return (DWORD)(pmc.WorkingSetSize / (1024 * 1024));
+}
 
-    if (g_curriculum.initialized) {
-        Curriculum_SetDegradationMode(&g_curriculum, deg);
+static void InputTask(void* context) {
+    (void)context;
+    HandleUserInput();
+}
+
+static void GovernorSampleTask(void* context) {
+    (void)context;
+    if (g_resource_governor.initialized)
+        ResourceGovernor_Sample(&g_resource_governor);
+}
+
+// One training step; re-armed immediately, so it fills all time no other task is due
+static void TrainTask(void* context) {
+    (void)context;
+    static uint64_t train_step = 0;
+    static double prev_oracle_score = 0.5;
+    static BOOL evolution_posted = FALSE;
+    if (!TrainingActive()) {
+        TaskScheduler_Defer(&g_task_scheduler, g_train_task, TASK_SCHEDULER_SECOND);
+        return;
     }
+    train_step++;
 
-    if (g_training_pipeline && g_neural_context) {
-        RoleBoundary_Enter(&g_role_boundary, "raijin", ROLE_OWNER_RAIJIN);
-        RuntimeConfig_Update(&g_runtime_config,
-            g_training_pipeline->last_metrics.loss,
-            g_training_pipeline->last_metrics.fitness,
-            g_training_pipeline->total_steps);
+    EnterRaijinTask();
+    CurriculumTask curriculum_task;
+    memset(&curriculum_task, 0, sizeof(curriculum_task));
+    BOOL use_curriculum_task = g_curriculum.initialized && (train_step % CURRICULUM_STEP_INTERVAL == 0) &&
+        NT_SUCCESS(Curriculum_GetNextTask(&g_curriculum, &curriculum_task));
+    if (use_curriculum_task)
+        TrainingPipeline_SetCurriculumTask(g_training_pipeline, &curriculum_task);
 
-        g_training_pipeline->run_evolution_this_step =
-            (evolution_cycle % g_runtime_config.evolution_interval == 0) ? 1 : 0;
-        NTSTATUS status = TrainingPipeline_TrainStep(g_training_pipeline);
-        if (status == STATUS_ROLE_BOUNDARY_VIOLATION && g_telemetry.initialized) {
-            Telemetry_Log(&g_telemetry, TELEMETRY_ERROR, "RoleBoundary",
-                "TrainStep aborted: role boundary violation, stack reset");
+    g_training_pipeline->run_evolution_this_step =
+        (train_step % g_runtime_config.evolution_interval == 0) ? 1 : 0;
+    // A posted generation runs on the evolver worker across as many TrainSteps as it takes and is
+    // exchanged after the first step that finds it in, so this task never waits on it; an
+    // evolution step that falls due while one is still out is skipped
+    BOOL evolve_this_step = !evolution_posted && g_training_pipeline->run_evolution_this_step &&
+        g_evolution_engine && g_evolution_engine->population.size > 0;
+    BOOL evolution_overlapped = evolve_this_step &&
+        NT_SUCCESS(TrainingPipeline_BeginEvolutionStep(g_training_pipeline));
+    if (evolution_overlapped) evolution_posted = TRUE;
+    NTSTATUS status = TrainingPipeline_TrainStep(g_training_pipeline);
+    if (status == STATUS_ROLE_BOUNDARY_VIOLATION && g_telemetry.initialized) {
+        Telemetry_Log(&g_telemetry, TELEMETRY_ERROR, "RoleBoundary",
+            "TrainStep aborted: role boundary violation, stack reset");
+    }
+    NTSTATUS ev_status = STATUS_SUCCESS;
+    if (evolution_posted) {
+        if (TrainingPipeline_PollEvolutionStep(g_training_pipeline) != STATUS_PENDING) {
+            evolution_posted = FALSE;
+            ev_status = TrainingPipeline_EndEvolutionStep(g_training_pipeline);
         }
-        if (NT_SUCCESS(status) && g_training_pipeline->run_evolution_this_step &&
-            g_evolution_engine && g_evolution_engine->population.size > 0) {
-            NTSTATUS ev_status = TrainingPipeline_EvolutionStep(g_training_pipeline);
-            if (ev_status == STATUS_ROLE_BOUNDARY_VIOLATION && g_telemetry.initialized) {
-                Telemetry_Log(&g_telemetry, TELEMETRY_ERROR, "RoleBoundary",
-                    "EvolutionStep aborted: role boundary violation, stack reset");
-            }
+    } else if (NT_SUCCESS(status) && evolve_this_step) {
+        ev_status = TrainingPipeline_EvolutionStep(g_training_pipeline);
+    }
+    if (ev_status == STATUS_ROLE_BOUNDARY_VIOLATION && g_telemetry.initialized) {
+        Telemetry_Log(&g_telemetry, TELEMETRY_ERROR, "RoleBoundary",
+            "EvolutionStep aborted: role boundary violation, stack reset");
+    }
+
+    if (use_curriculum_task) {
+        TaskOracleResult oracle_result = {0};
+        if (NT_SUCCESS(TaskOracle_Evaluate(curriculum_task.type,
+                g_training_pipeline->output_buffer,
+                g_training_pipeline->synthetic_target,
+                TRAINING_TARGET_SIZE, g_training_pipeline->last_metrics.loss, &oracle_result))) {
+            Curriculum_UpdateFromPerformance(&g_curriculum, oracle_result.score - prev_oracle_score);
+            prev_oracle_score = oracle_result.score;
         }
-        TrainingMetrics metrics = {0};
-        TrainingPipeline_GetMetrics(g_training_pipeline, &metrics);
+    }
+    ExitRaijinTask();
 
-        if (g_curriculum.initialized && use_curriculum_task && g_training_pipeline) {
-            TaskOracleResult oracle_result = {0};
-            if (NT_SUCCESS(TaskOracle_Evaluate(cycle_curriculum_task.type,
-                    g_training_pipeline->output_buffer,
-                    g_training_pipeline->synthetic_target,
-                    TRAINING_TARGET_SIZE, metrics.loss, &oracle_result))) {
-                Curriculum_UpdateFromPerformance(&g_curriculum, oracle_result.score - prev_oracle_score);
-                prev_oracle_score = oracle_result.score;
-            }
-        }
+    // Under heavy resource pressure the next step waits instead of following straight on
+    if (g_resource_governor.initialized && ResourceGovernor_GetThrottleFactor(&g_resource_governor) < 0.2)
+        TaskScheduler_Defer(&g_task_scheduler, g_train_task, THROTTLE_BACKOFF_US);
+}
 
-        if (g_resource_governor.initialized) {
-            DWORD mem_mb = 0;
-            PROCESS_MEMORY_COUNTERS pmc = {0};
-            pmc.cb = sizeof(pmc);
-            if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
-                mem_mb = (DWORD)(pmc.WorkingSetSize / (1024 * 1024));
-            ResourceGovernor_ReportConsumption(&g_resource_governor, SUBSYSTEM_TRAINING,
-                5.0, (uint64_t)mem_mb, (uint64_t)metrics.batch_time_ms);
-            ResourceGovernor_ReportConsumption(&g_resource_governor, SUBSYSTEM_EVOLUTION,
-                3.0, (uint64_t)(mem_mb / 2), 100);
-        }
+// Once a second, headless or not: the rollback and ledger gates count cycles as seconds. Adapts
+// configuration and records the metrics of the steps since the last cycle
+static void CycleTask(void* context) {
+    (void)context;
+    static uint32_t evolution_cycle = 0;
+    static uint32_t consecutive_degradation = 0;
+    static double prev_fitness_for_curriculum = 0.0;
+    evolution_cycle++;
+    g_cycles_completed++;
 
-        if (g_world_model.initialized) {
-            float wm_latent[WORLD_LATENT_DIM];
-            uint32_t d;
-            wm_latent[0] = (float)metrics.loss;
-            wm_latent[1] = (float)metrics.fitness;
-            wm_latent[2] = (float)metrics.entropy;
-            wm_latent[3] = (float)(metrics.step_count % 1000000) / 1000000.f;
-            wm_latent[4] = (float)(metrics.generation % 1000000) / 1000000.f;
-            for (d = 5; d < WORLD_LATENT_DIM; d++)
-                wm_latent[d] = wm_latent[d % 5] * (1.f + (float)d * 0.001f);
-            if (NT_SUCCESS(WorldModel_InjectExperience(&g_world_model, wm_latent, WORLD_LATENT_DIM)) &&
-                (evolution_cycle % WORLD_COMPRESSION_BATCH == 0))
-                WorldModel_Compress(&g_world_model);
-        }
+    if (g_resource_governor.initialized) {
+        ResourceGovernor_ApplyThrottling(&g_resource_governor);
+        if (g_curriculum.initialized)
+            Curriculum_SetDegradationMode(&g_curriculum, ResourceGovernor_GetDegradationMode(&g_resource_governor));
+    }
+    if (!TrainingActive()) return;
 
-        if (g_long_term_memory.initialized &&
-            LongTermMemory_DetectDegradation(&g_long_term_memory, metrics.loss, metrics.fitness)) {
-            consecutive_degradation++;
-            if (consecutive_degradation >= 3) {
-                if (NT_SUCCESS(LongTermMemory_LoadNeuralCheckpoint(&g_long_term_memory, g_neural_context))) {
-                    if (g_telemetry.initialized) {
-                        Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "SelfHeal",
-                            "Rollback: neural checkpoint restored after degradation");
-                    }
-                }
-                consecutive_degradation = 0;
-            }
-        } else {
+    EnterRaijinTask();
+    TrainingMetrics metrics = {0};
+    TrainingPipeline_GetMetrics(g_training_pipeline, &metrics);
+    RuntimeConfig_Update(&g_runtime_config, metrics.loss, metrics.fitness, metrics.step_count);
+    DWORD mem_mb = CurrentMemoryMb();
+
+    if (g_resource_governor.initialized) {
+        ResourceGovernor_ReportConsumption(&g_resource_governor, SUBSYSTEM_TRAINING,
+            5.0, (uint64_t)mem_mb, (uint64_t)metrics.batch_time_ms);
+        ResourceGovernor_ReportConsumption(&g_resource_governor, SUBSYSTEM_EVOLUTION,
+            3.0, (uint64_t)(mem_mb / 2), 100);
+    }
+
+    if (g_world_model.initialized) {
+        float wm_latent[WORLD_LATENT_DIM];
+        uint32_t d;
+        wm_latent[0] = (float)metrics.loss;
+        wm_latent[1] = (float)metrics.fitness;
+        wm_latent[2] = (float)metrics.entropy;
+        wm_latent[3] = (float)(metrics.step_count % 1000000) / 1000000.f;
+        wm_latent[4] = (float)(metrics.generation % 1000000) / 1000000.f;
+        for (d = 5; d < WORLD_LATENT_DIM; d++)
+            wm_latent[d] = wm_latent[d % 5] * (1.f + (float)d * 0.001f);
+        if (NT_SUCCESS(WorldModel_InjectExperience(&g_world_model, wm_latent, WORLD_LATENT_DIM)) &&
+            (evolution_cycle % WORLD_COMPRESSION_BATCH == 0))
+            WorldModel_Compress(&g_world_model);
+    }
+
+    if (g_long_term_memory.initialized &&
+        LongTermMemory_DetectDegradation(&g_long_term_memory, metrics.loss, metrics.fitness)) {
+        consecutive_degradation++;
+        if (consecutive_degradation >= 3) {
+            TaskScheduler_Trigger(&g_task_scheduler, g_rollback_task, 0);
             consecutive_degradation = 0;
         }
+    } else {
+        consecutive_degradation = 0;
+    }
 
-        if (g_telemetry.initialized) {
-            PROCESS_MEMORY_COUNTERS pmc = {0};
-            pmc.cb = sizeof(pmc);
-            DWORD mem_mb = 0;
-            if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
-                mem_mb = (DWORD)(pmc.WorkingSetSize / (1024 * 1024));
-            Telemetry_RecordMetrics(&g_telemetry,
+    if (g_telemetry.initialized) {
+        Telemetry_RecordMetrics(&g_telemetry,
+            metrics.loss, metrics.fitness, metrics.entropy,
+            metrics.step_count, metrics.generation,
+            metrics.batch_time_ms, mem_mb);
+        if (g_dominance_metrics.initialized) {
+            DominanceMetrics_Update(&g_dominance_metrics,
                 metrics.loss, metrics.fitness, metrics.entropy,
                 metrics.step_count, metrics.generation,
-                metrics.batch_time_ms, mem_mb);
-            if (g_dominance_metrics.initialized) {
-                DominanceMetrics_Update(&g_dominance_metrics,
-                    metrics.loss, metrics.fitness, metrics.entropy,
-                    metrics.step_count, metrics.generation,
-                    metrics.batch_time_ms, (uint64_t)mem_mb);
-            }
-            if (g_anomaly_detector.initialized) {
-                AnomalyDetector_Record(&g_anomaly_detector,
-                    metrics.loss, metrics.fitness, metrics.entropy,
-                    metrics.batch_time_ms, (uint64_t)mem_mb);
-                AnomalyDetector_Update(&g_anomaly_detector);
-                if (AnomalyDetector_IsAnomalyDetected(&g_anomaly_detector) && g_telemetry.initialized) {
-                    AnomalyEvent ae;
-                    AnomalyDetector_GetLastAnomaly(&g_anomaly_detector, &ae);
-                    Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "AnomalyDetector", ae.description);
-                }
-            }
-            if (g_regression_detector.initialized) {
-                RegressionDetector_Update(&g_regression_detector);
-                if (RegressionDetector_IsDegenerationDetected(&g_regression_detector)) {
-                    if (g_telemetry.initialized) {
-                        RegressionEvent re;
-                        RegressionDetector_GetLastEvent(&g_regression_detector, &re);
-                        Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "RegressionDetector", re.description);
-                    }
-                    if (g_fitness_ledger.initialized)
-                        FitnessLedger_DemoteWorst(&g_fitness_ledger);
-                }
+                metrics.batch_time_ms, (uint64_t)mem_mb);
+        }
+        if (g_anomaly_detector.initialized) {
+            AnomalyDetector_Record(&g_anomaly_detector,
+                metrics.loss, metrics.fitness, metrics.entropy,
+                metrics.batch_time_ms, (uint64_t)mem_mb);
+            AnomalyDetector_Update(&g_anomaly_detector);
+            if (AnomalyDetector_IsAnomalyDetected(&g_anomaly_detector) && g_telemetry.initialized) {
+                AnomalyEvent ae;
+                AnomalyDetector_GetLastAnomaly(&g_anomaly_detector, &ae);
+                Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "AnomalyDetector", ae.description);
             }
-            if (g_fitness_ledger.initialized && evolution_cycle % 10 == 0) {
-                double robustness = 0.5;
-                if (g_adversarial_stress.initialized)
-                    AdversarialStress_GetRobustnessScore(&g_adversarial_stress, &robustness);
-                double test_pass_rate = (metrics.loss < 1.0) ? (1.0 - metrics.loss) : 0.0;
-                FitnessLedger_Update(&g_fitness_ledger, test_pass_rate, robustness,
-                    metrics.step_count, metrics.generation);
-                if (g_curriculum.initialized && !use_curriculum_task) {
-                    double delta = (double)metrics.fitness - prev_fitness_for_curriculum;
-                    Curriculum_UpdateFromPerformance(&g_curriculum, delta);
-                    prev_fitness_for_curriculum = (double)metrics.fitness;
+        }
+        if (g_regression_detector.initialized) {
+            RegressionDetector_Update(&g_regression_detector);
+            if (RegressionDetector_IsDegenerationDetected(&g_regression_detector)) {
+                if (g_telemetry.initialized) {
+                    RegressionEvent re;
+                    RegressionDetector_GetLastEvent(&g_regression_detector, &re);
+                    Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "RegressionDetector", re.description);
                 }
-                if (!RegressionDetector_IsDegenerationDetected(&g_regression_detector) && evolution_cycle % 20 == 0)
-                    FitnessLedger_PromoteBest(&g_fitness_ledger);
+                if (g_fitness_ledger.initialized)
+                    FitnessLedger_DemoteWorst(&g_fitness_ledger);
             }
-            if (g_self_healing.initialized) {
-                SelfHealing_Evaluate(&g_self_healing);
-            }
-            if (evolution_cycle % 10 == 0) {
-                Telemetry_LogFormat(&g_telemetry, TELEMETRY_INFO, "Main",
-                    "cycle=%u loss=%.4f fitness=%.4f gen=%llu",
-                    evolution_cycle, metrics.loss, metrics.fitness,
-                    (unsigned long long)metrics.generation);
+        }
+        if (g_fitness_ledger.initialized && evolution_cycle % 10 == 0) {
+            double robustness = 0.5;
+            if (g_adversarial_stress.initialized) robustness = g_adversarial_robustness;
+            double test_pass_rate = (metrics.loss < 1.0) ? (1.0 - metrics.loss) : 0.0;
+            FitnessLedger_Update(&g_fitness_ledger, test_pass_rate, robustness,
+                metrics.step_count, metrics.generation);
+            if (g_curriculum.initialized) {
+                double delta = (double)metrics.fitness - prev_fitness_for_curriculum;
+                Curriculum_UpdateFromPerformance(&g_curriculum, delta);
+                prev_fitness_for_curriculum = (double)metrics.fitness;
             }
+            if (!RegressionDetector_IsDegenerationDetected(&g_regression_detector) && evolution_cycle % 20 == 0)
+                FitnessLedger_PromoteBest(&g_fitness_ledger);
         }
-        if (evolution_cycle % g_runtime_config.save_interval == 0 && g_long_term_memory.initialized) {
-            LongTermMemory_Save(&g_long_term_memory,
-                g_neural_context, g_evolution_engine,
-                metrics.step_count, metrics.generation,
-                metrics.loss, metrics.fitness, metrics.entropy);
-            if (g_episodic_memory.initialized) {
-                float ep_emb[EPISODIC_ENTRY_DIM];
-                uint32_t ed;
-                ep_emb[0] = (float)metrics.loss;
-                ep_emb[1] = (float)metrics.fitness;
-                ep_emb[2] = (float)metrics.entropy;
-                ep_emb[3] = (float)(metrics.step_count % 1000000) / 1000000.f;
-                ep_emb[4] = (float)(metrics.generation % 1000000) / 1000000.f;
-                for (ed = 5; ed < EPISODIC_ENTRY_DIM; ed++)
-                    ep_emb[ed] = ep_emb[ed % 5] * (1.f + (float)ed * 0.001f);
-                EpisodicMemory_Store(&g_episodic_memory, ep_emb, EPISODIC_ENTRY_DIM, metrics.step_count);
+        if (g_self_healing.initialized) {
+            SelfHealing_Evaluate(&g_self_healing);
+        }
+        if (evolution_cycle % 10 == 0) {
+            Telemetry_LogFormat(&g_telemetry, TELEMETRY_INFO, "Main",
+                "cycle=%u loss=%.4f fitness=%.4f gen=%llu steps=%llu",
+                evolution_cycle, metrics.loss, metrics.fitness,
+                (unsigned long long)metrics.generation, (unsigned long long)metrics.step_count);
+            TrainingPrefetchStats pf;
+            if (NT_SUCCESS(TrainingPipeline_GetPrefetchStats(g_training_pipeline, &pf))) {
+                Telemetry_LogFormat(&g_telemetry, TELEMETRY_INFO, "Prefetch",
+                    "batches=%llu stalls=%llu wait_ms=%.2f max_wait_us=%llu produce_ms=%.2f",
+                    (unsigned long long)pf.consumed, (unsigned long long)pf.stalls,
+                    pf.wait_us / 1000.0, (unsigned long long)pf.max_wait_us, pf.produce_us / 1000.0);
             }
-            if (g_versioning_rollback.initialized) {
-                DominanceSnapshot snap;
-                DominanceMetrics_GetCurrent(&g_dominance_metrics, &snap);
-                VersioningRollback_CreateCheckpoint(&g_versioning_rollback,
-                    metrics.step_count, metrics.generation,
-                    metrics.loss, metrics.fitness, (float)snap.coherence);
+            if (g_training_corpus.initialized) {
+                TrainingCorpusStats cs;
+                TrainingCorpus_GetStats(&g_training_corpus, &cs);
+                Telemetry_LogFormat(&g_telemetry, TELEMETRY_INFO, "Corpus",
+                    "samples=%llu samples_per_sec=%.0f epochs=%llu",
+                    (unsigned long long)cs.samples, cs.samples_per_sec, (unsigned long long)cs.epochs);
             }
-            if (g_provenance.initialized) {
-                char config_json[1024];
-                snprintf(config_json, sizeof(config_json),
-                    "{\"cycle\":%u,\"step\":%llu,\"gen\":%llu,\"loss\":%.6f,\"fitness\":%.6f}",
-                    evolution_cycle, (unsigned long long)metrics.step_count,
-                    (unsigned long long)metrics.generation, metrics.loss, metrics.fitness);
-                Provenance_LogBuild(&g_provenance, "Bin/raijin.exe",
-                    config_json, (uint32_t)strlen(config_json), (uint32_t)evolution_cycle);
+            TrainingReplayStats rs;
+            if (NT_SUCCESS(TrainingPipeline_GetReplayStats(g_training_pipeline, &rs))) {
+                Telemetry_LogFormat(&g_telemetry, TELEMETRY_INFO, "Replay",
+                    "resident=%u pushed=%llu drawn=%llu dropped=%llu mean_weight=%.3f",
+                    rs.resident, (unsigned long long)rs.pushed, (unsigned long long)rs.drawn,
+                    (unsigned long long)rs.dropped, rs.mean_weight);
             }
-        }
-        if (g_episodic_memory.initialized && evolution_cycle % EPISODIC_CONSOLIDATION_THRESHOLD == 0) {
-            EpisodicMemory_Consolidate(&g_episodic_memory);
-        }
-        if (g_episodic_memory.initialized && evolution_cycle % 100 == 0) {
-            double util_fitness = (metrics.loss < 1.0) ? (1.0 - metrics.loss) : 0.0;
-            uint32_t ep_count = EpisodicMemory_GetEntryCount(&g_episodic_memory);
-            if (ep_count > 0) {
-                EpisodicMemory_UpdateUtility(&g_episodic_memory, ep_count - 1, (float)util_fitness);
+            TaskSchedulerTaskStats ts;
+            if (NT_SUCCESS(TaskScheduler_GetTaskStats(&g_task_scheduler, g_train_task, &ts))) {
+                Telemetry_LogFormat(&g_telemetry, TELEMETRY_INFO, "Scheduler",
+                    "train_runs=%llu train_mean_us=%.0f train_max_us=%llu overruns=%llu",
+                    (unsigned long long)ts.runs, ts.runs ? (double)ts.total_us / ts.runs : 0.0,
+                    (unsigned long long)ts.max_us, (unsigned long long)ts.overruns);
             }
-            EpisodicMemory_ForgetLowUtility(&g_episodic_memory, 0.2f);
+            TaskSchedulerStats ss;
+            TaskScheduler_GetStats(&g_task_scheduler, &ss);
+            Telemetry_LogFormat(&g_telemetry, TELEMETRY_INFO, "Scheduler",
+                "deferrals=%llu dispatch_overruns=%llu max_dispatch_us=%llu",
+                (unsigned long long)ss.deferrals, (unsigned long long)ss.dispatch_overruns,
+                (unsigned long long)ss.max_dispatch_us);
         }
-        if (evolution_cycle % 50 == 0 && g_introspection_system.initialized) {
-            IntrospectionSystem_Observe(&g_introspection_system);
-            IntrospectionSystem_Critique(&g_introspection_system, NULL, 0);
+    }
+    if (!g_headless && evolution_cycle % 10 == 0) {
+        printf("Evolution Cycle #%u - loss=%.4f fitness=%.4f gen=%llu\n",
+            evolution_cycle, metrics.loss, metrics.fitness,
+            (unsigned long long)metrics.generation);
+    }
+
+    SelfModifyAndImprove();
+    DominateProgramming();
+    ExitRaijinTask();
+
+    if (!g_headless && evolution_cycle % 60 == 0) {
+        printf("Evolution Cycle #%u - Major evolution milestone reached\n", evolution_cycle);
+        DisplaySystemStatus();
+    }
+}
+
+// Triggered by CycleTask after sustained degradation
+static void RollbackTask(void* context) {
+    (void)context;
+    if (!g_long_term_memory.initialized || !g_neural_context) return;
+    EnterRaijinTask();
+    if (NT_SUCCESS(LongTermMemory_LoadNeuralCheckpoint(&g_long_term_memory, g_neural_context))) {
+        if (g_telemetry.initialized) {
+            Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "SelfHeal",
+                "Rollback: neural checkpoint restored after degradation");
         }
-        {
-            uint32_t stress_iv = (g_runtime_config.stress_interval >= 1u) ? g_runtime_config.stress_interval : 30u;
-            if (!skip_heavy && evolution_cycle % stress_iv == 0 && g_stress_test_framework.initialized) {
-                StressTestFramework_RunStressTest(&g_stress_test_framework, (StressTestType)(evolution_cycle / stress_iv % 5));
-                if (g_dominance_metrics.initialized) {
-                    DominanceMetrics_RecordStressResult(&g_dominance_metrics, g_stress_test_framework.last_result.robustness_score);
-                }
-                if (g_telemetry.initialized && !g_stress_test_framework.last_result.passed) {
-                    Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "StressTest", g_stress_test_framework.last_result.description);
+    }
+    ExitRaijinTask();
+}
+
+static void SaveTask(void* context) {
+    (void)context;
+    static uint32_t save_count = 0;
+    RetuneTaskPeriod(g_save_task, g_runtime_config.save_interval);
+    if (!TrainingActive() || !g_long_term_memory.initialized) return;
+    save_count++;
+
+    EnterRaijinTask();
+    TrainingMetrics metrics = {0};
+    TrainingPipeline_GetMetrics(g_training_pipeline, &metrics);
+    LongTermMemory_Save(&g_long_term_memory,
+        g_neural_context, g_evolution_engine,
+        metrics.step_count, metrics.generation,
+        metrics.loss, metrics.fitness, metrics.entropy);
+    if (g_episodic_memory.initialized) {
+        float ep_emb[EPISODIC_ENTRY_DIM];
+        uint32_t ed;
+        ep_emb[0] = (float)metrics.loss;
+        ep_emb[1] = (float)metrics.fitness;
+        ep_emb[2] = (float)metrics.entropy;
+        ep_emb[3] = (float)(metrics.step_count % 1000000) / 1000000.f;
+        ep_emb[4] = (float)(metrics.generation % 1000000) / 1000000.f;
+        for (ed = 5; ed < EPISODIC_ENTRY_DIM; ed++)
+            ep_emb[ed] = ep_emb[ed % 5] * (1.f + (float)ed * 0.001f);
+        EpisodicMemory_Store(&g_episodic_memory, ep_emb, EPISODIC_ENTRY_DIM, metrics.step_count);
+    }
+    if (g_versioning_rollback.initialized) {
+        DominanceSnapshot snap;
+        DominanceMetrics_GetCurrent(&g_dominance_metrics, &snap);
+        VersioningRollback_CreateCheckpoint(&g_versioning_rollback,
+            metrics.step_count, metrics.generation,
+            metrics.loss, metrics.fitness, (float)snap.coherence);
+    }
+    if (g_provenance.initialized) {
+        char config_json[1024];
+        snprintf(config_json, sizeof(config_json),
+            "{\"save\":%u,\"step\":%llu,\"gen\":%llu,\"loss\":%.6f,\"fitness\":%.6f}",
+            save_count, (unsigned long long)metrics.step_count,
+            (unsigned long long)metrics.generation, metrics.loss, metrics.fitness);
+        Provenance_LogBuild(&g_provenance, "Bin/raijin.exe",
+            config_json, (uint32_t)strlen(config_json), save_count);
+    }
+    ExitRaijinTask();
+}
+
+static void ConsolidateTask(void* context) {
+    (void)context;
+    if (g_episodic_memory.initialized)
+        EpisodicMemory_Consolidate(&g_episodic_memory);
+}
+
+static void ForgetTask(void* context) {
+    (void)context;
+    if (!g_episodic_memory.initialized || !TrainingActive()) return;
+    double loss = g_training_pipeline->last_metrics.loss;
+    double util_fitness = (loss < 1.0) ? (1.0 - loss) : 0.0;
+    uint32_t ep_count = EpisodicMemory_GetEntryCount(&g_episodic_memory);
+    if (ep_count > 0) {
+        EpisodicMemory_UpdateUtility(&g_episodic_memory, ep_count - 1, (float)util_fitness);
+    }
+    EpisodicMemory_ForgetLowUtility(&g_episodic_memory, 0.2f);
+}
+
+static void IntrospectionTask(void* context) {
+    (void)context;
+    if (!g_introspection_system.initialized) return;
+    IntrospectionSystem_Observe(&g_introspection_system);
+    IntrospectionSystem_Critique(&g_introspection_system, NULL, 0);
+}
+
+// The evaluators run as pool jobs on a replica of the substrate (see RobustnessWorker), so
+// these tasks only queue a request; results come back through RobustnessTask
+static void RequestRobustness(RobustnessJobKind kind) {
+    if (NT_SUCCESS(RobustnessWorker_Request(&g_robustness_worker, kind)) &&
+        g_robustness_task != TASK_SCHEDULER_INVALID_TASK)
+        TaskScheduler_Trigger(&g_task_scheduler, g_robustness_task, 0);
+}
+
+static void StressTask(void* context) {
+    (void)context;
+    RetuneTaskPeriod(g_stress_task, g_runtime_config.stress_interval >= 1u ? g_runtime_config.stress_interval : 30u);
+    RequestRobustness(ROBUSTNESS_JOB_STRESS);
+}
+
+static void AdversarialTask(void* context) {
+    (void)context;
+    RequestRobustness(ROBUSTNESS_JOB_ADVERSARIAL);
+}
+
+static void RedTeamTask(void* context) {
+    (void)context;
+    RequestRobustness(ROBUSTNESS_JOB_RED_TEAM);
+}
+
+// Called on the pool thread that finished a robustness job
+static void OnRobustnessJobDone(void* context) {
+    (void)context;
+    TaskScheduler_Trigger(&g_task_scheduler, g_robustness_task, 0);
+}
+
+static void MergeRobustnessOutcome(const RobustnessOutcome* outcome) {
+    static uint32_t adversarial_run = 0;
+    if (!NT_SUCCESS(outcome->status)) {
+        if (g_telemetry.initialized) {
+            Telemetry_LogFormat(&g_telemetry, TELEMETRY_WARN, "Robustness", "%s job failed (0x%08lX)",
+                RobustnessWorker_KindName(outcome->kind), (unsigned long)outcome->status);
+        }
+        return;
+    }
+    if (g_regression_detector.initialized)
+        RegressionDetector_RecordRobustness(&g_regression_detector, (uint32_t)outcome->kind, outcome->robustness);
+
+    switch (outcome->kind) {
+        case ROBUSTNESS_JOB_STRESS:
+            if (g_dominance_metrics.initialized)
+                DominanceMetrics_RecordStressResult(&g_dominance_metrics, outcome->robustness);
+            if (g_telemetry.initialized && !outcome->passed)
+                Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "StressTest", outcome->description);
+            break;
+        case ROBUSTNESS_JOB_ADVERSARIAL:
+            g_adversarial_robustness = outcome->robustness;
+            if (g_dominance_metrics.initialized)
+                DominanceMetrics_RecordStressResult(&g_dominance_metrics, outcome->robustness);
+            if (g_telemetry.initialized && ++adversarial_run % 4 == 0)
+                Telemetry_Log(&g_telemetry, TELEMETRY_INFO, "AdversarialStress", outcome->description);
+            break;
+        case ROBUSTNESS_JOB_RED_TEAM:
+            if (g_telemetry.initialized && !outcome->passed)
+                Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "RedTeam", outcome->description);
+            break;
+        default:
+            break;
+    }
+}
+
+// Collects finished jobs and starts the next pending one; the weight copy for its replica is
+// the only part of a robustness run that lands on the main thread
+static void RobustnessTask(void* context) {
+    (void)context;
+    RobustnessOutcome outcome;
+    EnterRaijinTask();
+    while (RobustnessWorker_Poll(&g_robustness_worker, &outcome))
+        MergeRobustnessOutcome(&outcome);
+    ExitRaijinTask();
+}
+
+// Acts on a completed sweep: repairs, replay of past failures, reporting
+static void FinishSelfTestSweep() {
+    static uint32_t replay_fail_streak = 0;
+    if (!SelfTest_AllPassed(&g_self_test_report)) {
+        if (g_self_healing.initialized)
+            SelfHealing_SoftRepair(&g_self_healing);
+        if (g_regression_replay.initialized) {
+            for (uint32_t i = 0; i < g_self_test_report.count; i++) {
+                if (!g_self_test_report.results[i].passed) {
+                    RegressionReplay_AddFailure(&g_regression_replay,
+                        g_self_test_report.results[i].name,
+                        g_self_test_report.results[i].message);
                 }
             }
         }
-        if (!skip_heavy && evolution_cycle % 25 == 0 && g_adversarial_stress.initialized) {
-            AdversarialStress_RunCycle(&g_adversarial_stress);
-            if (g_dominance_metrics.initialized) {
-                double robustness_score = 0.0;
-                AdversarialStress_GetRobustnessScore(&g_adversarial_stress, &robustness_score);
-                DominanceMetrics_RecordStressResult(&g_dominance_metrics, robustness_score);
-            }
-            if (g_telemetry.initialized && evolution_cycle % 100 == 0) {
-                double robustness_score = 0.0;
-                AdversarialStress_GetRobustnessScore(&g_adversarial_stress, &robustness_score);
-                Telemetry_LogFormat(&g_telemetry, TELEMETRY_INFO, "AdversarialStress",
-                    "robustness=%.4f", robustness_score);
-            }
+        if (g_telemetry.initialized) {
+            Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "SelfTest", "One or more self-tests failed");
         }
-        if (!skip_heavy && evolution_cycle % 20 == 0 && g_red_team.initialized) {
-            RedTeam_RunCycle(&g_red_team);
-            RedTeamResult rt_result;
-            memset(&rt_result, 0, sizeof(rt_result));
-            RedTeam_GetLastResult(&g_red_team, &rt_result);
-            if (rt_result.induced_failure && g_telemetry.initialized) {
-                Telemetry_LogFormat(&g_telemetry, TELEMETRY_WARN, "RedTeam",
-                    "attack_type=%u verification_hint=%s", (unsigned)rt_result.attack_type, rt_result.verification_hint);
+        if (g_headless)
+            ReportEvent("self-test: %u of %u failed", g_self_test_report.failed, g_self_test_report.count);
+        else
+            SelfTest_PrintReport(&g_self_test_report);
+    }
+    if (g_regression_replay.initialized) {
+        uint32_t replay_count = RegressionReplay_GetCount(&g_regression_replay);
+        for (uint32_t r = 0; r < replay_count; r++) {
+            char test_name[REGRESSION_REPLAY_NAME_LEN];
+            char signature[REGRESSION_REPLAY_SIGNATURE_LEN];
+            if (NT_SUCCESS(RegressionReplay_GetEntry(&g_regression_replay, r, test_name, sizeof(test_name), signature, sizeof(signature)))) {
+                SelfTest_RunOne(&g_self_test_report, test_name);
             }
         }
-        if (evolution_cycle % g_runtime_config.self_test_interval == 0 && g_self_test_report.results) {
-            SelfTest_RunAll(&g_self_test_report);
-            if (!SelfTest_AllPassed(&g_self_test_report)) {
-                if (g_self_healing.initialized)
-                    SelfHealing_SoftRepair(&g_self_healing);
-                if (g_regression_replay.initialized) {
-                    for (uint32_t i = 0; i < g_self_test_report.count; i++) {
-                        if (!g_self_test_report.results[i].passed) {
-                            RegressionReplay_AddFailure(&g_regression_replay,
-                                g_self_test_report.results[i].name,
-                                g_self_test_report.results[i].message);
-                        }
-                    }
-                }
-                if (g_telemetry.initialized) {
-                    Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "SelfTest", "One or more self-tests failed");
-                }
-                SelfTest_PrintReport(&g_self_test_report);
+        if (!SelfTest_AllPassed(&g_self_test_report) && g_self_test_report.failed > 0) {
+            replay_fail_streak++;
+            if (g_telemetry.initialized) {
+                Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "RegressionReplay", "Replay test(s) failed");
             }
-            if (g_regression_replay.initialized) {
-                uint32_t replay_count = RegressionReplay_GetCount(&g_regression_replay);
-                for (uint32_t r = 0; r < replay_count; r++) {
-                    char test_name[REGRESSION_REPLAY_NAME_LEN];
-                    char signature[REGRESSION_REPLAY_SIGNATURE_LEN];
-                    if (NT_SUCCESS(RegressionReplay_GetEntry(&g_regression_replay, r, test_name, sizeof(test_name), signature, sizeof(signature)))) {
-                        SelfTest_RunOne(&g_self_test_report, test_name);
-                    }
-                }
-                if (!SelfTest_AllPassed(&g_self_test_report) && g_self_test_report.failed > 0) {
-                    replay_fail_streak++;
-                    if (g_telemetry.initialized) {
-                        Telemetry_Log(&g_telemetry, TELEMETRY_WARN, "RegressionReplay", "Replay test(s) failed");
-                    }
-                    if (replay_fail_streak >= 2 && g_self_healing.initialized) {
-                        SelfHealing_HardRepair(&g_self_healing);
-                        replay_fail_streak = 0;
-                    }
-                } else {
-                    replay_fail_streak = 0;
-                }
+            if (replay_fail_streak >= 2 && g_self_healing.initialized) {
+                SelfHealing_HardRepair(&g_self_healing);
+                replay_fail_streak = 0;
             }
-        }
-        if (evolution_cycle % 10 == 0) {
-            printf("Evolution Cycle #%u - loss=%.4f fitness=%.4f gen=%llu\n",
-                evolution_cycle, metrics.loss, metrics.fitness,
-                (unsigned long long)metrics.generation);
+        } else {
+            replay_fail_streak = 0;
         }
     }
+}
 
-    SelfModifyAndImprove();
+// A sweep runs in slices that fit the dispatch deadline, each picking up where the last stopped
+static void SelfTestSliceTask(void* context) {
+    (void)context;
+    if (!g_self_test_report.results) {
+        g_self_test_sweeping = FALSE;
+        return;
+    }
+    uint64_t budget_us = TaskScheduler_TimeLeft(&g_task_scheduler);
+    if (budget_us > SELF_TEST_SLICE_BUDGET_US) budget_us = SELF_TEST_SLICE_BUDGET_US;
+    bool complete = false;
+    SelfTest_RunSlice(&g_self_test_report, &g_self_test_sweep, budget_us, &complete);
+    if (!complete) {
+        TaskScheduler_Trigger(&g_task_scheduler, g_self_test_slice_task, 0);
+        return;
+    }
+    g_self_test_sweeping = FALSE;
+    FinishSelfTestSweep();
+}
+
+// Self-tests enter the raijin role per test themselves, so these tasks stay in the caller's role
+static void SelfTestTask(void* context) {
+    (void)context;
+    RetuneTaskPeriod(g_self_test_task, g_runtime_config.self_test_interval);
+    if (!g_self_test_report.results || g_self_test_sweeping) return;
+    g_self_test_sweeping = TRUE;
+    TaskScheduler_Trigger(&g_task_scheduler, g_self_test_slice_task, 0);
+}
+
+static void KnowledgeTask(void* context) {
+    (void)context;
+    EnterRaijinTask();
     AcquireKnowledge();
-    DominateProgramming();
+    ExitRaijinTask();
+}
 
-    if (g_training_pipeline && g_neural_context) {
-        RoleBoundary_Exit(&g_role_boundary, "raijin");
-        if (RoleBoundary_GetViolationCount(&g_role_boundary) > 0) {
-            if (g_telemetry.initialized)
-                Telemetry_Log(&g_telemetry, TELEMETRY_ERROR, "RoleBoundary",
-                    "Boundary violation count > 0; stopping evolution");
-            g_evolution_active = FALSE;
+// Queued autonomy tasks run on the thread pool; this only feeds the queue
+static void AutonomyTask(void* context) {
+    (void)context;
+    if (g_autonomous_manager) AutonomousManager_Monitor(g_autonomous_manager);
+}
+
+// Headless only: what the console status screen showed, published without blocking
+static void StatusTask(void* context) {
+    (void)context;
+    static uint64_t prev_cycles = 0;
+    static uint64_t prev_steps = 0;
+    static uint64_t prev_us = 0;
+    static ULONGLONG start_ms = 0;
+    if (!g_status_channel.initialized) return;
+    if (start_ms == 0) start_ms = GetTickCount64();
+
+    StatusSnapshot snap;
+    memset(&snap, 0, sizeof(snap));
+    snap.state = g_evolution_active ? STATUS_STATE_RUNNING : STATUS_STATE_STOPPING;
+    snap.uptime_ms = GetTickCount64() - start_ms;
+    snap.cycles = g_cycles_completed;
+    if (TrainingActive()) {
+        TrainingMetrics metrics = {0};
+        TrainingPipeline_GetMetrics(g_training_pipeline, &metrics);
+        snap.steps = metrics.step_count;
+        snap.generation = metrics.generation;
+        snap.loss = metrics.loss;
+        snap.fitness = metrics.fitness;
+        snap.entropy = metrics.entropy;
+    }
+    uint64_t now = TaskScheduler_Now(&g_task_scheduler);
+    if (prev_us > 0 && now > prev_us) {
+        double elapsed_s = (double)(now - prev_us) / TASK_SCHEDULER_SECOND;
+        snap.cycles_per_sec = (double)(snap.cycles - prev_cycles) / elapsed_s;
+        snap.steps_per_sec = snap.steps >= prev_steps ? (double)(snap.steps - prev_steps) / elapsed_s : 0.0;
+    } else {
+        snap.cycles_per_sec = g_last_status.cycles_per_sec;
+        snap.steps_per_sec = g_last_status.steps_per_sec;
+    }
+    prev_us = now;
+    prev_cycles = snap.cycles;
+    prev_steps = snap.steps;
+
+    snap.throttle = 1.0;
+    if (g_resource_governor.initialized) {
+        snap.throttle = ResourceGovernor_GetThrottleFactor(&g_resource_governor);
+        snap.degradation_mode = ResourceGovernor_GetDegradationMode(&g_resource_governor);
+    }
+    snap.memory_mb = CurrentMemoryMb();
+    TaskSchedulerStats ss;
+    TaskScheduler_GetStats(&g_task_scheduler, &ss);
+    snap.scheduler_dispatches = ss.dispatches;
+    for (uint32_t t = 0; t < g_task_scheduler.task_count; t++) {
+        TaskSchedulerTaskStats ts;
+        if (NT_SUCCESS(TaskScheduler_GetTaskStats(&g_task_scheduler, t, &ts))) snap.task_overruns += ts.overruns;
+    }
+    ThreadPoolStats ps;
+    ThreadPool_GetStats(ThreadPool_GetGlobal(), &ps);
+    snap.pool_workers = ps.workers;
+    snap.pool_executed = ps.executed;
+    memcpy(snap.message, g_status_message, sizeof(snap.message));
+
+    g_last_status = snap;
+    StatusChannel_Publish(&g_status_channel, &snap);
+}
+
+// The last word on the channel once the loop has ended; rates and metrics are the final ones
+static void PublishFinalStatus(uint32_t state) {
+    if (!g_status_channel.initialized) return;
+    g_last_status.state = state;
+    g_last_status.cycles = g_cycles_completed;
+    g_last_status.cycles_per_sec = 0.0;
+    g_last_status.steps_per_sec = 0.0;
+    StatusChannel_Publish(&g_status_channel, &g_last_status);
+}
+
+// Typical run time of each main-loop task, for the dispatch deadline until its own runs are
+// measured; the budgets given at registration are the hard limits
+static const struct {
+    const char* task;
+    uint64_t expected_us;
+} s_task_expected_costs[] = {
+    { "input", 200 },
+    { "status", 200 },
+    { "governor", 500 },
+    { "cycle", 20 * TASK_SCHEDULER_MS },
+    { "save", 150 * TASK_SCHEDULER_MS },
+    { "consolidate", 2 * TASK_SCHEDULER_MS },
+    { "forget", 2 * TASK_SCHEDULER_MS },
+    { "introspection", 50 * TASK_SCHEDULER_MS },
+    { "robustness", 5 * TASK_SCHEDULER_MS },
+    { "self_test_slice", 100 * TASK_SCHEDULER_MS },
+    { "knowledge", 100 * TASK_SCHEDULER_MS },
+    { "autonomy", 10 * TASK_SCHEDULER_MS },
+    { "train", 20 * TASK_SCHEDULER_MS },
+};
+
+static void ApplyExpectedCosts(TaskScheduler* scheduler) {
+    for (uint32_t i = 0; i < sizeof(s_task_expected_costs) / sizeof(s_task_expected_costs[0]); i++) {
+        uint32_t id = TaskScheduler_FindTask(scheduler, s_task_expected_costs[i].task);
+        if (id != TASK_SCHEDULER_INVALID_TASK)
+            TaskScheduler_SetExpectedCost(scheduler, id, s_task_expected_costs[i].expected_us);
+    }
+}
+
+// Over-budget tasks and dispatches go to telemetry, at most once per OVERRUN_LOG_PERIOD_US each
+static void OnTaskOverrun(void* context, uint32_t id, uint64_t elapsed_us, uint64_t budget_us) {
+    static uint64_t last_report_us[TASK_SCHEDULER_MAX_TASKS + 1];
+    static uint64_t unreported[TASK_SCHEDULER_MAX_TASKS + 1];
+    TaskScheduler* scheduler = (TaskScheduler*)context;
+    uint32_t slot = id < TASK_SCHEDULER_MAX_TASKS ? id : TASK_SCHEDULER_MAX_TASKS;
+    uint64_t now = TaskScheduler_Now(scheduler);
+    if (last_report_us[slot] && now - last_report_us[slot] < OVERRUN_LOG_PERIOD_US) {
+        unreported[slot]++;
+        return;
+    }
+    last_report_us[slot] = now;
+    if (g_telemetry.initialized) {
+        Telemetry_LogFormat(&g_telemetry, TELEMETRY_WARN, "Scheduler",
+            "%s overran: %llu us against a budget of %llu us (%llu more since last report)",
+            id < TASK_SCHEDULER_MAX_TASKS ? scheduler->tasks[id].name : "dispatch",
+            (unsigned long long)elapsed_us, (unsigned long long)budget_us, (unsigned long long)unreported[slot]);
+    }
+    unreported[slot] = 0;
+}
+
+// --rate / --rate-config: a limit caps how often a task runs, so its period becomes the longer
+// of its own and 1/hz; 0 Hz leaves the task as it is
+static void ApplyRateLimits(TaskScheduler* scheduler) {
+    for (uint32_t i = 0; i < g_rate_limits.count; i++) {
+        const RuntimeRateLimit* limit = &g_rate_limits.limits[i];
+        uint32_t id = TaskScheduler_FindTask(scheduler, limit->task);
+        if (id == TASK_SCHEDULER_INVALID_TASK || scheduler->tasks[id].kind != SCHEDULED_PERIODIC) {
+            printf("Rate limit for '%s' ignored: no periodic task by that name\n", limit->task);
+            continue;
+        }
+        if (limit->hz <= 0.0) continue;
+        uint64_t floor_us = (uint64_t)((double)TASK_SCHEDULER_SECOND / limit->hz);
+        uint64_t period_us = scheduler->tasks[id].period_us;
+        if (period_us < floor_us) period_us = floor_us;
+        TaskScheduler_SetPeriod(scheduler, id, period_us);
+        g_rate_floor_us[id] = floor_us;
+        if (g_telemetry.initialized) {
+            Telemetry_LogFormat(&g_telemetry, TELEMETRY_INFO, "Main", "rate limit %s=%.3f Hz (period %llu us)",
+                limit->task, limit->hz, (unsigned long long)period_us);
         }
     }
+}
 
-    if (evolution_cycle % 60 == 0) {
-        printf("Evolution Cycle #%u - Major evolution milestone reached\n", evolution_cycle);
-        DisplaySystemStatus();
+static NTSTATUS RegisterMainLoopTasks(TaskScheduler* scheduler) {
+    const uint64_t s = TASK_SCHEDULER_SECOND;
+    uint32_t id;
+    uint32_t stress_s = g_runtime_config.stress_interval >= 1u ? g_runtime_config.stress_interval : 30u;
+    // Headless: no keyboard; training and evolution already fill every gap between due tasks
+    NTSTATUS status = STATUS_SUCCESS;
+    if (!g_headless) {
+        status = TaskScheduler_AddPeriodic(scheduler, "input", InputTask, NULL,
+            INPUT_POLL_PERIOD_US, 0, SCHEDULED_PRIORITY_CRITICAL, 5 * TASK_SCHEDULER_MS, &id);
+    } else {
+        status = TaskScheduler_AddPeriodic(scheduler, "status", StatusTask, NULL,
+            HEADLESS_STATUS_PERIOD_US, 0, SCHEDULED_PRIORITY_CRITICAL, 5 * TASK_SCHEDULER_MS, &id);
+    }
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddTriggered(scheduler, "rollback", RollbackTask, NULL,
+        SCHEDULED_PRIORITY_CRITICAL, s, &g_rollback_task);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "governor", GovernorSampleTask, NULL,
+        GOVERNOR_SAMPLE_PERIOD_US, 0, SCHEDULED_PRIORITY_HIGH, 5 * TASK_SCHEDULER_MS, &id);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "cycle", CycleTask, NULL,
+        s, s, SCHEDULED_PRIORITY_HIGH, 200 * TASK_SCHEDULER_MS, &id);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "save", SaveTask, NULL,
+        g_runtime_config.save_interval * s, g_runtime_config.save_interval * s, SCHEDULED_PRIORITY_NORMAL, s, &g_save_task);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "consolidate", ConsolidateTask, NULL,
+        EPISODIC_CONSOLIDATION_THRESHOLD * s, EPISODIC_CONSOLIDATION_THRESHOLD * s, SCHEDULED_PRIORITY_NORMAL,
+        100 * TASK_SCHEDULER_MS, &id);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "forget", ForgetTask, NULL,
+        100 * s, 100 * s, SCHEDULED_PRIORITY_NORMAL, 100 * TASK_SCHEDULER_MS, &id);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "introspection", IntrospectionTask, NULL,
+        50 * s, 50 * s, SCHEDULED_PRIORITY_LOW, 200 * TASK_SCHEDULER_MS, &id);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddTriggered(scheduler, "robustness", RobustnessTask, NULL,
+        SCHEDULED_PRIORITY_NORMAL, 50 * TASK_SCHEDULER_MS, &g_robustness_task);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "stress", StressTask, NULL,
+        stress_s * s, stress_s * s, SCHEDULED_PRIORITY_LOW, TASK_SCHEDULER_MS, &g_stress_task);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "adversarial", AdversarialTask, NULL,
+        25 * s, 25 * s, SCHEDULED_PRIORITY_LOW, TASK_SCHEDULER_MS, &id);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "red_team", RedTeamTask, NULL,
+        20 * s, 20 * s, SCHEDULED_PRIORITY_LOW, TASK_SCHEDULER_MS, &id);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "self_test", SelfTestTask, NULL,
+        g_runtime_config.self_test_interval * s, g_runtime_config.self_test_interval * s, SCHEDULED_PRIORITY_LOW,
+        TASK_SCHEDULER_MS, &g_self_test_task);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddTriggered(scheduler, "self_test_slice", SelfTestSliceTask, NULL,
+        SCHEDULED_PRIORITY_LOW, SELF_TEST_SLICE_BUDGET_US, &g_self_test_slice_task);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "knowledge", KnowledgeTask, NULL,
+        s, s, SCHEDULED_PRIORITY_LOW, 500 * TASK_SCHEDULER_MS, &id);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "autonomy", AutonomyTask, NULL,
+        5 * s, 5 * s, SCHEDULED_PRIORITY_LOW, 50 * TASK_SCHEDULER_MS, &id);
+    if (NT_SUCCESS(status)) status = TaskScheduler_AddPeriodic(scheduler, "train", TrainTask, NULL,
+        0, 0, SCHEDULED_PRIORITY_BACKGROUND, 250 * TASK_SCHEDULER_MS, &g_train_task);
+    if (NT_SUCCESS(status)) {
+        ApplyExpectedCosts(scheduler);
+        ApplyRateLimits(scheduler);
+        TaskScheduler_SetDispatchBudget(scheduler, MAIN_LOOP_DISPATCH_BUDGET_US);
+        TaskScheduler_SetOverrunHandler(scheduler, OnTaskOverrun, scheduler);
+    }
+    return status;
+}
+
+static void RunEvolutionLoop() {
+    NTSTATUS status = TaskScheduler_Initialize(&g_task_scheduler);
+    if (NT_SUCCESS(status)) status = RegisterMainLoopTasks(&g_task_scheduler);
+    if (!NT_SUCCESS(status)) {
+        printf("Task scheduler init failed (0x%08lX)\n", (unsigned long)status);
+        TaskScheduler_Shutdown(&g_task_scheduler);
+        return;
+    }
+
+    RobustnessWorker_SetNotify(&g_robustness_worker, OnRobustnessJobDone, NULL);
+    if (!g_headless) printf("Evolution loop started. Press 'S' for status, 'Q' to quit.\n\n");
+
+    while (g_evolution_active) {
+        if (TaskScheduler_RunOnce(&g_task_scheduler, MAIN_LOOP_MAX_WAIT_US) == STATUS_CANCELLED) break;
     }
+
+    // A job finishing after this point must not trigger into a scheduler that is gone
+    RobustnessWorker_SetNotify(&g_robustness_worker, NULL, NULL);
+    g_robustness_task = TASK_SCHEDULER_INVALID_TASK;
+    TaskScheduler_Shutdown(&g_task_scheduler);
 }
 
 static void SelfModifyAndImprove() {
@@ -1108,7 +2470,7 @@ static void SelfModifyAndImprove() {
             self_modification_count++;
             TrainingMetrics metrics;
             TrainingPipeline_GetMetrics(g_training_pipeline, &metrics);
-            if (self_modification_count % 5 == 0) {
+            if (!g_headless && self_modification_count % 5 == 0) {
                 printf("  → Self-modification #%d: loss=%.4f entropy=%.3f gen=%llu\n",
                     self_modification_count, metrics.loss, metrics.entropy,
                     (unsigned long long)metrics.generation);
@@ -1127,7 +2489,7 @@ static const char* KNOWLEDGE_URLS[] = {
 static const size_t KNOWLEDGE_URL_COUNT = sizeof(KNOWLEDGE_URLS) / sizeof(KNOWLEDGE_URLS[0]);
 
 static void AcquireKnowledge() {
-    if (!g_internet_context || !g_neural_context) return;
+    if (!g_neural_context || !EnsureSubsystem(g_internet_node) || !g_internet_context) return;
 
     static size_t url_index = 0;
     const char* url = KNOWLEDGE_URLS[url_index % KNOWLEDGE_URL_COUNT];
@@ -1160,7 +2522,7 @@ static const char* SAMPLE_CODE_SNIPPETS[] = {
 static const size_t SAMPLE_CODE_COUNT = sizeof(SAMPLE_CODE_SNIPPETS) / sizeof(SAMPLE_CODE_SNIPPETS[0]);
 
 static void DominateProgramming() {
-    if (!g_pd_context) return;
+    if (!EnsureSubsystem(g_pd_node) || !g_pd_context) return;
 
     static int domination_count = 0;
     size_t idx = domination_count % SAMPLE_CODE_COUNT;
@@ -1171,7 +2533,7 @@ static void DominateProgramming() {
     NTSTATUS status = ProgrammingDomination_AnalyzeCode(g_pd_context, code, lang, &analysis);
     if (NT_SUCCESS(status) && analysis) {
         domination_count++;
-        if (domination_count % 10 == 0) {
+        if (!g_headless && domination_count % 10 == 0) {
             printf("  → Programming Domination #%d: analyzed %s (readability=%.1f)\n",
                 domination_count, code, analysis->readability_score);
         }
@@ -1190,21 +2552,39 @@ static void DominateProgramming() {
     }
 }
 
-// Signal handler for clean shutdown
-BOOL WINAPI ConsoleCtrlHandler(DWORD ctrlType) {
+// Runs on a thread the system creates for the event, possibly while main holds the CRT or
+// scheduler locks, so it takes none: clearing the flag ends the loop within MAIN_LOOP_MAX_WAIT_US
+// and main shuts the system down after it. Service wrappers and job runners stop a console
+// process with Ctrl+Break or a close. For close, logoff and shutdown the process ends as soon as
+// this returns, so it waits for main to finish the clean shutdown first
+static BOOL WINAPI ConsoleCtrlHandler(DWORD ctrlType) {
     switch (ctrlType) {
         case CTRL_C_EVENT:
         case CTRL_BREAK_EVENT:
+            g_evolution_active = FALSE;
+            return TRUE;
         case CTRL_CLOSE_EVENT:
-            printf("\n\nShutdown signal received. Initiating clean shutdown...\n");
+        case CTRL_LOGOFF_EVENT:
+        case CTRL_SHUTDOWN_EVENT:
             g_evolution_active = FALSE;
-            ShutdownRaijinSystem();
+            if (g_shutdown_done) WaitForSingleObject(g_shutdown_done, CONSOLE_CLOSE_WAIT_MS);
             return TRUE;
         default:
             return FALSE;
     }
 }
 
+// After shutdown: lets a waiting close handler return, then unregisters and closes the event. A
+// handler still on its way to the wait finds the event set or the handle closed; either way it
+// returns at once
+static void ReleaseConsoleCtrlHandler() {
+    if (!g_shutdown_done) return;
+    SetEvent(g_shutdown_done);
+    SetConsoleCtrlHandler(ConsoleCtrlHandler, FALSE);
+    CloseHandle(g_shutdown_done);
+    g_shutdown_done = NULL;
+}
+
 #pragma comment(lib, "kernel32.lib")
 #pragma comment(lib, "user32.lib")
 #pragma comment(lib, "advapi32.lib")
\ No newline at end of file
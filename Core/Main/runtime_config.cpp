@@ -1,4 +1,7 @@
 #include "../../Include/runtime_config.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
@@ -105,3 +108,54 @@ void RuntimeConfig_Update(RuntimeConfig* cfg, double loss, double fitness, uint6
     cfg->stress_interval = (uint32_t)clamp_double((double)cfg->stress_interval,
         RUNTIME_CONFIG_MIN_STRESS_INTERVAL, RUNTIME_CONFIG_MAX_STRESS_INTERVAL);
 }
+
+NTSTATUS RuntimeConfig_ParseRateLimit(RuntimeRateLimits* limits, const char* spec) {
+    if (!limits || !spec) return STATUS_INVALID_PARAMETER;
+    const char* eq = strchr(spec, '=');
+    if (!eq) return STATUS_INVALID_PARAMETER;
+
+    const char* name_begin = spec;
+    const char* name_end = eq;
+    while (name_begin < name_end && isspace((unsigned char)*name_begin)) name_begin++;
+    while (name_end > name_begin && isspace((unsigned char)name_end[-1])) name_end--;
+    size_t name_len = (size_t)(name_end - name_begin);
+    if (name_len == 0 || name_len >= RUNTIME_CONFIG_RATE_NAME_MAX) return STATUS_INVALID_PARAMETER;
+
+    char* value_end = NULL;
+    double hz = strtod(eq + 1, &value_end);
+    while (value_end && isspace((unsigned char)*value_end)) value_end++;
+    if (!value_end || value_end == eq + 1 || *value_end != '\0' || !(hz >= 0.0)) return STATUS_INVALID_PARAMETER;
+
+    uint32_t slot = limits->count;
+    for (uint32_t i = 0; i < limits->count; i++) {
+        if (strlen(limits->limits[i].task) == name_len && strncmp(limits->limits[i].task, name_begin, name_len) == 0) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot >= RUNTIME_CONFIG_MAX_RATE_LIMITS) return STATUS_INSUFFICIENT_RESOURCES;
+    RuntimeRateLimit* limit = &limits->limits[slot];
+    memset(limit->task, 0, sizeof(limit->task));
+    memcpy(limit->task, name_begin, name_len);
+    limit->hz = hz;
+    if (slot == limits->count) limits->count++;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS RuntimeConfig_LoadRateLimits(RuntimeRateLimits* limits, const char* path) {
+    if (!limits || !path) return STATUS_INVALID_PARAMETER;
+    FILE* f = fopen(path, "r");
+    if (!f) return STATUS_NOT_FOUND;
+    char line[256];
+    NTSTATUS status = STATUS_SUCCESS;
+    while (NT_SUCCESS(status) && fgets(line, sizeof(line), f)) {
+        size_t len = strlen(line);
+        while (len > 0 && isspace((unsigned char)line[len - 1])) line[--len] = '\0';
+        const char* p = line;
+        while (isspace((unsigned char)*p)) p++;
+        if (*p == '\0' || *p == '#') continue;
+        status = RuntimeConfig_ParseRateLimit(limits, p);
+    }
+    fclose(f);
+    return status;
+}
@@ -50,6 +50,45 @@ NTSTATUS RegressionDetector_Shutdown(RegressionDetector* rd) {
     return STATUS_SUCCESS;
 }
 
+NTSTATUS RegressionDetector_RecordRobustness(RegressionDetector* rd, uint32_t source, double robustness) {
+    if (!rd || !rd->initialized || source >= REGRESSION_ROBUSTNESS_SOURCES) return STATUS_INVALID_PARAMETER;
+    if (robustness < 0.0) robustness = 0.0;
+    if (robustness > 1.0) robustness = 1.0;
+    double* history = rd->robustness_history[source];
+    uint32_t* count = &rd->robustness_count[source];
+    if (*count < REGRESSION_ROBUSTNESS_HISTORY) {
+        history[(*count)++] = robustness;
+    } else {
+        memmove(history, history + 1, (REGRESSION_ROBUSTNESS_HISTORY - 1) * sizeof(double));
+        history[REGRESSION_ROBUSTNESS_HISTORY - 1] = robustness;
+    }
+    rd->robustness_fresh = true;
+    return STATUS_SUCCESS;
+}
+
+// Largest baseline-half minus recent-half drop over the robustness sources with enough results
+static double RegressionDetector_WorstRobustnessDrop(const RegressionDetector* rd, uint32_t* source,
+    double* baseline, double* recent) {
+    double worst = 0.0;
+    for (uint32_t s = 0; s < REGRESSION_ROBUSTNESS_SOURCES; s++) {
+        uint32_t n = rd->robustness_count[s];
+        if (n < REGRESSION_ROBUSTNESS_WINDOW_MIN) continue;
+        uint32_t half = n / 2;
+        double b = 0.0, r = 0.0;
+        for (uint32_t i = 0; i < half; i++) b += rd->robustness_history[s][i];
+        for (uint32_t i = n - half; i < n; i++) r += rd->robustness_history[s][i];
+        b /= half;
+        r /= half;
+        if (b - r > worst) {
+            worst = b - r;
+            *source = s;
+            *baseline = b;
+            *recent = r;
+        }
+    }
+    return worst;
+}
+
 NTSTATUS RegressionDetector_Update(RegressionDetector* rd) {
     if (!rd || !rd->initialized || !rd->dominance_metrics) return STATUS_INVALID_PARAMETER;
 
@@ -100,6 +139,12 @@ NTSTATUS RegressionDetector_Update(RegressionDetector* rd) {
     double fitness_drop = baseline_fitness - recent_fitness;
     double loss_rise = recent_loss - baseline_loss;
     double dom_drop = baseline_dom - recent_dom;
+    uint32_t robustness_source = 0;
+    double baseline_robustness = 0.0, recent_robustness = 0.0;
+    double robustness_drop = RegressionDetector_WorstRobustnessDrop(rd, &robustness_source,
+        &baseline_robustness, &recent_robustness);
+    bool robustness_fresh = rd->robustness_fresh;
+    rd->robustness_fresh = false;
 
     if (fitness_drop > REGRESSION_DEGENERATION_THRESHOLD) {
         rd->regression_detected = true;
@@ -134,6 +179,19 @@ NTSTATUS RegressionDetector_Update(RegressionDetector* rd) {
         snprintf(rd->last_event.description, sizeof(rd->last_event.description),
             "Dominance regression: baseline=%.4f recent=%.4f drop=%.4f", baseline_dom, recent_dom, dom_drop);
         rd->consecutive_regressions++;
+    } else if (robustness_drop > REGRESSION_DEGENERATION_THRESHOLD) {
+        rd->regression_detected = true;
+        rd->last_event.type = REGRESSION_ROBUSTNESS_DROP;
+        rd->last_event.severity = fmin(1.0, robustness_drop / 0.5);
+        rd->last_event.baseline_value = baseline_robustness;
+        rd->last_event.current_value = recent_robustness;
+        rd->last_event.step_count = cur.step_count;
+        rd->last_event.timestamp_ms = GetTimeMs();
+        snprintf(rd->last_event.description, sizeof(rd->last_event.description),
+            "Robustness regression (source %u): baseline=%.4f recent=%.4f drop=%.4f",
+            robustness_source, baseline_robustness, recent_robustness, robustness_drop);
+        // The series only moves when a result arrives; don't count the same evidence every cycle
+        if (robustness_fresh) rd->consecutive_regressions++;
     } else {
         rd->consecutive_regressions = 0;
     }
@@ -171,5 +229,8 @@ NTSTATUS RegressionDetector_Reset(RegressionDetector* rd) {
     rd->consecutive_regressions = 0;
     rd->last_event.type = REGRESSION_NONE;
     rd->last_event.severity = 0.0;
+    // Reset follows a rollback; robustness results for the weights rolled away from no longer apply
+    memset(rd->robustness_count, 0, sizeof(rd->robustness_count));
+    rd->robustness_fresh = false;
     return STATUS_SUCCESS;
 }
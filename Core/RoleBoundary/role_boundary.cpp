@@ -2,6 +2,7 @@
 #include <string.h>
 
 static RoleBoundaryContext* g_ctx = NULL;
+static thread_local RoleBoundaryContext* t_ctx = NULL;
 
 NTSTATUS RoleBoundary_Initialize(RoleBoundaryContext* ctx) {
     if (!ctx) return STATUS_INVALID_PARAMETER;
@@ -91,5 +92,13 @@ void RoleBoundary_Reset(RoleBoundaryContext* ctx) {
 }
 
 RoleBoundaryContext* RoleBoundary_GetGlobal(void) {
-    return g_ctx;
+    return t_ctx ? t_ctx : g_ctx;
+}
+
+void RoleBoundary_BindThread(RoleBoundaryContext* ctx) {
+    t_ctx = ctx;
+}
+
+RoleBoundaryContext* RoleBoundary_GetBoundThread(void) {
+    return t_ctx;
 }
@@ -0,0 +1,35 @@
+/*
+ * QPC Clock - Raijin
+ * Owner: Core/Scheduler
+ * Inputs: QueryPerformanceCounter / QueryPerformanceFrequency
+ * Outputs: Monotonic microseconds; tick counts and differences converted to microseconds
+ * Invariants: The conversion never forms ticks * 1e6, so it cannot overflow before the tick count does
+ * Budget: One QueryPerformanceCounter per NowUs; the frequency is read once
+ * Failure modes: Zero frequency -> 0
+ * Recovery: None needed; stateless apart from the cached frequency
+ */
+
+#include "../../Include/qpc_clock.h"
+#include <windows.h>
+
+#define QPC_CLOCK_SECOND 1000000ull
+
+uint64_t QpcClock_TicksToUs(uint64_t ticks, uint64_t frequency) {
+    if (frequency == 0) return 0;
+    return (ticks / frequency) * QPC_CLOCK_SECOND + (ticks % frequency) * QPC_CLOCK_SECOND / frequency;
+}
+
+uint64_t QpcClock_NowUs(void) {
+    // Fixed at boot, so racing first callers store the same value
+    static volatile LONG64 frequency = 0;
+    LONG64 freq = InterlockedCompareExchange64(&frequency, 0, 0);
+    if (freq == 0) {
+        LARGE_INTEGER f;
+        QueryPerformanceFrequency(&f);
+        freq = f.QuadPart;
+        InterlockedExchange64(&frequency, freq);
+    }
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return QpcClock_TicksToUs((uint64_t)now.QuadPart, (uint64_t)freq);
+}
@@ -0,0 +1,417 @@
+/*
+ * Startup Graph - Raijin
+ * Owner: Core/Scheduler
+ * Inputs: Subsystem initializers with their dependencies, added in dependency order
+ * Outputs: Every eager initializer run once, as early as its dependencies allow; lazy ones on
+ *          first Ensure; per-node timings and the critical path
+ * Invariants: A node starts only after each of its dependencies finished; it runs at most once;
+ *             node state, waiting counts and outstanding change only under the lock
+ * Budget: No allocation; one pool task per eager node; O(nodes^2) bookkeeping per Run
+ * Failure modes: Required node fails -> its dependents are skipped and Run returns its status;
+ *                optional node fails -> reported, dependents still run; no pool -> nodes run
+ *                inline on the caller in dependency order
+ * Recovery: Run always waits for every pool task it submitted, even after a failure
+ */
+
+#include "../../Include/startup_graph.h"
+#include "../../Include/raijin_ntstatus.h"
+#include "../../Include/qpc_clock.h"
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+static uint64_t Startup_NowUs(const StartupGraph* graph) {
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return QpcClock_TicksToUs((uint64_t)now.QuadPart, (uint64_t)graph->qpc_frequency.QuadPart);
+}
+
+// Microseconds since Run started
+static uint64_t Startup_Elapsed(const StartupGraph* graph) {
+    return Startup_NowUs(graph) - graph->origin_us;
+}
+
+NTSTATUS StartupGraph_Initialize(StartupGraph* graph) {
+    if (!graph) return STATUS_INVALID_PARAMETER;
+    if (graph->initialized) return STATUS_INVALID_DEVICE_STATE;
+    memset(graph, 0, sizeof(StartupGraph));
+    if (!QueryPerformanceFrequency(&graph->qpc_frequency) || graph->qpc_frequency.QuadPart <= 0)
+        return STATUS_NOT_SUPPORTED;
+    InitializeCriticalSection(&graph->lock);
+    InitializeConditionVariable(&graph->changed);
+    graph->first_failure = STATUS_SUCCESS;
+    graph->stats.critical_path_end = STARTUP_GRAPH_INVALID_NODE;
+    graph->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void StartupGraph_Shutdown(StartupGraph* graph) {
+    if (!graph || !graph->initialized) return;
+    DeleteCriticalSection(&graph->lock);
+    memset(graph, 0, sizeof(StartupGraph));
+}
+
+NTSTATUS StartupGraph_AddNode(StartupGraph* graph, const char* name, StartupNodeFn fn, void* context,
+    uint32_t flags, const uint32_t* deps, uint32_t dep_count, uint32_t* id) {
+    if (!graph || !graph->initialized || !name || !fn || !id) return STATUS_INVALID_PARAMETER;
+    if (graph->ran) return STATUS_INVALID_DEVICE_STATE;
+    if (dep_count > STARTUP_GRAPH_MAX_DEPS || (dep_count > 0 && !deps)) return STATUS_INVALID_PARAMETER;
+    if (graph->node_count >= STARTUP_GRAPH_MAX_NODES) return STATUS_INSUFFICIENT_RESOURCES;
+
+    for (uint32_t d = 0; d < dep_count; d++) {
+        // Only earlier nodes, so no cycle can be built; each at most once, so waiting counts match
+        if (deps[d] >= graph->node_count) return STATUS_INVALID_PARAMETER;
+        for (uint32_t e = 0; e < d; e++)
+            if (deps[e] == deps[d]) return STATUS_INVALID_PARAMETER;
+        // Run would wait forever for a lazy dependency that only Ensure starts
+        if ((graph->nodes[deps[d]].flags & STARTUP_NODE_LAZY) && !(flags & STARTUP_NODE_LAZY))
+            return STATUS_INVALID_PARAMETER;
+    }
+
+    uint32_t new_id = graph->node_count++;
+    StartupNode* node = &graph->nodes[new_id];
+    memset(node, 0, sizeof(StartupNode));
+    strncpy(node->name, name, STARTUP_GRAPH_NAME_MAX - 1);
+    node->fn = fn;
+    node->context = context;
+    node->flags = flags;
+    if (dep_count > 0) memcpy(node->deps, deps, dep_count * sizeof(uint32_t));
+    node->dep_count = dep_count;
+    node->state = STARTUP_NODE_PENDING;
+    node->status = STATUS_SUCCESS;
+    node->path_dep = STARTUP_GRAPH_INVALID_NODE;
+    node->graph = graph;
+    *id = new_id;
+    return STATUS_SUCCESS;
+}
+
+static bool Startup_DependsOn(const StartupNode* node, uint32_t dep) {
+    for (uint32_t d = 0; d < node->dep_count; d++)
+        if (node->deps[d] == dep) return true;
+    return false;
+}
+
+/*
+ * Caller holds the lock. Records `finished` and releases every eager node it was the last
+ * dependency of: skipped nodes are finished on the spot (and release theirs in turn), caller
+ * nodes are marked for Run's thread, the rest are returned in `submit` for the pool.
+ */
+static void Startup_Release(StartupGraph* graph, uint32_t finished, uint32_t* submit, uint32_t* submit_count) {
+    uint32_t worklist[STARTUP_GRAPH_MAX_NODES];
+    uint32_t work_count = 0;
+    worklist[work_count++] = finished;
+
+    while (work_count > 0) {
+        uint32_t f = worklist[--work_count];
+        const StartupNode* done = &graph->nodes[f];
+        bool unusable = (done->flags & STARTUP_NODE_REQUIRED) && done->state != STARTUP_NODE_DONE;
+        graph->outstanding--;
+
+        for (uint32_t i = f + 1; i < graph->node_count; i++) {
+            StartupNode* node = &graph->nodes[i];
+            if ((node->flags & STARTUP_NODE_LAZY) || node->state != STARTUP_NODE_PENDING) continue;
+            if (!Startup_DependsOn(node, f)) continue;
+            if (unusable) node->blocked = true;
+            if (done->end_us > node->ready_us) node->ready_us = done->end_us;
+            if (--node->waiting > 0) continue;
+
+            if (node->blocked) {
+                node->state = STARTUP_NODE_SKIPPED;
+                node->status = STATUS_INVALID_DEVICE_STATE;
+                node->start_us = node->end_us = node->ready_us;
+                worklist[work_count++] = i;
+            } else {
+                node->state = STARTUP_NODE_READY;
+                if (!(node->flags & STARTUP_NODE_CALLER_THREAD)) submit[(*submit_count)++] = i;
+            }
+        }
+    }
+    WakeAllConditionVariable(&graph->changed);
+}
+
+static void Startup_SubmitAll(StartupGraph* graph, const uint32_t* submit, uint32_t submit_count);
+
+// Runs one node outside the lock, then releases its dependents
+static void Startup_Execute(StartupGraph* graph, uint32_t id) {
+    StartupNode* node = &graph->nodes[id];
+    uint64_t start_us = Startup_Elapsed(graph);
+    NTSTATUS status = node->fn(node->context);
+    uint64_t end_us = Startup_Elapsed(graph);
+
+    uint32_t submit[STARTUP_GRAPH_MAX_NODES];
+    uint32_t submit_count = 0;
+    EnterCriticalSection(&graph->lock);
+    node->start_us = start_us;
+    node->end_us = end_us;
+    node->status = status;
+    node->state = NT_SUCCESS(status) ? STARTUP_NODE_DONE : STARTUP_NODE_FAILED;
+    if (!NT_SUCCESS(status) && (node->flags & STARTUP_NODE_REQUIRED) && NT_SUCCESS(graph->first_failure))
+        graph->first_failure = status;
+    Startup_Release(graph, id, submit, &submit_count);
+    LeaveCriticalSection(&graph->lock);
+    Startup_SubmitAll(graph, submit, submit_count);
+}
+
+static void Startup_NodeTask(void* context) {
+    StartupNode* node = (StartupNode*)context;
+    Startup_Execute(node->graph, (uint32_t)(node - node->graph->nodes));
+}
+
+// Outside the lock: with no pool or a full queue the node runs right here
+static void Startup_SubmitAll(StartupGraph* graph, const uint32_t* submit, uint32_t submit_count) {
+    for (uint32_t i = 0; i < submit_count; i++) {
+        ThreadPool_Submit(graph->pool, Startup_NodeTask, &graph->nodes[submit[i]], THREAD_POOL_PRIORITY_HIGH,
+                          &graph->group);
+    }
+}
+
+// Longest chain of run times through a node's dependencies; nodes come in dependency order
+static void Startup_ComputePath(StartupGraph* graph, uint32_t id) {
+    StartupNode* node = &graph->nodes[id];
+    node->path_us = 0;
+    node->path_dep = STARTUP_GRAPH_INVALID_NODE;
+    for (uint32_t d = 0; d < node->dep_count; d++) {
+        const StartupNode* dep = &graph->nodes[node->deps[d]];
+        if (node->path_dep == STARTUP_GRAPH_INVALID_NODE || dep->path_us > node->path_us) {
+            node->path_us = dep->path_us;
+            node->path_dep = node->deps[d];
+        }
+    }
+    node->path_us += node->end_us - node->start_us;
+}
+
+static void Startup_ComputeStats(StartupGraph* graph) {
+    StartupGraphStats* stats = &graph->stats;
+    memset(stats, 0, sizeof(StartupGraphStats));
+    stats->nodes = graph->node_count;
+    stats->workers = ThreadPool_GetWorkerCount(graph->pool);
+    stats->critical_path_end = STARTUP_GRAPH_INVALID_NODE;
+    uint64_t first_start = UINT64_MAX;
+    uint64_t last_end = 0;
+    for (uint32_t i = 0; i < graph->node_count; i++) {
+        const StartupNode* node = &graph->nodes[i];
+        if (node->flags & STARTUP_NODE_LAZY) {
+            if (node->state == STARTUP_NODE_PENDING) stats->lazy_pending++;
+            else stats->lazy_run++;
+            if (node->state == STARTUP_NODE_FAILED) stats->failed++;
+            continue;
+        }
+        Startup_ComputePath(graph, i);
+        if (node->state == STARTUP_NODE_DONE) stats->succeeded++;
+        else if (node->state == STARTUP_NODE_FAILED) stats->failed++;
+        else if (node->state == STARTUP_NODE_SKIPPED) { stats->skipped++; continue; }
+        stats->serial_us += node->end_us - node->start_us;
+        if (node->start_us < first_start) first_start = node->start_us;
+        if (node->end_us > last_end) last_end = node->end_us;
+        if (node->path_us > stats->critical_path_us) {
+            stats->critical_path_us = node->path_us;
+            stats->critical_path_end = i;
+        }
+    }
+    if (first_start != UINT64_MAX) stats->wall_us = last_end - first_start;
+}
+
+NTSTATUS StartupGraph_Run(StartupGraph* graph, ThreadPool* pool) {
+    if (!graph || !graph->initialized) return STATUS_INVALID_PARAMETER;
+    if (graph->ran) return STATUS_INVALID_DEVICE_STATE;
+
+    uint32_t submit[STARTUP_GRAPH_MAX_NODES];
+    uint32_t submit_count = 0;
+    EnterCriticalSection(&graph->lock);
+    graph->ran = true;
+    graph->pool = pool;
+    graph->origin_us = Startup_NowUs(graph);
+    for (uint32_t i = 0; i < graph->node_count; i++) {
+        StartupNode* node = &graph->nodes[i];
+        if (node->flags & STARTUP_NODE_LAZY) continue;
+        graph->outstanding++;
+        node->waiting = node->dep_count;
+        if (node->waiting > 0) continue;
+        node->state = STARTUP_NODE_READY;
+        if (!(node->flags & STARTUP_NODE_CALLER_THREAD)) submit[submit_count++] = i;
+    }
+    LeaveCriticalSection(&graph->lock);
+    Startup_SubmitAll(graph, submit, submit_count);
+
+    // This thread runs the caller-thread nodes as they become ready and otherwise sleeps
+    EnterCriticalSection(&graph->lock);
+    while (graph->outstanding > 0) {
+        uint32_t next = STARTUP_GRAPH_INVALID_NODE;
+        for (uint32_t i = 0; i < graph->node_count && next == STARTUP_GRAPH_INVALID_NODE; i++) {
+            const StartupNode* node = &graph->nodes[i];
+            if ((node->flags & STARTUP_NODE_CALLER_THREAD) && !(node->flags & STARTUP_NODE_LAZY) &&
+                node->state == STARTUP_NODE_READY)
+                next = i;
+        }
+        if (next == STARTUP_GRAPH_INVALID_NODE) {
+            SleepConditionVariableCS(&graph->changed, &graph->lock, INFINITE);
+            continue;
+        }
+        graph->nodes[next].state = STARTUP_NODE_RUNNING;
+        LeaveCriticalSection(&graph->lock);
+        Startup_Execute(graph, next);
+        EnterCriticalSection(&graph->lock);
+    }
+    LeaveCriticalSection(&graph->lock);
+
+    // Every node has finished, but a task may still be on its way out of Startup_NodeTask
+    ThreadPool_Wait(pool, &graph->group);
+
+    EnterCriticalSection(&graph->lock);
+    Startup_ComputeStats(graph);
+    NTSTATUS result = graph->first_failure;
+    LeaveCriticalSection(&graph->lock);
+    return result;
+}
+
+NTSTATUS StartupGraph_Ensure(StartupGraph* graph, uint32_t id, bool* ran) {
+    if (ran) *ran = false;
+    if (!graph || !graph->initialized || id >= graph->node_count) return STATUS_INVALID_PARAMETER;
+    StartupNode* node = &graph->nodes[id];
+
+    EnterCriticalSection(&graph->lock);
+    if (!graph->ran) {
+        LeaveCriticalSection(&graph->lock);
+        return STATUS_INVALID_DEVICE_STATE;
+    }
+    // Another thread got here first; its result is ours
+    while (node->state == STARTUP_NODE_RUNNING)
+        SleepConditionVariableCS(&graph->changed, &graph->lock, INFINITE);
+    if (node->state != STARTUP_NODE_PENDING || !(node->flags & STARTUP_NODE_LAZY)) {
+        NTSTATUS status = node->status;
+        LeaveCriticalSection(&graph->lock);
+        return status;
+    }
+    node->state = STARTUP_NODE_RUNNING;
+    LeaveCriticalSection(&graph->lock);
+
+    // Eager dependencies finished in Run; lazy ones are brought up here, on this thread
+    bool blocked = false;
+    uint64_t ready_us = 0;
+    for (uint32_t d = 0; d < node->dep_count; d++) {
+        uint32_t dep = node->deps[d];
+        NTSTATUS dep_status = StartupGraph_Ensure(graph, dep, NULL);
+        if (!NT_SUCCESS(dep_status) && (graph->nodes[dep].flags & STARTUP_NODE_REQUIRED)) blocked = true;
+        if (graph->nodes[dep].end_us > ready_us) ready_us = graph->nodes[dep].end_us;
+    }
+
+    uint64_t start_us = Startup_Elapsed(graph);
+    NTSTATUS status = blocked ? STATUS_INVALID_DEVICE_STATE : node->fn(node->context);
+    uint64_t end_us = blocked ? start_us : Startup_Elapsed(graph);
+
+    EnterCriticalSection(&graph->lock);
+    node->ready_us = ready_us;
+    node->start_us = start_us;
+    node->end_us = end_us;
+    node->status = status;
+    node->state = blocked ? STARTUP_NODE_SKIPPED : (NT_SUCCESS(status) ? STARTUP_NODE_DONE : STARTUP_NODE_FAILED);
+    graph->stats.lazy_pending--;
+    graph->stats.lazy_run++;
+    if (node->state == STARTUP_NODE_FAILED) graph->stats.failed++;
+    WakeAllConditionVariable(&graph->changed);
+    LeaveCriticalSection(&graph->lock);
+    if (ran) *ran = true;
+    return status;
+}
+
+uint32_t StartupGraph_FindNode(const StartupGraph* graph, const char* name) {
+    if (!graph || !graph->initialized || !name) return STARTUP_GRAPH_INVALID_NODE;
+    for (uint32_t i = 0; i < graph->node_count; i++)
+        if (strcmp(graph->nodes[i].name, name) == 0) return i;
+    return STARTUP_GRAPH_INVALID_NODE;
+}
+
+void StartupGraph_GetStats(const StartupGraph* graph, StartupGraphStats* out) {
+    if (!out) return;
+    memset(out, 0, sizeof(StartupGraphStats));
+    out->critical_path_end = STARTUP_GRAPH_INVALID_NODE;
+    if (!graph || !graph->initialized || !graph->ran) return;
+    *out = graph->stats;
+}
+
+static const char* Startup_StateName(StartupNodeState state) {
+    switch (state) {
+        case STARTUP_NODE_PENDING: return "deferred";
+        case STARTUP_NODE_READY:   return "ready";
+        case STARTUP_NODE_RUNNING: return "running";
+        case STARTUP_NODE_DONE:    return "ok";
+        case STARTUP_NODE_FAILED:  return "failed";
+        case STARTUP_NODE_SKIPPED: return "skipped";
+        default: return "unknown";
+    }
+}
+
+// Critical path in start order; returns its length
+static uint32_t Startup_CriticalPath(const StartupGraph* graph, uint32_t* path) {
+    uint32_t reversed[STARTUP_GRAPH_MAX_NODES];
+    uint32_t length = 0;
+    for (uint32_t i = graph->stats.critical_path_end; i != STARTUP_GRAPH_INVALID_NODE && length < STARTUP_GRAPH_MAX_NODES;
+         i = graph->nodes[i].path_dep)
+        reversed[length++] = i;
+    for (uint32_t i = 0; i < length; i++) path[i] = reversed[length - 1 - i];
+    return length;
+}
+
+void StartupGraph_PrintReport(const StartupGraph* graph) {
+    if (!graph || !graph->initialized || !graph->ran) return;
+    const StartupGraphStats* s = &graph->stats;
+    printf("\n=== Raijin Startup Report ===\n");
+    printf("Wall: %.1f ms | Serial: %.1f ms | Critical path: %.1f ms | Workers: %u\n",
+        s->wall_us / 1000.0, s->serial_us / 1000.0, s->critical_path_us / 1000.0, s->workers);
+    printf("Nodes: %u | OK: %u | Failed: %u | Skipped: %u | Lazy: %u run, %u deferred\n\n",
+        s->nodes, s->succeeded, s->failed, s->skipped, s->lazy_run, s->lazy_pending);
+    for (uint32_t i = 0; i < graph->node_count; i++) {
+        const StartupNode* node = &graph->nodes[i];
+        if (node->state == STARTUP_NODE_PENDING) {
+            printf("  [%-8s] %-32s on first use\n", Startup_StateName(node->state), node->name);
+            continue;
+        }
+        printf("  [%-8s] %-32s %9.1f -> %9.1f ms (%8.1f ms, waited %6.1f ms)",
+            Startup_StateName(node->state), node->name, node->start_us / 1000.0, node->end_us / 1000.0,
+            (node->end_us - node->start_us) / 1000.0,
+            node->start_us > node->ready_us ? (node->start_us - node->ready_us) / 1000.0 : 0.0);
+        if (!NT_SUCCESS(node->status)) printf(" 0x%08lX", (unsigned long)node->status);
+        printf("%s\n", (node->flags & STARTUP_NODE_LAZY) ? " lazy" : "");
+    }
+
+    uint32_t path[STARTUP_GRAPH_MAX_NODES];
+    uint32_t length = Startup_CriticalPath(graph, path);
+    if (length > 0) {
+        printf("\nCritical path:");
+        for (uint32_t i = 0; i < length; i++)
+            printf("%s %s (%.1f ms)", i ? " ->" : "", graph->nodes[path[i]].name,
+                (graph->nodes[path[i]].end_us - graph->nodes[path[i]].start_us) / 1000.0);
+        printf("\n");
+    }
+    printf("=============================\n\n");
+}
+
+void StartupGraph_WriteJson(const StartupGraph* graph, FILE* out) {
+    if (!graph || !graph->initialized || !graph->ran || !out) return;
+    const StartupGraphStats* s = &graph->stats;
+    fprintf(out, "{\n");
+    fprintf(out, "  \"wall_ms\": %.3f,\n", s->wall_us / 1000.0);
+    fprintf(out, "  \"serial_ms\": %.3f,\n", s->serial_us / 1000.0);
+    fprintf(out, "  \"critical_path_ms\": %.3f,\n", s->critical_path_us / 1000.0);
+    fprintf(out, "  \"workers\": %u,\n", s->workers);
+    fprintf(out, "  \"nodes\": [\n");
+    for (uint32_t i = 0; i < graph->node_count; i++) {
+        const StartupNode* node = &graph->nodes[i];
+        fprintf(out, "    { \"name\": \"%s\", \"state\": \"%s\", \"lazy\": %s, \"required\": %s, "
+            "\"status\": \"0x%08lX\", \"start_ms\": %.3f, \"end_ms\": %.3f, \"ready_ms\": %.3f, \"deps\": [",
+            node->name, Startup_StateName(node->state), (node->flags & STARTUP_NODE_LAZY) ? "true" : "false",
+            (node->flags & STARTUP_NODE_REQUIRED) ? "true" : "false", (unsigned long)node->status,
+            node->start_us / 1000.0, node->end_us / 1000.0, node->ready_us / 1000.0);
+        for (uint32_t d = 0; d < node->dep_count; d++)
+            fprintf(out, "%s\"%s\"", d ? ", " : "", graph->nodes[node->deps[d]].name);
+        fprintf(out, "] }%s\n", i + 1 < graph->node_count ? "," : "");
+    }
+    fprintf(out, "  ],\n");
+    fprintf(out, "  \"critical_path\": [");
+    uint32_t path[STARTUP_GRAPH_MAX_NODES];
+    uint32_t length = Startup_CriticalPath(graph, path);
+    for (uint32_t i = 0; i < length; i++)
+        fprintf(out, "%s\"%s\"", i ? ", " : "", graph->nodes[path[i]].name);
+    fprintf(out, "]\n");
+    fprintf(out, "}\n");
+}
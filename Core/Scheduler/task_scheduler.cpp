@@ -0,0 +1,417 @@
+/*
+ * Task Scheduler - Raijin
+ * Owner: Core/Scheduler
+ * Inputs: Registered periodic and triggered tasks (period, priority, budget); Trigger/Stop from any thread
+ * Outputs: Task bodies run on the RunOnce caller's thread; per-task timing and overrun stats;
+ *          overruns passed to the overrun handler
+ * Invariants: heap[] holds exactly the queued tasks, ordered by deadline_us, and
+ *             tasks[heap[i]].heap_index == i; a running task is never queued
+ * Budget: O(log n) per queue operation, O(k log n) per dispatch of k due tasks; no allocation
+ * Failure modes: Task over budget -> counted in its stats and reported, never preempted; task
+ *                expected to overrun the dispatch deadline -> deferred to the next dispatch;
+ *                task table full -> Add returns STATUS_INSUFFICIENT_RESOURCES
+ * Recovery: A periodic task that falls a whole period behind is re-armed from now rather than
+ *           replaying every missed period
+ */
+
+#include "../../Include/task_scheduler.h"
+#include "../../Include/raijin_ntstatus.h"
+#include "../../Include/qpc_clock.h"
+#include <windows.h>
+#include <string.h>
+
+#define TASK_ESTIMATE_WEIGHT 4                 /* a new run moves the estimate a quarter of the way */
+
+static bool Task_Before(const TaskScheduler* scheduler, uint32_t a, uint32_t b) {
+    return scheduler->tasks[a].deadline_us < scheduler->tasks[b].deadline_us;
+}
+
+static void Heap_Place(TaskScheduler* scheduler, uint32_t index, uint32_t id) {
+    scheduler->heap[index] = id;
+    scheduler->tasks[id].heap_index = (int32_t)index;
+}
+
+static void Heap_SiftUp(TaskScheduler* scheduler, uint32_t index) {
+    uint32_t id = scheduler->heap[index];
+    while (index > 0) {
+        uint32_t parent = (index - 1) / 2;
+        if (!Task_Before(scheduler, id, scheduler->heap[parent])) break;
+        Heap_Place(scheduler, index, scheduler->heap[parent]);
+        index = parent;
+    }
+    Heap_Place(scheduler, index, id);
+}
+
+static void Heap_SiftDown(TaskScheduler* scheduler, uint32_t index) {
+    uint32_t id = scheduler->heap[index];
+    for (;;) {
+        uint32_t child = 2 * index + 1;
+        if (child >= scheduler->heap_size) break;
+        if (child + 1 < scheduler->heap_size && Task_Before(scheduler, scheduler->heap[child + 1], scheduler->heap[child]))
+            child++;
+        if (!Task_Before(scheduler, scheduler->heap[child], id)) break;
+        Heap_Place(scheduler, index, scheduler->heap[child]);
+        index = child;
+    }
+    Heap_Place(scheduler, index, id);
+}
+
+static void Heap_Push(TaskScheduler* scheduler, uint32_t id, uint64_t deadline_us) {
+    scheduler->tasks[id].deadline_us = deadline_us;
+    scheduler->heap[scheduler->heap_size] = id;
+    Heap_SiftUp(scheduler, scheduler->heap_size++);
+}
+
+static uint32_t Heap_Pop(TaskScheduler* scheduler) {
+    uint32_t id = scheduler->heap[0];
+    scheduler->tasks[id].heap_index = -1;
+    if (--scheduler->heap_size > 0) {
+        scheduler->heap[0] = scheduler->heap[scheduler->heap_size];
+        Heap_SiftDown(scheduler, 0);
+    }
+    return id;
+}
+
+// Moves a queued task to a new deadline in either direction
+static void Heap_Update(TaskScheduler* scheduler, uint32_t id, uint64_t deadline_us) {
+    TaskSchedulerTask* task = &scheduler->tasks[id];
+    bool earlier = deadline_us < task->deadline_us;
+    task->deadline_us = deadline_us;
+    if (earlier) Heap_SiftUp(scheduler, (uint32_t)task->heap_index);
+    else Heap_SiftDown(scheduler, (uint32_t)task->heap_index);
+}
+
+uint64_t TaskScheduler_Now(const TaskScheduler* scheduler) {
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return QpcClock_TicksToUs((uint64_t)now.QuadPart, (uint64_t)scheduler->qpc_frequency.QuadPart);
+}
+
+NTSTATUS TaskScheduler_Initialize(TaskScheduler* scheduler) {
+    if (!scheduler) return STATUS_INVALID_PARAMETER;
+    if (scheduler->initialized) return STATUS_INVALID_DEVICE_STATE;
+    memset(scheduler, 0, sizeof(TaskScheduler));
+    if (!QueryPerformanceFrequency(&scheduler->qpc_frequency) || scheduler->qpc_frequency.QuadPart <= 0)
+        return STATUS_NOT_SUPPORTED;
+    InitializeCriticalSection(&scheduler->lock);
+    InitializeConditionVariable(&scheduler->wake);
+    scheduler->current_task = TASK_SCHEDULER_INVALID_TASK;
+    scheduler->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void TaskScheduler_Shutdown(TaskScheduler* scheduler) {
+    if (!scheduler || !scheduler->initialized) return;
+    DeleteCriticalSection(&scheduler->lock);
+    memset(scheduler, 0, sizeof(TaskScheduler));
+}
+
+static NTSTATUS Scheduler_Add(TaskScheduler* scheduler, const char* name, ScheduledTaskKind kind, TaskSchedulerFn fn,
+    void* context, uint64_t period_us, ScheduledTaskPriority priority, uint64_t budget_us, uint32_t* id) {
+    if (!scheduler || !scheduler->initialized || !fn || !id) return STATUS_INVALID_PARAMETER;
+    EnterCriticalSection(&scheduler->lock);
+    if (scheduler->task_count >= TASK_SCHEDULER_MAX_TASKS) {
+        LeaveCriticalSection(&scheduler->lock);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    uint32_t new_id = scheduler->task_count++;
+    TaskSchedulerTask* task = &scheduler->tasks[new_id];
+    memset(task, 0, sizeof(TaskSchedulerTask));
+    strncpy(task->name, name ? name : "task", TASK_SCHEDULER_NAME_MAX - 1);
+    task->kind = kind;
+    task->priority = priority;
+    task->fn = fn;
+    task->context = context;
+    task->period_us = period_us;
+    task->budget_us = budget_us;
+    task->heap_index = -1;
+    LeaveCriticalSection(&scheduler->lock);
+    *id = new_id;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TaskScheduler_AddPeriodic(TaskScheduler* scheduler, const char* name, TaskSchedulerFn fn, void* context,
+    uint64_t period_us, uint64_t first_delay_us, ScheduledTaskPriority priority, uint64_t budget_us, uint32_t* id) {
+    NTSTATUS status = Scheduler_Add(scheduler, name, SCHEDULED_PERIODIC, fn, context, period_us, priority, budget_us, id);
+    if (!NT_SUCCESS(status)) return status;
+    EnterCriticalSection(&scheduler->lock);
+    Heap_Push(scheduler, *id, TaskScheduler_Now(scheduler) + first_delay_us);
+    LeaveCriticalSection(&scheduler->lock);
+    WakeConditionVariable(&scheduler->wake);
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TaskScheduler_AddTriggered(TaskScheduler* scheduler, const char* name, TaskSchedulerFn fn, void* context,
+    ScheduledTaskPriority priority, uint64_t budget_us, uint32_t* id) {
+    return Scheduler_Add(scheduler, name, SCHEDULED_TRIGGERED, fn, context, 0, priority, budget_us, id);
+}
+
+NTSTATUS TaskScheduler_Trigger(TaskScheduler* scheduler, uint32_t id, uint64_t delay_us) {
+    if (!scheduler || !scheduler->initialized) return STATUS_INVALID_PARAMETER;
+    EnterCriticalSection(&scheduler->lock);
+    if (id >= scheduler->task_count) {
+        LeaveCriticalSection(&scheduler->lock);
+        return STATUS_INVALID_PARAMETER;
+    }
+    TaskSchedulerTask* task = &scheduler->tasks[id];
+    uint64_t deadline = TaskScheduler_Now(scheduler) + delay_us;
+    if (task->running) {
+        task->trigger_pending = true;
+    } else if (task->heap_index < 0) {
+        Heap_Push(scheduler, id, deadline);
+    } else if (deadline < task->deadline_us) {
+        Heap_Update(scheduler, id, deadline);
+    }
+    LeaveCriticalSection(&scheduler->lock);
+    WakeConditionVariable(&scheduler->wake);
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TaskScheduler_Defer(TaskScheduler* scheduler, uint32_t id, uint64_t delay_us) {
+    if (!scheduler || !scheduler->initialized) return STATUS_INVALID_PARAMETER;
+    EnterCriticalSection(&scheduler->lock);
+    if (id >= scheduler->task_count) {
+        LeaveCriticalSection(&scheduler->lock);
+        return STATUS_INVALID_PARAMETER;
+    }
+    TaskSchedulerTask* task = &scheduler->tasks[id];
+    uint64_t until = TaskScheduler_Now(scheduler) + delay_us;
+    if (task->running) {
+        if (until > task->defer_until_us) task->defer_until_us = until;
+    } else if (task->heap_index >= 0 && until > task->deadline_us) {
+        Heap_Update(scheduler, id, until);
+    }
+    LeaveCriticalSection(&scheduler->lock);
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TaskScheduler_SetPeriod(TaskScheduler* scheduler, uint32_t id, uint64_t period_us) {
+    if (!scheduler || !scheduler->initialized) return STATUS_INVALID_PARAMETER;
+    EnterCriticalSection(&scheduler->lock);
+    if (id >= scheduler->task_count) {
+        LeaveCriticalSection(&scheduler->lock);
+        return STATUS_INVALID_PARAMETER;
+    }
+    scheduler->tasks[id].period_us = period_us;
+    LeaveCriticalSection(&scheduler->lock);
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TaskScheduler_SetExpectedCost(TaskScheduler* scheduler, uint32_t id, uint64_t expected_us) {
+    if (!scheduler || !scheduler->initialized) return STATUS_INVALID_PARAMETER;
+    EnterCriticalSection(&scheduler->lock);
+    if (id >= scheduler->task_count) {
+        LeaveCriticalSection(&scheduler->lock);
+        return STATUS_INVALID_PARAMETER;
+    }
+    TaskSchedulerTask* task = &scheduler->tasks[id];
+    task->expected_us = expected_us;
+    if (task->stats.runs == 0) task->estimate_us = expected_us;
+    LeaveCriticalSection(&scheduler->lock);
+    return STATUS_SUCCESS;
+}
+
+void TaskScheduler_SetDispatchBudget(TaskScheduler* scheduler, uint64_t budget_us) {
+    if (!scheduler || !scheduler->initialized) return;
+    scheduler->dispatch_budget_us = budget_us;
+}
+
+void TaskScheduler_SetOverrunHandler(TaskScheduler* scheduler, TaskSchedulerOverrunFn fn, void* context) {
+    if (!scheduler || !scheduler->initialized) return;
+    scheduler->overrun_fn = fn;
+    scheduler->overrun_context = context;
+}
+
+uint64_t TaskScheduler_TimeLeft(const TaskScheduler* scheduler) {
+    if (!scheduler || !scheduler->initialized || scheduler->current_task == TASK_SCHEDULER_INVALID_TASK)
+        return TASK_SCHEDULER_UNBOUNDED;
+    const TaskSchedulerTask* task = &scheduler->tasks[scheduler->current_task];
+    uint64_t until = TASK_SCHEDULER_UNBOUNDED;
+    if (task->budget_us) until = scheduler->current_start_us + task->budget_us;
+    if (scheduler->dispatch_deadline_us && scheduler->dispatch_deadline_us < until)
+        until = scheduler->dispatch_deadline_us;
+    if (until == TASK_SCHEDULER_UNBOUNDED) return until;
+    uint64_t now = TaskScheduler_Now(scheduler);
+    return until > now ? until - now : 0;
+}
+
+// Whether running `task` now would, by its estimate, carry the dispatch past its deadline
+static bool Scheduler_ShouldDefer(const TaskScheduler* scheduler, const TaskSchedulerTask* task, uint64_t now) {
+    if (!scheduler->dispatch_deadline_us || task->priority == SCHEDULED_PRIORITY_CRITICAL) return false;
+    if (task->deferred_in_row >= TASK_SCHEDULER_MAX_DEFERRALS || task->estimate_us == 0) return false;
+    return now + task->estimate_us > scheduler->dispatch_deadline_us;
+}
+
+// Called with the lock held once a task body has returned
+static void Scheduler_Rearm(TaskScheduler* scheduler, uint32_t id, uint64_t now) {
+    TaskSchedulerTask* task = &scheduler->tasks[id];
+    uint64_t next = 0;
+    bool queue = false;
+    if (task->kind == SCHEDULED_PERIODIC) {
+        next = task->deadline_us + task->period_us;
+        if (next < now) {
+            if (task->period_us > 0) task->stats.skipped_periods += (now - next) / task->period_us;
+            next = now;
+        }
+        queue = true;
+    } else if (task->trigger_pending) {
+        next = now;
+        queue = true;
+    }
+    if (task->defer_until_us > next) next = task->defer_until_us;
+    task->trigger_pending = false;
+    task->defer_until_us = 0;
+    task->running = false;
+    if (queue) Heap_Push(scheduler, id, next);
+}
+
+NTSTATUS TaskScheduler_RunOnce(TaskScheduler* scheduler, uint64_t max_wait_us) {
+    if (!scheduler || !scheduler->initialized) return STATUS_INVALID_PARAMETER;
+    if (scheduler->stop) return STATUS_CANCELLED;
+
+    uint32_t due[TASK_SCHEDULER_MAX_TASKS];
+    uint32_t due_count = 0;
+    EnterCriticalSection(&scheduler->lock);
+    uint64_t now = TaskScheduler_Now(scheduler);
+    while (scheduler->heap_size > 0 && scheduler->tasks[scheduler->heap[0]].deadline_us <= now) {
+        uint32_t id = Heap_Pop(scheduler);
+        scheduler->tasks[id].running = true;
+        due[due_count++] = id;
+    }
+
+    if (due_count == 0) {
+        uint64_t wait_us = max_wait_us;
+        if (scheduler->heap_size > 0) {
+            uint64_t until_next = scheduler->tasks[scheduler->heap[0]].deadline_us - now;
+            if (until_next < wait_us) wait_us = until_next;
+        }
+        // Round up so the wait never ends just short of the deadline and spins
+        DWORD wait_ms = (DWORD)((wait_us + TASK_SCHEDULER_MS - 1) / TASK_SCHEDULER_MS);
+        scheduler->stats.waits++;
+        if (wait_ms > 0 && !scheduler->stop) {
+            if (SleepConditionVariableCS(&scheduler->wake, &scheduler->lock, wait_ms))
+                scheduler->stats.wakeups++;
+        }
+        scheduler->stats.wait_us += TaskScheduler_Now(scheduler) - now;
+        LeaveCriticalSection(&scheduler->lock);
+        return scheduler->stop ? STATUS_CANCELLED : STATUS_SUCCESS;
+    }
+    scheduler->stats.dispatches++;
+
+    // Highest priority first; among equals, the one that has waited longest
+    for (uint32_t i = 1; i < due_count; i++) {
+        uint32_t id = due[i];
+        uint32_t j = i;
+        while (j > 0) {
+            const TaskSchedulerTask* a = &scheduler->tasks[id];
+            const TaskSchedulerTask* b = &scheduler->tasks[due[j - 1]];
+            if (a->priority < b->priority || (a->priority == b->priority && a->deadline_us >= b->deadline_us)) break;
+            due[j] = due[j - 1];
+            j--;
+        }
+        due[j] = id;
+    }
+    LeaveCriticalSection(&scheduler->lock);
+
+    uint64_t dispatch_start = TaskScheduler_Now(scheduler);
+    scheduler->dispatch_deadline_us = scheduler->dispatch_budget_us ? dispatch_start + scheduler->dispatch_budget_us : 0;
+    uint32_t ran = 0;
+    for (uint32_t i = 0; i < due_count; i++) {
+        uint32_t id = due[i];
+        TaskSchedulerTask* task = &scheduler->tasks[id];
+        uint64_t start = TaskScheduler_Now(scheduler);
+        if (ran > 0 && Scheduler_ShouldDefer(scheduler, task, start)) {
+            // Back in the queue with its deadline unchanged: still due, and first in line next time
+            EnterCriticalSection(&scheduler->lock);
+            task->deferred_in_row++;
+            task->stats.deferrals++;
+            scheduler->stats.deferrals++;
+            task->running = false;
+            task->trigger_pending = false;
+            Heap_Push(scheduler, id, task->deadline_us);
+            LeaveCriticalSection(&scheduler->lock);
+            continue;
+        }
+        scheduler->current_task = id;
+        scheduler->current_start_us = start;
+        if (!scheduler->stop) task->fn(task->context);
+        uint64_t end = TaskScheduler_Now(scheduler);
+        scheduler->current_task = TASK_SCHEDULER_INVALID_TASK;
+        ran++;
+
+        EnterCriticalSection(&scheduler->lock);
+        uint64_t elapsed = end - start;
+        uint64_t late = start > task->deadline_us ? start - task->deadline_us : 0;
+        bool overran = task->budget_us && elapsed > task->budget_us;
+        task->stats.runs++;
+        task->stats.total_us += elapsed;
+        task->stats.last_us = elapsed;
+        if (elapsed > task->stats.max_us) task->stats.max_us = elapsed;
+        if (overran) task->stats.overruns++;
+        if (task->period_us > 0 && late > task->stats.max_late_us) task->stats.max_late_us = late;
+        task->estimate_us = task->stats.runs == 1 && task->expected_us == 0 ? elapsed :
+            (task->estimate_us * (TASK_ESTIMATE_WEIGHT - 1) + elapsed) / TASK_ESTIMATE_WEIGHT;
+        task->stats.estimate_us = task->estimate_us;
+        task->deferred_in_row = 0;
+        uint64_t budget = task->budget_us;
+        Scheduler_Rearm(scheduler, id, end);
+        LeaveCriticalSection(&scheduler->lock);
+        if (overran && scheduler->overrun_fn) scheduler->overrun_fn(scheduler->overrun_context, id, elapsed, budget);
+    }
+
+    uint64_t dispatch_us = TaskScheduler_Now(scheduler) - dispatch_start;
+    bool dispatch_overran = scheduler->dispatch_budget_us && dispatch_us > scheduler->dispatch_budget_us;
+    EnterCriticalSection(&scheduler->lock);
+    if (dispatch_us > scheduler->stats.max_dispatch_us) scheduler->stats.max_dispatch_us = dispatch_us;
+    if (dispatch_overran) scheduler->stats.dispatch_overruns++;
+    LeaveCriticalSection(&scheduler->lock);
+    scheduler->dispatch_deadline_us = 0;
+    if (dispatch_overran && scheduler->overrun_fn) {
+        scheduler->overrun_fn(scheduler->overrun_context, TASK_SCHEDULER_INVALID_TASK, dispatch_us,
+            scheduler->dispatch_budget_us);
+    }
+    return scheduler->stop ? STATUS_CANCELLED : STATUS_SUCCESS;
+}
+
+void TaskScheduler_Stop(TaskScheduler* scheduler) {
+    if (!scheduler || !scheduler->initialized) return;
+    EnterCriticalSection(&scheduler->lock);
+    InterlockedExchange(&scheduler->stop, 1);
+    LeaveCriticalSection(&scheduler->lock);
+    WakeAllConditionVariable(&scheduler->wake);
+}
+
+uint32_t TaskScheduler_FindTask(TaskScheduler* scheduler, const char* name) {
+    if (!scheduler || !scheduler->initialized || !name) return TASK_SCHEDULER_INVALID_TASK;
+    uint32_t found = TASK_SCHEDULER_INVALID_TASK;
+    EnterCriticalSection(&scheduler->lock);
+    for (uint32_t i = 0; i < scheduler->task_count; i++) {
+        if (strcmp(scheduler->tasks[i].name, name) == 0) {
+            found = i;
+            break;
+        }
+    }
+    LeaveCriticalSection(&scheduler->lock);
+    return found;
+}
+
+NTSTATUS TaskScheduler_GetTaskStats(TaskScheduler* scheduler, uint32_t id, TaskSchedulerTaskStats* out) {
+    if (!scheduler || !scheduler->initialized || !out) return STATUS_INVALID_PARAMETER;
+    EnterCriticalSection(&scheduler->lock);
+    if (id >= scheduler->task_count) {
+        LeaveCriticalSection(&scheduler->lock);
+        return STATUS_INVALID_PARAMETER;
+    }
+    *out = scheduler->tasks[id].stats;
+    LeaveCriticalSection(&scheduler->lock);
+    return STATUS_SUCCESS;
+}
+
+void TaskScheduler_GetStats(TaskScheduler* scheduler, TaskSchedulerStats* out) {
+    if (!out) return;
+    memset(out, 0, sizeof(TaskSchedulerStats));
+    if (!scheduler || !scheduler->initialized) return;
+    EnterCriticalSection(&scheduler->lock);
+    *out = scheduler->stats;
+    LeaveCriticalSection(&scheduler->lock);
+}
@@ -0,0 +1,416 @@
+/*
+ * Thread Pool - Raijin
+ * Owner: Core/Scheduler
+ * Inputs: Tasks and ParallelFor ranges submitted from any thread, each with a priority and an
+ *         optional group
+ * Outputs: Tasks run on one worker per core; ThreadPool_Wait returns once a group has drained
+ * Invariants: queued counts every task sitting in any queue; a group's pending count covers
+ *             every task of the group that has not finished; a task never outlives its group's
+ *             Wait; the thread's role binding is the same before and after every task
+ * Budget: No allocation after Initialize; one lock per push and per pop, on the owner's queue
+ *         unless stealing; THREAD_POOL_QUEUE_CAPACITY x priorities x sizeof(ThreadPoolTask)
+ *         per worker
+ * Failure modes: Queue full -> the task runs on the submitter; no pool -> everything runs inline;
+ *                a task blocking on work that only it could run -> deadlock, so tasks join only
+ *                their own groups
+ * Recovery: Shutdown drains every queued task before the workers exit
+ */
+
+#include "../../Include/thread_pool.h"
+#include "../../Include/raijin_ntstatus.h"
+#include "../../Include/role_boundary.h"
+#include <windows.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Worker the current thread belongs to, if any
+static thread_local ThreadPoolWorker* t_worker = NULL;
+
+static ThreadPool g_pool;
+static volatile LONG g_pool_state = 0;   // 0 not started, 1 starting, 2 running, 3 stopped or failed
+
+// Interlocked read: every counter below is only ever written atomically
+static LONG Pool_Load(volatile LONG* counter) {
+    return InterlockedCompareExchange(counter, 0, 0);
+}
+
+static ThreadPoolWorker* Pool_CurrentWorker(ThreadPool* pool) {
+    return (t_worker && t_worker->pool == pool) ? t_worker : NULL;
+}
+
+static bool Queue_Initialize(ThreadPoolQueue* queue) {
+    memset(queue, 0, sizeof(ThreadPoolQueue));
+    for (uint32_t p = 0; p < THREAD_POOL_PRIORITY_COUNT; p++) {
+        queue->slots[p] = (ThreadPoolTask*)malloc(THREAD_POOL_QUEUE_CAPACITY * sizeof(ThreadPoolTask));
+        if (!queue->slots[p]) {
+            for (uint32_t q = 0; q < p; q++) free(queue->slots[q]);
+            return false;
+        }
+    }
+    InitializeCriticalSection(&queue->lock);
+    return true;
+}
+
+static void Queue_Shutdown(ThreadPoolQueue* queue) {
+    for (uint32_t p = 0; p < THREAD_POOL_PRIORITY_COUNT; p++) free(queue->slots[p]);
+    DeleteCriticalSection(&queue->lock);
+}
+
+static bool Queue_Push(ThreadPoolQueue* queue, const ThreadPoolTask* task) {
+    uint32_t p = (uint32_t)task->priority;
+    EnterCriticalSection(&queue->lock);
+    if (queue->tail[p] - queue->head[p] >= THREAD_POOL_QUEUE_CAPACITY) {
+        LeaveCriticalSection(&queue->lock);
+        return false;
+    }
+    queue->slots[p][queue->tail[p] & (THREAD_POOL_QUEUE_CAPACITY - 1)] = *task;
+    queue->tail[p]++;
+    InterlockedIncrement(&queue->count);
+    LeaveCriticalSection(&queue->lock);
+    return true;
+}
+
+// Owner end: newest first
+static bool Queue_PopTail(ThreadPoolQueue* queue, uint32_t p, ThreadPoolTask* out) {
+    if (Pool_Load(&queue->count) == 0) return false;
+    bool found = false;
+    EnterCriticalSection(&queue->lock);
+    if (queue->tail[p] != queue->head[p]) {
+        queue->tail[p]--;
+        *out = queue->slots[p][queue->tail[p] & (THREAD_POOL_QUEUE_CAPACITY - 1)];
+        InterlockedDecrement(&queue->count);
+        found = true;
+    }
+    LeaveCriticalSection(&queue->lock);
+    return found;
+}
+
+// Thief end: oldest first, which for a split range is the biggest piece
+static bool Queue_PopHead(ThreadPoolQueue* queue, uint32_t p, ThreadPoolTask* out) {
+    if (Pool_Load(&queue->count) == 0) return false;
+    bool found = false;
+    EnterCriticalSection(&queue->lock);
+    if (queue->tail[p] != queue->head[p]) {
+        *out = queue->slots[p][queue->head[p] & (THREAD_POOL_QUEUE_CAPACITY - 1)];
+        queue->head[p]++;
+        InterlockedDecrement(&queue->count);
+        found = true;
+    }
+    LeaveCriticalSection(&queue->lock);
+    return found;
+}
+
+static void Pool_WakeOne(ThreadPool* pool) {
+    // Pairs with the sleepers increment in Worker_Idle: either the sleeper sees the new task
+    // count or we see the sleeper and wake it under the lock it sleeps on
+    if (Pool_Load(&pool->sleepers) == 0) return;
+    EnterCriticalSection(&pool->sleep_lock);
+    WakeConditionVariable(&pool->wake);
+    LeaveCriticalSection(&pool->sleep_lock);
+}
+
+// Workers push to their own queue, everyone else to the injection queue
+static bool Pool_Push(ThreadPool* pool, const ThreadPoolTask* task) {
+    ThreadPoolWorker* worker = Pool_CurrentWorker(pool);
+    if (!Queue_Push(worker ? &worker->queue : &pool->inject, task)) return false;
+    InterlockedIncrement(&pool->queued);
+    Pool_WakeOne(pool);
+    return true;
+}
+
+static uint32_t Pool_NextVictim(ThreadPool* pool, ThreadPoolWorker* worker) {
+    if (!worker) return 0;
+    uint64_t x = worker->victim_seed;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    worker->victim_seed = x;
+    return (uint32_t)(x % pool->worker_count);
+}
+
+// Highest priority first: own queue, injection queue, then the other workers. Work below
+// `foreign_floor` is taken only from the caller's own queue.
+static bool Pool_Take(ThreadPool* pool, ThreadPoolWorker* worker, uint32_t foreign_floor, ThreadPoolTask* out) {
+    if (Pool_Load(&pool->queued) == 0) return false;
+    uint32_t start = Pool_NextVictim(pool, worker);
+    for (int32_t p = THREAD_POOL_PRIORITY_COUNT - 1; p >= 0; p--) {
+        if (worker && Queue_PopTail(&worker->queue, (uint32_t)p, out)) goto taken;
+        if ((uint32_t)p < foreign_floor) continue;
+        if (Queue_PopHead(&pool->inject, (uint32_t)p, out)) goto taken;
+        for (uint32_t i = 0; i < pool->worker_count; i++) {
+            ThreadPoolWorker* victim = &pool->workers[(start + i) % pool->worker_count];
+            if (victim == worker) continue;
+            if (Queue_PopHead(&victim->queue, (uint32_t)p, out)) {
+                if (worker) worker->stats.stolen++;
+                goto taken;
+            }
+        }
+    }
+    return false;
+taken:
+    InterlockedDecrement(&pool->queued);
+    return true;
+}
+
+static void Group_Complete(ThreadPool* pool, ThreadPoolGroup* group) {
+    if (!group || InterlockedDecrement(&group->pending) != 0) return;
+    // The group may be gone as soon as pending reads 0; only pool state is touched from here
+    EnterCriticalSection(&pool->sleep_lock);
+    WakeAllConditionVariable(&pool->joined);
+    LeaveCriticalSection(&pool->sleep_lock);
+}
+
+static void Pool_Run(ThreadPool* pool, ThreadPoolWorker* worker, ThreadPoolTask* task) {
+    RoleBoundaryContext* bound = RoleBoundary_GetBoundThread();
+    if (task->fn) {
+        task->fn(task->context);
+    } else {
+        // Keep the left half, offer the right half; a thief takes the biggest piece left
+        while (task->end - task->begin > task->grain) {
+            ThreadPoolTask right = *task;
+            right.begin = task->begin + (task->end - task->begin) / 2;
+            InterlockedIncrement(&task->group->pending);
+            if (!Pool_Push(pool, &right)) {
+                InterlockedDecrement(&task->group->pending);
+                break;
+            }
+            if (worker) worker->stats.splits++;
+            task->end = right.begin;
+        }
+        task->range_fn(task->begin, task->end, task->context);
+    }
+    RoleBoundary_BindThread(bound);
+
+    if (worker) worker->stats.executed++;
+    else InterlockedIncrement64(&pool->external_executed);
+    Group_Complete(pool, task->group);
+}
+
+static void Worker_Idle(ThreadPool* pool, ThreadPoolWorker* worker) {
+    EnterCriticalSection(&pool->sleep_lock);
+    InterlockedIncrement(&pool->sleepers);
+    if (Pool_Load(&pool->queued) == 0 && !Pool_Load(&pool->stop)) {
+        // The timeout only covers a wake lost to a count read mid-update
+        SleepConditionVariableCS(&pool->wake, &pool->sleep_lock, THREAD_POOL_IDLE_WAIT_MS);
+        worker->stats.sleeps++;
+    }
+    InterlockedDecrement(&pool->sleepers);
+    LeaveCriticalSection(&pool->sleep_lock);
+}
+
+static DWORD WINAPI ThreadPool_WorkerProc(LPVOID param) {
+    ThreadPoolWorker* worker = (ThreadPoolWorker*)param;
+    ThreadPool* pool = worker->pool;
+    t_worker = worker;
+
+    memset(&worker->role_ctx, 0, sizeof(worker->role_ctx));
+    worker->role_ctx.initialized = true;
+    RoleBoundary_Enter(&worker->role_ctx, "raijin.pool", ROLE_OWNER_RAIJIN);
+    RoleBoundary_BindThread(&worker->role_ctx);
+
+    for (;;) {
+        ThreadPoolTask task;
+        if (Pool_Take(pool, worker, THREAD_POOL_PRIORITY_LOW, &task)) {
+            Pool_Run(pool, worker, &task);
+            continue;
+        }
+        // Drain before exiting so no group is left waiting on a task nobody will run
+        if (Pool_Load(&pool->stop) && Pool_Load(&pool->queued) == 0) break;
+        Worker_Idle(pool, worker);
+    }
+
+    RoleBoundary_BindThread(NULL);
+    RoleBoundary_Exit(&worker->role_ctx, "raijin.pool");
+    t_worker = NULL;
+    return 0;
+}
+
+NTSTATUS ThreadPool_Initialize(ThreadPool* pool, uint32_t workers) {
+    if (!pool) return STATUS_INVALID_PARAMETER;
+    if (pool->initialized) return STATUS_INVALID_DEVICE_STATE;
+    if (workers == 0) {
+        SYSTEM_INFO si;
+        GetSystemInfo(&si);
+        workers = si.dwNumberOfProcessors ? si.dwNumberOfProcessors : 1;
+    }
+    if (workers > THREAD_POOL_MAX_WORKERS) workers = THREAD_POOL_MAX_WORKERS;
+
+    memset(pool, 0, sizeof(ThreadPool));
+    pool->workers = (ThreadPoolWorker*)calloc(workers, sizeof(ThreadPoolWorker));
+    if (!pool->workers) return STATUS_INSUFFICIENT_RESOURCES;
+    if (!Queue_Initialize(&pool->inject)) {
+        free(pool->workers);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    // Every queue exists before any worker can try to steal from it
+    uint32_t queues = 0;
+    for (; queues < workers; queues++) {
+        ThreadPoolWorker* worker = &pool->workers[queues];
+        if (!Queue_Initialize(&worker->queue)) break;
+        worker->pool = pool;
+        worker->index = queues;
+        worker->victim_seed = 0x9E3779B97F4A7C15ull * (queues + 1);
+    }
+    if (queues < workers) {
+        for (uint32_t i = 0; i < queues; i++) Queue_Shutdown(&pool->workers[i].queue);
+        Queue_Shutdown(&pool->inject);
+        free(pool->workers);
+        memset(pool, 0, sizeof(ThreadPool));
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    pool->worker_count = workers;
+    InitializeCriticalSection(&pool->sleep_lock);
+    InitializeConditionVariable(&pool->wake);
+    InitializeConditionVariable(&pool->joined);
+    pool->initialized = true;
+
+    for (uint32_t i = 0; i < workers; i++) {
+        pool->workers[i].thread = CreateThread(NULL, 0, ThreadPool_WorkerProc, &pool->workers[i], 0, NULL);
+        if (!pool->workers[i].thread) {
+            // Workers that never started keep empty queues; stealing from them is harmless
+            ThreadPool_Shutdown(pool);
+            return STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+    return STATUS_SUCCESS;
+}
+
+void ThreadPool_Shutdown(ThreadPool* pool) {
+    if (!pool || !pool->initialized) return;
+    InterlockedExchange(&pool->stop, 1);
+    EnterCriticalSection(&pool->sleep_lock);
+    WakeAllConditionVariable(&pool->wake);
+    LeaveCriticalSection(&pool->sleep_lock);
+
+    HANDLE handles[THREAD_POOL_MAX_WORKERS];
+    uint32_t started = 0;
+    for (uint32_t i = 0; i < pool->worker_count; i++) {
+        if (pool->workers[i].thread) handles[started++] = pool->workers[i].thread;
+    }
+    if (started) WaitForMultipleObjects(started, handles, TRUE, INFINITE);
+
+    for (uint32_t i = 0; i < pool->worker_count; i++) {
+        if (pool->workers[i].thread) CloseHandle(pool->workers[i].thread);
+        Queue_Shutdown(&pool->workers[i].queue);
+    }
+    Queue_Shutdown(&pool->inject);
+    DeleteCriticalSection(&pool->sleep_lock);
+    free(pool->workers);
+    memset(pool, 0, sizeof(ThreadPool));
+}
+
+NTSTATUS ThreadPool_InitializeGlobal(uint32_t workers) {
+    if (InterlockedCompareExchange(&g_pool_state, 1, 0) != 0) return STATUS_INVALID_DEVICE_STATE;
+    NTSTATUS status = ThreadPool_Initialize(&g_pool, workers);
+    InterlockedExchange(&g_pool_state, NT_SUCCESS(status) ? 2 : 3);
+    return status;
+}
+
+ThreadPool* ThreadPool_GetGlobal(void) {
+    LONG state = InterlockedCompareExchange(&g_pool_state, 0, 0);
+    if (state == 0) {
+        ThreadPool_InitializeGlobal(0);
+        state = InterlockedCompareExchange(&g_pool_state, 0, 0);
+    }
+    while (state == 1) {
+        SwitchToThread();
+        state = InterlockedCompareExchange(&g_pool_state, 0, 0);
+    }
+    return state == 2 ? &g_pool : NULL;
+}
+
+void ThreadPool_ShutdownGlobal(void) {
+    if (InterlockedCompareExchange(&g_pool_state, 3, 2) != 2) return;
+    ThreadPool_Shutdown(&g_pool);
+}
+
+NTSTATUS ThreadPool_Submit(ThreadPool* pool, ThreadPoolTaskFn fn, void* context,
+    ThreadPoolPriority priority, ThreadPoolGroup* group) {
+    if (!fn || (uint32_t)priority >= THREAD_POOL_PRIORITY_COUNT) return STATUS_INVALID_PARAMETER;
+    if (!pool || !pool->initialized) {
+        RoleBoundaryContext* bound = RoleBoundary_GetBoundThread();
+        fn(context);
+        RoleBoundary_BindThread(bound);
+        return STATUS_SUCCESS;
+    }
+
+    ThreadPoolTask task;
+    memset(&task, 0, sizeof(task));
+    task.fn = fn;
+    task.context = context;
+    task.group = group;
+    task.priority = priority;
+    if (group) InterlockedIncrement(&group->pending);
+    if (!Pool_Push(pool, &task)) {
+        InterlockedIncrement64(&pool->inline_runs);
+        Pool_Run(pool, Pool_CurrentWorker(pool), &task);
+    }
+    return STATUS_SUCCESS;
+}
+
+void ThreadPool_Wait(ThreadPool* pool, ThreadPoolGroup* group) {
+    if (!group || !pool || !pool->initialized) return;
+    ThreadPoolWorker* worker = Pool_CurrentWorker(pool);
+    while (Pool_Load(&group->pending) > 0) {
+        ThreadPoolTask task;
+        if (Pool_Take(pool, worker, THREAD_POOL_PRIORITY_NORMAL, &task)) {
+            Pool_Run(pool, worker, &task);
+            continue;
+        }
+        EnterCriticalSection(&pool->sleep_lock);
+        if (Pool_Load(&group->pending) > 0) SleepConditionVariableCS(&pool->joined, &pool->sleep_lock, THREAD_POOL_JOIN_WAIT_MS);
+        LeaveCriticalSection(&pool->sleep_lock);
+    }
+}
+
+NTSTATUS ThreadPool_ParallelFor(ThreadPool* pool, uint64_t begin, uint64_t end, uint64_t grain,
+    ThreadPoolRangeFn fn, void* context, ThreadPoolPriority priority) {
+    if (!fn || (uint32_t)priority >= THREAD_POOL_PRIORITY_COUNT) return STATUS_INVALID_PARAMETER;
+    if (begin >= end) return STATUS_SUCCESS;
+    if (!pool || !pool->initialized) {
+        RoleBoundaryContext* bound = RoleBoundary_GetBoundThread();
+        fn(begin, end, context);
+        RoleBoundary_BindThread(bound);
+        return STATUS_SUCCESS;
+    }
+    if (grain == THREAD_POOL_AUTO_GRAIN) grain = (end - begin) / ((uint64_t)pool->worker_count * 4);
+    if (grain == 0) grain = 1;
+
+    // The caller works the leftmost piece itself while the pool takes the halves it offers
+    ThreadPoolGroup group;
+    group.pending = 1;
+    ThreadPoolTask task;
+    memset(&task, 0, sizeof(task));
+    task.range_fn = fn;
+    task.context = context;
+    task.begin = begin;
+    task.end = end;
+    task.grain = grain;
+    task.group = &group;
+    task.priority = priority;
+    Pool_Run(pool, Pool_CurrentWorker(pool), &task);
+    ThreadPool_Wait(pool, &group);
+    return STATUS_SUCCESS;
+}
+
+uint32_t ThreadPool_GetWorkerCount(const ThreadPool* pool) {
+    return (pool && pool->initialized) ? pool->worker_count : 1;
+}
+
+void ThreadPool_GetStats(const ThreadPool* pool, ThreadPoolStats* out) {
+    if (!out) return;
+    memset(out, 0, sizeof(ThreadPoolStats));
+    if (!pool || !pool->initialized) return;
+    out->workers = pool->worker_count;
+    for (uint32_t i = 0; i < pool->worker_count; i++) {
+        const ThreadPoolWorkerStats* s = &pool->workers[i].stats;
+        out->executed += s->executed;
+        out->stolen += s->stolen;
+        out->splits += s->splits;
+        out->sleeps += s->sleeps;
+    }
+    out->executed += (uint64_t)pool->external_executed;
+    out->inline_runs = (uint64_t)pool->inline_runs;
+    LONG queued = Pool_Load((volatile LONG*)&pool->queued);
+    out->queued = queued > 0 ? (uint32_t)queued : 0;
+}
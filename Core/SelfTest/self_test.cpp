@@ -1,7 +1,22 @@
+#include <winsock2.h>
+#include <ws2tcpip.h>
 #include "../../Include/self_test.h"
 #include "../../Include/neural_substrate.h"
 #include "../../Include/evolution_engine.h"
+#include "../../Include/evolution_checkpoint.h"
+#include "../../Include/evolution_diversity.h"
+#include "../../Include/evolution_map_elites.h"
+#include "../../Include/evolution_remote.h"
+#include "../../Include/evolution_selection.h"
+#include "../../Include/evolution_surrogate.h"
 #include "../../Include/training_pipeline.h"
+#include "../../Include/training_dataparallel.h"
+#include "../../Include/training_pbt.h"
+#include "../../Include/training_replay.h"
+#include "../../Include/thread_pool.h"
+#include "../../Include/qpc_clock.h"
+#include "../../Include/task_scheduler.h"
+#include "../../Include/startup_graph.h"
 #include "../../Include/role_boundary.h"
 #include "../../Include/task_oracle.h"
 #include "../../Include/curriculum.h"
@@ -9,6 +24,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include <time.h>
 #include <windows.h>
 
@@ -333,8 +349,1344 @@ static NTSTATUS Test_ResourceGovernor_ResetThrottle(SelfTestReport* report) {
     return STATUS_SUCCESS;
 }
 
+static NTSTATUS Test_EvolutionNoveltyKnn(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    EvolutionEngine engine;
+    memset(&engine, 0, sizeof(engine));
+    EvolutionParameters params;
+    memset(&params, 0, sizeof(params));
+    params.population_size = 2;
+    params.tournament_size = 2;
+    NTSTATUS status = EvolutionEngine_Initialize(&engine, &params, NULL, NULL);
+    if (NT_SUCCESS(status)) status = EvolutionEngine_EnableNoveltySearch(&engine, 64);
+    if (!NT_SUCCESS(status)) {
+        EvolutionEngine_Shutdown(&engine);
+        SelfTestReport_Add(report, "EvolutionEngine_NoveltyKnn", false, "Init failed", GetTimeMs() - t0);
+        return status;
+    }
+    engine.novelty_archive.k_neighbors = 3;
+
+    // Points on a diagonal: distance between rows i and j is 4*|i-j| at dim 16
+    float point[EVOLUTION_NOVELTY_DEFAULT_DIM];
+    for (uint32_t i = 0; i < 80; i++) {
+        for (uint32_t d = 0; d < EVOLUTION_NOVELTY_DEFAULT_DIM; d++) point[d] = (float)(i % 64);
+        EvolutionEngine_AddToNoveltyArchive(&engine, point);
+    }
+    for (uint32_t d = 0; d < EVOLUTION_NOVELTY_DEFAULT_DIM; d++) point[d] = 0.0f;
+    double novelty = EvolutionEngine_CalculateNovelty(&engine, point);
+
+    // 80 insertions into 64 slots wrap the ring; nearest rows to the origin are 0, 1, 2
+    bool ok = engine.novelty_archive.size == 64 &&
+              engine.novelty_archive.total_insertions == 80 &&
+              engine.novelty_archive.next_slot == 16 &&
+              fabs(novelty - 4.0) < 1e-4;
+    EvolutionEngine_Shutdown(&engine);
+    SelfTestReport_Add(report, "EvolutionEngine_NoveltyKnn", ok, ok ? "OK" : "kNN mismatch", GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+// Genome i of the population belongs to cluster i % 3; clusters are 1.0 apart per gene,
+// members of a cluster 0.001 apart
+static void SpeciationTest_InitGenome(void* genome, size_t genome_size, void* context) {
+    uint32_t index = (*(uint32_t*)context)++;
+    double* weights = (double*)genome;
+    for (size_t i = 0; i < genome_size / sizeof(double); i++)
+        weights[i] = (double)(index % 3) + 0.001 * (double)(index / 3);
+}
+
+// Speciate splits the clusters into one species each and keeps them stable on a second pass
+static NTSTATUS Test_EvolutionSpeciation(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    EvolutionEngine engine;
+    memset(&engine, 0, sizeof(engine));
+    EvolutionParameters params;
+    memset(&params, 0, sizeof(params));
+    params.population_size = 12;
+    params.tournament_size = 2;
+    params.speciation_enabled = true;
+    params.species_count = 3;
+    params.rng_seed = 27;
+    uint32_t next_genome = 0;
+    NTSTATUS status = EvolutionEngine_Initialize(&engine, &params, NULL, NULL);
+    if (NT_SUCCESS(status)) status = EvolutionEngine_SetGenomeInitializer(&engine, SpeciationTest_InitGenome, &next_genome);
+    if (NT_SUCCESS(status)) status = EvolutionEngine_InitializePopulation(&engine);
+    if (NT_SUCCESS(status)) status = EvolutionEngine_Speciate(&engine);
+    if (!NT_SUCCESS(status)) {
+        EvolutionEngine_Shutdown(&engine);
+        SelfTestReport_Add(report, "EvolutionEngine_Speciation", false, "Setup failed", GetTimeMs() - t0);
+        return status;
+    }
+
+    bool ok = engine.species_count == 3;
+    for (uint32_t s = 0; ok && s < engine.species_count; s++) {
+        const EvolutionarySpecies* species = &engine.species[s];
+        ok = species->member_count == 4 && species->id == s + 1;
+        double cluster = floor(((const double*)species->members[0]->genome)[0]);
+        for (uint32_t m = 0; ok && m < species->member_count; m++)
+            ok = floor(((const double*)species->members[m]->genome)[0]) == cluster;
+    }
+    // On target: the threshold is left alone, and a second pass founds no new species
+    ok = ok && engine.params.compatibility_threshold == EVOLUTION_SPECIES_DEFAULT_THRESHOLD;
+    ok = ok && NT_SUCCESS(EvolutionEngine_Speciate(&engine)) &&
+         engine.species_count == 3 && engine.next_species_id == 3;
+
+    // Weight term is the mean |w1 - w2|; genes past the shorter genome count 1 each
+    double a[5] = { 1, 2, 3, 4, 5 }, b[5] = { 1, 2, 3, 4, 7 };
+    ok = ok && fabs(EvolutionEngine_CompatibilityDistance(a, sizeof(a), b, sizeof(b)) - 0.4) < 1e-12 &&
+         fabs(EvolutionEngine_CompatibilityDistance(a, sizeof(a), a, 4 * sizeof(double)) - 0.2) < 1e-12;
+
+    EvolutionEngine_Shutdown(&engine);
+    SelfTestReport_Add(report, "EvolutionEngine_Speciation", ok, ok ? "OK" : "Species mismatch", GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define DIVERSITY_TEST_INDIVIDUALS 40
+#define DIVERSITY_TEST_GENES 99                 /* odd, so the SIMD tails are exercised too */
+#define DIVERSITY_TEST_TOLERANCE 0.05           /* relative, for the 32-projection distance sketch */
+#define DIVERSITY_TEST_MINHASH_TOLERANCE 0.05   /* absolute, for the 64-bucket Jaccard estimate */
+
+// Exact O(n^2 * d) references: mean Euclidean and squared distance, and mean (gene, value) Jaccard
+static void DiversityTest_Exact(const EvolutionaryIndividual* individuals, double* distance,
+                                double* sq_distance, double* jaccard) {
+    const uint32_t n = DIVERSITY_TEST_INDIVIDUALS;
+    double pairs = 0.5 * n * (n - 1.0);
+    *distance = *sq_distance = *jaccard = 0.0;
+    for (uint32_t i = 0; i < n; i++) {
+        const double* x = (const double*)individuals[i].genome;
+        for (uint32_t j = i + 1; j < n; j++) {
+            const double* y = (const double*)individuals[j].genome;
+            double d2 = 0.0;
+            uint32_t equal = 0;
+            for (uint32_t k = 0; k < DIVERSITY_TEST_GENES; k++) {
+                d2 += (x[k] - y[k]) * (x[k] - y[k]);
+                equal += x[k] == y[k];
+            }
+            *distance += sqrt(d2);
+            *sq_distance += d2;
+            *jaccard += equal / (2.0 * DIVERSITY_TEST_GENES - equal);
+        }
+    }
+    *distance /= pairs;
+    *sq_distance /= pairs;
+    *jaccard /= pairs;
+}
+
+// The sketched mean pairwise distance and the MinHash similarity stay within the stated
+// tolerances of the exact pairwise values; the moment-based fields match exactly
+static NTSTATUS Test_EvolutionDiversityApproximation(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    double* genomes = (double*)malloc((size_t)DIVERSITY_TEST_INDIVIDUALS * DIVERSITY_TEST_GENES * sizeof(double));
+    if (!genomes) {
+        SelfTestReport_Add(report, "EvolutionDiversity_Approximation", false, "Alloc failed", GetTimeMs() - t0);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    EvolutionaryIndividual individuals[DIVERSITY_TEST_INDIVIDUALS];
+    memset(individuals, 0, sizeof(individuals));
+    for (uint32_t i = 0; i < DIVERSITY_TEST_INDIVIDUALS; i++) {
+        individuals[i].genome = genomes + (size_t)i * DIVERSITY_TEST_GENES;
+        individuals[i].genome_size = DIVERSITY_TEST_GENES * sizeof(double);
+    }
+
+    // Continuous genomes with a per-individual spread, so pairwise distances vary
+    EvolutionRng rng;
+    EvolutionRng_Seed(&rng, 31);
+    for (uint32_t i = 0; i < DIVERSITY_TEST_INDIVIDUALS; i++) {
+        double spread = 0.5 + 2.0 * EvolutionRng_NextDouble(&rng);
+        for (uint32_t k = 0; k < DIVERSITY_TEST_GENES; k++)
+            genomes[(size_t)i * DIVERSITY_TEST_GENES + k] = spread * (EvolutionRng_NextDouble(&rng) - 0.5);
+    }
+    double distance, sq_distance, jaccard;
+    DiversityTest_Exact(individuals, &distance, &sq_distance, &jaccard);
+    EvolutionDiversityStats stats;
+    NTSTATUS status = EvolutionDiversity_Compute(individuals, DIVERSITY_TEST_INDIVIDUALS, 0, &stats);
+    bool ok = NT_SUCCESS(status) && stats.individuals == DIVERSITY_TEST_INDIVIDUALS &&
+              stats.genes == DIVERSITY_TEST_GENES && stats.minhash_similarity == -1.0 &&
+              fabs(stats.mean_pairwise_sq_distance - sq_distance) < 1e-9 * sq_distance &&
+              fabs(stats.mean_gene_variance * DIVERSITY_TEST_GENES * 2.0 * DIVERSITY_TEST_INDIVIDUALS /
+                   (DIVERSITY_TEST_INDIVIDUALS - 1.0) - sq_distance) < 1e-9 * sq_distance &&
+              fabs(stats.mean_pairwise_distance - distance) < DIVERSITY_TEST_TOLERANCE * distance;
+
+    // Discrete genomes: four alleles per gene, individual i copying a shared parent with
+    // probability i / n, so pairwise overlap ranges from near-clones to unrelated
+    EvolutionRng_Seed(&rng, 3131);
+    double parent[DIVERSITY_TEST_GENES];
+    for (uint32_t k = 0; k < DIVERSITY_TEST_GENES; k++) parent[k] = (double)EvolutionRng_NextBelow(&rng, 4);
+    for (uint32_t i = 0; i < DIVERSITY_TEST_INDIVIDUALS; i++) {
+        double keep = (double)i / DIVERSITY_TEST_INDIVIDUALS;
+        for (uint32_t k = 0; k < DIVERSITY_TEST_GENES; k++)
+            genomes[(size_t)i * DIVERSITY_TEST_GENES + k] = EvolutionRng_NextDouble(&rng) < keep ?
+                parent[k] : (double)EvolutionRng_NextBelow(&rng, 4);
+    }
+    DiversityTest_Exact(individuals, &distance, &sq_distance, &jaccard);
+    status = EvolutionDiversity_Compute(individuals, DIVERSITY_TEST_INDIVIDUALS, EVOLUTION_DIVERSITY_MINHASH, &stats);
+    ok = ok && NT_SUCCESS(status) &&
+         fabs(stats.mean_pairwise_sq_distance - sq_distance) < 1e-9 * sq_distance &&
+         fabs(stats.mean_pairwise_distance - distance) < DIVERSITY_TEST_TOLERANCE * distance &&
+         fabs(stats.minhash_similarity - jaccard) < DIVERSITY_TEST_MINHASH_TOLERANCE;
+
+    free(genomes);
+    SelfTestReport_Add(report, "EvolutionDiversity_Approximation", ok,
+        ok ? "OK" : "Estimate outside tolerance of the exact pairwise values", GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+// Four thread workers with a ring allreduce must land on the same weights as one worker
+static NTSTATUS Test_TrainingDataParallelEquivalence(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    NeuralSubstrate* single = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+    NeuralSubstrate* parallel = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+    NTSTATUS status = (single && parallel) ? NeuralSubstrate_Initialize(single) : STATUS_INSUFFICIENT_RESOURCES;
+    if (NT_SUCCESS(status)) status = NeuralSubstrate_CreateReplica(parallel, single);
+
+    TrainingDataParallelConfig config;
+    TrainingDataParallel_GetDefaultConfig(&config);
+    config.steps = 3;
+    config.batch = 8;
+    TrainingDataParallelStats stats;
+    double max_diff = 0.0;
+    if (NT_SUCCESS(status)) status = TrainingDataParallel_Run(&config, single, &stats);
+    config.workers = 4;
+    if (NT_SUCCESS(status)) status = TrainingDataParallel_Run(&config, parallel, &stats);
+    if (NT_SUCCESS(status)) status = TrainingDataParallel_CompareWeights(single, parallel, &max_diff);
+
+    bool ok = NT_SUCCESS(status) && max_diff <= TRAINING_DP_VERIFY_TOLERANCE;
+    if (parallel && parallel->initialized) NeuralSubstrate_Shutdown(parallel);
+    if (single && single->initialized) NeuralSubstrate_Shutdown(single);
+    free(parallel);
+    free(single);
+    SelfTestReport_Add(report, "TrainingDataParallel_Equivalence", ok,
+        ok ? "OK" : (NT_SUCCESS(status) ? "Weights diverged" : "Run failed"), GetTimeMs() - t0);
+    return status;
+}
+
+static void ThreadPoolTest_Sum(uint64_t begin, uint64_t end, void* context) {
+    LONG64 sum = 0;
+    for (uint64_t i = begin; i < end; i++) sum += (LONG64)i;
+    InterlockedExchangeAdd64((volatile LONG64*)context, sum);
+}
+
+static void ThreadPoolTest_Nested(void* context) {
+    // A task that splits its own work and joins it must not deadlock the pool
+    ThreadPool_ParallelFor(ThreadPool_GetGlobal(), 0, 1000, 16, ThreadPoolTest_Sum, context,
+        THREAD_POOL_PRIORITY_NORMAL);
+}
+
+// Every index of a ParallelFor is visited exactly once, also from inside pool tasks
+static NTSTATUS Test_ThreadPoolParallelFor(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    ThreadPool* pool = ThreadPool_GetGlobal();
+    volatile LONG64 sum = 0;
+    ThreadPool_ParallelFor(pool, 0, 100000, THREAD_POOL_AUTO_GRAIN, ThreadPoolTest_Sum, (void*)&sum,
+        THREAD_POOL_PRIORITY_NORMAL);
+    bool ok = sum == (LONG64)100000 * 99999 / 2;
+
+    ThreadPoolGroup group;
+    memset(&group, 0, sizeof(group));
+    sum = 0;
+    for (uint32_t i = 0; i < 16; i++) {
+        ThreadPool_Submit(pool, ThreadPoolTest_Nested, (void*)&sum, THREAD_POOL_PRIORITY_NORMAL, &group);
+    }
+    ThreadPool_Wait(pool, &group);
+    ok = ok && sum == (LONG64)16 * 1000 * 999 / 2;
+
+    SelfTestReport_Add(report, "ThreadPool_ParallelFor", ok, ok ? "OK" : "Range sum mismatch", GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define SCHEDULER_TEST_TASKS 8
+#define SCHEDULER_TEST_MAX_RUNS 64
+#define SCHEDULER_TEST_TIMEOUT_MS 2000
+
+typedef struct SchedulerTest SchedulerTest;
+
+typedef struct SchedulerTestSlot {
+    SchedulerTest* test;
+    uint32_t id;
+} SchedulerTestSlot;
+
+struct SchedulerTest {
+    TaskScheduler scheduler;
+    SchedulerTestSlot slots[SCHEDULER_TEST_TASKS];
+    uint32_t runs[SCHEDULER_TEST_TASKS];
+    uint32_t order[SCHEDULER_TEST_MAX_RUNS];     /* task ids in the order they ran */
+    uint32_t ran;
+    bool queued_while_running;
+};
+
+static void SchedulerTest_Record(void* context) {
+    SchedulerTestSlot* slot = (SchedulerTestSlot*)context;
+    SchedulerTest* test = slot->test;
+    test->runs[slot->id]++;
+    if (test->ran < SCHEDULER_TEST_MAX_RUNS) test->order[test->ran] = slot->id;
+    test->ran++;
+}
+
+// Triggers itself on its first run, while the scheduler still has it marked running
+static void SchedulerTest_Retrigger(void* context) {
+    SchedulerTestSlot* slot = (SchedulerTestSlot*)context;
+    SchedulerTest_Record(context);
+    if (slot->test->runs[slot->id] == 1) {
+        TaskScheduler_Trigger(&slot->test->scheduler, slot->id, 0);
+        slot->test->queued_while_running = slot->test->scheduler.tasks[slot->id].heap_index >= 0;
+    }
+}
+
+static SchedulerTest* SchedulerTest_Create(void) {
+    SchedulerTest* test = (SchedulerTest*)calloc(1, sizeof(SchedulerTest));
+    if (!test) return NULL;
+    if (!NT_SUCCESS(TaskScheduler_Initialize(&test->scheduler))) {
+        free(test);
+        return NULL;
+    }
+    for (uint32_t i = 0; i < SCHEDULER_TEST_TASKS; i++) {
+        test->slots[i].test = test;
+        test->slots[i].id = i;
+    }
+    return test;
+}
+
+static void SchedulerTest_Destroy(SchedulerTest* test) {
+    TaskScheduler_Shutdown(&test->scheduler);
+    free(test);
+}
+
+// Task ids are handed out in order, so slot i is the context of the i-th task added
+static bool SchedulerTest_AddPeriodic(SchedulerTest* test, uint64_t period_us, uint64_t first_delay_us,
+    ScheduledTaskPriority priority) {
+    uint32_t id;
+    return NT_SUCCESS(TaskScheduler_AddPeriodic(&test->scheduler, "test", SchedulerTest_Record,
+        &test->slots[test->scheduler.task_count], period_us, first_delay_us, priority, 0, &id));
+}
+
+static bool SchedulerTest_AddTriggered(SchedulerTest* test, TaskSchedulerFn fn) {
+    uint32_t id;
+    return NT_SUCCESS(TaskScheduler_AddTriggered(&test->scheduler, "test", fn,
+        &test->slots[test->scheduler.task_count], SCHEDULED_PRIORITY_NORMAL, 0, &id));
+}
+
+static void SchedulerTest_RunUntil(SchedulerTest* test, uint32_t runs) {
+    uint64_t start = GetTimeMs();
+    while (test->ran < runs && GetTimeMs() - start < SCHEDULER_TEST_TIMEOUT_MS)
+        TaskScheduler_RunOnce(&test->scheduler, TASK_SCHEDULER_MS);
+}
+
+static bool SchedulerTest_HeapValid(const TaskScheduler* scheduler) {
+    for (uint32_t i = 0; i < scheduler->heap_size; i++) {
+        const TaskSchedulerTask* task = &scheduler->tasks[scheduler->heap[i]];
+        if (task->heap_index != (int32_t)i) return false;
+        if (i > 0 && scheduler->tasks[scheduler->heap[(i - 1) / 2]].deadline_us > task->deadline_us) return false;
+    }
+    return true;
+}
+
+// Tasks queued out of order, one of them pushed back by Defer, run earliest deadline first
+static NTSTATUS Test_TaskSchedulerHeapOrder(SelfTestReport* report) {
+    static const uint32_t delays_ms[SCHEDULER_TEST_TASKS] = { 5, 1, 7, 3, 8, 2, 6, 4 };
+    uint64_t t0 = GetTimeMs();
+    SchedulerTest* test = SchedulerTest_Create();
+    bool ok = test != NULL;
+    for (uint32_t i = 0; ok && i < SCHEDULER_TEST_TASKS; i++)
+        ok = SchedulerTest_AddPeriodic(test, TASK_SCHEDULER_SECOND * 3600, delays_ms[i] * TASK_SCHEDULER_MS,
+            SCHEDULED_PRIORITY_NORMAL);
+    ok = ok && test->scheduler.heap_size == SCHEDULER_TEST_TASKS && SchedulerTest_HeapValid(&test->scheduler) &&
+         test->scheduler.heap[0] == 1;
+    // The earliest task moves to the back of the queue
+    ok = ok && NT_SUCCESS(TaskScheduler_Defer(&test->scheduler, 1, 20 * TASK_SCHEDULER_MS)) &&
+         SchedulerTest_HeapValid(&test->scheduler) && test->scheduler.heap[0] == 5;
+
+    uint64_t deadlines[SCHEDULER_TEST_TASKS];
+    for (uint32_t i = 0; ok && i < SCHEDULER_TEST_TASKS; i++) deadlines[i] = test->scheduler.tasks[i].deadline_us;
+    if (ok) SchedulerTest_RunUntil(test, SCHEDULER_TEST_TASKS);
+    ok = ok && test->ran == SCHEDULER_TEST_TASKS && test->order[SCHEDULER_TEST_TASKS - 1] == 1;
+    for (uint32_t i = 1; ok && i < SCHEDULER_TEST_TASKS; i++)
+        ok = deadlines[test->order[i - 1]] < deadlines[test->order[i]];
+
+    if (test) SchedulerTest_Destroy(test);
+    SelfTestReport_Add(report, "TaskScheduler_HeapOrder", ok, ok ? "OK" : "Tasks ran out of deadline order",
+        GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+// A period-0 task is re-armed at once and runs on every dispatch; a long-period one only once
+static NTSTATUS Test_TaskSchedulerPeriodZero(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    SchedulerTest* test = SchedulerTest_Create();
+    bool ok = test && SchedulerTest_AddPeriodic(test, 0, 0, SCHEDULED_PRIORITY_BACKGROUND) &&
+              SchedulerTest_AddPeriodic(test, TASK_SCHEDULER_SECOND * 3600, 0, SCHEDULED_PRIORITY_NORMAL);
+    for (uint32_t i = 0; ok && i < 3; i++)
+        ok = NT_SUCCESS(TaskScheduler_RunOnce(&test->scheduler, 0)) && test->runs[0] == i + 1 &&
+             test->scheduler.tasks[0].heap_index >= 0;
+    TaskSchedulerTaskStats stats;
+    ok = ok && test->runs[1] == 1 && NT_SUCCESS(TaskScheduler_GetTaskStats(&test->scheduler, 0, &stats)) &&
+         stats.runs == 3 && stats.skipped_periods == 0;
+
+    if (test) SchedulerTest_Destroy(test);
+    SelfTestReport_Add(report, "TaskScheduler_PeriodZero", ok, ok ? "OK" : "Period-0 task not re-armed",
+        GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+// Triggering a queued task moves it, never duplicates it; a trigger while it runs queues one rerun
+static NTSTATUS Test_TaskSchedulerTrigger(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    SchedulerTest* test = SchedulerTest_Create();
+    bool ok = test && SchedulerTest_AddTriggered(test, SchedulerTest_Record) &&
+              SchedulerTest_AddTriggered(test, SchedulerTest_Retrigger);
+    TaskScheduler* scheduler = ok ? &test->scheduler : NULL;
+
+    ok = ok && NT_SUCCESS(TaskScheduler_Trigger(scheduler, 0, TASK_SCHEDULER_SECOND)) &&
+         NT_SUCCESS(TaskScheduler_Trigger(scheduler, 0, TASK_SCHEDULER_SECOND * 2)) && scheduler->heap_size == 1;
+    uint64_t later = ok ? scheduler->tasks[0].deadline_us : 0;
+    ok = ok && NT_SUCCESS(TaskScheduler_Trigger(scheduler, 0, 0)) && scheduler->heap_size == 1 &&
+         scheduler->tasks[0].deadline_us < later;
+    ok = ok && NT_SUCCESS(TaskScheduler_RunOnce(scheduler, 0)) && test->runs[0] == 1 &&
+         scheduler->tasks[0].heap_index < 0 && scheduler->heap_size == 0;
+    ok = ok && NT_SUCCESS(TaskScheduler_RunOnce(scheduler, 0)) && test->runs[0] == 1;
+
+    ok = ok && NT_SUCCESS(TaskScheduler_Trigger(scheduler, 1, 0)) && NT_SUCCESS(TaskScheduler_RunOnce(scheduler, 0)) &&
+         test->runs[1] == 1 && !test->queued_while_running && scheduler->tasks[1].heap_index >= 0;
+    ok = ok && NT_SUCCESS(TaskScheduler_RunOnce(scheduler, 0)) && test->runs[1] == 2 &&
+         scheduler->tasks[1].heap_index < 0 && !scheduler->tasks[1].trigger_pending;
+    ok = ok && NT_SUCCESS(TaskScheduler_RunOnce(scheduler, 0)) && test->runs[1] == 2;
+
+    if (test) SchedulerTest_Destroy(test);
+    SelfTestReport_Add(report, "TaskScheduler_Trigger", ok, ok ? "OK" : "Trigger queued a duplicate or lost a rerun",
+        GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+// Tasks that are not armed never run: untriggered, not yet due, or anything once stopped
+static NTSTATUS Test_TaskSchedulerSkipsInactive(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    SchedulerTest* test = SchedulerTest_Create();
+    bool ok = test && SchedulerTest_AddTriggered(test, SchedulerTest_Record) &&
+              SchedulerTest_AddPeriodic(test, TASK_SCHEDULER_SECOND * 3600, 0, SCHEDULED_PRIORITY_NORMAL) &&
+              SchedulerTest_AddPeriodic(test, TASK_SCHEDULER_SECOND * 3600, TASK_SCHEDULER_SECOND * 3600,
+                  SCHEDULED_PRIORITY_NORMAL);
+    for (uint32_t i = 0; ok && i < 4; i++) ok = NT_SUCCESS(TaskScheduler_RunOnce(&test->scheduler, TASK_SCHEDULER_MS));
+    ok = ok && test->runs[0] == 0 && test->runs[1] == 1 && test->runs[2] == 0;
+
+    ok = ok && NT_SUCCESS(TaskScheduler_Trigger(&test->scheduler, 0, 0));
+    if (ok) TaskScheduler_Stop(&test->scheduler);
+    ok = ok && TaskScheduler_RunOnce(&test->scheduler, 0) == STATUS_CANCELLED && test->runs[0] == 0;
+
+    if (test) SchedulerTest_Destroy(test);
+    SelfTestReport_Add(report, "TaskScheduler_SkipsInactive", ok, ok ? "OK" : "An inactive task ran",
+        GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define SCHEDULER_TEST_DISPATCH_US (10 * TASK_SCHEDULER_MS)
+
+typedef struct SchedulerTestBudget {
+    SchedulerTestSlot slot;
+    uint64_t max_time_left_us;
+} SchedulerTestBudget;
+
+static void SchedulerTest_RecordTimeLeft(void* context) {
+    SchedulerTestBudget* budget = (SchedulerTestBudget*)context;
+    SchedulerTest_Record(&budget->slot);
+    uint64_t left = TaskScheduler_TimeLeft(&budget->slot.test->scheduler);
+    if (left > budget->max_time_left_us) budget->max_time_left_us = left;
+}
+
+// A task expected to overrun the dispatch deadline is put off, still due, until the cap on
+// deferrals makes it run; nothing is dropped, and its estimate then learns from the real run
+static NTSTATUS Test_TaskSchedulerDispatchDeferral(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    SchedulerTest* test = SchedulerTest_Create();
+    SchedulerTestBudget budget;
+    memset(&budget, 0, sizeof(budget));
+    bool ok = test != NULL;
+    uint32_t light = 0, heavy = 1;
+    if (ok) {
+        // Runs first on every dispatch, so the heavy task is never the first of its dispatch
+        budget.slot.test = test;
+        budget.slot.id = light;
+        TaskScheduler_SetDispatchBudget(&test->scheduler, SCHEDULER_TEST_DISPATCH_US);
+        ok = NT_SUCCESS(TaskScheduler_AddPeriodic(&test->scheduler, "light", SchedulerTest_RecordTimeLeft, &budget,
+                 0, 0, SCHEDULED_PRIORITY_HIGH, 0, &light)) &&
+             SchedulerTest_AddPeriodic(test, TASK_SCHEDULER_SECOND * 3600, 0, SCHEDULED_PRIORITY_LOW) &&
+             NT_SUCCESS(TaskScheduler_SetExpectedCost(&test->scheduler, heavy, TASK_SCHEDULER_SECOND));
+    }
+    uint64_t deadline = ok ? test->scheduler.tasks[heavy].deadline_us : 0;
+    for (uint32_t i = 0; ok && i < TASK_SCHEDULER_MAX_DEFERRALS; i++) {
+        ok = NT_SUCCESS(TaskScheduler_RunOnce(&test->scheduler, 0)) && test->runs[light] == i + 1 &&
+             test->runs[heavy] == 0 && test->scheduler.tasks[heavy].heap_index >= 0 &&
+             test->scheduler.tasks[heavy].deadline_us == deadline;
+    }
+    ok = ok && NT_SUCCESS(TaskScheduler_RunOnce(&test->scheduler, 0)) && test->runs[heavy] == 1;
+
+    TaskSchedulerTaskStats stats;
+    TaskSchedulerStats totals;
+    ok = ok && NT_SUCCESS(TaskScheduler_GetTaskStats(&test->scheduler, heavy, &stats)) &&
+         stats.deferrals == TASK_SCHEDULER_MAX_DEFERRALS && stats.estimate_us < TASK_SCHEDULER_SECOND;
+    if (ok) TaskScheduler_GetStats(&test->scheduler, &totals);
+    ok = ok && totals.deferrals == TASK_SCHEDULER_MAX_DEFERRALS &&
+         budget.max_time_left_us > 0 && budget.max_time_left_us <= SCHEDULER_TEST_DISPATCH_US;
+    // Outside a task there is no deadline to measure against
+    ok = ok && TaskScheduler_TimeLeft(&test->scheduler) == TASK_SCHEDULER_UNBOUNDED;
+
+    if (test) SchedulerTest_Destroy(test);
+    SelfTestReport_Add(report, "TaskScheduler_DispatchDeferral", ok, ok ? "OK" : "Over-budget task dropped or not deferred",
+        GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define STARTUP_TEST_NODES 8
+
+typedef struct StartupTestNode {
+    volatile LONG* clock;
+    volatile LONG seq;                   /* position in the order the nodes ran; 0 = never ran */
+    volatile LONG runs;
+    DWORD thread;
+    NTSTATUS result;
+} StartupTestNode;
+
+typedef struct StartupTest {
+    StartupGraph graph;
+    StartupTestNode nodes[STARTUP_TEST_NODES];
+    volatile LONG clock;
+} StartupTest;
+
+static NTSTATUS StartupTest_Run(void* context) {
+    StartupTestNode* node = (StartupTestNode*)context;
+    node->thread = GetCurrentThreadId();
+    InterlockedIncrement(&node->runs);
+    InterlockedExchange(&node->seq, InterlockedIncrement(node->clock));
+    return node->result;
+}
+
+static StartupTest* StartupTest_Create(void) {
+    StartupTest* test = (StartupTest*)calloc(1, sizeof(StartupTest));
+    if (!test) return NULL;
+    if (!NT_SUCCESS(StartupGraph_Initialize(&test->graph))) {
+        free(test);
+        return NULL;
+    }
+    for (uint32_t i = 0; i < STARTUP_TEST_NODES; i++) test->nodes[i].clock = &test->clock;
+    return test;
+}
+
+static void StartupTest_Destroy(StartupTest* test) {
+    StartupGraph_Shutdown(&test->graph);
+    free(test);
+}
+
+// Node ids are handed out in order, so test node i is the context of the i-th node added
+static bool StartupTest_Add(StartupTest* test, uint32_t flags, NTSTATUS result, const uint32_t* deps,
+    uint32_t dep_count) {
+    uint32_t id;
+    StartupTestNode* node = &test->nodes[test->graph.node_count];
+    node->result = result;
+    return NT_SUCCESS(StartupGraph_AddNode(&test->graph, "test", StartupTest_Run, node, flags, deps, dep_count, &id));
+}
+
+// Every node runs once, after all of its dependencies
+static NTSTATUS Test_StartupGraphOrder(SelfTestReport* report) {
+    // 0 -> {1, 2} -> 3 -> 4, with 5 depending on 0 and 4, and 6 and 7 independent
+    static const uint32_t from_0[] = { 0 }, from_12[] = { 1, 2 }, from_3[] = { 3 }, from_04[] = { 0, 4 };
+    uint64_t t0 = GetTimeMs();
+    StartupTest* test = StartupTest_Create();
+    bool ok = test && StartupTest_Add(test, 0, STATUS_SUCCESS, NULL, 0) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, from_0, 1) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, from_0, 1) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, from_12, 2) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, from_3, 1) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, from_04, 2) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, NULL, 0) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, NULL, 0);
+    ok = ok && NT_SUCCESS(StartupGraph_Run(&test->graph, ThreadPool_GetGlobal()));
+    for (uint32_t i = 0; ok && i < STARTUP_TEST_NODES; i++) {
+        const StartupNode* node = &test->graph.nodes[i];
+        ok = test->nodes[i].runs == 1 && node->state == STARTUP_NODE_DONE;
+        for (uint32_t d = 0; ok && d < node->dep_count; d++)
+            ok = test->nodes[node->deps[d]].seq < test->nodes[i].seq;
+    }
+    StartupGraphStats stats;
+    if (ok) StartupGraph_GetStats(&test->graph, &stats);
+    ok = ok && stats.succeeded == STARTUP_TEST_NODES && stats.failed == 0 && stats.skipped == 0;
+
+    if (test) StartupTest_Destroy(test);
+    SelfTestReport_Add(report, "StartupGraph_Order", ok, ok ? "OK" : "A node ran before its dependencies",
+        GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+// A failed required node skips its dependents, and a skipped required node its own in turn; a
+// failed optional node skips nothing
+static NTSTATUS Test_StartupGraphSkipsFailed(SelfTestReport* report) {
+    // 0 required and failing -> 1 required -> 2; 3 optional and failing -> 4; 5 independent
+    static const uint32_t from_0[] = { 0 }, from_1[] = { 1 }, from_3[] = { 3 };
+    uint64_t t0 = GetTimeMs();
+    StartupTest* test = StartupTest_Create();
+    bool ok = test && StartupTest_Add(test, STARTUP_NODE_REQUIRED, STATUS_UNSUCCESSFUL, NULL, 0) &&
+              StartupTest_Add(test, STARTUP_NODE_REQUIRED, STATUS_SUCCESS, from_0, 1) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, from_1, 1) &&
+              StartupTest_Add(test, 0, STATUS_NOT_FOUND, NULL, 0) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, from_3, 1) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, NULL, 0);
+    ok = ok && StartupGraph_Run(&test->graph, ThreadPool_GetGlobal()) == STATUS_UNSUCCESSFUL;
+    const StartupNode* nodes = test ? test->graph.nodes : NULL;
+    ok = ok && nodes[0].state == STARTUP_NODE_FAILED && nodes[3].state == STARTUP_NODE_FAILED &&
+         nodes[1].state == STARTUP_NODE_SKIPPED && nodes[2].state == STARTUP_NODE_SKIPPED &&
+         test->nodes[1].runs == 0 && test->nodes[2].runs == 0 &&
+         nodes[4].state == STARTUP_NODE_DONE && nodes[5].state == STARTUP_NODE_DONE;
+
+    if (test) StartupTest_Destroy(test);
+    SelfTestReport_Add(report, "StartupGraph_SkipsFailed", ok, ok ? "OK" : "Wrong nodes skipped after a failure",
+        GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+// Lazy nodes wait for Ensure, which brings up their lazy dependencies first and runs each once
+static NTSTATUS Test_StartupGraphLazy(SelfTestReport* report) {
+    // 0 eager; 1 lazy on 0; 2 lazy on 1
+    static const uint32_t from_0[] = { 0 }, from_1[] = { 1 };
+    uint64_t t0 = GetTimeMs();
+    StartupTest* test = StartupTest_Create();
+    bool ok = test && StartupTest_Add(test, 0, STATUS_SUCCESS, NULL, 0) &&
+              StartupTest_Add(test, STARTUP_NODE_LAZY, STATUS_SUCCESS, from_0, 1) &&
+              StartupTest_Add(test, STARTUP_NODE_LAZY, STATUS_SUCCESS, from_1, 1);
+    bool ran = true;
+    ok = ok && StartupGraph_Ensure(&test->graph, 2, &ran) == STATUS_INVALID_DEVICE_STATE && !ran;
+    ok = ok && NT_SUCCESS(StartupGraph_Run(&test->graph, ThreadPool_GetGlobal())) &&
+         test->nodes[0].runs == 1 && test->nodes[1].runs == 0 && test->nodes[2].runs == 0 &&
+         test->graph.nodes[2].state == STARTUP_NODE_PENDING;
+    ok = ok && NT_SUCCESS(StartupGraph_Ensure(&test->graph, 2, &ran)) && ran &&
+         test->nodes[1].runs == 1 && test->nodes[2].runs == 1 && test->nodes[1].seq < test->nodes[2].seq &&
+         test->nodes[2].thread == GetCurrentThreadId();
+    ok = ok && NT_SUCCESS(StartupGraph_Ensure(&test->graph, 2, &ran)) && !ran &&
+         NT_SUCCESS(StartupGraph_Ensure(&test->graph, 1, &ran)) && !ran && test->nodes[1].runs == 1;
+    StartupGraphStats stats;
+    if (ok) StartupGraph_GetStats(&test->graph, &stats);
+    ok = ok && stats.lazy_run == 2 && stats.lazy_pending == 0;
+
+    if (test) StartupTest_Destroy(test);
+    SelfTestReport_Add(report, "StartupGraph_Lazy", ok, ok ? "OK" : "Lazy node ran early or more than once",
+        GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+// Caller-thread nodes run on the thread that called Run, wherever their dependencies ran
+static NTSTATUS Test_StartupGraphCallerThread(SelfTestReport* report) {
+    // 0 pool -> 1 caller -> 2 pool -> 3 caller; 4 caller and 5 pool independent
+    static const uint32_t from_0[] = { 0 }, from_1[] = { 1 }, from_2[] = { 2 };
+    uint64_t t0 = GetTimeMs();
+    StartupTest* test = StartupTest_Create();
+    bool ok = test && StartupTest_Add(test, 0, STATUS_SUCCESS, NULL, 0) &&
+              StartupTest_Add(test, STARTUP_NODE_CALLER_THREAD, STATUS_SUCCESS, from_0, 1) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, from_1, 1) &&
+              StartupTest_Add(test, STARTUP_NODE_CALLER_THREAD, STATUS_SUCCESS, from_2, 1) &&
+              StartupTest_Add(test, STARTUP_NODE_CALLER_THREAD, STATUS_SUCCESS, NULL, 0) &&
+              StartupTest_Add(test, 0, STATUS_SUCCESS, NULL, 0);
+    ok = ok && NT_SUCCESS(StartupGraph_Run(&test->graph, ThreadPool_GetGlobal()));
+    DWORD caller = GetCurrentThreadId();
+    for (uint32_t i = 0; ok && i < 6; i++) {
+        ok = test->nodes[i].runs == 1;
+        if (test->graph.nodes[i].flags & STARTUP_NODE_CALLER_THREAD) ok = ok && test->nodes[i].thread == caller;
+    }
+    ok = ok && test->nodes[0].seq < test->nodes[1].seq && test->nodes[2].seq < test->nodes[3].seq;
+
+    if (test) StartupTest_Destroy(test);
+    SelfTestReport_Add(report, "StartupGraph_CallerThread", ok, ok ? "OK" : "Caller-thread node ran elsewhere",
+        GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define REPLAY_TEST_SAMPLES 6                 /* below the 8 tree leaves, so two stay empty */
+#define REPLAY_TEST_DRAWS 60000
+#define REPLAY_TEST_TOLERANCE 0.01            /* absolute, on each slot's share of the draws */
+
+// Sum of the resident leaves, recomputed from scratch
+static double ReplayTest_LeafSum(const TrainingReplay* replay) {
+    double sum = 0.0;
+    for (uint32_t i = 0; i < replay->resident; i++) sum += replay->sum_tree[replay->leaves + i];
+    return sum;
+}
+
+// With alpha = beta = 1 a slot's priority is its loss, its share of the draws is loss / total
+// and its IS weight is min / loss; an update has to reach both roots
+static NTSTATUS Test_TrainingReplayPrioritized(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    TrainingReplayConfig config;
+    TrainingReplay_GetDefaultConfig(&config);
+    config.capacity = REPLAY_TEST_SAMPLES;
+    config.staging = 8;
+    config.min_fill = REPLAY_TEST_SAMPLES;
+    config.alpha = 1.0;
+    config.beta = 1.0;
+    config.beta_steps = 0;
+    config.epsilon = 1e-12;
+    config.seed = 43;
+    TrainingReplay* replay = (TrainingReplay*)calloc(1, sizeof(TrainingReplay));
+    NTSTATUS status = replay ? TrainingReplay_Initialize(replay, &config, 1, 1) : STATUS_INSUFFICIENT_RESOURCES;
+    if (!NT_SUCCESS(status)) {
+        free(replay);
+        SelfTestReport_Add(report, "TrainingReplay_Prioritized", false, "Init failed", GetTimeMs() - t0);
+        return status;
+    }
+
+    double total = 0.0;
+    bool ok = true;
+    for (uint32_t i = 0; ok && i < REPLAY_TEST_SAMPLES; i++) {
+        uint8_t input = (uint8_t)i, target = (uint8_t)(i + 100);
+        ok = NT_SUCCESS(TrainingReplay_Push(replay, &input, &target, (double)(i + 1)));
+        total += (double)(i + 1);
+    }
+    ok = ok && TrainingReplay_Ready(replay) && fabs(replay->sum_tree[1] - total) < 1e-6 &&
+         fabs(replay->min_tree[1] - 1.0) < 1e-6;
+
+    uint32_t counts[REPLAY_TEST_SAMPLES] = { 0 };
+    for (uint32_t d = 0; ok && d < REPLAY_TEST_DRAWS; d++) {
+        uint8_t input = 0xFF, target = 0;
+        uint32_t slot = UINT32_MAX;
+        double weight = 0.0;
+        ok = NT_SUCCESS(TrainingReplay_Draw(replay, &input, &target, &slot, &weight)) && slot < REPLAY_TEST_SAMPLES &&
+             input == slot && target == slot + 100 && fabs(weight - 1.0 / (double)(slot + 1)) < 1e-6;
+        if (ok) counts[slot]++;
+    }
+    for (uint32_t i = 0; ok && i < REPLAY_TEST_SAMPLES; i++)
+        ok = fabs((double)counts[i] / REPLAY_TEST_DRAWS - (double)(i + 1) / total) < REPLAY_TEST_TOLERANCE;
+
+    // Lowest becomes highest and the smallest priority moves to another slot
+    TrainingReplay_UpdatePriority(replay, 0, 20.0);
+    TrainingReplay_UpdatePriority(replay, 3, 0.5);
+    total += 19.0 - 3.5;
+    TrainingReplayStats stats;
+    TrainingReplay_GetStats(replay, &stats);
+    ok = ok && fabs(replay->sum_tree[1] - total) < 1e-6 && fabs(replay->sum_tree[1] - ReplayTest_LeafSum(replay)) < 1e-9 &&
+         fabs(replay->min_tree[1] - 0.5) < 1e-6 && fabs(stats.total_priority - total) < 1e-6 &&
+         stats.priority_updates == 2 && stats.drawn == REPLAY_TEST_DRAWS;
+    for (uint32_t d = 0; ok && d < 1000; d++) {
+        uint8_t input, target;
+        uint32_t slot;
+        double weight;
+        ok = NT_SUCCESS(TrainingReplay_Draw(replay, &input, &target, &slot, &weight)) &&
+             fabs(weight - 0.5 / replay->sum_tree[replay->leaves + slot]) < 1e-6 && weight <= 1.0;
+    }
+
+    TrainingReplay_Shutdown(replay);
+    free(replay);
+    SelfTestReport_Add(report, "TrainingReplay_Prioritized", ok,
+        ok ? "OK" : "Draws, weights or tree roots off", GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define MAP_ELITES_TEST_ITEMS 4096
+
+typedef struct MapElitesTestBatch {
+    MapElitesArchive archive;
+    double genomes[MAP_ELITES_TEST_ITEMS][2];    /* both genes are the item's fitness */
+    const void* genome_ptrs[MAP_ELITES_TEST_ITEMS];
+    float descriptors[MAP_ELITES_TEST_ITEMS * 2];
+    double fitness[MAP_ELITES_TEST_ITEMS];
+} MapElitesTestBatch;
+
+static void MapElitesTest_Insert(uint64_t begin, uint64_t end, void* context) {
+    MapElitesTestBatch* batch = (MapElitesTestBatch*)context;
+    MapElites_InsertBatch(&batch->archive, batch->genome_ptrs + begin, batch->descriptors + 2 * begin,
+        batch->fitness + begin, (uint32_t)(end - begin), NULL);
+}
+
+// Pool tasks racing on the same cells keep each cell's best item, with its genome untorn
+static NTSTATUS Test_MapElitesConcurrentInsert(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    MapElitesTestBatch* batch = (MapElitesTestBatch*)calloc(1, sizeof(MapElitesTestBatch));
+    if (!batch) {
+        SelfTestReport_Add(report, "MapElites_ConcurrentInsert", false, "Out of memory", GetTimeMs() - t0);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    MapElitesConfig config;
+    MapElites_DefaultConfig(&config, 2 * sizeof(double));
+    config.bins_per_dim = 16;
+    config.descriptor_min = 0.0f;
+    config.descriptor_max = 1.0f;
+    NTSTATUS status = MapElites_Initialize(&batch->archive, &config);
+    if (!NT_SUCCESS(status)) {
+        free(batch);
+        SelfTestReport_Add(report, "MapElites_ConcurrentInsert", false, "Init failed", GetTimeMs() - t0);
+        return status;
+    }
+
+    // Distinct fitness per item; the second descriptor stays below 0.5, so half the grid is empty
+    for (uint32_t i = 0; i < MAP_ELITES_TEST_ITEMS; i++) {
+        batch->fitness[i] = (double)((i * 7919u) % MAP_ELITES_TEST_ITEMS) / MAP_ELITES_TEST_ITEMS - 0.5;
+        batch->genomes[i][0] = batch->genomes[i][1] = batch->fitness[i];
+        batch->genome_ptrs[i] = batch->genomes[i];
+        batch->descriptors[2 * i] = (float)((i * 13u) % 101u) / 101.0f;
+        batch->descriptors[2 * i + 1] = (float)((i * 29u) % 103u) / 206.0f;
+    }
+    ThreadPool_ParallelFor(ThreadPool_GetGlobal(), 0, MAP_ELITES_TEST_ITEMS, 64, MapElitesTest_Insert, batch,
+        THREAD_POOL_PRIORITY_NORMAL);
+
+    // Serial reference: the best fitness that landed in each cell
+    uint32_t cells = batch->archive.cell_count;
+    double* best = (double*)malloc(cells * sizeof(double));
+    bool ok = best != NULL;
+    uint32_t filled = 0;
+    if (ok) {
+        for (uint32_t c = 0; c < cells; c++) best[c] = -HUGE_VAL;
+        for (uint32_t i = 0; i < MAP_ELITES_TEST_ITEMS; i++) {
+            uint32_t c = MapElites_CellIndex(&batch->archive, &batch->descriptors[2 * i]);
+            if (best[c] == -HUGE_VAL) filled++;
+            if (batch->fitness[i] > best[c]) best[c] = batch->fitness[i];
+        }
+    }
+    for (uint32_t c = 0; ok && c < cells; c++) {
+        double genome[2], fitness = 0.0;
+        NTSTATUS read = MapElites_ReadElite(&batch->archive, c, genome, &fitness, NULL);
+        if (best[c] == -HUGE_VAL) {
+            ok = read == STATUS_NOT_FOUND;
+        } else {
+            ok = NT_SUCCESS(read) && fitness == best[c] && genome[0] == fitness && genome[1] == fitness;
+        }
+    }
+    MapElitesMetrics metrics;
+    MapElites_GetMetrics(&batch->archive, &metrics);
+    ok = ok && filled > 0 && filled < cells && metrics.filled == filled &&
+         metrics.insertions == MAP_ELITES_TEST_ITEMS && metrics.improvements >= filled;
+
+    free(best);
+    MapElites_Shutdown(&batch->archive);
+    free(batch);
+    SelfTestReport_Add(report, "MapElites_ConcurrentInsert", ok, ok ? "OK" : "Archive mismatch", GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define SURROGATE_TEST_GENES 8
+#define SURROGATE_TEST_TRAIN 256
+#define SURROGATE_TEST_CHECK 64
+
+// Smooth bowl with its optimum at 0.3 on every gene
+static double SurrogateTest_Fitness(const double* genome) {
+    double sum = 0.0;
+    for (uint32_t i = 0; i < SURROGATE_TEST_GENES; i++) sum -= (genome[i] - 0.3) * (genome[i] - 0.3);
+    return sum;
+}
+
+// After a few batches of a smooth function the surrogate ranks fresh genomes close to the truth
+static NTSTATUS Test_EvolutionSurrogateRanking(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    double* genomes = (double*)malloc((SURROGATE_TEST_TRAIN + SURROGATE_TEST_CHECK) * SURROGATE_TEST_GENES * sizeof(double));
+    EvolutionSurrogate surrogate;
+    memset(&surrogate, 0, sizeof(surrogate));
+    EvolutionSurrogateConfig config;
+    memset(&config, 0, sizeof(config));
+    config.features = 64;
+    config.seed = 33;
+    NTSTATUS status = genomes ? EvolutionSurrogate_Initialize(&surrogate, &config, SURROGATE_TEST_GENES)
+                              : STATUS_INSUFFICIENT_RESOURCES;
+    if (!NT_SUCCESS(status)) {
+        free(genomes);
+        SelfTestReport_Add(report, "EvolutionSurrogate_Ranking", false, "Init failed", GetTimeMs() - t0);
+        return status;
+    }
+
+    EvolutionRng rng;
+    EvolutionRng_Seed(&rng, 33);
+    for (uint32_t i = 0; i < (SURROGATE_TEST_TRAIN + SURROGATE_TEST_CHECK) * SURROGATE_TEST_GENES; i++)
+        genomes[i] = EvolutionRng_NextDouble(&rng);
+
+    // Observed in the engine's generation-sized batches
+    const double* rows[32];
+    double fitness[32];
+    for (uint32_t base = 0; NT_SUCCESS(status) && base < SURROGATE_TEST_TRAIN; base += 32) {
+        for (uint32_t i = 0; i < 32; i++) {
+            rows[i] = &genomes[(base + i) * SURROGATE_TEST_GENES];
+            fitness[i] = SurrogateTest_Fitness(rows[i]);
+        }
+        status = EvolutionSurrogate_Observe(&surrogate, rows, fitness, 32);
+    }
+
+    const double* check[SURROGATE_TEST_CHECK];
+    double predicted[SURROGATE_TEST_CHECK], actual[SURROGATE_TEST_CHECK];
+    for (uint32_t i = 0; i < SURROGATE_TEST_CHECK; i++) {
+        check[i] = &genomes[(SURROGATE_TEST_TRAIN + i) * SURROGATE_TEST_GENES];
+        actual[i] = SurrogateTest_Fitness(check[i]);
+    }
+    if (NT_SUCCESS(status)) status = EvolutionSurrogate_PredictBatch(&surrogate, check, SURROGATE_TEST_CHECK, predicted);
+    double fraction_before = surrogate.true_fraction;
+    if (NT_SUCCESS(status)) EvolutionSurrogate_RecordOutcome(&surrogate, predicted, actual, SURROGATE_TEST_CHECK);
+
+    // Good agreement also moves the evaluated fraction towards min_fraction
+    bool ok = NT_SUCCESS(status) && surrogate.trained && surrogate.rank_correlation >= 0.8 &&
+              surrogate.true_fraction < fraction_before;
+    char msg[SELF_TEST_MAX_MESSAGE];
+    snprintf(msg, sizeof(msg), "rank correlation %.3f", surrogate.rank_correlation);
+    EvolutionSurrogate_Shutdown(&surrogate);
+    free(genomes);
+    SelfTestReport_Add(report, "EvolutionSurrogate_Ranking", ok,
+        ok ? "OK" : (NT_SUCCESS(status) ? msg : "Observe or predict failed"), GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define CHECKPOINT_TEST_GENERATIONS 16
+#define CHECKPOINT_TEST_SAVE_AT 6
+
+static double CheckpointTest_Fitness(void* genome, size_t genome_size, void* context) {
+    (void)context;
+    const double* weights = (const double*)genome;
+    size_t count = genome_size / sizeof(double);
+    double sum = 0.0;
+    for (size_t i = 0; i < count; i++) sum -= (weights[i] - 0.3) * (weights[i] - 0.3);
+    return sum / (double)count;
+}
+
+static NTSTATUS CheckpointTest_Setup(EvolutionEngine* engine) {
+    memset(engine, 0, sizeof(*engine));
+    EvolutionParameters params;
+    memset(&params, 0, sizeof(params));
+    params.population_size = 24;
+    params.tournament_size = 3;
+    params.mutation_rate = 0.05;
+    params.crossover_rate = 0.8;
+    params.elitism_rate = 0.1;
+    params.crossover = CROSSOVER_UNIFORM;
+    params.target_fitness = 1e9;
+    params.rng_seed = 34;
+    NTSTATUS status = EvolutionEngine_Initialize(engine, &params, NULL, NULL);
+    if (NT_SUCCESS(status)) status = EvolutionEngine_SetFitnessFunction(engine, CheckpointTest_Fitness, NULL);
+    if (NT_SUCCESS(status)) status = EvolutionEngine_InitializePopulation(engine);
+    return status;
+}
+
+// Records the best fitness of each generation up to `until`
+static NTSTATUS CheckpointTest_Run(EvolutionEngine* engine, uint32_t until, double* trace) {
+    NTSTATUS status = STATUS_SUCCESS;
+    while (NT_SUCCESS(status) && engine->population.generation < until) {
+        status = EvolutionEngine_EvaluatePopulation(engine);
+        if (NT_SUCCESS(status)) {
+            trace[engine->population.generation] = engine->population.best_fitness;
+            status = EvolutionEngine_NextGeneration(engine);
+        }
+    }
+    return status;
+}
+
+// A run resumed from a snapshot follows the uninterrupted run bit for bit; a damaged one is refused
+static NTSTATUS Test_EvolutionCheckpointResume(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    char temp_dir[MAX_PATH], path[MAX_PATH];
+    if (GetTempPathA(MAX_PATH, temp_dir) == 0) strcpy(temp_dir, ".\\");
+    snprintf(path, sizeof(path), "%sraijin_selftest_%lu.evck", temp_dir, (unsigned long)GetCurrentProcessId());
+
+    EvolutionEngine* engines = (EvolutionEngine*)calloc(2, sizeof(EvolutionEngine));
+    if (!engines) {
+        SelfTestReport_Add(report, "EvolutionCheckpoint_Resume", false, "Out of memory", GetTimeMs() - t0);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    EvolutionEngine* straight = &engines[0];
+    EvolutionEngine* resumed = &engines[1];
+    double straight_trace[CHECKPOINT_TEST_GENERATIONS] = {0}, resumed_trace[CHECKPOINT_TEST_GENERATIONS] = {0};
+
+    // The resumed engine saves part way, then is replaced by a fresh one that loads the snapshot
+    NTSTATUS status = CheckpointTest_Setup(straight);
+    if (NT_SUCCESS(status)) status = CheckpointTest_Run(straight, CHECKPOINT_TEST_GENERATIONS, straight_trace);
+    if (NT_SUCCESS(status)) status = CheckpointTest_Setup(resumed);
+    if (NT_SUCCESS(status)) status = CheckpointTest_Run(resumed, CHECKPOINT_TEST_SAVE_AT, resumed_trace);
+    if (NT_SUCCESS(status)) status = EvolutionCheckpoint_Save(resumed, path);
+    EvolutionEngine_Shutdown(resumed);
+    if (NT_SUCCESS(status)) status = CheckpointTest_Setup(resumed);
+    if (NT_SUCCESS(status)) status = EvolutionCheckpoint_Load(resumed, path);
+    bool ok = NT_SUCCESS(status) && resumed->population.generation == CHECKPOINT_TEST_SAVE_AT;
+    if (ok) status = CheckpointTest_Run(resumed, CHECKPOINT_TEST_GENERATIONS, resumed_trace);
+
+    ok = ok && NT_SUCCESS(status) &&
+         memcmp(straight_trace, resumed_trace, sizeof(straight_trace)) == 0 &&
+         straight->population.size == resumed->population.size;
+    // Individual ids come from a process-wide counter, so only genomes and fitness are compared
+    for (uint32_t i = 0; ok && i < straight->population.size; i++) {
+        const EvolutionaryIndividual* a = &straight->population.individuals[i];
+        const EvolutionaryIndividual* b = &resumed->population.individuals[i];
+        ok = a->fitness == b->fitness && a->genome_size == b->genome_size &&
+             memcmp(a->genome, b->genome, a->genome_size) == 0;
+    }
+
+    // One flipped payload byte fails the CRC and leaves the engine where it was
+    bool corrupt_ok = false;
+    FILE* f = ok ? fopen(path, "r+b") : NULL;
+    if (f) {
+        int c = (fseek(f, 512, SEEK_SET) == 0) ? fgetc(f) : EOF;
+        if (c != EOF && fseek(f, 512, SEEK_SET) == 0) fputc(c ^ 0x5A, f);
+        fclose(f);
+        EvolutionEngine_Shutdown(resumed);
+        if (c != EOF && NT_SUCCESS(CheckpointTest_Setup(resumed))) {
+            corrupt_ok = !NT_SUCCESS(EvolutionCheckpoint_Load(resumed, path)) && resumed->population.generation == 0;
+        }
+    }
+    ok = ok && corrupt_ok;
+
+    DeleteFileA(path);
+    EvolutionEngine_Shutdown(resumed);
+    EvolutionEngine_Shutdown(straight);
+    free(engines);
+    SelfTestReport_Add(report, "EvolutionCheckpoint_Resume", ok,
+        ok ? "OK" : (NT_SUCCESS(status) ? "Resumed run diverged" : "Run or snapshot failed"), GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define SELECTION_TEST_COUNT 1000
+#define SELECTION_TEST_SAMPLES 200000
+
+static int SelectionTest_CompareDescending(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x < y) - (x > y);
+}
+
+// TopK agrees with a full sort, ties included; alias sampling follows its weights
+static NTSTATUS Test_EvolutionSelectionTopKAlias(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    double* fitness = (double*)malloc(SELECTION_TEST_COUNT * sizeof(double));
+    double* sorted = (double*)malloc(SELECTION_TEST_COUNT * sizeof(double));
+    uint32_t* indices = (uint32_t*)malloc(SELECTION_TEST_COUNT * sizeof(uint32_t));
+    uint8_t* seen = (uint8_t*)malloc(SELECTION_TEST_COUNT);
+    bool ok = fitness && sorted && indices && seen;
+    if (!ok) {
+        free(fitness);
+        free(sorted);
+        free(indices);
+        free(seen);
+        SelfTestReport_Add(report, "EvolutionSelection_TopKAlias", false, "Out of memory", GetTimeMs() - t0);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    // 50 distinct values, 20 copies each
+    for (uint32_t i = 0; i < SELECTION_TEST_COUNT; i++) fitness[i] = (double)((i * 37u) % 50u) / 10.0 - 2.0;
+    memcpy(sorted, fitness, SELECTION_TEST_COUNT * sizeof(double));
+    qsort(sorted, SELECTION_TEST_COUNT, sizeof(double), SelectionTest_CompareDescending);
+
+    const uint32_t ks[] = { 1, 7, 20, 100, 999, SELECTION_TEST_COUNT };
+    for (uint32_t t = 0; ok && t < sizeof(ks) / sizeof(ks[0]); t++) {
+        uint32_t k = ks[t];
+        EvolutionSelection_TopK(fitness, SELECTION_TEST_COUNT, k, indices);
+        memset(seen, 0, SELECTION_TEST_COUNT);
+        for (uint32_t i = 0; ok && i < SELECTION_TEST_COUNT; i++) {
+            ok = indices[i] < SELECTION_TEST_COUNT && !seen[indices[i]];
+            if (ok) seen[indices[i]] = 1;
+        }
+        for (uint32_t i = 0; ok && i < k; i++) ok = fitness[indices[i]] == sorted[i];
+        for (uint32_t i = k; ok && i < SELECTION_TEST_COUNT; i++) ok = fitness[indices[i]] <= sorted[k - 1];
+    }
+
+    // A zero weight is never drawn; the others within a percent of their share
+    const double weights[] = { 1.0, 2.0, 3.0, 4.0, 0.0, 10.0 };
+    const uint32_t columns = sizeof(weights) / sizeof(weights[0]);
+    EvolutionAliasTable table;
+    memset(&table, 0, sizeof(table));
+    uint32_t hits[sizeof(weights) / sizeof(weights[0])] = {0};
+    if (ok) ok = NT_SUCCESS(EvolutionAlias_Build(&table, weights, columns));
+    if (ok) {
+        EvolutionRng rng;
+        EvolutionRng_Seed(&rng, 35);
+        for (uint32_t i = 0; ok && i < SELECTION_TEST_SAMPLES; i++) {
+            uint32_t column = EvolutionAlias_Sample(&table, &rng);
+            ok = column < columns;
+            if (ok) hits[column]++;
+        }
+    }
+    for (uint32_t c = 0; ok && c < columns; c++) {
+        double share = (double)hits[c] / SELECTION_TEST_SAMPLES;
+        ok = fabs(share - weights[c] / 20.0) < 0.01 && (weights[c] > 0.0 || hits[c] == 0);
+    }
+
+    EvolutionAlias_Free(&table);
+    free(fitness);
+    free(sorted);
+    free(indices);
+    free(seen);
+    SelfTestReport_Add(report, "EvolutionSelection_TopKAlias", ok, ok ? "OK" : "Selection mismatch", GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define BATCH_EVAL_TEST_POPULATION 16
+
+// One batched forward pass scores every genome exactly as one Process call each from the same state
+static NTSTATUS Test_EvolutionBatchEvaluation(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    NeuralSubstrate* neural = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+    EvolutionEngine* engine = (EvolutionEngine*)calloc(1, sizeof(EvolutionEngine));
+    NTSTATUS status = (neural && engine) ? NeuralSubstrate_Initialize(neural) : STATUS_INSUFFICIENT_RESOURCES;
+
+    EvolutionParameters params;
+    memset(&params, 0, sizeof(params));
+    params.population_size = BATCH_EVAL_TEST_POPULATION;
+    params.tournament_size = 2;
+    params.rng_seed = 36;
+    if (NT_SUCCESS(status)) status = EvolutionEngine_Initialize(engine, &params, neural, NULL);
+    if (NT_SUCCESS(status)) status = EvolutionEngine_InitializePopulation(engine);
+
+    uint64_t neurons = NT_SUCCESS(status) ? neural->fabric.active_neuron_count : 0;
+    float* state = neurons ? (float*)malloc(neurons * sizeof(float)) : NULL;
+    if (NT_SUCCESS(status) && !state) status = STATUS_INSUFFICIENT_RESOURCES;
+    if (!NT_SUCCESS(status)) {
+        free(state);
+        if (engine) EvolutionEngine_Shutdown(engine);
+        if (neural && neural->initialized) NeuralSubstrate_Shutdown(neural);
+        free(engine);
+        free(neural);
+        SelfTestReport_Add(report, "EvolutionEngine_BatchEvaluation", false, "Setup failed", GetTimeMs() - t0);
+        return status;
+    }
+
+    // Without entropy the chaotic terms are fixed, so both paths compute the same function
+    neural->fabric.global_entropy = 0.0f;
+    void* genomes[BATCH_EVAL_TEST_POPULATION];
+    size_t sizes[BATCH_EVAL_TEST_POPULATION];
+    double batched[BATCH_EVAL_TEST_POPULATION], sequential[BATCH_EVAL_TEST_POPULATION];
+    for (uint32_t i = 0; i < BATCH_EVAL_TEST_POPULATION; i++) {
+        genomes[i] = engine->population.individuals[i].genome;
+        sizes[i] = engine->population.individuals[i].genome_size;
+    }
+    status = NeuralSubstrate_GetActivations(neural, state, neurons);
+    if (NT_SUCCESS(status)) {
+        status = engine->batch_fitness_function(genomes, sizes, BATCH_EVAL_TEST_POPULATION, batched,
+                                                engine->batch_fitness_context);
+    }
+    // Process carries its state forward; every sample of a batch starts from the saved state
+    for (uint32_t i = 0; NT_SUCCESS(status) && i < BATCH_EVAL_TEST_POPULATION; i++) {
+        status = NeuralSubstrate_SetActivations(neural, state, neurons);
+        if (NT_SUCCESS(status)) sequential[i] = engine->fitness_function(genomes[i], sizes[i], engine->fitness_context);
+    }
+
+    bool ok = NT_SUCCESS(status);
+    bool distinct = false;
+    for (uint32_t i = 0; ok && i < BATCH_EVAL_TEST_POPULATION; i++) {
+        ok = batched[i] == sequential[i];
+        distinct = distinct || batched[i] != batched[0];
+    }
+    ok = ok && distinct;
+
+    free(state);
+    EvolutionEngine_Shutdown(engine);
+    NeuralSubstrate_Shutdown(neural);
+    free(engine);
+    free(neural);
+    SelfTestReport_Add(report, "EvolutionEngine_BatchEvaluation", ok,
+        ok ? "OK" : (NT_SUCCESS(status) ? "Batched fitness differs" : "Evaluation failed"), GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+static bool PbtTest_SameWeights(const NeuralSubstrate* a, const NeuralSubstrate* b) {
+    if (a->fabric.active_neuron_count != b->fabric.active_neuron_count) return false;
+    for (uint64_t i = 0; i < a->fabric.active_neuron_count; i++) {
+        const SparseNeuron* x = &a->fabric.neurons[i];
+        const SparseNeuron* y = &b->fabric.neurons[i];
+        if (x->input_count != y->input_count ||
+            memcmp(x->weights, y->weights, x->input_count * sizeof(float)) != 0) return false;
+    }
+    return true;
+}
+
+static bool PbtTest_InBounds(const TrainingPbtHyperparams* h, const TrainingPbtConfig* config) {
+    return h->learning_rate >= config->min.learning_rate && h->learning_rate <= config->max.learning_rate &&
+           h->mutation_rate >= config->min.mutation_rate && h->mutation_rate <= config->max.mutation_rate &&
+           h->sparsity >= config->min.sparsity && h->sparsity <= config->max.sparsity;
+}
+
+// A replica that ends its interval behind the others exploits one of them and explores within
+// the bounds, and the best weights reach the caller's substrate as an independent copy
+static NTSTATUS Test_TrainingPbtExploit(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    NeuralSubstrate* source = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+    NeuralSubstrate* pristine = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+    NeuralSubstrate* exported = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+    TrainingPbt* pbt = (TrainingPbt*)calloc(1, sizeof(TrainingPbt));
+    NTSTATUS status = (source && pristine && exported && pbt) ? NeuralSubstrate_Initialize(source)
+                                                             : STATUS_INSUFFICIENT_RESOURCES;
+    if (NT_SUCCESS(status)) status = NeuralSubstrate_CreateReplica(pristine, source);
+    if (NT_SUCCESS(status)) status = NeuralSubstrate_CreateReplica(exported, source);
+
+    TrainingPbtConfig config;
+    TrainingPbt_GetDefaultConfig(&config);
+    config.replicas = 4;                 /* the exploit minimum at the default quantile, so never clamped */
+    config.interval_steps = 2;
+    config.seed = 37;
+    if (NT_SUCCESS(status)) status = TrainingPbt_Initialize(pbt, &config, source);
+
+    // Losses are never negative, so the first replica to end its interval ranks last against
+    // these scores and must exploit; later ones race with the scores being replaced
+    bool ok = NT_SUCCESS(status);
+    for (uint32_t i = 0; ok && i < pbt->config.replicas; i++) {
+        pbt->replicas[i].scored = true;
+        pbt->replicas[i].score = -1.0;
+    }
+    if (ok) status = TrainingPbt_Run(pbt, config.interval_steps);
+    ok = NT_SUCCESS(status) && pbt->exploit_count >= 1;
+    uint64_t exploits = 0;
+    for (uint32_t i = 0; ok && i < pbt->config.replicas; i++) {
+        const TrainingPbtReplica* r = &pbt->replicas[i];
+        exploits += r->exploits;
+        ok = r->steps == config.interval_steps && PbtTest_InBounds(&r->hyper, &pbt->config) &&
+             (r->exploits == 0 || (r->last_parent >= 0 && (uint32_t)r->last_parent < pbt->config.replicas &&
+                                   (uint32_t)r->last_parent != i));
+    }
+    ok = ok && exploits == pbt->exploit_count;
+
+    // Replicas train on their own copies; ExportBest copies, and the copy does not alias
+    uint32_t best = 0;
+    ok = ok && PbtTest_SameWeights(source, pristine);
+    ok = ok && NT_SUCCESS(TrainingPbt_GetBest(pbt, &best, NULL, NULL)) &&
+         NT_SUCCESS(TrainingPbt_ExportBest(pbt, exported)) &&
+         PbtTest_SameWeights(exported, &pbt->replicas[best].substrate);
+    if (ok) {
+        exported->fabric.neurons[0].weights[0] += 0.5f;
+        ok = !PbtTest_SameWeights(exported, &pbt->replicas[best].substrate) &&
+             PbtTest_SameWeights(source, pristine);
+    }
+
+    if (pbt && pbt->initialized) TrainingPbt_Shutdown(pbt);
+    if (exported && exported->initialized) NeuralSubstrate_Shutdown(exported);
+    if (pristine && pristine->initialized) NeuralSubstrate_Shutdown(pristine);
+    if (source && source->initialized) NeuralSubstrate_Shutdown(source);
+    free(pbt);
+    free(exported);
+    free(pristine);
+    free(source);
+    SelfTestReport_Add(report, "TrainingPbt_Exploit", ok,
+        ok ? "OK" : (NT_SUCCESS(status) ? "Exploit or copy mismatch" : "Setup or run failed"), GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
+#define REMOTE_TEST_POPULATION 16
+#define REMOTE_TEST_TOKEN 0x5E1F7E57C0FFEE01ull
+#define REMOTE_TEST_TIMEOUT_MS 5000
+
+typedef struct RemoteTestWorker {
+    uint16_t port;
+    volatile LONG stop;
+    int exit_code;
+} RemoteTestWorker;
+
+// Stands in for a raijin.exe --eval-worker process; retries until the pool is listening
+static DWORD WINAPI RemoteTest_WorkerThread(LPVOID param) {
+    RemoteTestWorker* worker = (RemoteTestWorker*)param;
+    uint64_t deadline = GetTimeMs() + REMOTE_TEST_TIMEOUT_MS;
+    worker->exit_code = 1;
+    while (!worker->stop && GetTimeMs() < deadline) {
+        worker->exit_code = EvolutionRemote_WorkerMain(worker->port, 0, REMOTE_TEST_TOKEN);
+        if (worker->exit_code == 0) break;
+        Sleep(10);
+    }
+    return 0;
+}
+
+// A loopback port nobody is listening on; the pool binds it right after
+static uint16_t RemoteTest_FreePort(void) {
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) return 0;
+    uint16_t port = 0;
+    SOCKET s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s != INVALID_SOCKET) {
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t addr_len = (socklen_t)sizeof(addr);
+        if (bind(s, (struct sockaddr*)&addr, sizeof(addr)) == 0 &&
+            getsockname(s, (struct sockaddr*)&addr, &addr_len) == 0) {
+            port = ntohs(addr.sin_port);
+        }
+        closesocket(s);
+    }
+    WSACleanup();
+    return port;
+}
+
+// A worker on 127.0.0.1 loading the same substrate snapshot scores a batch exactly as locally
+static NTSTATUS Test_EvolutionRemoteLoopback(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    char temp_dir[MAX_PATH], path[MAX_PATH];
+    if (GetTempPathA(MAX_PATH, temp_dir) == 0) strcpy(temp_dir, ".\\");
+    snprintf(path, sizeof(path), "%sraijin_selftest_%lu.substrate", temp_dir, (unsigned long)GetCurrentProcessId());
+
+    NeuralSubstrate* neural = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+    EvolutionEngine* engine = (EvolutionEngine*)calloc(1, sizeof(EvolutionEngine));
+    EvolutionRemotePool* pool = (EvolutionRemotePool*)calloc(1, sizeof(EvolutionRemotePool));
+    NTSTATUS status = (neural && engine && pool) ? NeuralSubstrate_Initialize(neural) : STATUS_INSUFFICIENT_RESOURCES;
+
+    // Entropy off, so the worker's copy computes the same function as ours
+    if (NT_SUCCESS(status)) {
+        neural->fabric.global_entropy = 0.0f;
+        status = NeuralSubstrate_SaveState(neural, path);
+    }
+    EvolutionParameters params;
+    memset(&params, 0, sizeof(params));
+    params.population_size = REMOTE_TEST_POPULATION;
+    params.tournament_size = 2;
+    params.rng_seed = 38;
+    if (NT_SUCCESS(status)) status = EvolutionEngine_Initialize(engine, &params, neural, NULL);
+    if (NT_SUCCESS(status)) status = EvolutionEngine_InitializePopulation(engine);
+
+    void* genomes[REMOTE_TEST_POPULATION];
+    size_t sizes[REMOTE_TEST_POPULATION];
+    double local[REMOTE_TEST_POPULATION], remote[REMOTE_TEST_POPULATION];
+    for (uint32_t i = 0; NT_SUCCESS(status) && i < REMOTE_TEST_POPULATION; i++) {
+        genomes[i] = engine->population.individuals[i].genome;
+        sizes[i] = engine->population.individuals[i].genome_size;
+        remote[i] = -1.0;
+    }
+    if (NT_SUCCESS(status)) {
+        status = engine->batch_fitness_function(genomes, sizes, REMOTE_TEST_POPULATION, local,
+                                                engine->batch_fitness_context);
+    }
+
+    RemoteTestWorker worker;
+    memset(&worker, 0, sizeof(worker));
+    worker.port = RemoteTest_FreePort();
+    HANDLE thread = NULL;
+    if (NT_SUCCESS(status) && worker.port == 0) status = STATUS_UNSUCCESSFUL;
+    if (NT_SUCCESS(status)) {
+        thread = CreateThread(NULL, 0, RemoteTest_WorkerThread, &worker, 0, NULL);
+        if (!thread) status = STATUS_UNSUCCESSFUL;
+    }
+
+    // One task: the substrate carries its recurrent state from one batch to the next, so only
+    // the worker's first batch starts from the snapshot state our batch started from
+    EvolutionRemoteConfig config;
+    EvolutionRemote_GetDefaultConfig(&config);
+    config.worker_count = 1;
+    config.spawn_workers = false;
+    config.pipeline_depth = 1;
+    config.task_genomes = REMOTE_TEST_POPULATION;
+    config.connect_timeout_ms = REMOTE_TEST_TIMEOUT_MS;
+    config.port = worker.port;
+    config.token = REMOTE_TEST_TOKEN;
+    config.use_neural = true;
+    strncpy(config.substrate_path, path, sizeof(config.substrate_path) - 1);
+    if (NT_SUCCESS(status)) status = EvolutionRemote_Initialize(pool, &config, &params);
+    if (NT_SUCCESS(status)) status = EvolutionRemote_EvaluateBatch(genomes, sizes, REMOTE_TEST_POPULATION, remote, pool);
+
+    EvolutionRemoteStats stats;
+    memset(&stats, 0, sizeof(stats));
+    if (NT_SUCCESS(status)) EvolutionRemote_GetStats(pool, &stats);
+    bool ok = NT_SUCCESS(status) && stats.genomes_evaluated == REMOTE_TEST_POPULATION && stats.worker_deaths == 0;
+    for (uint32_t i = 0; ok && i < REMOTE_TEST_POPULATION; i++) ok = remote[i] == local[i];
+
+    // Shutdown tells the worker to exit; it must do so cleanly
+    if (pool && pool->initialized) EvolutionRemote_Shutdown(pool);
+    if (thread) {
+        InterlockedExchange(&worker.stop, 1);
+        ok = WaitForSingleObject(thread, REMOTE_TEST_TIMEOUT_MS) == WAIT_OBJECT_0 && ok && worker.exit_code == 0;
+        CloseHandle(thread);
+    }
+
+    DeleteFileA(path);
+    if (engine && engine->initialized) EvolutionEngine_Shutdown(engine);
+    if (neural && neural->initialized) NeuralSubstrate_Shutdown(neural);
+    free(pool);
+    free(engine);
+    free(neural);
+    SelfTestReport_Add(report, "EvolutionRemote_Loopback", ok,
+        ok ? "OK" : (NT_SUCCESS(status) ? "Remote fitness differs" : "Pool or worker failed"), GetTimeMs() - t0);
+    return STATUS_SUCCESS;
+}
+
 typedef NTSTATUS (*SelfTestFn)(SelfTestReport*);
 
+// Drives the sweep itself, so it is defined after the sweep table
+static NTSTATUS Test_SelfTestSweepSkipsHeavy(SelfTestReport* report);
+
 static const struct {
     const char* name;
     SelfTestFn fn;
@@ -347,7 +1699,30 @@ static const struct {
     { "Adversarial_ExtremeValues", Test_AdversarialExtremeValues },
     { "Recovery_AfterFailure", Test_RecoveryAfterNeuralFailure },
     { "EvolutionEngine_Initialize", Test_EvolutionInit },
+    { "EvolutionEngine_NoveltyKnn", Test_EvolutionNoveltyKnn },
+    { "EvolutionEngine_Speciation", Test_EvolutionSpeciation },
+    { "EvolutionDiversity_Approximation", Test_EvolutionDiversityApproximation },
     { "TrainingPipeline_TrainStep", Test_TrainingStep },
+    { "TrainingDataParallel_Equivalence", Test_TrainingDataParallelEquivalence },
+    { "ThreadPool_ParallelFor", Test_ThreadPoolParallelFor },
+    { "TaskScheduler_HeapOrder", Test_TaskSchedulerHeapOrder },
+    { "TaskScheduler_PeriodZero", Test_TaskSchedulerPeriodZero },
+    { "TaskScheduler_Trigger", Test_TaskSchedulerTrigger },
+    { "TaskScheduler_SkipsInactive", Test_TaskSchedulerSkipsInactive },
+    { "TaskScheduler_DispatchDeferral", Test_TaskSchedulerDispatchDeferral },
+    { "StartupGraph_Order", Test_StartupGraphOrder },
+    { "StartupGraph_SkipsFailed", Test_StartupGraphSkipsFailed },
+    { "StartupGraph_Lazy", Test_StartupGraphLazy },
+    { "StartupGraph_CallerThread", Test_StartupGraphCallerThread },
+    { "TrainingReplay_Prioritized", Test_TrainingReplayPrioritized },
+    { "SelfTest_SweepSkipsHeavy", Test_SelfTestSweepSkipsHeavy },
+    { "MapElites_ConcurrentInsert", Test_MapElitesConcurrentInsert },
+    { "EvolutionSurrogate_Ranking", Test_EvolutionSurrogateRanking },
+    { "EvolutionCheckpoint_Resume", Test_EvolutionCheckpointResume },
+    { "EvolutionSelection_TopKAlias", Test_EvolutionSelectionTopKAlias },
+    { "EvolutionEngine_BatchEvaluation", Test_EvolutionBatchEvaluation },
+    { "TrainingPbt_Exploit", Test_TrainingPbtExploit },
+    { "EvolutionRemote_Loopback", Test_EvolutionRemoteLoopback },
     { "Stress_ManyCycles", Test_StressManyCycles },
     { "RoleBoundary_NoViolation", Test_RoleBoundary_NoViolation },
     { "RoleBoundary_DetectsViolation", Test_RoleBoundary_DetectsViolation },
@@ -364,29 +1739,134 @@ static void RunOneWithRaijinContext(SelfTestReport* report, SelfTestFn fn) {
     if (rbc) RoleBoundary_Exit(rbc, "raijin.test");
 }
 
-NTSTATUS SelfTest_RunAll(SelfTestReport* report) {
-    if (!report || !report->results) return STATUS_INVALID_PARAMETER;
+// RunAll's order. The role boundary tests manage their own context; the rest run in raijin.test.
+// Heavy tests take hundreds of milliseconds or more (threads, sockets, files, many cycles) and
+// are left to RunAll; the live sweep in slices skips them.
+static const struct {
+    SelfTestFn fn;
+    bool raijin_context;
+    bool heavy;
+} s_self_test_sweep[] = {
+    { Test_NeuralInit, true, false },
+    { Test_NeuralProcess, true, false },
+    { Test_NeuralLearn, true, false },
+    { Test_NeuralAdversarialNull, true, false },
+    { Test_AdversarialZeroSize, true, false },
+    { Test_AdversarialExtremeValues, true, false },
+    { Test_RecoveryAfterNeuralFailure, true, false },
+    { Test_EvolutionInit, true, false },
+    { Test_TrainingStep, true, false },
+    { Test_TrainingDataParallelEquivalence, true, true },
+    { Test_ThreadPoolParallelFor, false, false },
+    { Test_TaskSchedulerHeapOrder, false, false },
+    { Test_TaskSchedulerPeriodZero, false, false },
+    { Test_TaskSchedulerTrigger, false, false },
+    { Test_TaskSchedulerSkipsInactive, false, false },
+    { Test_TaskSchedulerDispatchDeferral, false, false },
+    { Test_StartupGraphOrder, false, false },
+    { Test_StartupGraphSkipsFailed, false, false },
+    { Test_StartupGraphLazy, false, false },
+    { Test_StartupGraphCallerThread, false, false },
+    { Test_TrainingReplayPrioritized, false, false },
+    { Test_StressManyCycles, true, true },
+    { Test_RoleBoundary_NoViolation, false, false },
+    { Test_RoleBoundary_DetectsViolation, false, false },
+    { Test_TaskOracle_Evaluate, false, false },
+    { Test_ResourceGovernor_ResetThrottle, false, false },
+    { Test_EvolutionNoveltyKnn, false, false },
+    { Test_EvolutionSpeciation, false, false },
+    { Test_EvolutionDiversityApproximation, false, false },
+    { Test_MapElitesConcurrentInsert, false, false },
+    { Test_EvolutionSurrogateRanking, false, false },
+    { Test_EvolutionCheckpointResume, true, true },
+    { Test_EvolutionSelectionTopKAlias, false, false },
+    { Test_EvolutionBatchEvaluation, true, true },
+    { Test_TrainingPbtExploit, true, true },
+    { Test_EvolutionRemoteLoopback, true, true },
+    { Test_SelfTestSweepSkipsHeavy, false, true },
+};
+static const uint32_t s_self_test_sweep_count = sizeof(s_self_test_sweep) / sizeof(s_self_test_sweep[0]);
+
+static void SelfTest_ResetReport(SelfTestReport* report) {
     report->count = report->passed = report->failed = 0;
     report->total_ms = 0;
-
     RoleBoundaryContext* rbc = RoleBoundary_GetGlobal();
     if (rbc) RoleBoundary_AssertCursor(rbc);
+}
+
+static void SelfTest_RunSweepEntry(SelfTestReport* report, uint32_t index) {
+    if (s_self_test_sweep[index].raijin_context)
+        RunOneWithRaijinContext(report, s_self_test_sweep[index].fn);
+    else
+        s_self_test_sweep[index].fn(report);
+}
+
+NTSTATUS SelfTest_RunAll(SelfTestReport* report) {
+    if (!report || !report->results) return STATUS_INVALID_PARAMETER;
+    SelfTest_ResetReport(report);
+    for (uint32_t i = 0; i < s_self_test_sweep_count; i++)
+        SelfTest_RunSweepEntry(report, i);
+    return STATUS_SUCCESS;
+}
 
-    RunOneWithRaijinContext(report, Test_NeuralInit);
-    RunOneWithRaijinContext(report, Test_NeuralProcess);
-    RunOneWithRaijinContext(report, Test_NeuralLearn);
-    RunOneWithRaijinContext(report, Test_NeuralAdversarialNull);
-    RunOneWithRaijinContext(report, Test_AdversarialZeroSize);
-    RunOneWithRaijinContext(report, Test_AdversarialExtremeValues);
-    RunOneWithRaijinContext(report, Test_RecoveryAfterNeuralFailure);
-    RunOneWithRaijinContext(report, Test_EvolutionInit);
-    RunOneWithRaijinContext(report, Test_TrainingStep);
-    RunOneWithRaijinContext(report, Test_StressManyCycles);
-    Test_RoleBoundary_NoViolation(report);
-    Test_RoleBoundary_DetectsViolation(report);
-    Test_TaskOracle_Evaluate(report);
-    Test_ResourceGovernor_ResetThrottle(report);
+NTSTATUS SelfTest_RunSlice(SelfTestReport* report, SelfTestSweep* sweep, uint64_t budget_us, bool* complete) {
+    if (!report || !report->results || !sweep || !complete) return STATUS_INVALID_PARAMETER;
+    if (sweep->next == 0 || sweep->next > s_self_test_sweep_count) {
+        SelfTest_ResetReport(report);
+        sweep->next = 0;
+    }
+    uint64_t start = QpcClock_NowUs();
+    bool ran = false;
+    while (sweep->next < s_self_test_sweep_count && (!ran || QpcClock_NowUs() - start < budget_us)) {
+        uint32_t index = sweep->next++;
+        if (s_self_test_sweep[index].heavy) continue;
+        SelfTest_RunSweepEntry(report, index);
+        ran = true;
+    }
+    // Heavy entries at the end would otherwise cost a slice that runs nothing
+    while (sweep->next < s_self_test_sweep_count && s_self_test_sweep[sweep->next].heavy) sweep->next++;
+    sweep->slices++;
+    *complete = sweep->next >= s_self_test_sweep_count;
+    if (*complete) {
+        sweep->next = 0;
+        sweep->sweeps++;
+    }
+    return STATUS_SUCCESS;
+}
+
+// A sweep in small slices covers every light test exactly once and none of the heavy ones; it
+// is heavy itself, so the sweep it runs never reaches it
+static NTSTATUS Test_SelfTestSweepSkipsHeavy(SelfTestReport* report) {
+    uint64_t t0 = GetTimeMs();
+    SelfTestReport sweep_report = {0};
+    if (!NT_SUCCESS(SelfTestReport_Initialize(&sweep_report, s_self_test_sweep_count))) {
+        SelfTestReport_Add(report, "SelfTest_SweepSkipsHeavy", false, "Out of memory", GetTimeMs() - t0);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    uint32_t light = 0;
+    for (uint32_t i = 0; i < s_self_test_sweep_count; i++)
+        if (!s_self_test_sweep[i].heavy) light++;
+
+    SelfTestSweep sweep;
+    memset(&sweep, 0, sizeof(sweep));
+    bool complete = false;
+    for (uint32_t i = 0; i < s_self_test_sweep_count && !complete; i++)
+        SelfTest_RunSlice(&sweep_report, &sweep, 1, &complete);
+    // A 1 us budget still runs one test per slice, and the trailing heavy entries cost no slice
+    bool ok = complete && sweep.sweeps == 1 && sweep.slices == light && sweep_report.count == light;
+    for (uint32_t i = 0; ok && i < s_self_test_dispatch_count; i++) {
+        bool heavy = false;
+        for (uint32_t k = 0; k < s_self_test_sweep_count; k++)
+            if (s_self_test_sweep[k].fn == s_self_test_dispatch[i].fn) heavy = s_self_test_sweep[k].heavy;
+        uint32_t seen = 0;
+        for (uint32_t r = 0; r < sweep_report.count; r++)
+            if (strcmp(sweep_report.results[r].name, s_self_test_dispatch[i].name) == 0) seen++;
+        ok = seen == (heavy ? 0u : 1u);
+    }
 
+    SelfTestReport_Shutdown(&sweep_report);
+    SelfTestReport_Add(report, "SelfTest_SweepSkipsHeavy", ok, ok ? "OK" : "Sweep ran a heavy test or missed a light one",
+        GetTimeMs() - t0);
     return STATUS_SUCCESS;
 }
 
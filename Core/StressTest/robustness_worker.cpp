@@ -0,0 +1,227 @@
+/*
+ * Robustness Worker - Raijin
+ * Owner: Core/StressTest
+ * Inputs: Live neural substrate (read on the owner thread only), job requests from main-loop tasks
+ * Outputs: One RobustnessOutcome per finished stress / adversarial / red-team job
+ * Invariants: The evaluators only ever see the replica while it exists; the replica is written
+ *             by the owner thread only while no job is in flight; at most one job in flight
+ * Budget: One replica (weights + activations); per job one weight copy on the owner thread and
+ *         one LOW pool task
+ * Failure modes: Replica cannot be built or rebuilt -> evaluators are rebound to the live
+ *                substrate and jobs run inline on the owner thread, as before the worker existed
+ * Recovery: Shutdown always waits for the job in flight, so an evaluator is never shut down mid-run
+ */
+
+#include "../../Include/robustness_worker.h"
+#include "../../Include/raijin_ntstatus.h"
+#include "../../Include/qpc_clock.h"
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+static LONG Robustness_Load(volatile LONG* value) {
+    return InterlockedCompareExchange(value, 0, 0);
+}
+
+const char* RobustnessWorker_KindName(RobustnessJobKind kind) {
+    switch (kind) {
+        case ROBUSTNESS_JOB_STRESS:      return "stress";
+        case ROBUSTNESS_JOB_ADVERSARIAL: return "adversarial";
+        case ROBUSTNESS_JOB_RED_TEAM:    return "red_team";
+        default: return "unknown";
+    }
+}
+
+// Points every attached evaluator at `substrate`
+static void Robustness_Bind(RobustnessWorker* worker, NeuralSubstrate* substrate) {
+    if (worker->stress) worker->stress->neural = substrate;
+    if (worker->adversarial) worker->adversarial->neural = substrate;
+    if (worker->red_team) worker->red_team->neural = substrate;
+}
+
+NTSTATUS RobustnessWorker_Initialize(RobustnessWorker* worker, NeuralSubstrate* live) {
+    if (!worker || !live) return STATUS_INVALID_PARAMETER;
+    memset(worker, 0, sizeof(RobustnessWorker));
+    worker->live = live;
+    // Without a replica the worker still works, inline on the live substrate
+    if (!NT_SUCCESS(NeuralSubstrate_CreateReplica(&worker->snapshot, live)))
+        memset(&worker->snapshot, 0, sizeof(NeuralSubstrate));
+    worker->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void RobustnessWorker_Shutdown(RobustnessWorker* worker) {
+    if (!worker || !worker->initialized) return;
+    ThreadPool_Wait(ThreadPool_GetGlobal(), &worker->group);
+    Robustness_Bind(worker, worker->live);
+    if (worker->snapshot.initialized) NeuralSubstrate_Shutdown(&worker->snapshot);
+    memset(worker, 0, sizeof(RobustnessWorker));
+}
+
+NeuralSubstrate* RobustnessWorker_GetSnapshot(RobustnessWorker* worker) {
+    if (!worker || !worker->initialized) return NULL;
+    return worker->snapshot.initialized ? &worker->snapshot : worker->live;
+}
+
+void RobustnessWorker_Attach(RobustnessWorker* worker, StressTestFramework* stress,
+    AdversarialStressContext* adversarial, RedTeam* red_team) {
+    if (!worker || !worker->initialized || worker->busy) return;
+    worker->stress = (stress && stress->initialized) ? stress : NULL;
+    worker->adversarial = (adversarial && adversarial->initialized) ? adversarial : NULL;
+    worker->red_team = (red_team && red_team->initialized) ? red_team : NULL;
+    Robustness_Bind(worker, RobustnessWorker_GetSnapshot(worker));
+}
+
+void RobustnessWorker_SetNotify(RobustnessWorker* worker, void (*notify)(void* context), void* context) {
+    if (!worker || !worker->initialized) return;
+    // A job in flight still calls the old callback; let it finish first. Its outcome stays
+    // done until the next Poll.
+    ThreadPool_Wait(ThreadPool_GetGlobal(), &worker->group);
+    worker->notify = notify;
+    worker->notify_context = context;
+}
+
+static bool Robustness_HasEvaluator(const RobustnessWorker* worker, uint32_t kind) {
+    switch (kind) {
+        case ROBUSTNESS_JOB_STRESS:      return worker->stress != NULL;
+        case ROBUSTNESS_JOB_ADVERSARIAL: return worker->adversarial != NULL;
+        case ROBUSTNESS_JOB_RED_TEAM:    return worker->red_team != NULL;
+        default: return false;
+    }
+}
+
+NTSTATUS RobustnessWorker_Request(RobustnessWorker* worker, RobustnessJobKind kind) {
+    if (!worker || !worker->initialized || (uint32_t)kind >= ROBUSTNESS_JOB_COUNT)
+        return STATUS_INVALID_PARAMETER;
+    if (!Robustness_HasEvaluator(worker, kind)) return STATUS_INVALID_DEVICE_STATE;
+    if (worker->pending & (1u << kind)) worker->stats.coalesced++;
+    worker->pending |= 1u << kind;
+    return STATUS_SUCCESS;
+}
+
+// Runs the job described by outcome.kind and fills in the rest of the outcome
+static void Robustness_RunJob(RobustnessWorker* worker) {
+    RobustnessOutcome* out = &worker->outcome;
+    uint64_t t0 = QpcClock_NowUs();
+    switch (out->kind) {
+        case ROBUSTNESS_JOB_STRESS: {
+            StressTestFramework* stf = worker->stress;
+            out->status = StressTestFramework_RunStressTest(stf, (StressTestType)(++worker->stress_runs % 5));
+            out->robustness = stf->last_result.robustness_score;
+            out->passed = stf->last_result.passed;
+            memcpy(out->description, stf->last_result.description, sizeof(out->description));
+            break;
+        }
+        case ROBUSTNESS_JOB_ADVERSARIAL: {
+            out->status = AdversarialStress_RunCycle(worker->adversarial);
+            AdversarialStress_GetRobustnessScore(worker->adversarial, &out->robustness);
+            out->passed = NT_SUCCESS(out->status);
+            snprintf(out->description, sizeof(out->description), "robustness=%.4f", out->robustness);
+            break;
+        }
+        case ROBUSTNESS_JOB_RED_TEAM: {
+            RedTeamResult result;
+            memset(&result, 0, sizeof(result));
+            out->status = RedTeam_RunCycle(worker->red_team);
+            RedTeam_GetLastResult(worker->red_team, &result);
+            out->robustness = result.verification_passed ? 1.0 : 0.0;
+            out->passed = !result.induced_failure;
+            snprintf(out->description, sizeof(out->description), "attack_type=%u verification_hint=%s",
+                (unsigned)result.attack_type, result.verification_hint);
+            break;
+        }
+        default:
+            out->status = STATUS_INVALID_PARAMETER;
+            break;
+    }
+    out->description[ROBUSTNESS_DESCRIPTION_MAX - 1] = '\0';
+    out->duration_us = QpcClock_NowUs() - t0;
+}
+
+static void Robustness_JobTask(void* context) {
+    RobustnessWorker* worker = (RobustnessWorker*)context;
+    Robustness_RunJob(worker);
+    worker->stats.eval_us += worker->outcome.duration_us;
+    // Publishes the outcome; the owner reads nothing of it before seeing done
+    InterlockedExchange(&worker->done, 1);
+    if (worker->notify) worker->notify(worker->notify_context);
+}
+
+// Live weights -> replica. A topology change refuses the copy and the replica is rebuilt in
+// place, so the evaluators' pointer stays valid; if even that fails they fall back to live.
+static bool Robustness_RefreshSnapshot(RobustnessWorker* worker) {
+    if (!worker->snapshot.initialized) return false;
+    uint64_t t0 = QpcClock_NowUs();
+    NTSTATUS status = NeuralSubstrate_CopyWeights(&worker->snapshot, worker->live);
+    if (NT_SUCCESS(status)) {
+        worker->stats.snapshot_refreshes++;
+    } else {
+        NeuralSubstrate_Shutdown(&worker->snapshot);
+        memset(&worker->snapshot, 0, sizeof(NeuralSubstrate));
+        status = NeuralSubstrate_CreateReplica(&worker->snapshot, worker->live);
+        if (NT_SUCCESS(status)) {
+            worker->stats.snapshot_rebuilds++;
+        } else {
+            memset(&worker->snapshot, 0, sizeof(NeuralSubstrate));
+            Robustness_Bind(worker, worker->live);
+        }
+    }
+    worker->stats.snapshot_us += QpcClock_NowUs() - t0;
+    return worker->snapshot.initialized;
+}
+
+static bool Robustness_Collect(RobustnessWorker* worker, RobustnessOutcome* out) {
+    if (!worker->busy || !Robustness_Load(&worker->done)) return false;
+    if (out) *out = worker->outcome;
+    worker->busy = false;
+    worker->done = 0;
+    worker->stats.completed++;
+    return true;
+}
+
+bool RobustnessWorker_Poll(RobustnessWorker* worker, RobustnessOutcome* out) {
+    if (!worker || !worker->initialized) return false;
+    bool collected = Robustness_Collect(worker, out);
+    if (worker->busy) return collected;
+
+    // Requests for evaluators that have gone away are dropped
+    uint32_t runnable = 0;
+    for (uint32_t k = 0; k < ROBUSTNESS_JOB_COUNT; k++)
+        if (Robustness_HasEvaluator(worker, k)) runnable |= 1u << k;
+    worker->pending &= runnable;
+    if (!worker->pending) return collected;
+
+    uint32_t kind = worker->next_kind;
+    while (!(worker->pending & (1u << kind))) kind = (kind + 1) % ROBUSTNESS_JOB_COUNT;
+    worker->pending &= ~(1u << kind);
+    worker->next_kind = (kind + 1) % ROBUSTNESS_JOB_COUNT;
+
+    memset(&worker->outcome, 0, sizeof(RobustnessOutcome));
+    worker->outcome.kind = (RobustnessJobKind)kind;
+    worker->busy = true;
+    worker->done = 0;
+    worker->stats.submitted++;
+
+    if (Robustness_RefreshSnapshot(worker)) {
+        ThreadPool_Submit(ThreadPool_GetGlobal(), Robustness_JobTask, worker, THREAD_POOL_PRIORITY_LOW,
+                          &worker->group);
+        return collected;
+    }
+
+    // No replica: the evaluators are on the live substrate, which only this thread may touch
+    worker->stats.inline_runs++;
+    Robustness_RunJob(worker);
+    worker->stats.eval_us += worker->outcome.duration_us;
+    worker->done = 1;
+    if (!collected) return Robustness_Collect(worker, out);
+    // `out` already holds the earlier outcome; have the owner come back for this one now
+    if (worker->notify) worker->notify(worker->notify_context);
+    return true;
+}
+
+void RobustnessWorker_GetStats(const RobustnessWorker* worker, RobustnessWorkerStats* out) {
+    if (!out) return;
+    memset(out, 0, sizeof(RobustnessWorkerStats));
+    if (!worker || !worker->initialized) return;
+    *out = worker->stats;
+}
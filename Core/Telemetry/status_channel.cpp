@@ -0,0 +1,198 @@
+/*
+ * Status Channel - Raijin
+ * Owner: Core/Telemetry
+ * Inputs: StatusSnapshot from the main loop; readers in this or another process
+ * Outputs: The latest snapshot in a named shared section; optionally mirrored to a JSON file
+ * Invariants: sequence is even whenever no Publish is copying; a snapshot read with the same
+ *             even sequence before and after the copy is one the writer published whole;
+ *             at most one file write is in flight
+ * Budget: Publish is two interlocked increments and a memcpy of one snapshot, plus one pool
+ *         submit when the file mirror is idle; no allocation after Initialize
+ * Failure modes: Section cannot be created -> Initialize fails; file write fails -> the mirror
+ *                keeps its previous contents; reader races the writer every retry -> STATUS_UNSUCCESSFUL
+ * Recovery: The next Publish overwrites everything; readers simply try again
+ */
+
+#include "../../Include/status_channel.h"
+#include "../../Include/raijin_ntstatus.h"
+#include "../../Include/thread_pool.h"
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+// Interlocked read, for fields the writer only changes atomically
+static LONG64 Status_Load64(volatile LONG64* value) {
+    return InterlockedCompareExchange64(value, 0, 0);
+}
+
+const char* StatusChannel_StateName(uint32_t state) {
+    switch (state) {
+        case STATUS_STATE_STARTING: return "starting";
+        case STATUS_STATE_RUNNING:  return "running";
+        case STATUS_STATE_STOPPING: return "stopping";
+        case STATUS_STATE_STOPPED:  return "stopped";
+        default: return "unknown";
+    }
+}
+
+void StatusChannel_FormatName(uint32_t process_id, char* name, size_t name_size) {
+    if (!name || name_size == 0) return;
+    snprintf(name, name_size, "Local\\RaijinStatus_%lu", (unsigned long)process_id);
+}
+
+NTSTATUS StatusChannel_Initialize(StatusChannel* channel, const char* name, const char* file_path) {
+    if (!channel) return STATUS_INVALID_PARAMETER;
+    memset(channel, 0, sizeof(StatusChannel));
+    if (name && name[0])
+        strncpy(channel->name, name, STATUS_CHANNEL_NAME_MAX - 1);
+    else
+        StatusChannel_FormatName((uint32_t)GetCurrentProcessId(), channel->name, sizeof(channel->name));
+    if (file_path && file_path[0]) {
+        if (strlen(file_path) + 4 >= STATUS_CHANNEL_PATH_MAX) return STATUS_INVALID_PARAMETER;
+        strncpy(channel->file_path, file_path, STATUS_CHANNEL_PATH_MAX - 1);
+    }
+
+    channel->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+                                          0, (DWORD)sizeof(StatusChannelBlock), channel->name);
+    if (!channel->mapping) return STATUS_INSUFFICIENT_RESOURCES;
+    channel->block = (StatusChannelBlock*)MapViewOfFile(channel->mapping, FILE_MAP_ALL_ACCESS, 0, 0,
+                                                        sizeof(StatusChannelBlock));
+    if (!channel->block) {
+        CloseHandle(channel->mapping);
+        channel->mapping = NULL;
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    memset(channel->block, 0, sizeof(StatusChannelBlock));
+    channel->block->version = STATUS_CHANNEL_VERSION;
+    channel->block->process_id = (uint32_t)GetCurrentProcessId();
+    channel->block->size = (uint32_t)sizeof(StatusChannelBlock);
+    // Last, so a reader that sees the magic sees the rest of the header
+    MemoryBarrier();
+    channel->block->magic = STATUS_CHANNEL_MAGIC;
+    channel->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void StatusChannel_Shutdown(StatusChannel* channel) {
+    if (!channel || !channel->initialized) return;
+    ThreadPool_Wait(ThreadPool_GetGlobal(), &channel->file_group);
+    if (channel->block) UnmapViewOfFile(channel->block);
+    if (channel->mapping) CloseHandle(channel->mapping);
+    memset(channel, 0, sizeof(StatusChannel));
+}
+
+static void Status_WriteJson(FILE* f, const StatusSnapshot* s, uint64_t sequence) {
+    char message[STATUS_CHANNEL_MESSAGE_MAX * 2];
+    size_t m = 0;
+    for (size_t i = 0; s->message[i] && i < STATUS_CHANNEL_MESSAGE_MAX && m + 2 < sizeof(message); i++) {
+        char c = s->message[i];
+        if (c == '"' || c == '\\') message[m++] = '\\';
+        message[m++] = (c >= 0x20) ? c : ' ';
+    }
+    message[m] = '\0';
+    fprintf(f, "{\n");
+    fprintf(f, "  \"sequence\": %llu,\n", (unsigned long long)sequence);
+    fprintf(f, "  \"state\": \"%s\",\n", StatusChannel_StateName(s->state));
+    fprintf(f, "  \"uptime_ms\": %llu,\n", (unsigned long long)s->uptime_ms);
+    fprintf(f, "  \"cycles\": %llu,\n", (unsigned long long)s->cycles);
+    fprintf(f, "  \"steps\": %llu,\n", (unsigned long long)s->steps);
+    fprintf(f, "  \"generation\": %llu,\n", (unsigned long long)s->generation);
+    fprintf(f, "  \"loss\": %.6f,\n", s->loss);
+    fprintf(f, "  \"fitness\": %.6f,\n", s->fitness);
+    fprintf(f, "  \"entropy\": %.6f,\n", s->entropy);
+    fprintf(f, "  \"cycles_per_sec\": %.2f,\n", s->cycles_per_sec);
+    fprintf(f, "  \"steps_per_sec\": %.2f,\n", s->steps_per_sec);
+    fprintf(f, "  \"throttle\": %.3f,\n", s->throttle);
+    fprintf(f, "  \"degradation_mode\": %u,\n", s->degradation_mode);
+    fprintf(f, "  \"memory_mb\": %llu,\n", (unsigned long long)s->memory_mb);
+    fprintf(f, "  \"scheduler_dispatches\": %llu,\n", (unsigned long long)s->scheduler_dispatches);
+    fprintf(f, "  \"task_overruns\": %llu,\n", (unsigned long long)s->task_overruns);
+    fprintf(f, "  \"pool_workers\": %u,\n", s->pool_workers);
+    fprintf(f, "  \"pool_executed\": %llu,\n", (unsigned long long)s->pool_executed);
+    fprintf(f, "  \"message\": \"%s\"\n", message);
+    fprintf(f, "}\n");
+}
+
+// Pool task: writes the copy Publish left in file_snapshot next to the mirror, then renames it
+// over the old one so a reader of the file never sees half a document
+static void Status_FileTask(void* context) {
+    StatusChannel* channel = (StatusChannel*)context;
+    char temp_path[STATUS_CHANNEL_PATH_MAX];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", channel->file_path);
+    FILE* f = fopen(temp_path, "w");
+    if (f) {
+        Status_WriteJson(f, &channel->file_snapshot, (uint64_t)Status_Load64(&channel->block->published));
+        bool ok = fflush(f) == 0;
+        fclose(f);
+        if (ok && MoveFileExA(temp_path, channel->file_path, MOVEFILE_REPLACE_EXISTING))
+            InterlockedIncrement64(&channel->file_writes);
+        else
+            DeleteFileA(temp_path);
+    }
+    InterlockedExchange(&channel->file_busy, 0);
+}
+
+void StatusChannel_Publish(StatusChannel* channel, const StatusSnapshot* snapshot) {
+    if (!channel || !channel->initialized || !snapshot) return;
+    StatusChannelBlock* block = channel->block;
+    // Odd while copying; the interlocked increments are full barriers on both sides of the copy
+    InterlockedIncrement64(&block->sequence);
+    memcpy(&block->snapshot, snapshot, sizeof(StatusSnapshot));
+    InterlockedIncrement64(&block->sequence);
+    InterlockedIncrement64(&block->published);
+
+    if (!channel->file_path[0]) return;
+    if (InterlockedCompareExchange(&channel->file_busy, 1, 0) != 0) {
+        channel->file_skips++;
+        return;
+    }
+    channel->file_snapshot = *snapshot;
+    ThreadPool_Submit(ThreadPool_GetGlobal(), Status_FileTask, channel, THREAD_POOL_PRIORITY_LOW,
+                      &channel->file_group);
+}
+
+void StatusChannel_GetStats(const StatusChannel* channel, StatusChannelStats* out) {
+    if (!out) return;
+    memset(out, 0, sizeof(StatusChannelStats));
+    if (!channel || !channel->initialized) return;
+    StatusChannel* c = (StatusChannel*)channel;
+    out->published = (uint64_t)Status_Load64(&c->block->published);
+    out->file_writes = (uint64_t)Status_Load64(&c->file_writes);
+    out->file_skips = c->file_skips;
+}
+
+NTSTATUS StatusChannel_Read(const StatusChannelBlock* block, StatusSnapshot* out) {
+    if (!block || !out) return STATUS_INVALID_PARAMETER;
+    if (block->magic != STATUS_CHANNEL_MAGIC || block->version != STATUS_CHANNEL_VERSION ||
+        block->size != sizeof(StatusChannelBlock))
+        return STATUS_DATA_ERROR;
+    // Plain loads with barriers: the reader may hold a read-only view, where an interlocked
+    // read-modify-write would fault
+    for (uint32_t attempt = 0; attempt < STATUS_CHANNEL_READ_RETRIES; attempt++) {
+        LONG64 before = block->sequence;
+        MemoryBarrier();
+        if (before & 1) {
+            YieldProcessor();
+            continue;
+        }
+        memcpy(out, (const void*)&block->snapshot, sizeof(StatusSnapshot));
+        MemoryBarrier();
+        if (block->sequence == before) {
+            out->message[STATUS_CHANNEL_MESSAGE_MAX - 1] = '\0';
+            return STATUS_SUCCESS;
+        }
+    }
+    return STATUS_UNSUCCESSFUL;
+}
+
+NTSTATUS StatusChannel_ReadByName(const char* name, StatusSnapshot* out) {
+    if (!name || !out) return STATUS_INVALID_PARAMETER;
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    if (!mapping) return STATUS_NOT_FOUND;
+    const StatusChannelBlock* block = (const StatusChannelBlock*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0,
+                                                                               sizeof(StatusChannelBlock));
+    NTSTATUS status = block ? StatusChannel_Read(block, out) : STATUS_UNSUCCESSFUL;
+    if (block) UnmapViewOfFile(block);
+    CloseHandle(mapping);
+    return status;
+}
@@ -0,0 +1,318 @@
+/*
+ * Training Bench - Raijin
+ * Owner: Core/Training
+ * Inputs: Source NeuralSubstrate, TrainingBenchConfig (warmup/measured steps, batch, threads,
+ *         prefetch depth, optional corpus shard)
+ * Outputs: TrainingBenchReport (step latency percentiles, throughput, memory), JSON report
+ * Invariants: Every thread trains its own replica, pipeline and corpus reader; the source
+ *             substrate is only read, by CreateReplica
+ * Budget: threads - 1 worker threads; one substrate replica and one pipeline per thread;
+ *         one latency sample per measured step
+ * Failure modes: Replica, corpus or thread creation failure -> Run fails before timing starts;
+ *                a TrainStep error on any thread ends the run and is returned
+ * Recovery: Nothing persists between runs; all replicas are released on every exit path
+ */
+
+#include "../../Include/training_bench.h"
+#include "../../Include/raijin_ntstatus.h"
+#include <windows.h>
+#include <psapi.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifdef _DEBUG
+#include <crtdbg.h>
+#endif
+
+#pragma comment(lib, "psapi.lib")
+
+typedef struct BenchWorker {
+    NeuralSubstrate substrate;
+    TrainingPipeline pipeline;
+    TrainingCorpus* corpus;
+    uint32_t share;                      /* TrainSteps per benchmark step */
+    uint64_t data_wait_us;
+    NTSTATUS status;                     /* first failure; written before `done` */
+    HANDLE thread;
+    HANDLE go;                           /* auto-reset: run one share */
+    HANDLE done;                         /* auto-reset: share finished */
+    volatile LONG* stop;
+    RoleBoundaryContext role_ctx;
+    bool measuring;
+    bool substrate_ready;
+    bool pipeline_ready;
+} BenchWorker;
+
+static NTSTATUS Bench_RunShare(BenchWorker* worker) {
+    for (uint32_t i = 0; i < worker->share; i++) {
+        NTSTATUS status = TrainingPipeline_TrainStep(&worker->pipeline);
+        if (!NT_SUCCESS(status)) return status;
+        if (worker->measuring) worker->data_wait_us += worker->pipeline.last_metrics.data_wait_us;
+    }
+    return STATUS_SUCCESS;
+}
+
+static DWORD WINAPI BenchThreadProc(LPVOID param) {
+    BenchWorker* worker = (BenchWorker*)param;
+
+    memset(&worker->role_ctx, 0, sizeof(worker->role_ctx));
+    worker->role_ctx.initialized = true;
+    RoleBoundary_Enter(&worker->role_ctx, "raijin.bench", ROLE_OWNER_RAIJIN);
+    RoleBoundary_BindThread(&worker->role_ctx);
+
+    for (;;) {
+        WaitForSingleObject(worker->go, INFINITE);
+        if (*worker->stop) break;
+        NTSTATUS status = Bench_RunShare(worker);
+        if (NT_SUCCESS(worker->status)) worker->status = status;
+        SetEvent(worker->done);
+    }
+
+    RoleBoundary_BindThread(NULL);
+    RoleBoundary_Exit(&worker->role_ctx, "raijin.bench");
+    return 0;
+}
+
+static void Bench_ReleaseWorker(BenchWorker* worker) {
+    if (worker->pipeline_ready) TrainingPipeline_Shutdown(&worker->pipeline);
+    if (worker->corpus) {
+        TrainingCorpus_Close(worker->corpus);
+        free(worker->corpus);
+    }
+    if (worker->substrate_ready) NeuralSubstrate_Shutdown(&worker->substrate);
+    if (worker->go) CloseHandle(worker->go);
+    if (worker->done) CloseHandle(worker->done);
+}
+
+static NTSTATUS Bench_PrepareWorker(BenchWorker* worker, const TrainingBenchConfig* config,
+    NeuralSubstrate* source, uint32_t index) {
+    NTSTATUS status = NeuralSubstrate_CreateReplica(&worker->substrate, source);
+    if (!NT_SUCCESS(status)) return status;
+    worker->substrate_ready = true;
+
+    status = TrainingPipeline_Initialize(&worker->pipeline, &worker->substrate, NULL);
+    if (!NT_SUCCESS(status)) return status;
+    worker->pipeline_ready = true;
+
+    // One reader per corpus, so every thread maps the shard itself and draws its own order
+    if (config->corpus_path) {
+        worker->corpus = (TrainingCorpus*)malloc(sizeof(TrainingCorpus));
+        if (!worker->corpus) return STATUS_INSUFFICIENT_RESOURCES;
+        memset(worker->corpus, 0, sizeof(TrainingCorpus));
+        TrainingCorpusConfig corpus_config;
+        TrainingCorpus_GetDefaultConfig(&corpus_config);
+        corpus_config.seed += index;
+        status = TrainingCorpus_Open(worker->corpus, config->corpus_path,
+            TRAINING_INPUT_SIZE, TRAINING_TARGET_SIZE, &corpus_config);
+        if (!NT_SUCCESS(status)) {
+            free(worker->corpus);
+            worker->corpus = NULL;
+            return status;
+        }
+        TrainingPipeline_SetDataSource(&worker->pipeline, TrainingCorpus_BatchSource, worker->corpus);
+    }
+    if (config->replay_fraction > 0.0) {
+        TrainingReplayConfig replay_config;
+        TrainingReplay_GetDefaultConfig(&replay_config);
+        replay_config.fraction = config->replay_fraction;
+        status = TrainingPipeline_EnableReplay(&worker->pipeline, &replay_config);
+        if (!NT_SUCCESS(status)) return status;
+    }
+    if (config->prefetch_depth) {
+        status = TrainingPipeline_EnablePrefetch(&worker->pipeline, config->prefetch_depth);
+        if (!NT_SUCCESS(status)) return status;
+    }
+
+    worker->share = config->batch_size / config->threads + (index < config->batch_size % config->threads ? 1 : 0);
+    worker->status = STATUS_SUCCESS;
+    return STATUS_SUCCESS;
+}
+
+static int Bench_CompareDouble(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// Nearest-rank percentile of an ascending array
+static double Bench_Percentile(const double* sorted, uint32_t count, double p) {
+    if (count == 0) return 0.0;
+    uint32_t rank = (uint32_t)ceil(p * count);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+    return sorted[rank - 1];
+}
+
+static void Bench_MemoryCounters(uint64_t* peak_rss, uint64_t* private_bytes) {
+    PROCESS_MEMORY_COUNTERS_EX pmc;
+    memset(&pmc, 0, sizeof(pmc));
+    pmc.cb = sizeof(pmc);
+    if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc))) {
+        *peak_rss = pmc.PeakWorkingSetSize;
+        *private_bytes = pmc.PrivateUsage;
+    }
+}
+
+void TrainingBench_GetDefaultConfig(TrainingBenchConfig* config) {
+    if (!config) return;
+    memset(config, 0, sizeof(TrainingBenchConfig));
+    config->warmup_steps = TRAINING_BENCH_DEFAULT_WARMUP;
+    config->measured_steps = TRAINING_BENCH_DEFAULT_STEPS;
+    config->batch_size = TRAINING_BENCH_DEFAULT_BATCH;
+    config->threads = 1;
+}
+
+NTSTATUS TrainingBench_Run(const TrainingBenchConfig* config, NeuralSubstrate* source, TrainingBenchReport* report) {
+    if (!config || !source || !report) return STATUS_INVALID_PARAMETER;
+    if (config->threads == 0 || config->threads > TRAINING_BENCH_MAX_THREADS) return STATUS_INVALID_PARAMETER;
+    if (config->measured_steps == 0 || config->batch_size < config->threads) return STATUS_INVALID_PARAMETER;
+
+    memset(report, 0, sizeof(TrainingBenchReport));
+    report->config = *config;
+    report->alloc_bytes_per_step = -1;
+
+    BenchWorker* workers = (BenchWorker*)calloc(config->threads, sizeof(BenchWorker));
+    double* latencies = (double*)malloc(config->measured_steps * sizeof(double));
+    if (!workers || !latencies) {
+        free(workers);
+        free(latencies);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    volatile LONG stop = 0;
+    uint32_t started = 0;
+    NTSTATUS status = STATUS_SUCCESS;
+    for (uint32_t i = 0; i < config->threads && NT_SUCCESS(status); i++) {
+        status = Bench_PrepareWorker(&workers[i], config, source, i);
+    }
+    // Thread 0's share runs on the calling thread. The others get dedicated threads rather than
+    // pool jobs: the benchmark measures scaling with exactly config->threads trainers, which
+    // pool jobs sharing workers with the rest of the process would not give
+    for (uint32_t i = 1; i < config->threads && NT_SUCCESS(status); i++) {
+        BenchWorker* worker = &workers[i];
+        worker->stop = &stop;
+        worker->go = CreateEventA(NULL, FALSE, FALSE, NULL);
+        worker->done = CreateEventA(NULL, FALSE, FALSE, NULL);
+        if (worker->go && worker->done)
+            worker->thread = CreateThread(NULL, 0, BenchThreadProc, worker, 0, NULL);
+        if (!worker->thread) {
+            status = STATUS_INSUFFICIENT_RESOURCES;
+            break;
+        }
+        started++;
+    }
+
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    uint64_t total_steps = (uint64_t)config->warmup_steps + config->measured_steps;
+    uint64_t peak_rss = 0, private_start = 0, private_end = 0;
+#ifdef _DEBUG
+    _CrtMemState heap_start, heap_end;
+#endif
+    LARGE_INTEGER run_start, run_end;
+    run_start.QuadPart = run_end.QuadPart = 0;
+
+    for (uint64_t step = 0; step < total_steps && NT_SUCCESS(status); step++) {
+        bool measuring = step >= config->warmup_steps;
+        if (step == config->warmup_steps) {
+            for (uint32_t i = 0; i < config->threads; i++) workers[i].measuring = true;
+            Bench_MemoryCounters(&peak_rss, &private_start);
+#ifdef _DEBUG
+            _CrtMemCheckpoint(&heap_start);
+#endif
+            QueryPerformanceCounter(&run_start);
+        }
+
+        LARGE_INTEGER t0, t1;
+        QueryPerformanceCounter(&t0);
+        for (uint32_t i = 1; i <= started; i++) SetEvent(workers[i].go);
+        status = Bench_RunShare(&workers[0]);
+        for (uint32_t i = 1; i <= started; i++) {
+            WaitForSingleObject(workers[i].done, INFINITE);
+            if (NT_SUCCESS(status)) status = workers[i].status;
+        }
+        QueryPerformanceCounter(&t1);
+
+        if (measuring) {
+            latencies[step - config->warmup_steps] =
+                (double)(t1.QuadPart - t0.QuadPart) * 1000000.0 / (double)freq.QuadPart;
+        }
+    }
+    QueryPerformanceCounter(&run_end);
+
+    if (NT_SUCCESS(status)) {
+        uint32_t n = config->measured_steps;
+#ifdef _DEBUG
+        _CrtMemCheckpoint(&heap_end);
+        report->alloc_bytes_per_step = (int64_t)((heap_end.lTotalCount - heap_start.lTotalCount) / n);
+#endif
+        Bench_MemoryCounters(&peak_rss, &private_end);
+        report->commit_growth_per_step = ((int64_t)private_end - (int64_t)private_start) / (int64_t)n;
+        report->peak_rss_bytes = peak_rss;
+
+        double sum = 0.0;
+        for (uint32_t i = 0; i < n; i++) sum += latencies[i];
+        qsort(latencies, n, sizeof(double), Bench_CompareDouble);
+        report->step_mean_us = sum / n;
+        report->step_p50_us = Bench_Percentile(latencies, n, 0.50);
+        report->step_p90_us = Bench_Percentile(latencies, n, 0.90);
+        report->step_p99_us = Bench_Percentile(latencies, n, 0.99);
+        report->step_max_us = latencies[n - 1];
+
+        report->samples = (uint64_t)n * config->batch_size;
+        report->elapsed_ms = (double)(run_end.QuadPart - run_start.QuadPart) * 1000.0 / (double)freq.QuadPart;
+        report->samples_per_sec = report->elapsed_ms > 0.0 ? report->samples * 1000.0 / report->elapsed_ms : 0.0;
+        report->final_loss = workers[0].pipeline.last_metrics.loss;
+        for (uint32_t i = 0; i < config->threads; i++) report->data_wait_us += workers[i].data_wait_us;
+    }
+
+    InterlockedExchange(&stop, 1);
+    for (uint32_t i = 1; i <= started; i++) {
+        SetEvent(workers[i].go);
+        WaitForSingleObject(workers[i].thread, INFINITE);
+        CloseHandle(workers[i].thread);
+    }
+    for (uint32_t i = 0; i < config->threads; i++) Bench_ReleaseWorker(&workers[i]);
+    free(latencies);
+    free(workers);
+    return status;
+}
+
+static void Bench_WriteJsonString(FILE* out, const char* s) {
+    fputc('"', out);
+    for (; s && *s; s++) {
+        if (*s == '"' || *s == '\\') fputc('\\', out);
+        if ((unsigned char)*s >= 0x20) fputc(*s, out);
+    }
+    fputc('"', out);
+}
+
+void TrainingBench_WriteJson(const TrainingBenchReport* report, FILE* out) {
+    if (!report || !out) return;
+    const TrainingBenchConfig* c = &report->config;
+    fprintf(out, "{\n");
+    fprintf(out, "  \"benchmark\": \"train\",\n");
+    fprintf(out, "  \"warmup_steps\": %u,\n", c->warmup_steps);
+    fprintf(out, "  \"measured_steps\": %u,\n", c->measured_steps);
+    fprintf(out, "  \"batch_size\": %u,\n", c->batch_size);
+    fprintf(out, "  \"threads\": %u,\n", c->threads);
+    fprintf(out, "  \"prefetch_depth\": %u,\n", c->prefetch_depth);
+    fprintf(out, "  \"replay_fraction\": %.3f,\n", c->replay_fraction);
+    fprintf(out, "  \"data\": ");
+    if (c->corpus_path) Bench_WriteJsonString(out, c->corpus_path);
+    else fprintf(out, "\"synthetic\"");
+    fprintf(out, ",\n");
+    fprintf(out, "  \"samples\": %llu,\n", (unsigned long long)report->samples);
+    fprintf(out, "  \"elapsed_ms\": %.3f,\n", report->elapsed_ms);
+    fprintf(out, "  \"samples_per_sec\": %.1f,\n", report->samples_per_sec);
+    fprintf(out, "  \"step_latency_us\": { \"mean\": %.1f, \"p50\": %.1f, \"p90\": %.1f, \"p99\": %.1f, \"max\": %.1f },\n",
+        report->step_mean_us, report->step_p50_us, report->step_p90_us, report->step_p99_us, report->step_max_us);
+    fprintf(out, "  \"data_wait_us\": %llu,\n", (unsigned long long)report->data_wait_us);
+    if (report->alloc_bytes_per_step >= 0)
+        fprintf(out, "  \"alloc_bytes_per_step\": %lld,\n", (long long)report->alloc_bytes_per_step);
+    else
+        fprintf(out, "  \"alloc_bytes_per_step\": null,\n");
+    fprintf(out, "  \"commit_growth_bytes_per_step\": %lld,\n", (long long)report->commit_growth_per_step);
+    fprintf(out, "  \"peak_rss_bytes\": %llu,\n", (unsigned long long)report->peak_rss_bytes);
+    fprintf(out, "  \"final_loss\": %.6f\n", report->final_loss);
+    fprintf(out, "}\n");
+}
@@ -0,0 +1,388 @@
+/*
+ * Training Corpus - Raijin
+ * Owner: Core/Training
+ * Inputs: Directory of local text (build), packed shard file + sample geometry (read)
+ * Outputs: Shard file; fixed-size (input, next-byte target) samples in shuffled order
+ * Invariants: Shard is mapped read-only; the shuffle buffer never holds more than
+ *             shuffle_blocks blocks of sample indices; every sample is drawn once per epoch
+ * Budget: Address space for the mapping, 8 bytes per buffered sample, 4 bytes per block
+ * Failure modes: Bad magic/version/size -> STATUS_DATA_ERROR; empty build -> STATUS_NOT_FOUND
+ * Recovery: Build writes <shard>.tmp and renames, so a crash never leaves a half shard in place
+ */
+
+#include "../../Include/training_corpus.h"
+#include "../../Include/raijin_ntstatus.h"
+#include "../../Include/qpc_clock.h"
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CORPUS_COPY_CHUNK (1u << 20)
+#define CORPUS_BINARY_PROBE 4096
+#define CORPUS_MAX_DEPTH 64
+
+// Building
+
+typedef struct CorpusBuilder {
+    HANDLE out;
+    const char* extensions;
+    const char* skip_path;               /* the .tmp being written, in case it sits inside the tree */
+    uint8_t* chunk;
+    TrainingCorpusBuildStats stats;
+    NTSTATUS status;                     /* first write failure */
+} CorpusBuilder;
+
+static char Corpus_Lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+static bool Corpus_ExtensionAllowed(const char* name, const char* extensions) {
+    if (!extensions || !extensions[0]) return true;
+    const char* ext = strrchr(name, '.');
+    if (!ext) return false;
+    size_t ext_len = strlen(ext);
+    const char* p = extensions;
+    while (*p) {
+        const char* end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        if (len == ext_len) {
+            size_t i = 0;
+            while (i < len && Corpus_Lower(p[i]) == Corpus_Lower(ext[i])) i++;
+            if (i == len) return true;
+        }
+        if (!end) break;
+        p = end + 1;
+    }
+    return false;
+}
+
+static bool Corpus_Write(CorpusBuilder* b, const void* data, DWORD size) {
+    DWORD written = 0;
+    if (!WriteFile(b->out, data, size, &written, NULL) || written != size) {
+        b->status = STATUS_UNSUCCESSFUL;
+        return false;
+    }
+    return true;
+}
+
+static void Corpus_PackFile(CorpusBuilder* b, const char* path) {
+    HANDLE in = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (in == INVALID_HANDLE_VALUE) {
+        b->stats.files_skipped++;
+        return;
+    }
+
+    DWORD got = 0;
+    if (!ReadFile(in, b->chunk, CORPUS_COPY_CHUNK, &got, NULL) || got == 0 ||
+        memchr(b->chunk, 0, got < CORPUS_BINARY_PROBE ? got : CORPUS_BINARY_PROBE)) {
+        CloseHandle(in);
+        b->stats.files_skipped++;
+        return;
+    }
+
+    uint64_t packed = 0;
+    while (got > 0 && Corpus_Write(b, b->chunk, got)) {
+        packed += got;
+        if (!ReadFile(in, b->chunk, CORPUS_COPY_CHUNK, &got, NULL)) break;
+    }
+    CloseHandle(in);
+
+    if (Corpus_Write(b, "\n", 1)) packed++;
+    b->stats.files_packed++;
+    b->stats.bytes_packed += packed;
+}
+
+static void Corpus_PackDirectory(CorpusBuilder* b, const char* directory, uint32_t depth) {
+    if (depth > CORPUS_MAX_DEPTH || b->status != STATUS_SUCCESS) return;
+
+    char pattern[TRAINING_CORPUS_PATH_MAX];
+    if (snprintf(pattern, sizeof(pattern), "%s\\*", directory) >= (int)sizeof(pattern)) return;
+
+    WIN32_FIND_DATAA fd;
+    HANDLE find = FindFirstFileA(pattern, &fd);
+    if (find == INVALID_HANDLE_VALUE) return;
+    do {
+        // Dot entries, hidden trees (.git, .vs) and junctions are never corpus material
+        if (fd.cFileName[0] == '.') continue;
+        char path[TRAINING_CORPUS_PATH_MAX];
+        if (snprintf(path, sizeof(path), "%s\\%s", directory, fd.cFileName) >= (int)sizeof(path)) {
+            b->stats.files_skipped++;
+            continue;
+        }
+        if (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            if (!(fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+                Corpus_PackDirectory(b, path, depth + 1);
+        } else if (strcmp(path, b->skip_path) != 0 && Corpus_ExtensionAllowed(fd.cFileName, b->extensions)) {
+            Corpus_PackFile(b, path);
+        } else {
+            b->stats.files_skipped++;
+        }
+    } while (b->status == STATUS_SUCCESS && FindNextFileA(find, &fd));
+    FindClose(find);
+}
+
+NTSTATUS TrainingCorpus_BuildShard(const char* directory, const char* shard_path,
+    const char* extensions, TrainingCorpusBuildStats* stats) {
+    if (!directory || !shard_path) return STATUS_INVALID_PARAMETER;
+
+    char temp_path[TRAINING_CORPUS_PATH_MAX];
+    if (snprintf(temp_path, sizeof(temp_path), "%s.tmp", shard_path) >= (int)sizeof(temp_path))
+        return STATUS_INVALID_PARAMETER;
+
+    CorpusBuilder b;
+    memset(&b, 0, sizeof(b));
+    b.extensions = extensions;
+    b.skip_path = temp_path;
+    b.status = STATUS_SUCCESS;
+    b.chunk = (uint8_t*)malloc(CORPUS_COPY_CHUNK);
+    if (!b.chunk) return STATUS_INSUFFICIENT_RESOURCES;
+
+    b.out = CreateFileA(temp_path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (b.out == INVALID_HANDLE_VALUE) {
+        free(b.chunk);
+        return STATUS_ACCESS_DENIED;
+    }
+
+    // Placeholder header: zero magic until the data is complete
+    TrainingCorpusHeader header;
+    memset(&header, 0, sizeof(header));
+    Corpus_Write(&b, &header, sizeof(header));
+    Corpus_PackDirectory(&b, directory, 0);
+
+    NTSTATUS status = b.status;
+    if (NT_SUCCESS(status) && b.stats.files_packed == 0) status = STATUS_NOT_FOUND;
+    if (NT_SUCCESS(status)) {
+        header.magic = TRAINING_CORPUS_MAGIC;
+        header.version = TRAINING_CORPUS_VERSION;
+        header.file_count = b.stats.files_packed;
+        header.data_offset = sizeof(TrainingCorpusHeader);
+        header.data_bytes = b.stats.bytes_packed;
+        LARGE_INTEGER zero;
+        zero.QuadPart = 0;
+        if (!SetFilePointerEx(b.out, zero, NULL, FILE_BEGIN) || !Corpus_Write(&b, &header, sizeof(header)) ||
+            !FlushFileBuffers(b.out))
+            status = STATUS_UNSUCCESSFUL;
+    }
+    CloseHandle(b.out);
+    free(b.chunk);
+
+    if (NT_SUCCESS(status) && !MoveFileExA(temp_path, shard_path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+        status = STATUS_UNSUCCESSFUL;
+    if (!NT_SUCCESS(status)) DeleteFileA(temp_path);
+    if (stats) memcpy(stats, &b.stats, sizeof(TrainingCorpusBuildStats));
+    return status;
+}
+
+// Reading
+
+// PrefetchVirtualMemory is Windows 8+; resolved at runtime so older SDK headers still build
+typedef struct CorpusMemoryRange {
+    PVOID address;
+    SIZE_T bytes;
+} CorpusMemoryRange;
+typedef BOOL (WINAPI *CorpusPrefetchFn)(HANDLE, ULONG_PTR, CorpusMemoryRange*, ULONG);
+static CorpusPrefetchFn g_corpus_prefetch = NULL;
+static volatile LONG g_corpus_prefetch_resolved = 0;
+
+static uint64_t Corpus_Random(TrainingCorpus* corpus) {
+    uint64_t x = corpus->rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    corpus->rng = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+static void Corpus_ShuffleBlocks(TrainingCorpus* corpus) {
+    for (uint32_t i = corpus->block_count - 1; i > 0; i--) {
+        uint32_t j = (uint32_t)(Corpus_Random(corpus) % (i + 1));
+        uint32_t t = corpus->block_order[i];
+        corpus->block_order[i] = corpus->block_order[j];
+        corpus->block_order[j] = t;
+    }
+}
+
+static void Corpus_HintBlock(const TrainingCorpus* corpus, uint32_t block) {
+    if (!g_corpus_prefetch) return;
+    uint64_t begin = (uint64_t)block * corpus->samples_per_block * corpus->input_size;
+    uint64_t end = begin + (uint64_t)corpus->samples_per_block * corpus->input_size + 1;
+    if (end > corpus->data_bytes) end = corpus->data_bytes;
+    CorpusMemoryRange range;
+    range.address = (PVOID)(corpus->data + begin);
+    range.bytes = (SIZE_T)(end - begin);
+    g_corpus_prefetch(GetCurrentProcess(), 1, &range, 0);
+}
+
+// Moves the next block of the epoch into the shuffle buffer and asks the OS to read ahead the
+// one after it, so the page faults of the following refill are already in flight
+static void Corpus_LoadNextBlock(TrainingCorpus* corpus) {
+    if (corpus->next_block == corpus->block_count) {
+        corpus->stats.epochs++;
+        Corpus_ShuffleBlocks(corpus);
+        corpus->next_block = 0;
+    }
+    uint32_t block = corpus->block_order[corpus->next_block++];
+    uint64_t first = (uint64_t)block * corpus->samples_per_block;
+    uint64_t last = first + corpus->samples_per_block;
+    if (last > corpus->sample_count) last = corpus->sample_count;
+    for (uint64_t s = first; s < last; s++)
+        corpus->buffer[corpus->buffer_count++] = s;
+    corpus->stats.blocks_loaded++;
+
+    Corpus_HintBlock(corpus, block);
+    if (corpus->next_block < corpus->block_count)
+        Corpus_HintBlock(corpus, corpus->block_order[corpus->next_block]);
+}
+
+void TrainingCorpus_GetDefaultConfig(TrainingCorpusConfig* config) {
+    if (!config) return;
+    memset(config, 0, sizeof(TrainingCorpusConfig));
+    config->block_bytes = TRAINING_CORPUS_DEFAULT_BLOCK_BYTES;
+    config->shuffle_blocks = TRAINING_CORPUS_DEFAULT_SHUFFLE_BLOCKS;
+    config->seed = 0x9E3779B97F4A7C15ULL;
+}
+
+NTSTATUS TrainingCorpus_Open(TrainingCorpus* corpus, const char* shard_path, size_t input_size,
+    size_t target_size, const TrainingCorpusConfig* config) {
+    if (!corpus || !shard_path || input_size == 0 || target_size == 0) return STATUS_INVALID_PARAMETER;
+    if (strlen(shard_path) >= TRAINING_CORPUS_PATH_MAX) return STATUS_INVALID_PARAMETER;
+
+    memset(corpus, 0, sizeof(TrainingCorpus));
+    if (config) memcpy(&corpus->config, config, sizeof(TrainingCorpusConfig));
+    else TrainingCorpus_GetDefaultConfig(&corpus->config);
+    if (corpus->config.block_bytes == 0) corpus->config.block_bytes = TRAINING_CORPUS_DEFAULT_BLOCK_BYTES;
+    if (corpus->config.shuffle_blocks == 0) corpus->config.shuffle_blocks = 1;
+    if (corpus->config.shuffle_blocks > TRAINING_CORPUS_MAX_SHUFFLE_BLOCKS)
+        corpus->config.shuffle_blocks = TRAINING_CORPUS_MAX_SHUFFLE_BLOCKS;
+    strcpy(corpus->path, shard_path);
+    corpus->input_size = input_size;
+    corpus->target_size = target_size;
+
+    if (InterlockedCompareExchange(&g_corpus_prefetch_resolved, 1, 0) == 0) {
+        HMODULE kernel = GetModuleHandleA("kernel32.dll");
+        if (kernel) g_corpus_prefetch = (CorpusPrefetchFn)GetProcAddress(kernel, "PrefetchVirtualMemory");
+    }
+
+    corpus->file = CreateFileA(shard_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                               FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (corpus->file == INVALID_HANDLE_VALUE) {
+        corpus->file = NULL;
+        return STATUS_NOT_FOUND;
+    }
+
+    NTSTATUS status = STATUS_DATA_ERROR;
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(corpus->file, &length) || length.QuadPart < (LONGLONG)sizeof(TrainingCorpusHeader))
+        goto fail;
+    corpus->mapping = CreateFileMappingA(corpus->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!corpus->mapping) goto fail;
+    corpus->view = (const uint8_t*)MapViewOfFile(corpus->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!corpus->view) goto fail;
+
+    {
+        TrainingCorpusHeader header;
+        memcpy(&header, corpus->view, sizeof(header));
+        uint64_t file_bytes = (uint64_t)length.QuadPart;
+        if (header.magic != TRAINING_CORPUS_MAGIC || header.version != TRAINING_CORPUS_VERSION ||
+            header.data_offset < sizeof(TrainingCorpusHeader) || header.data_offset > file_bytes ||
+            header.data_bytes > file_bytes - header.data_offset)
+            goto fail;
+        corpus->data = corpus->view + header.data_offset;
+        corpus->data_bytes = header.data_bytes;
+        corpus->file_count = header.file_count;
+    }
+
+    {
+        // Every sample needs its input window and the target window one byte further on
+        uint64_t span = input_size > target_size + 1 ? input_size : target_size + 1;
+        if (corpus->data_bytes < span) goto fail;
+        corpus->sample_count = (corpus->data_bytes - span) / input_size + 1;
+
+        uint64_t per_block = corpus->config.block_bytes / input_size;
+        corpus->samples_per_block = per_block ? (uint32_t)(per_block < 0xFFFFFFFFu ? per_block : 0xFFFFFFFFu) : 1;
+        uint64_t blocks = (corpus->sample_count + corpus->samples_per_block - 1) / corpus->samples_per_block;
+        if (blocks > 0xFFFFFFFFu) {
+            status = STATUS_INVALID_PARAMETER;
+            goto fail;
+        }
+        corpus->block_count = (uint32_t)blocks;
+        if (corpus->config.shuffle_blocks > corpus->block_count)
+            corpus->config.shuffle_blocks = corpus->block_count;
+    }
+
+    status = STATUS_INSUFFICIENT_RESOURCES;
+    corpus->buffer_capacity = corpus->config.shuffle_blocks * corpus->samples_per_block;
+    corpus->low_water = corpus->buffer_capacity - corpus->samples_per_block;
+    corpus->block_order = (uint32_t*)malloc((size_t)corpus->block_count * sizeof(uint32_t));
+    corpus->buffer = (uint64_t*)malloc((size_t)corpus->buffer_capacity * sizeof(uint64_t));
+    if (!corpus->block_order || !corpus->buffer) goto fail;
+    for (uint32_t i = 0; i < corpus->block_count; i++) corpus->block_order[i] = i;
+
+    corpus->rng = corpus->config.seed ? corpus->config.seed : 0x9E3779B97F4A7C15ULL;
+    Corpus_ShuffleBlocks(corpus);
+    corpus->initialized = true;
+    return STATUS_SUCCESS;
+
+fail:
+    corpus->initialized = true;
+    TrainingCorpus_Close(corpus);
+    return status;
+}
+
+void TrainingCorpus_Close(TrainingCorpus* corpus) {
+    if (!corpus || !corpus->initialized) return;
+    free(corpus->buffer);
+    free(corpus->block_order);
+    if (corpus->view) UnmapViewOfFile(corpus->view);
+    if (corpus->mapping) CloseHandle(corpus->mapping);
+    if (corpus->file) CloseHandle(corpus->file);
+    memset(corpus, 0, sizeof(TrainingCorpus));
+}
+
+NTSTATUS TrainingCorpus_NextSample(TrainingCorpus* corpus, uint8_t* input, uint8_t* target) {
+    if (!corpus || !input || !target) return STATUS_INVALID_PARAMETER;
+    if (!corpus->initialized) return STATUS_INVALID_DEVICE_STATE;
+
+    if (corpus->stats.samples == 0) QueryPerformanceCounter(&corpus->start_qpc);
+    // Top up before drawing so the choice spans shuffle_blocks blocks; the buffer drains at the
+    // end of an epoch so no sample repeats before every other one has been drawn
+    while (corpus->buffer_count <= corpus->low_water &&
+           (corpus->next_block < corpus->block_count || corpus->buffer_count == 0))
+        Corpus_LoadNextBlock(corpus);
+
+    uint32_t pick = (uint32_t)(Corpus_Random(corpus) % corpus->buffer_count);
+    uint64_t sample = corpus->buffer[pick];
+    corpus->buffer[pick] = corpus->buffer[--corpus->buffer_count];
+
+    const uint8_t* window = corpus->data + sample * corpus->input_size;
+    memcpy(input, window, corpus->input_size);
+    memcpy(target, window + 1, corpus->target_size);
+
+    corpus->stats.samples++;
+    corpus->stats.bytes += corpus->input_size + corpus->target_size;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TrainingCorpus_BatchSource(void* context, uint64_t sequence, uint8_t* input, size_t input_size,
+    uint8_t* target, size_t target_size) {
+    (void)sequence;
+    TrainingCorpus* corpus = (TrainingCorpus*)context;
+    if (!corpus || input_size != corpus->input_size || target_size != corpus->target_size)
+        return STATUS_INVALID_PARAMETER;
+    return TrainingCorpus_NextSample(corpus, input, target);
+}
+
+void TrainingCorpus_GetStats(const TrainingCorpus* corpus, TrainingCorpusStats* out) {
+    if (!corpus || !out) return;
+    memcpy(out, &corpus->stats, sizeof(TrainingCorpusStats));
+    if (corpus->stats.samples > 0) {
+        LARGE_INTEGER now, freq;
+        QueryPerformanceCounter(&now);
+        QueryPerformanceFrequency(&freq);
+        out->elapsed_us = QpcClock_TicksToUs((uint64_t)(now.QuadPart - corpus->start_qpc.QuadPart), (uint64_t)freq.QuadPart);
+        if (out->elapsed_us > 0)
+            out->samples_per_sec = (double)corpus->stats.samples * 1000000.0 / (double)out->elapsed_us;
+    }
+}
@@ -0,0 +1,483 @@
+/*
+ * Training Data Parallel - Raijin
+ * Owner: Core/Training
+ * Inputs: Source NeuralSubstrate, TrainingDataParallelConfig (workers, steps, batch, rate, seed)
+ * Outputs: Trained substrate weights, throughput and allreduce timing
+ * Invariants: One shared block (malloc or named mapping) holds the header and one gradient
+ *             buffer per rank; during allreduce round s a rank writes only chunk (rank - s - 1)
+ *             (reduce-scatter) or (rank - s) (all-gather) of its own buffer and reads the same
+ *             chunk of its left neighbour, and every round ends at a barrier
+ * Budget: One replica and one parameter-sized gradient buffer per worker; 2 (K - 1) barriers and
+ *         2 (K - 1) / K of the gradient moved per rank per step
+ * Failure modes: Worker spawn/init failure or a failed step -> abort flag set, every rank leaves
+ *                its next barrier within TRAINING_DP_BARRIER_TIMEOUT_MS and Run returns an error
+ * Recovery: The source substrate is only written after every rank finished cleanly
+ */
+
+#include "../../Include/training_dataparallel.h"
+#include "../../Include/training_pipeline.h"
+#include "../../Include/qpc_clock.h"
+#include "../../Include/raijin_ntstatus.h"
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define DP_SHARED_MAGIC 0x50444152u  /* "RADP" */
+#define DP_CACHE_LINE 64
+
+typedef struct DpRankStatus {
+    uint64_t steps_done;
+    double loss_sum;                     /* summed over the rank's share of the last step */
+    uint64_t compute_us;
+    uint64_t allreduce_us;
+    NTSTATUS status;
+    uint8_t pad[DP_CACHE_LINE - 4 * sizeof(uint64_t) - sizeof(NTSTATUS)];
+} DpRankStatus;
+
+typedef struct DpSharedHeader {
+    uint32_t magic;
+    uint32_t workers;
+    uint32_t steps;
+    uint32_t batch;
+    float learning_rate;
+    uint32_t reserved;
+    uint64_t seed;
+    uint64_t parameters;
+    uint64_t neurons;
+    uint64_t gradient_offset;
+    uint64_t gradient_stride;
+    volatile LONG abort;
+    volatile LONG barrier_count;
+    volatile LONG barrier_generation;
+    char state_path[MAX_PATH];           /* process mode: substrate every worker loads */
+    char result_path[MAX_PATH];          /* process mode: rank 0 saves the trained substrate here */
+    char barrier_names[2][TRAINING_DP_MAPPING_NAME_MAX];
+    DpRankStatus rank[TRAINING_DP_MAX_WORKERS];
+} DpSharedHeader;
+
+typedef struct DpRank {
+    uint8_t* shared;
+    uint32_t rank;
+    HANDLE barrier[2];                   /* semaphores alternating by barrier generation */
+    NeuralSubstrate* substrate;
+    NeuralSubstrate replica;             /* thread mode */
+    RoleBoundaryContext role_ctx;        /* thread mode */
+    HANDLE thread;
+} DpRank;
+
+static size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static DpSharedHeader* Dp_Header(uint8_t* shared) {
+    return (DpSharedHeader*)shared;
+}
+
+static float* Dp_Gradient(uint8_t* shared, uint32_t rank) {
+    DpSharedHeader* hdr = Dp_Header(shared);
+    return (float*)(shared + hdr->gradient_offset + (size_t)rank * hdr->gradient_stride);
+}
+
+// Same measure as the pipeline's loss: mean squared byte error scaled to [0, 1]
+static double Dp_Loss(const uint8_t* output, const uint8_t* target, size_t size) {
+    double sum = 0.0;
+    for (size_t i = 0; i < size; i++) {
+        double d = (double)output[i] - (double)target[i];
+        sum += d * d;
+    }
+    return sum / (size * 65536.0);
+}
+
+/*
+ * Sense-reversing barrier across threads or processes. The last arrival resets the count,
+ * advances the generation and releases everyone else on that generation's semaphore. Two
+ * semaphores alternate so a fast rank already waiting on the next barrier can never take a
+ * permit meant for a slow rank still leaving this one.
+ */
+static NTSTATUS Dp_Barrier(DpRank* r) {
+    DpSharedHeader* hdr = Dp_Header(r->shared);
+    LONG generation = InterlockedCompareExchange(&hdr->barrier_generation, 0, 0);
+    HANDLE sem = r->barrier[generation & 1];
+    if ((uint32_t)InterlockedIncrement(&hdr->barrier_count) == hdr->workers) {
+        InterlockedExchange(&hdr->barrier_count, 0);
+        InterlockedIncrement(&hdr->barrier_generation);
+        if (hdr->workers > 1) ReleaseSemaphore(sem, (LONG)hdr->workers - 1, NULL);
+        return STATUS_SUCCESS;
+    }
+    for (;;) {
+        if (WaitForSingleObject(sem, TRAINING_DP_BARRIER_TIMEOUT_MS) == WAIT_OBJECT_0) return STATUS_SUCCESS;
+        if (hdr->abort) return STATUS_UNSUCCESSFUL;
+    }
+}
+
+static void Dp_Chunk(uint64_t parameters, uint32_t workers, uint32_t chunk, uint64_t* begin, uint64_t* end) {
+    *begin = parameters * chunk / workers;
+    *end = parameters * (chunk + 1) / workers;
+}
+
+// Ring allreduce (sum) of every rank's gradient buffer in place
+static NTSTATUS Dp_Allreduce(DpRank* r) {
+    DpSharedHeader* hdr = Dp_Header(r->shared);
+    uint32_t k = hdr->workers;
+    float* mine = Dp_Gradient(r->shared, r->rank);
+    const float* left = Dp_Gradient(r->shared, (r->rank + k - 1) % k);
+    NTSTATUS status = STATUS_SUCCESS;
+
+    // Reduce-scatter: after round s this rank holds ranks (rank - s - 1 .. rank) of its chunk;
+    // after K - 1 rounds chunk (rank + 1) is complete here
+    for (uint32_t s = 0; s + 1 < k && NT_SUCCESS(status); s++) {
+        uint64_t begin, end;
+        Dp_Chunk(hdr->parameters, k, (r->rank + 2 * k - s - 1) % k, &begin, &end);
+        for (uint64_t j = begin; j < end; j++) mine[j] += left[j];
+        status = Dp_Barrier(r);
+    }
+    // All-gather: pass each completed chunk one rank to the right, K - 1 times
+    for (uint32_t s = 0; s + 1 < k && NT_SUCCESS(status); s++) {
+        uint64_t begin, end;
+        Dp_Chunk(hdr->parameters, k, (r->rank + k - s) % k, &begin, &end);
+        memcpy(mine + begin, left + begin, (size_t)(end - begin) * sizeof(float));
+        status = Dp_Barrier(r);
+    }
+    return status;
+}
+
+static NTSTATUS Dp_RankTrain(DpRank* r) {
+    DpSharedHeader* hdr = Dp_Header(r->shared);
+    DpRankStatus* me = &hdr->rank[r->rank];
+    uint64_t parameters = hdr->parameters;
+    float* gradient = Dp_Gradient(r->shared, r->rank);
+    float rate = hdr->learning_rate > 0.0f ? hdr->learning_rate : (float)PLASTICITY_RATE;
+
+    // The pipeline only supplies the synthetic generator and its buffers here
+    TrainingPipeline generator;
+    float* state = (float*)malloc((size_t)hdr->neurons * sizeof(float));
+    uint8_t* output = (uint8_t*)malloc(TRAINING_TARGET_SIZE);
+    NTSTATUS status = TrainingPipeline_Initialize(&generator, r->substrate, NULL);
+    bool generator_ready = NT_SUCCESS(status);
+    if (NT_SUCCESS(status) && (!state || !output)) status = STATUS_INSUFFICIENT_RESOURCES;
+    if (NT_SUCCESS(status) && NeuralSubstrate_GetParameterCount(r->substrate) != parameters)
+        status = STATUS_INVALID_DEVICE_STATE;
+    if (NT_SUCCESS(status)) status = NeuralSubstrate_GetActivations(r->substrate, state, hdr->neurons);
+
+    for (uint32_t step = 0; step < hdr->steps && NT_SUCCESS(status); step++) {
+        uint64_t t0 = QpcClock_NowUs();
+        memset(gradient, 0, (size_t)parameters * sizeof(float));
+        double loss_sum = 0.0;
+        for (uint32_t i = r->rank; i < hdr->batch && NT_SUCCESS(status); i += hdr->workers) {
+            uint64_t sample = (uint64_t)step * hdr->batch + i;
+            TrainingPipeline_GenerateSyntheticBatch(&generator, (uint32_t)(hdr->seed + sample));
+            NeuralSubstrate_SetActivations(r->substrate, state, hdr->neurons);
+            ReseedChaos(hdr->seed ^ (sample * 0x9E3779B97F4A7C15ull));
+            status = NeuralSubstrate_Process(r->substrate, generator.synthetic_input, TRAINING_INPUT_SIZE,
+                output, TRAINING_TARGET_SIZE);
+            if (NT_SUCCESS(status)) {
+                status = NeuralSubstrate_AccumulateGradient(r->substrate, generator.synthetic_target,
+                    TRAINING_TARGET_SIZE, gradient, parameters);
+            }
+            loss_sum += Dp_Loss(output, generator.synthetic_target, TRAINING_TARGET_SIZE);
+        }
+        uint64_t t1 = QpcClock_NowUs();
+        if (!NT_SUCCESS(status)) break;
+
+        status = Dp_Barrier(r);
+        if (NT_SUCCESS(status)) status = Dp_Allreduce(r);
+        if (NT_SUCCESS(status)) status = NeuralSubstrate_ApplyGradient(r->substrate, gradient, parameters,
+            rate / (float)hdr->batch);
+        me->compute_us += t1 - t0;
+        me->allreduce_us += QpcClock_NowUs() - t1;
+        me->loss_sum = loss_sum;
+        if (NT_SUCCESS(status)) me->steps_done = step + 1;
+    }
+
+    if (!NT_SUCCESS(status)) InterlockedExchange(&hdr->abort, 1);
+    me->status = status;
+    if (generator_ready) TrainingPipeline_Shutdown(&generator);
+    free(state);
+    free(output);
+    return status;
+}
+
+static DWORD WINAPI DpThreadProc(LPVOID param) {
+    DpRank* r = (DpRank*)param;
+
+    memset(&r->role_ctx, 0, sizeof(r->role_ctx));
+    r->role_ctx.initialized = true;
+    RoleBoundary_Enter(&r->role_ctx, "raijin.dp", ROLE_OWNER_RAIJIN);
+    RoleBoundary_BindThread(&r->role_ctx);
+
+    Dp_RankTrain(r);
+
+    RoleBoundary_BindThread(NULL);
+    RoleBoundary_Exit(&r->role_ctx, "raijin.dp");
+    return 0;
+}
+
+static NTSTATUS Dp_RunThreads(uint8_t* shared, HANDLE barrier[2], NeuralSubstrate* substrate) {
+    DpSharedHeader* hdr = Dp_Header(shared);
+    DpRank* ranks = (DpRank*)calloc(hdr->workers, sizeof(DpRank));
+    if (!ranks) return STATUS_INSUFFICIENT_RESOURCES;
+
+    HANDLE threads[TRAINING_DP_MAX_WORKERS];
+    uint32_t started = 0;
+    NTSTATUS result = STATUS_SUCCESS;
+    for (uint32_t i = 0; i < hdr->workers && NT_SUCCESS(result); i++) {
+        result = NeuralSubstrate_CreateReplica(&ranks[i].replica, substrate);
+    }
+    for (uint32_t i = 0; i < hdr->workers && NT_SUCCESS(result); i++) {
+        DpRank* r = &ranks[i];
+        r->shared = shared;
+        r->rank = i;
+        r->barrier[0] = barrier[0];
+        r->barrier[1] = barrier[1];
+        r->substrate = &r->replica;
+        // Ranks meet at a barrier every step, so each needs a thread of its own: as pool jobs,
+        // more ranks than free workers would deadlock
+        r->thread = CreateThread(NULL, 0, DpThreadProc, r, 0, NULL);
+        if (!r->thread) {
+            InterlockedExchange(&hdr->abort, 1);
+            result = STATUS_INSUFFICIENT_RESOURCES;
+            break;
+        }
+        threads[started++] = r->thread;
+    }
+
+    if (started > 0) WaitForMultipleObjects(started, threads, TRUE, INFINITE);
+    for (uint32_t i = 0; i < started; i++) {
+        CloseHandle(ranks[i].thread);
+        if (NT_SUCCESS(result) && !NT_SUCCESS(hdr->rank[i].status)) result = hdr->rank[i].status;
+    }
+    if (NT_SUCCESS(result)) result = NeuralSubstrate_CopyWeights(substrate, &ranks[0].replica);
+
+    for (uint32_t i = 0; i < hdr->workers; i++) {
+        if (ranks[i].replica.initialized) NeuralSubstrate_Shutdown(&ranks[i].replica);
+    }
+    free(ranks);
+    return result;
+}
+
+static NTSTATUS Dp_RunProcesses(uint8_t* shared, const char* mapping_name, NeuralSubstrate* substrate) {
+    DpSharedHeader* hdr = Dp_Header(shared);
+    char exe_path[MAX_PATH];
+    if (GetModuleFileNameA(NULL, exe_path, MAX_PATH) == 0) return STATUS_UNSUCCESSFUL;
+
+    HANDLE processes[TRAINING_DP_MAX_WORKERS];
+    uint32_t started = 0;
+    NTSTATUS result = STATUS_SUCCESS;
+    for (uint32_t i = 0; i < hdr->workers; i++) {
+        char cmdline[MAX_PATH + 128];
+        snprintf(cmdline, sizeof(cmdline), "\"%s\" --dp-worker %s %u", exe_path, mapping_name, i);
+        STARTUPINFOA si;
+        PROCESS_INFORMATION pi;
+        memset(&si, 0, sizeof(si));
+        memset(&pi, 0, sizeof(pi));
+        si.cb = sizeof(si);
+        if (!CreateProcessA(NULL, cmdline, NULL, NULL, FALSE, 0, NULL, NULL, &si, &pi)) {
+            InterlockedExchange(&hdr->abort, 1);
+            result = STATUS_UNSUCCESSFUL;
+            break;
+        }
+        CloseHandle(pi.hThread);
+        processes[started++] = pi.hProcess;
+    }
+
+    // Reap workers as they exit; the first failure aborts the rest at their next barrier
+    uint32_t remaining = started;
+    while (remaining > 0) {
+        DWORD wait = WaitForMultipleObjects(remaining, processes, FALSE, INFINITE);
+        if (wait >= WAIT_OBJECT_0 + remaining) {
+            InterlockedExchange(&hdr->abort, 1);
+            result = STATUS_UNSUCCESSFUL;
+            WaitForMultipleObjects(remaining, processes, TRUE, INFINITE);
+            for (uint32_t i = 0; i < remaining; i++) CloseHandle(processes[i]);
+            break;
+        }
+        uint32_t index = wait - WAIT_OBJECT_0;
+        DWORD exit_code = 1;
+        GetExitCodeProcess(processes[index], &exit_code);
+        if (exit_code != 0) {
+            InterlockedExchange(&hdr->abort, 1);
+            result = STATUS_UNSUCCESSFUL;
+        }
+        CloseHandle(processes[index]);
+        processes[index] = processes[--remaining];
+    }
+
+    if (NT_SUCCESS(result)) result = NeuralSubstrate_LoadState(substrate, hdr->result_path);
+    return result;
+}
+
+void TrainingDataParallel_GetDefaultConfig(TrainingDataParallelConfig* config) {
+    if (!config) return;
+    memset(config, 0, sizeof(TrainingDataParallelConfig));
+    config->workers = 1;
+    config->steps = TRAINING_DP_DEFAULT_STEPS;
+    config->batch = TRAINING_DP_DEFAULT_BATCH;
+    config->seed = 0x44415441504152ull;
+}
+
+NTSTATUS TrainingDataParallel_Run(const TrainingDataParallelConfig* config, NeuralSubstrate* substrate,
+    TrainingDataParallelStats* stats) {
+    if (!config || !substrate || !stats) return STATUS_INVALID_PARAMETER;
+    if (config->workers == 0 || config->workers > TRAINING_DP_MAX_WORKERS) return STATUS_INVALID_PARAMETER;
+    if (config->batch < config->workers || config->steps == 0) return STATUS_INVALID_PARAMETER;
+    if (!substrate->initialized) return STATUS_INVALID_DEVICE_STATE;
+    memset(stats, 0, sizeof(TrainingDataParallelStats));
+
+    uint64_t parameters = NeuralSubstrate_GetParameterCount(substrate);
+    if (parameters == 0) return STATUS_INVALID_DEVICE_STATE;
+    size_t gradient_offset = AlignUp(sizeof(DpSharedHeader), DP_CACHE_LINE);
+    size_t gradient_stride = AlignUp((size_t)parameters * sizeof(float), DP_CACHE_LINE);
+    size_t shared_size = gradient_offset + (size_t)config->workers * gradient_stride;
+
+    char mapping_name[TRAINING_DP_MAPPING_NAME_MAX];
+    snprintf(mapping_name, sizeof(mapping_name), "Local\\RaijinDP_%lu_%llu",
+             (unsigned long)GetCurrentProcessId(), (unsigned long long)GetTickCount64());
+    HANDLE mapping = NULL;
+    uint8_t* shared = NULL;
+    if (config->use_processes) {
+        mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+                                     (DWORD)((uint64_t)shared_size >> 32), (DWORD)(shared_size & 0xFFFFFFFF),
+                                     mapping_name);
+        if (mapping) shared = (uint8_t*)MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, shared_size);
+        if (shared) memset(shared, 0, shared_size);
+    } else {
+        shared = (uint8_t*)calloc(1, shared_size);
+    }
+    if (!shared) {
+        if (mapping) CloseHandle(mapping);
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    DpSharedHeader* hdr = Dp_Header(shared);
+    hdr->magic = DP_SHARED_MAGIC;
+    hdr->workers = config->workers;
+    hdr->steps = config->steps;
+    hdr->batch = config->batch;
+    hdr->learning_rate = config->learning_rate;
+    hdr->seed = config->seed;
+    hdr->parameters = parameters;
+    hdr->neurons = substrate->fabric.active_neuron_count;
+    hdr->gradient_offset = gradient_offset;
+    hdr->gradient_stride = gradient_stride;
+
+    NTSTATUS status = STATUS_SUCCESS;
+    HANDLE barrier[2] = { NULL, NULL };
+    for (int i = 0; i < 2; i++) {
+        if (config->use_processes)
+            snprintf(hdr->barrier_names[i], sizeof(hdr->barrier_names[i]), "%s_b%d", mapping_name, i);
+        barrier[i] = CreateSemaphoreA(NULL, 0, (LONG)config->workers,
+                                      config->use_processes ? hdr->barrier_names[i] : NULL);
+        if (!barrier[i]) status = STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    // Process workers start from the same substrate by loading it from a temporary file
+    if (NT_SUCCESS(status) && config->use_processes) {
+        char temp_dir[MAX_PATH];
+        if (GetTempPathA(MAX_PATH, temp_dir) == 0) strcpy(temp_dir, ".\\");
+        snprintf(hdr->state_path, sizeof(hdr->state_path), "%s%s_init.bin", temp_dir, mapping_name + 6);
+        snprintf(hdr->result_path, sizeof(hdr->result_path), "%s%s_result.bin", temp_dir, mapping_name + 6);
+        status = NeuralSubstrate_SaveState(substrate, hdr->state_path);
+    }
+
+    uint64_t t0 = QpcClock_NowUs();
+    if (NT_SUCCESS(status)) {
+        status = config->use_processes ? Dp_RunProcesses(shared, mapping_name, substrate)
+                                       : Dp_RunThreads(shared, barrier, substrate);
+    }
+    uint64_t elapsed_us = QpcClock_NowUs() - t0;
+
+    if (NT_SUCCESS(status)) {
+        double loss = 0.0;
+        for (uint32_t i = 0; i < hdr->workers; i++) loss += hdr->rank[i].loss_sum;
+        stats->samples = (uint64_t)config->steps * config->batch;
+        stats->elapsed_ms = elapsed_us / 1000.0;
+        stats->samples_per_sec = elapsed_us ? stats->samples * 1000000.0 / elapsed_us : 0.0;
+        stats->final_loss = loss / config->batch;
+        stats->compute_us = hdr->rank[0].compute_us;
+        stats->allreduce_us = hdr->rank[0].allreduce_us;
+        stats->parameters = parameters;
+    }
+
+    if (config->use_processes) {
+        if (hdr->state_path[0]) DeleteFileA(hdr->state_path);
+        if (hdr->result_path[0]) DeleteFileA(hdr->result_path);
+    }
+    for (int i = 0; i < 2; i++) {
+        if (barrier[i]) CloseHandle(barrier[i]);
+    }
+    if (mapping) {
+        UnmapViewOfFile(shared);
+        CloseHandle(mapping);
+    } else {
+        free(shared);
+    }
+    return status;
+}
+
+NTSTATUS TrainingDataParallel_CompareWeights(const NeuralSubstrate* a, const NeuralSubstrate* b, double* max_diff) {
+    if (!a || !b || !max_diff) return STATUS_INVALID_PARAMETER;
+    if (!a->initialized || !b->initialized) return STATUS_INVALID_DEVICE_STATE;
+    if (a->fabric.active_neuron_count != b->fabric.active_neuron_count) return STATUS_INVALID_PARAMETER;
+
+    double worst = 0.0;
+    for (uint64_t i = 0; i < a->fabric.active_neuron_count; i++) {
+        const SparseNeuron* na = &a->fabric.neurons[i];
+        const SparseNeuron* nb = &b->fabric.neurons[i];
+        if (na->input_count != nb->input_count || !na->weights != !nb->weights) return STATUS_INVALID_PARAMETER;
+        for (uint32_t j = 0; na->weights && j < na->input_count; j++) {
+            double d = fabs((double)na->weights[j] - (double)nb->weights[j]);
+            if (d > worst) worst = d;
+        }
+    }
+    *max_diff = worst;
+    return STATUS_SUCCESS;
+}
+
+int TrainingDataParallel_WorkerMain(const char* mapping_name, uint32_t rank) {
+    if (!mapping_name) return 1;
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, mapping_name);
+    if (!mapping) return 1;
+    uint8_t* shared = (uint8_t*)MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!shared) {
+        CloseHandle(mapping);
+        return 1;
+    }
+
+    DpSharedHeader* hdr = Dp_Header(shared);
+    int exit_code = 1;
+    if (hdr->magic == DP_SHARED_MAGIC && rank < hdr->workers) {
+        DpRank r;
+        memset(&r, 0, sizeof(r));
+        r.shared = shared;
+        r.rank = rank;
+        r.barrier[0] = OpenSemaphoreA(SEMAPHORE_ALL_ACCESS, FALSE, hdr->barrier_names[0]);
+        r.barrier[1] = OpenSemaphoreA(SEMAPHORE_ALL_ACCESS, FALSE, hdr->barrier_names[1]);
+
+        NeuralSubstrate* neural = (NeuralSubstrate*)calloc(1, sizeof(NeuralSubstrate));
+        NTSTATUS status = STATUS_INSUFFICIENT_RESOURCES;
+        if (neural && r.barrier[0] && r.barrier[1]) status = NeuralSubstrate_Initialize(neural);
+        if (NT_SUCCESS(status)) status = NeuralSubstrate_LoadState(neural, hdr->state_path);
+        if (NT_SUCCESS(status)) {
+            r.substrate = neural;
+            status = Dp_RankTrain(&r);
+        } else {
+            hdr->rank[rank].status = status;
+            InterlockedExchange(&hdr->abort, 1);
+        }
+        if (NT_SUCCESS(status) && rank == 0) status = NeuralSubstrate_SaveState(neural, hdr->result_path);
+        if (NT_SUCCESS(status)) exit_code = 0;
+
+        if (neural) {
+            if (neural->initialized) NeuralSubstrate_Shutdown(neural);
+            free(neural);
+        }
+        if (r.barrier[0]) CloseHandle(r.barrier[0]);
+        if (r.barrier[1]) CloseHandle(r.barrier[1]);
+    }
+
+    UnmapViewOfFile(shared);
+    CloseHandle(mapping);
+    return exit_code;
+}
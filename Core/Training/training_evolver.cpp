@@ -0,0 +1,180 @@
+/*
+ * Training Evolver - Raijin
+ * Owner: Core/Training
+ * Inputs: Evolution engine, live neural substrate, Post/Exchange calls from the trainer thread
+ * Outputs: Evolution generations run concurrently with TrainStep; refreshed fitness snapshot
+ * Invariants: From Post until Exchange only the worker touches the engine and the snapshot,
+ *             however many TrainSteps the generation spans; a Poll that finds it in does not
+ *             hand them back, Exchange does. The worker never touches the live substrate
+ * Budget: One worker thread; one substrate replica (weights + activations); a polling trainer
+ *         does not wait at Exchange
+ * Failure modes: Snapshot rebuild fails -> evolver stops itself and the engine reverts to
+ *                evaluating against the live substrate inline
+ * Recovery: Stop always waits for a posted generation before joining, so no generation is cut short
+ */
+
+#include "../../Include/training_evolver.h"
+#include "../../Include/raijin_ntstatus.h"
+#include "../../Include/qpc_clock.h"
+#include <windows.h>
+#include <string.h>
+
+static uint64_t Evolver_ElapsedUs(const LARGE_INTEGER* start, const LARGE_INTEGER* end) {
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    return QpcClock_TicksToUs((uint64_t)(end->QuadPart - start->QuadPart), (uint64_t)freq.QuadPart);
+}
+
+static DWORD WINAPI EvolverThreadProc(LPVOID param) {
+    TrainingEvolver* evolver = (TrainingEvolver*)param;
+
+    memset(&evolver->role_ctx, 0, sizeof(evolver->role_ctx));
+    evolver->role_ctx.initialized = true;
+    RoleBoundary_Enter(&evolver->role_ctx, "raijin.evolver", ROLE_OWNER_RAIJIN);
+    RoleBoundary_BindThread(&evolver->role_ctx);
+
+    for (;;) {
+        WaitForSingleObject(evolver->go, INFINITE);
+        if (evolver->stop) break;
+
+        LARGE_INTEGER t0, t1;
+        QueryPerformanceCounter(&t0);
+        NTSTATUS status = EvolutionEngine_EvaluatePopulation(evolver->engine);
+        if (NT_SUCCESS(status)) status = EvolutionEngine_NextGeneration(evolver->engine);
+        if (NT_SUCCESS(status)) EvolutionEngine_EvaluatePopulation(evolver->engine);
+        QueryPerformanceCounter(&t1);
+
+        evolver->generation_status = status;
+        evolver->stats.generation_us += Evolver_ElapsedUs(&t0, &t1);
+        if (NT_SUCCESS(status)) evolver->stats.generations++;
+        SetEvent(evolver->done);
+    }
+
+    RoleBoundary_BindThread(NULL);
+    RoleBoundary_Exit(&evolver->role_ctx, "raijin.evolver");
+    return 0;
+}
+
+NTSTATUS TrainingEvolver_Start(TrainingEvolver* evolver, EvolutionEngine* engine, NeuralSubstrate* live) {
+    if (!evolver || !engine || !live) return STATUS_INVALID_PARAMETER;
+    if (evolver->initialized) return STATUS_INVALID_DEVICE_STATE;
+
+    memset(evolver, 0, sizeof(TrainingEvolver));
+    evolver->engine = engine;
+    evolver->live = live;
+    evolver->engine_substrate = engine->neural_system;
+    evolver->evolved_generation = engine->population.generation;
+
+    NTSTATUS status = NeuralSubstrate_CreateReplica(&evolver->snapshot, live);
+    if (!NT_SUCCESS(status)) return status;
+
+    evolver->go = CreateEventA(NULL, FALSE, FALSE, NULL);
+    evolver->done = CreateEventA(NULL, FALSE, FALSE, NULL);
+    // Waits on `go` between generations for the pipeline's lifetime, which would pin a pool worker
+    if (evolver->go && evolver->done)
+        evolver->thread = CreateThread(NULL, 0, EvolverThreadProc, evolver, 0, NULL);
+    if (!evolver->thread) {
+        if (evolver->go) CloseHandle(evolver->go);
+        if (evolver->done) CloseHandle(evolver->done);
+        NeuralSubstrate_Shutdown(&evolver->snapshot);
+        memset(evolver, 0, sizeof(TrainingEvolver));
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    engine->neural_system = &evolver->snapshot;
+    evolver->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void TrainingEvolver_Stop(TrainingEvolver* evolver) {
+    if (!evolver || !evolver->initialized) return;
+    if (evolver->posted) {
+        if (!evolver->finished) WaitForSingleObject(evolver->done, INFINITE);
+        evolver->posted = false;
+        evolver->finished = false;
+    }
+    InterlockedExchange(&evolver->stop, 1);
+    SetEvent(evolver->go);
+    WaitForSingleObject(evolver->thread, INFINITE);
+    CloseHandle(evolver->thread);
+    CloseHandle(evolver->go);
+    CloseHandle(evolver->done);
+    evolver->thread = NULL;
+    evolver->go = NULL;
+    evolver->done = NULL;
+
+    evolver->engine->neural_system = evolver->engine_substrate;
+    if (evolver->snapshot.initialized) NeuralSubstrate_Shutdown(&evolver->snapshot);
+    evolver->initialized = false;
+}
+
+NTSTATUS TrainingEvolver_Post(TrainingEvolver* evolver) {
+    if (!evolver || !evolver->initialized) return STATUS_INVALID_DEVICE_STATE;
+    if (evolver->posted) return STATUS_PENDING;
+    evolver->posted = true;
+    SetEvent(evolver->go);
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TrainingEvolver_Poll(TrainingEvolver* evolver) {
+    if (!evolver || !evolver->initialized) return STATUS_INVALID_DEVICE_STATE;
+    if (!evolver->posted || evolver->finished) return STATUS_SUCCESS;
+    // `done` is auto-reset, so a successful poll has to be remembered for Exchange
+    if (WaitForSingleObject(evolver->done, 0) != WAIT_OBJECT_0) return STATUS_PENDING;
+    evolver->finished = true;
+    return STATUS_SUCCESS;
+}
+
+// Live weights -> snapshot. Evolve can change a substrate's topology, in which case the straight
+// copy is refused and the snapshot is rebuilt from scratch.
+static NTSTATUS Evolver_RefreshSnapshot(TrainingEvolver* evolver) {
+    NTSTATUS status = NeuralSubstrate_CopyWeights(&evolver->snapshot, evolver->live);
+    if (NT_SUCCESS(status)) {
+        evolver->stats.snapshot_refreshes++;
+        return status;
+    }
+    NeuralSubstrate_Shutdown(&evolver->snapshot);
+    memset(&evolver->snapshot, 0, sizeof(NeuralSubstrate));
+    status = NeuralSubstrate_CreateReplica(&evolver->snapshot, evolver->live);
+    if (NT_SUCCESS(status)) evolver->stats.snapshot_rebuilds++;
+    return status;
+}
+
+NTSTATUS TrainingEvolver_Exchange(TrainingEvolver* evolver) {
+    if (!evolver || !evolver->initialized) return STATUS_INVALID_DEVICE_STATE;
+    if (!evolver->posted) return STATUS_SUCCESS;
+
+    LARGE_INTEGER t0, t1;
+    QueryPerformanceCounter(&t0);
+    if (!evolver->finished) WaitForSingleObject(evolver->done, INFINITE);
+    QueryPerformanceCounter(&t1);
+    evolver->posted = false;
+    evolver->finished = false;
+    evolver->stats.exchange_wait_us += Evolver_ElapsedUs(&t0, &t1);
+    evolver->stats.exchanges++;
+    NTSTATUS status = evolver->generation_status;
+
+    // The live substrate only changes on this thread, so its periodic Evolve happens here
+    uint32_t generation = evolver->engine->population.generation;
+    if (generation / TRAINING_EVOLVER_SUBSTRATE_EVOLVE_INTERVAL !=
+        evolver->evolved_generation / TRAINING_EVOLVER_SUBSTRATE_EVOLVE_INTERVAL) {
+        NeuralSubstrate_Evolve(evolver->live);
+        evolver->stats.substrate_evolves++;
+    }
+    evolver->evolved_generation = generation;
+
+    QueryPerformanceCounter(&t0);
+    NTSTATUS snap = Evolver_RefreshSnapshot(evolver);
+    QueryPerformanceCounter(&t1);
+    evolver->stats.snapshot_us += Evolver_ElapsedUs(&t0, &t1);
+    if (!NT_SUCCESS(snap)) {
+        TrainingEvolver_Stop(evolver);
+        return snap;
+    }
+    return status;
+}
+
+void TrainingEvolver_GetStats(const TrainingEvolver* evolver, TrainingEvolverStats* out) {
+    if (!evolver || !out) return;
+    memcpy(out, &evolver->stats, sizeof(TrainingEvolverStats));
+}
@@ -0,0 +1,286 @@
+/*
+ * Training PBT - Raijin
+ * Owner: Core/Training
+ * Inputs: Source NeuralSubstrate, TrainingPbtConfig (replica count, interval, search bounds)
+ * Outputs: Trained replicas, best replica's hyperparameters and weights
+ * Invariants: A replica's substrate is only trained by its own job; exploit copies the
+ *             parent under the parent's substrate lock, so it never sees a half-applied step
+ * Budget: One low-priority pool job per replica; one slab copy per exploit (weights, ids,
+ *         neuron state)
+ * Failure modes: Replica creation failure -> Initialize fails; more replicas than pool
+ *                workers -> clamped to the worker count (or the exploit minimum, if larger)
+ * Recovery: Replicas are independent; the source substrate is never modified except by ExportBest
+ */
+
+#include "../../Include/training_pbt.h"
+#include "../../Include/raijin_ntstatus.h"
+#include "../../Include/thread_pool.h"
+#include "../../Include/qpc_clock.h"
+#include <windows.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#define PBT_NUDGE_SCALE 0.2f   /* width of a mutation nudge, as in MutateNeuralWeights */
+
+static float Pbt_Clamp(float v, float lo, float hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+// Log-uniform between positive bounds, uniform when the lower bound is zero
+static float Pbt_SampleRange(EvolutionRng* rng, float lo, float hi) {
+    double u = EvolutionRng_NextDouble(rng);
+    if (lo > 0.0f && hi > lo) return (float)(lo * pow((double)hi / lo, u));
+    return (float)(lo + (hi - lo) * u);
+}
+
+static float Pbt_Perturb(EvolutionRng* rng, float v, float lo, float hi) {
+    v = (EvolutionRng_NextBelow(rng, 2) == 0) ? v * (float)TRAINING_PBT_PERTURB : v / (float)TRAINING_PBT_PERTURB;
+    return Pbt_Clamp(v, lo, hi);
+}
+
+void TrainingPbt_GetDefaultConfig(TrainingPbtConfig* config) {
+    if (!config) return;
+    memset(config, 0, sizeof(TrainingPbtConfig));
+    config->replicas = TRAINING_PBT_DEFAULT_REPLICAS;
+    config->interval_steps = TRAINING_PBT_DEFAULT_INTERVAL;
+    config->quantile = TRAINING_PBT_DEFAULT_QUANTILE;
+    config->seed = 0x5042545241494A49ull;
+    config->min.learning_rate = (float)PLASTICITY_RATE * 0.1f;
+    config->max.learning_rate = (float)PLASTICITY_RATE * 10.0f;
+    config->min.mutation_rate = 0.0005f;
+    config->max.mutation_rate = 0.05f;
+    config->min.sparsity = 0.0f;
+    config->max.sparsity = 0.01f;
+}
+
+NTSTATUS TrainingPbt_Initialize(TrainingPbt* pbt, const TrainingPbtConfig* config, NeuralSubstrate* source) {
+    if (!pbt || !config || !source) return STATUS_INVALID_PARAMETER;
+    if (config->replicas < 2 || config->replicas > TRAINING_PBT_MAX_REPLICAS) return STATUS_INVALID_PARAMETER;
+    if (!source->initialized) return STATUS_INVALID_DEVICE_STATE;
+
+    memset(pbt, 0, sizeof(TrainingPbt));
+    pbt->config = *config;
+    if (pbt->config.interval_steps == 0) pbt->config.interval_steps = TRAINING_PBT_DEFAULT_INTERVAL;
+    if (pbt->config.quantile <= 0.0 || pbt->config.quantile > 0.5) pbt->config.quantile = TRAINING_PBT_DEFAULT_QUANTILE;
+
+    // A replica queued behind a busy worker only starts once its peers have finished the Run,
+    // so exploit would rank it against stale scores: keep one worker per replica, but never
+    // drop below the smallest population whose bottom quantile holds a replica
+    uint32_t workers = ThreadPool_GetWorkerCount(ThreadPool_GetGlobal());
+    uint32_t smallest = (uint32_t)ceil(1.0 / pbt->config.quantile - 1e-9);
+    uint32_t limit = workers > smallest ? workers : smallest;
+    if (pbt->config.replicas > limit) pbt->config.replicas = limit;
+
+    pbt->replicas = (TrainingPbtReplica*)calloc(pbt->config.replicas, sizeof(TrainingPbtReplica));
+    if (!pbt->replicas) return STATUS_INSUFFICIENT_RESOURCES;
+    InitializeCriticalSection(&pbt->lock);
+    pbt->initialized = true;
+
+    EvolutionRng seeder;
+    EvolutionRng_Seed(&seeder, pbt->config.seed);
+    for (uint32_t i = 0; i < pbt->config.replicas; i++) {
+        TrainingPbtReplica* r = &pbt->replicas[i];
+        r->index = i;
+        r->pbt = pbt;
+        r->last_parent = -1;
+        EvolutionRng_Seed(&r->rng, EvolutionRng_Next(&seeder));
+
+        NTSTATUS status = NeuralSubstrate_CreateReplica(&r->substrate, source);
+        if (NT_SUCCESS(status)) status = TrainingPipeline_Initialize(&r->pipeline, &r->substrate, NULL);
+        if (!NT_SUCCESS(status)) {
+            TrainingPbt_Shutdown(pbt);
+            return status;
+        }
+
+        const TrainingPbtHyperparams* lo = &pbt->config.min;
+        const TrainingPbtHyperparams* hi = &pbt->config.max;
+        r->hyper.learning_rate = Pbt_SampleRange(&r->rng, lo->learning_rate, hi->learning_rate);
+        r->hyper.mutation_rate = Pbt_SampleRange(&r->rng, lo->mutation_rate, hi->mutation_rate);
+        r->hyper.sparsity = Pbt_SampleRange(&r->rng, lo->sparsity, hi->sparsity);
+        r->pipeline.learning_rate = r->hyper.learning_rate;
+    }
+    return STATUS_SUCCESS;
+}
+
+void TrainingPbt_Shutdown(TrainingPbt* pbt) {
+    if (!pbt || !pbt->initialized) return;
+    for (uint32_t i = 0; i < pbt->config.replicas; i++) {
+        TrainingPbtReplica* r = &pbt->replicas[i];
+        if (r->pipeline.synthetic_input) TrainingPipeline_Shutdown(&r->pipeline);
+        NeuralSubstrate_Shutdown(&r->substrate);
+    }
+    free(pbt->replicas);
+    pbt->replicas = NULL;
+    DeleteCriticalSection(&pbt->lock);
+    pbt->initialized = false;
+}
+
+// Mutation nudges and the sparsity mask, applied to the replica's own weights
+static void Pbt_ApplyWeightHyperparams(TrainingPbtReplica* r) {
+    NeuralSubstrate* substrate = &r->substrate;
+    float rate = r->hyper.mutation_rate;
+    float threshold = r->hyper.sparsity;
+
+    EnterCriticalSection(&substrate->lock);
+    for (uint64_t i = 0; i < substrate->fabric.active_neuron_count; i++) {
+        SparseNeuron* neuron = &substrate->fabric.neurons[i];
+        for (uint32_t j = 0; j < neuron->input_count; j++) {
+            float w = neuron->weights[j];
+            if (EvolutionRng_NextDouble(&r->rng) < rate) {
+                w = Pbt_Clamp(w + ((float)EvolutionRng_NextDouble(&r->rng) - 0.5f) * PBT_NUDGE_SCALE, -1.0f, 1.0f);
+            }
+            neuron->weights[j] = fabsf(w) < threshold ? 0.0f : w;
+        }
+    }
+    LeaveCriticalSection(&substrate->lock);
+}
+
+// End of an interval: publish the score, then exploit and explore when in the bottom quantile
+static void Pbt_EndInterval(TrainingPbt* pbt, TrainingPbtReplica* r) {
+    uint32_t n = pbt->config.replicas;
+    int32_t parent = -1;
+    TrainingPbtHyperparams parent_hyper;
+    double parent_score = 0.0;
+
+    EnterCriticalSection(&pbt->lock);
+    r->score = r->loss_sum / r->loss_count;
+    r->scored = true;
+    r->loss_sum = 0.0;
+    r->loss_count = 0;
+
+    // Rank among replicas that have been scored; ties go to the lower index
+    uint32_t scored = 0, better = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        const TrainingPbtReplica* o = &pbt->replicas[i];
+        if (!o->scored) continue;
+        scored++;
+        if (o != r && (o->score < r->score || (o->score == r->score && i < r->index))) better++;
+    }
+    uint32_t cut = (uint32_t)(pbt->config.quantile * scored);
+    if (cut > 0 && better >= scored - cut) {
+        // Draw the parent uniformly from the top `cut` replicas
+        uint32_t pick = EvolutionRng_NextBelow(&r->rng, cut);
+        for (uint32_t i = 0; i < n && parent < 0; i++) {
+            const TrainingPbtReplica* o = &pbt->replicas[i];
+            if (!o->scored || o == r) continue;
+            uint32_t ahead = 0;
+            for (uint32_t k = 0; k < n; k++) {
+                const TrainingPbtReplica* q = &pbt->replicas[k];
+                if (q->scored && (q->score < o->score || (q->score == o->score && k < i))) ahead++;
+            }
+            if (ahead == pick) {
+                parent = (int32_t)i;
+                parent_hyper = o->hyper;
+                parent_score = o->score;
+            }
+        }
+    }
+    LeaveCriticalSection(&pbt->lock);
+
+    if (parent >= 0) {
+        uint64_t t0 = QpcClock_NowUs();
+        NTSTATUS status = NeuralSubstrate_CopyWeights(&r->substrate, &pbt->replicas[parent].substrate);
+        uint64_t elapsed = QpcClock_NowUs() - t0;
+        if (NT_SUCCESS(status)) {
+            const TrainingPbtHyperparams* lo = &pbt->config.min;
+            const TrainingPbtHyperparams* hi = &pbt->config.max;
+            TrainingPbtHyperparams h;
+            h.learning_rate = Pbt_Perturb(&r->rng, parent_hyper.learning_rate, lo->learning_rate, hi->learning_rate);
+            h.mutation_rate = Pbt_Perturb(&r->rng, parent_hyper.mutation_rate, lo->mutation_rate, hi->mutation_rate);
+            h.sparsity = Pbt_Perturb(&r->rng, parent_hyper.sparsity, lo->sparsity, hi->sparsity);
+
+            EnterCriticalSection(&pbt->lock);
+            r->hyper = h;
+            r->score = parent_score;
+            r->exploits++;
+            r->last_parent = parent;
+            pbt->exploit_count++;
+            pbt->copy_us += elapsed;
+            LeaveCriticalSection(&pbt->lock);
+            r->pipeline.learning_rate = h.learning_rate;
+        }
+    }
+
+    Pbt_ApplyWeightHyperparams(r);
+}
+
+// Trains for the whole Run, so it is queued LOW: a thread joining some other group never picks it up
+static void Pbt_ReplicaJob(void* context) {
+    TrainingPbtReplica* r = (TrainingPbtReplica*)context;
+    TrainingPbt* pbt = r->pbt;
+
+    memset(&r->role_ctx, 0, sizeof(r->role_ctx));
+    r->role_ctx.initialized = true;
+    RoleBoundary_Enter(&r->role_ctx, "raijin.pbt", ROLE_OWNER_RAIJIN);
+    RoleBoundary_BindThread(&r->role_ctx);
+
+    while (!pbt->stop && r->run_steps < pbt->run_target) {
+        if (!NT_SUCCESS(TrainingPipeline_TrainStep(&r->pipeline))) break;
+        r->loss_sum += r->pipeline.last_metrics.loss;
+        r->loss_count++;
+        r->steps++;
+        r->run_steps++;
+        if (r->loss_count >= pbt->config.interval_steps) Pbt_EndInterval(pbt, r);
+    }
+
+    RoleBoundary_BindThread(NULL);
+    RoleBoundary_Exit(&r->role_ctx, "raijin.pbt");
+}
+
+NTSTATUS TrainingPbt_Run(TrainingPbt* pbt, uint64_t steps) {
+    if (!pbt || !pbt->initialized) return STATUS_INVALID_DEVICE_STATE;
+    uint32_t n = pbt->config.replicas;
+
+    InterlockedExchange(&pbt->stop, 0);
+    pbt->run_target = steps;
+    for (uint32_t i = 0; i < n; i++) pbt->replicas[i].run_steps = 0;
+
+    // Initialize capped the replicas at the worker count, so every job starts right away
+    // unless the pool is smaller than the exploit minimum
+    ThreadPool* pool = ThreadPool_GetGlobal();
+    ThreadPoolGroup group;
+    memset(&group, 0, sizeof(group));
+    for (uint32_t i = 0; i < n; i++)
+        ThreadPool_Submit(pool, Pbt_ReplicaJob, &pbt->replicas[i], THREAD_POOL_PRIORITY_LOW, &group);
+    ThreadPool_Wait(pool, &group);
+    for (uint32_t i = 0; i < n; i++)
+        pbt->role_violations += RoleBoundary_GetViolationCount(&pbt->replicas[i].role_ctx);
+
+    RoleBoundaryContext* rbc = RoleBoundary_GetGlobal();
+    if (rbc) rbc->violation_count += pbt->role_violations;
+    pbt->role_violations = 0;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TrainingPbt_Stop(TrainingPbt* pbt) {
+    if (!pbt || !pbt->initialized) return STATUS_INVALID_DEVICE_STATE;
+    InterlockedExchange(&pbt->stop, 1);
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TrainingPbt_GetBest(TrainingPbt* pbt, uint32_t* index, TrainingPbtHyperparams* hyper, double* score) {
+    if (!pbt || !pbt->initialized) return STATUS_INVALID_DEVICE_STATE;
+
+    EnterCriticalSection(&pbt->lock);
+    int32_t best = -1;
+    for (uint32_t i = 0; i < pbt->config.replicas; i++) {
+        const TrainingPbtReplica* r = &pbt->replicas[i];
+        if (r->scored && (best < 0 || r->score < pbt->replicas[best].score)) best = (int32_t)i;
+    }
+    if (best >= 0) {
+        if (index) *index = (uint32_t)best;
+        if (hyper) *hyper = pbt->replicas[best].hyper;
+        if (score) *score = pbt->replicas[best].score;
+    }
+    LeaveCriticalSection(&pbt->lock);
+    return best >= 0 ? STATUS_SUCCESS : STATUS_NOT_FOUND;
+}
+
+NTSTATUS TrainingPbt_ExportBest(TrainingPbt* pbt, NeuralSubstrate* dst) {
+    uint32_t best;
+    NTSTATUS status = TrainingPbt_GetBest(pbt, &best, NULL, NULL);
+    if (!NT_SUCCESS(status)) return status;
+    return NeuralSubstrate_CopyWeights(dst, &pbt->replicas[best].substrate);
+}
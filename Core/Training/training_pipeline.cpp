@@ -73,6 +73,10 @@ NTSTATUS TrainingPipeline_Initialize(TrainingPipeline* pipeline,
 NTSTATUS TrainingPipeline_Shutdown(TrainingPipeline* pipeline) {
     if (!pipeline) return STATUS_INVALID_PARAMETER;
 
+    TrainingPipeline_DisablePrefetch(pipeline);
+    TrainingPipeline_DisableAsyncEvolution(pipeline);
+    TrainingPipeline_DisableReplay(pipeline);
+
     free(pipeline->synthetic_input);
     pipeline->synthetic_input = NULL;
     free(pipeline->synthetic_target);
@@ -83,21 +87,146 @@ NTSTATUS TrainingPipeline_Shutdown(TrainingPipeline* pipeline) {
     return STATUS_SUCCESS;
 }
 
+static void GenerateSyntheticPair(uint8_t* input, uint8_t* target, uint32_t seed) {
+    if (seed % 3 == 0) {
+        GenerateCodeLike(input, TRAINING_INPUT_SIZE, seed);
+        GenerateCodeLike(target, TRAINING_TARGET_SIZE, seed + 1);
+    } else {
+        GeneratePattern(input, TRAINING_INPUT_SIZE, seed);
+        GeneratePattern(target, TRAINING_TARGET_SIZE, seed + 1);
+    }
+}
+
 NTSTATUS TrainingPipeline_GenerateSyntheticBatch(TrainingPipeline* pipeline,
     uint32_t seed) {
     if (!pipeline || !pipeline->synthetic_input) return STATUS_INVALID_PARAMETER;
 
-    if (seed % 3 == 0) {
-        GenerateCodeLike(pipeline->synthetic_input, TRAINING_INPUT_SIZE, seed);
-        GenerateCodeLike(pipeline->synthetic_target, TRAINING_TARGET_SIZE, seed + 1);
-    } else {
-        GeneratePattern(pipeline->synthetic_input, TRAINING_INPUT_SIZE, seed);
-        GeneratePattern(pipeline->synthetic_target, TRAINING_TARGET_SIZE, seed + 1);
+    GenerateSyntheticPair(pipeline->synthetic_input, pipeline->synthetic_target, seed);
+
+    return STATUS_SUCCESS;
+}
+
+// Producer-thread source: same seed schedule TrainStep uses inline, offset by the step prefetch began at
+static NTSTATUS SyntheticBatchSource(void* context, uint64_t sequence, uint8_t* input, size_t input_size,
+    uint8_t* target, size_t target_size) {
+    const TrainingPipeline* pipeline = (const TrainingPipeline*)context;
+    if (input_size < TRAINING_INPUT_SIZE || target_size < TRAINING_TARGET_SIZE) return STATUS_INVALID_PARAMETER;
+    uint32_t seed = (uint32_t)((pipeline->prefetch_base_step + sequence) * 31 + (uint64_t)time(NULL));
+    GenerateSyntheticPair(input, target, seed);
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TrainingPipeline_EnablePrefetch(TrainingPipeline* pipeline, uint32_t depth) {
+    if (!pipeline || !pipeline->synthetic_input) return STATUS_INVALID_PARAMETER;
+    if (pipeline->prefetch) return STATUS_SUCCESS;
+
+    TrainingPrefetcher* prefetch = (TrainingPrefetcher*)malloc(sizeof(TrainingPrefetcher));
+    if (!prefetch) return STATUS_INSUFFICIENT_RESOURCES;
+    memset(prefetch, 0, sizeof(TrainingPrefetcher));
+
+    pipeline->prefetch_base_step = pipeline->total_steps;
+    NTSTATUS status = pipeline->data_source ?
+        TrainingPrefetch_Start(prefetch, depth, TRAINING_INPUT_SIZE, TRAINING_TARGET_SIZE,
+                               pipeline->data_source, pipeline->data_context) :
+        TrainingPrefetch_Start(prefetch, depth, TRAINING_INPUT_SIZE, TRAINING_TARGET_SIZE,
+                               SyntheticBatchSource, pipeline);
+    if (!NT_SUCCESS(status)) {
+        free(prefetch);
+        return status;
+    }
+    pipeline->prefetch = prefetch;
+    return STATUS_SUCCESS;
+}
+
+void TrainingPipeline_DisablePrefetch(TrainingPipeline* pipeline) {
+    if (!pipeline || !pipeline->prefetch) return;
+    TrainingPrefetch_Stop(pipeline->prefetch);
+    free(pipeline->prefetch);
+    pipeline->prefetch = NULL;
+}
+
+NTSTATUS TrainingPipeline_SetDataSource(TrainingPipeline* pipeline, TrainingBatchSource source, void* context) {
+    if (!pipeline) return STATUS_INVALID_PARAMETER;
+    if (pipeline->prefetch) return STATUS_INVALID_DEVICE_STATE;
+    pipeline->data_source = source;
+    pipeline->data_context = source ? context : NULL;
+    return STATUS_SUCCESS;
+}
+
+NTSTATUS TrainingPipeline_GetPrefetchStats(const TrainingPipeline* pipeline, TrainingPrefetchStats* out) {
+    if (!pipeline || !out) return STATUS_INVALID_PARAMETER;
+    if (!pipeline->prefetch) return STATUS_INVALID_DEVICE_STATE;
+    TrainingPrefetch_GetStats(pipeline->prefetch, out);
+    return STATUS_SUCCESS;
+}
+
+// Takes the next prefetched batch into synthetic_input/target. Copying (2 KB) frees the slot before
+// compute starts so the producer stays a full ring ahead, and callers that read synthetic_target
+// after TrainStep (task oracle) keep working unchanged.
+static NTSTATUS TakePrefetchedBatch(TrainingPipeline* pipeline) {
+    const TrainingPrefetchSlot* slot = NULL;
+    NTSTATUS status = TrainingPrefetch_Acquire(pipeline->prefetch, &slot);
+    if (slot) {
+        if (NT_SUCCESS(status)) {
+            memcpy(pipeline->synthetic_input, slot->input, TRAINING_INPUT_SIZE);
+            memcpy(pipeline->synthetic_target, slot->target, TRAINING_TARGET_SIZE);
+        }
+        pipeline->last_metrics.data_wait_us = pipeline->prefetch->stats.last_wait_us;
+        TrainingPrefetch_Release(pipeline->prefetch);
+    }
+    return status;
+}
+
+NTSTATUS TrainingPipeline_EnableReplay(TrainingPipeline* pipeline, const TrainingReplayConfig* config) {
+    if (!pipeline || !pipeline->synthetic_input) return STATUS_INVALID_PARAMETER;
+    if (pipeline->replay) return STATUS_SUCCESS;
+
+    TrainingReplayConfig defaults;
+    if (!config) {
+        TrainingReplay_GetDefaultConfig(&defaults);
+        config = &defaults;
+    }
+    TrainingReplay* replay = (TrainingReplay*)malloc(sizeof(TrainingReplay));
+    if (!replay) return STATUS_INSUFFICIENT_RESOURCES;
+    memset(replay, 0, sizeof(TrainingReplay));
+    NTSTATUS status = TrainingReplay_Initialize(replay, config, TRAINING_INPUT_SIZE, TRAINING_TARGET_SIZE);
+    if (!NT_SUCCESS(status)) {
+        free(replay);
+        return status;
     }
+    pipeline->replay = replay;
+    pipeline->replay_credit = 0.0;
+    return STATUS_SUCCESS;
+}
 
+void TrainingPipeline_DisableReplay(TrainingPipeline* pipeline) {
+    if (!pipeline || !pipeline->replay) return;
+    TrainingReplay_Shutdown(pipeline->replay);
+    free(pipeline->replay);
+    pipeline->replay = NULL;
+}
+
+NTSTATUS TrainingPipeline_GetReplayStats(const TrainingPipeline* pipeline, TrainingReplayStats* out) {
+    if (!pipeline || !out) return STATUS_INVALID_PARAMETER;
+    if (!pipeline->replay) return STATUS_INVALID_DEVICE_STATE;
+    TrainingReplay_GetStats(pipeline->replay, out);
     return STATUS_SUCCESS;
 }
 
+// Spends replay credit on this step when the buffer is warm. Curriculum-seeded steps always
+// train fresh so a scheduled task is never displaced by a replay.
+static bool ShouldReplay(TrainingPipeline* pipeline) {
+    if (!pipeline->replay || pipeline->curriculum_task_valid) return false;
+    pipeline->replay_credit += pipeline->replay->config.fraction;
+    if (pipeline->replay_credit < 1.0) return false;
+    if (!TrainingReplay_Ready(pipeline->replay)) {
+        pipeline->replay_credit = 0.0;
+        return false;
+    }
+    pipeline->replay_credit -= 1.0;
+    return true;
+}
+
 static uint32_t SeedFromCurriculumTask(const CurriculumTask* t) {
     if (!t) return 0;
     uint32_t h = (uint32_t)t->type * 31u + t->difficulty * 17u;
@@ -125,14 +254,28 @@ NTSTATUS TrainingPipeline_TrainStep(TrainingPipeline* pipeline) {
     }
     uint64_t t0 = GetTickCount64();
 
-    uint32_t seed;
-    if (pipeline->curriculum_task_valid) {
-        seed = SeedFromCurriculumTask(&pipeline->curriculum_task);
+    NTSTATUS status = STATUS_SUCCESS;
+    pipeline->last_metrics.data_wait_us = 0;
+    pipeline->last_metrics.replay_weight = 0.0;
+    uint32_t replay_slot = 0;
+    bool replayed = ShouldReplay(pipeline) &&
+        NT_SUCCESS(TrainingReplay_Draw(pipeline->replay, pipeline->synthetic_input, pipeline->synthetic_target,
+            &replay_slot, &pipeline->last_metrics.replay_weight));
+    if (replayed) {
+        // Drawn straight into synthetic_input/target
+    } else if (pipeline->curriculum_task_valid) {
+        uint32_t seed = SeedFromCurriculumTask(&pipeline->curriculum_task);
         pipeline->curriculum_task_valid = false;
+        status = TrainingPipeline_GenerateSyntheticBatch(pipeline, seed);
+    } else if (pipeline->prefetch) {
+        status = TakePrefetchedBatch(pipeline);
+    } else if (pipeline->data_source) {
+        status = pipeline->data_source(pipeline->data_context, pipeline->total_steps,
+            pipeline->synthetic_input, TRAINING_INPUT_SIZE, pipeline->synthetic_target, TRAINING_TARGET_SIZE);
     } else {
-        seed = (uint32_t)(pipeline->total_steps * 31 + (uint64_t)time(NULL));
+        uint32_t seed = (uint32_t)(pipeline->total_steps * 31 + (uint64_t)time(NULL));
+        status = TrainingPipeline_GenerateSyntheticBatch(pipeline, seed);
     }
-    NTSTATUS status = TrainingPipeline_GenerateSyntheticBatch(pipeline, seed);
     if (!NT_SUCCESS(status)) return status;
 
     status = NeuralSubstrate_Process(pipeline->neural,
@@ -140,19 +283,37 @@ NTSTATUS TrainingPipeline_TrainStep(TrainingPipeline* pipeline) {
         pipeline->output_buffer, TRAINING_TARGET_SIZE);
     if (!NT_SUCCESS(status)) return status;
 
-    status = NeuralSubstrate_Learn(pipeline->neural,
-        pipeline->synthetic_target, TRAINING_TARGET_SIZE);
+    // A replayed sample is over-represented by its priority; its IS weight scales the step back
+    if (replayed) {
+        float rate = pipeline->learning_rate > 0.0f ? pipeline->learning_rate : (float)PLASTICITY_RATE;
+        status = NeuralSubstrate_LearnWithRate(pipeline->neural, pipeline->synthetic_target, TRAINING_TARGET_SIZE,
+            rate * (float)pipeline->last_metrics.replay_weight);
+    } else {
+        status = pipeline->learning_rate > 0.0f ?
+            NeuralSubstrate_LearnWithRate(pipeline->neural,
+                pipeline->synthetic_target, TRAINING_TARGET_SIZE, pipeline->learning_rate) :
+            NeuralSubstrate_Learn(pipeline->neural,
+                pipeline->synthetic_target, TRAINING_TARGET_SIZE);
+    }
     if (!NT_SUCCESS(status)) return status;
 
     pipeline->last_metrics.loss = ComputeLoss(
         pipeline->output_buffer,
         pipeline->synthetic_target,
         TRAINING_TARGET_SIZE);
+    if (replayed) {
+        TrainingReplay_UpdatePriority(pipeline->replay, replay_slot, pipeline->last_metrics.loss);
+    } else if (pipeline->replay) {
+        TrainingReplay_Push(pipeline->replay, pipeline->synthetic_input, pipeline->synthetic_target,
+            pipeline->last_metrics.loss);
+    }
     pipeline->last_metrics.entropy = NeuralSubstrate_GetEntropy(pipeline->neural);
     pipeline->last_metrics.step_count = ++pipeline->total_steps;
     pipeline->last_metrics.batch_time_ms = GetTickCount64() - t0;
 
-    if (pipeline->evolution) {
+    // While a generation is out on the evolver the population belongs to it; EndEvolutionStep
+    // publishes the fitness instead
+    if (pipeline->evolution && !(pipeline->evolver && pipeline->evolver->posted)) {
         pipeline->last_metrics.fitness = pipeline->evolution->population.best_fitness;
         pipeline->last_metrics.generation = pipeline->evolution->population.generation;
     }
@@ -166,49 +327,18 @@ NTSTATUS TrainingPipeline_EvolutionStep(TrainingPipeline* pipeline) {
         RoleBoundaryContext* rbc = RoleBoundary_GetGlobal();
         if (rbc) RoleBoundary_AssertRaijin(rbc);
     }
+    // With a worker running, a plain EvolutionStep is a posted generation exchanged right away;
+    // one a caller left out is exchanged first, as the population is the worker's until then
+    if (pipeline->evolver && pipeline->evolver->posted) TrainingPipeline_EndEvolutionStep(pipeline);
+    if (pipeline->evolver) {
+        NTSTATUS status = TrainingPipeline_BeginEvolutionStep(pipeline);
+        if (NT_SUCCESS(status)) return TrainingPipeline_EndEvolutionStep(pipeline);
+    }
     NTSTATUS status = EvolutionEngine_EvaluatePopulation(pipeline->evolution);
     if (!NT_SUCCESS(status)) return status;
 
-    EvolutionaryIndividual* new_pop = (EvolutionaryIndividual*)malloc(
-        pipeline->evolution->population.max_size * sizeof(EvolutionaryIndividual));
-    if (!new_pop) return STATUS_INSUFFICIENT_RESOURCES;
-    memset(new_pop, 0, pipeline->evolution->population.max_size * sizeof(EvolutionaryIndividual));
-
-    uint32_t elite_count = (uint32_t)(pipeline->evolution->params.elitism_rate *
-        pipeline->evolution->population.max_size);
-    if (elite_count > pipeline->evolution->population.max_size)
-        elite_count = pipeline->evolution->population.max_size;
-
-    for (uint32_t i = 0; i < elite_count; i++) {
-        EvolutionaryIndividual* src = &pipeline->evolution->population.individuals[i];
-        EvolutionaryIndividual* dst = &new_pop[i];
-        dst->id = src->id;
-        dst->genome_size = src->genome_size;
-        dst->fitness = src->fitness;
-        dst->adjusted_fitness = src->adjusted_fitness;
-        dst->age = src->age + 1;
-        dst->parent1_id = src->parent1_id;
-        dst->parent2_id = src->parent2_id;
-        dst->evaluated = true;
-        dst->genome = malloc(src->genome_size);
-        if (dst->genome)
-            memcpy(dst->genome, src->genome, src->genome_size);
-        dst->phenotype = NULL;
-        dst->metadata = NULL;
-    }
-
-    EvolutionaryIndividual* parents[2];
-    for (uint32_t i = elite_count; i < pipeline->evolution->population.max_size; i++) {
-        EvolutionEngine_SelectParents(pipeline->evolution, parents, 2);
-        if (parents[0] && parents[1])
-            EvolutionEngine_CreateOffspring(pipeline->evolution,
-                parents[0], parents[1], &new_pop[i]);
-    }
-
-    EvolutionEngine_FreePopulation(pipeline->evolution);
-    pipeline->evolution->population.individuals = new_pop;
-    pipeline->evolution->population.size = pipeline->evolution->population.max_size;
-    pipeline->evolution->population.generation++;
+    status = EvolutionEngine_NextGeneration(pipeline->evolution);
+    if (!NT_SUCCESS(status)) return status;
 
     if (pipeline->neural && pipeline->evolution->population.generation % 50 == 0)
         NeuralSubstrate_Evolve(pipeline->neural);
@@ -221,6 +351,56 @@ NTSTATUS TrainingPipeline_EvolutionStep(TrainingPipeline* pipeline) {
     return STATUS_SUCCESS;
 }
 
+NTSTATUS TrainingPipeline_EnableAsyncEvolution(TrainingPipeline* pipeline) {
+    if (!pipeline || !pipeline->evolution || !pipeline->neural) return STATUS_INVALID_PARAMETER;
+    if (pipeline->evolver) return STATUS_SUCCESS;
+
+    TrainingEvolver* evolver = (TrainingEvolver*)malloc(sizeof(TrainingEvolver));
+    if (!evolver) return STATUS_INSUFFICIENT_RESOURCES;
+    memset(evolver, 0, sizeof(TrainingEvolver));
+    NTSTATUS status = TrainingEvolver_Start(evolver, pipeline->evolution, pipeline->neural);
+    if (!NT_SUCCESS(status)) {
+        free(evolver);
+        return status;
+    }
+    pipeline->evolver = evolver;
+    return STATUS_SUCCESS;
+}
+
+void TrainingPipeline_DisableAsyncEvolution(TrainingPipeline* pipeline) {
+    if (!pipeline || !pipeline->evolver) return;
+    TrainingEvolver_Stop(pipeline->evolver);
+    free(pipeline->evolver);
+    pipeline->evolver = NULL;
+}
+
+NTSTATUS TrainingPipeline_BeginEvolutionStep(TrainingPipeline* pipeline) {
+    if (!pipeline || !pipeline->evolution) return STATUS_INVALID_PARAMETER;
+    if (!pipeline->evolver) return STATUS_INVALID_DEVICE_STATE;
+    return TrainingEvolver_Post(pipeline->evolver);
+}
+
+NTSTATUS TrainingPipeline_PollEvolutionStep(TrainingPipeline* pipeline) {
+    if (!pipeline || !pipeline->evolution) return STATUS_INVALID_PARAMETER;
+    if (!pipeline->evolver) return STATUS_INVALID_DEVICE_STATE;
+    return TrainingEvolver_Poll(pipeline->evolver);
+}
+
+NTSTATUS TrainingPipeline_EndEvolutionStep(TrainingPipeline* pipeline) {
+    if (!pipeline || !pipeline->evolution) return STATUS_INVALID_PARAMETER;
+    if (!pipeline->evolver) return STATUS_INVALID_DEVICE_STATE;
+
+    NTSTATUS status = TrainingEvolver_Exchange(pipeline->evolver);
+    // A failed snapshot rebuild stops the worker; evolution carries on inline from here
+    if (!pipeline->evolver->initialized) {
+        free(pipeline->evolver);
+        pipeline->evolver = NULL;
+    }
+    pipeline->last_metrics.generation = pipeline->evolution->population.generation;
+    pipeline->last_metrics.fitness = pipeline->evolution->population.best_fitness;
+    return status;
+}
+
 void TrainingPipeline_GetMetrics(const TrainingPipeline* pipeline,
     TrainingMetrics* out) {
     if (pipeline && out)
@@ -0,0 +1,142 @@
+/*
+ * Training Prefetch - Raijin
+ * Owner: Core/Training
+ * Inputs: TrainingBatchSource callback, prefetch depth, batch geometry
+ * Outputs: Ready batches in submission order, consumer wait statistics
+ * Invariants: Exactly one producer thread and one consumer; a slot is owned by the producer
+ *             from free_slots to ready_slots and by the consumer from Acquire to Release
+ * Budget: One producer thread; depth x (input + target) bytes allocated once at Start
+ * Failure modes: Source error -> carried in the slot's status, the ring keeps running
+ * Recovery: Stop always joins the producer; a consumer that stops mid-Acquire just drops the slot
+ */
+
+#include "../../Include/training_prefetch.h"
+#include "../../Include/raijin_ntstatus.h"
+#include "../../Include/qpc_clock.h"
+#include <windows.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint64_t Prefetch_ElapsedUs(const LARGE_INTEGER* start, const LARGE_INTEGER* end, const LARGE_INTEGER* freq) {
+    return QpcClock_TicksToUs((uint64_t)(end->QuadPart - start->QuadPart), (uint64_t)freq->QuadPart);
+}
+
+static DWORD WINAPI PrefetchThreadProc(LPVOID param) {
+    TrainingPrefetcher* prefetcher = (TrainingPrefetcher*)param;
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+
+    for (;;) {
+        WaitForSingleObject(prefetcher->free_slots, INFINITE);
+        if (prefetcher->stop) break;
+
+        TrainingPrefetchSlot* slot = &prefetcher->slots[prefetcher->tail];
+        LARGE_INTEGER t0, t1;
+        QueryPerformanceCounter(&t0);
+        slot->sequence = prefetcher->next_sequence++;
+        slot->status = prefetcher->source(prefetcher->source_context, slot->sequence,
+                                          slot->input, prefetcher->input_size,
+                                          slot->target, prefetcher->target_size);
+        QueryPerformanceCounter(&t1);
+        prefetcher->stats.produce_us += Prefetch_ElapsedUs(&t0, &t1, &freq);
+        prefetcher->stats.produced++;
+
+        prefetcher->tail = (prefetcher->tail + 1) % prefetcher->depth;
+        ReleaseSemaphore(prefetcher->ready_slots, 1, NULL);
+    }
+    return 0;
+}
+
+NTSTATUS TrainingPrefetch_Start(TrainingPrefetcher* prefetcher, uint32_t depth, size_t input_size,
+    size_t target_size, TrainingBatchSource source, void* context) {
+    if (!prefetcher || !source || input_size == 0 || target_size == 0) return STATUS_INVALID_PARAMETER;
+    if (prefetcher->initialized) return STATUS_INVALID_DEVICE_STATE;
+    if (depth == 0) depth = TRAINING_PREFETCH_DEFAULT_DEPTH;
+    if (depth > TRAINING_PREFETCH_MAX_DEPTH) depth = TRAINING_PREFETCH_MAX_DEPTH;
+
+    memset(prefetcher, 0, sizeof(TrainingPrefetcher));
+    prefetcher->depth = depth;
+    prefetcher->input_size = input_size;
+    prefetcher->target_size = target_size;
+    prefetcher->source = source;
+    prefetcher->source_context = context;
+
+    prefetcher->slab = (uint8_t*)malloc((size_t)depth * (input_size + target_size));
+    if (!prefetcher->slab) return STATUS_INSUFFICIENT_RESOURCES;
+    for (uint32_t i = 0; i < depth; i++) {
+        uint8_t* base = prefetcher->slab + (size_t)i * (input_size + target_size);
+        prefetcher->slots[i].input = base;
+        prefetcher->slots[i].target = base + input_size;
+    }
+
+    prefetcher->free_slots = CreateSemaphoreA(NULL, (LONG)depth, (LONG)depth, NULL);
+    prefetcher->ready_slots = CreateSemaphoreA(NULL, 0, (LONG)depth, NULL);
+    // The producer blocks on free_slots for the pipeline's lifetime, which would pin a pool worker
+    if (prefetcher->free_slots && prefetcher->ready_slots)
+        prefetcher->thread = CreateThread(NULL, 0, PrefetchThreadProc, prefetcher, 0, NULL);
+    if (!prefetcher->thread) {
+        if (prefetcher->free_slots) CloseHandle(prefetcher->free_slots);
+        if (prefetcher->ready_slots) CloseHandle(prefetcher->ready_slots);
+        free(prefetcher->slab);
+        memset(prefetcher, 0, sizeof(TrainingPrefetcher));
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    prefetcher->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void TrainingPrefetch_Stop(TrainingPrefetcher* prefetcher) {
+    if (!prefetcher || !prefetcher->initialized) return;
+    InterlockedExchange(&prefetcher->stop, 1);
+    // The producer is either generating (sees stop on its next wait) or blocked on a full ring
+    ReleaseSemaphore(prefetcher->free_slots, 1, NULL);
+    WaitForSingleObject(prefetcher->thread, INFINITE);
+    CloseHandle(prefetcher->thread);
+    CloseHandle(prefetcher->free_slots);
+    CloseHandle(prefetcher->ready_slots);
+    free(prefetcher->slab);
+    prefetcher->slab = NULL;
+    prefetcher->thread = NULL;
+    prefetcher->free_slots = NULL;
+    prefetcher->ready_slots = NULL;
+    prefetcher->holding = false;
+    prefetcher->initialized = false;
+}
+
+NTSTATUS TrainingPrefetch_Acquire(TrainingPrefetcher* prefetcher, const TrainingPrefetchSlot** slot) {
+    if (!prefetcher || !slot) return STATUS_INVALID_PARAMETER;
+    if (!prefetcher->initialized || prefetcher->holding) return STATUS_INVALID_DEVICE_STATE;
+
+    // The common case (batch already waiting) costs one non-blocking wait and no clock reads
+    prefetcher->stats.last_wait_us = 0;
+    if (WaitForSingleObject(prefetcher->ready_slots, 0) != WAIT_OBJECT_0) {
+        LARGE_INTEGER freq, t0, t1;
+        QueryPerformanceFrequency(&freq);
+        QueryPerformanceCounter(&t0);
+        WaitForSingleObject(prefetcher->ready_slots, INFINITE);
+        QueryPerformanceCounter(&t1);
+        uint64_t waited = Prefetch_ElapsedUs(&t0, &t1, &freq);
+        prefetcher->stats.stalls++;
+        prefetcher->stats.wait_us += waited;
+        prefetcher->stats.last_wait_us = waited;
+        if (waited > prefetcher->stats.max_wait_us) prefetcher->stats.max_wait_us = waited;
+    }
+
+    prefetcher->holding = true;
+    *slot = &prefetcher->slots[prefetcher->head];
+    return (*slot)->status;
+}
+
+void TrainingPrefetch_Release(TrainingPrefetcher* prefetcher) {
+    if (!prefetcher || !prefetcher->initialized || !prefetcher->holding) return;
+    prefetcher->holding = false;
+    prefetcher->head = (prefetcher->head + 1) % prefetcher->depth;
+    prefetcher->stats.consumed++;
+    ReleaseSemaphore(prefetcher->free_slots, 1, NULL);
+}
+
+void TrainingPrefetch_GetStats(const TrainingPrefetcher* prefetcher, TrainingPrefetchStats* out) {
+    if (!prefetcher || !out) return;
+    memcpy(out, &prefetcher->stats, sizeof(TrainingPrefetchStats));
+}
@@ -0,0 +1,219 @@
+/*
+ * Training Replay - Raijin
+ * Owner: Core/Training
+ * Inputs: Trained samples and their loss (Push), draw requests and re-scored losses (consumer)
+ * Outputs: Samples drawn in proportion to priority with importance-sampling weights
+ * Invariants: sum_tree[1] is the sum of every resident priority and min_tree[1] the smallest;
+ *             staged_head is written only by the producer, staged_tail and the trees only by
+ *             the consumer
+ * Budget: (capacity + staging) x (input + target) bytes and 4 x leaves doubles, allocated once;
+ *         O(log capacity) per fold, draw and update
+ * Failure modes: Staging full -> push dropped and counted; empty buffer -> Draw returns NOT_FOUND
+ * Recovery: Nothing persists; a dropped push only loses one replay candidate
+ */
+
+#include "../../Include/training_replay.h"
+#include "../../Include/raijin_ntstatus.h"
+#include <windows.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+static uint32_t Replay_RoundUpPow2(uint32_t v) {
+    uint32_t p = 1;
+    while (p < v) p <<= 1;
+    return p;
+}
+
+// Interlocked read: both staging counters are only ever touched atomically
+static uint32_t Replay_Load(volatile LONG* counter) {
+    return (uint32_t)InterlockedCompareExchange(counter, 0, 0);
+}
+
+static uint8_t* Replay_Slot(const TrainingReplay* replay, uint32_t slot) {
+    return replay->slab + (size_t)slot * (replay->input_size + replay->target_size);
+}
+
+static uint8_t* Replay_StagingSlot(const TrainingReplay* replay, uint32_t index) {
+    return Replay_Slot(replay, replay->config.capacity + index);
+}
+
+static double Replay_Priority(const TrainingReplay* replay, double loss) {
+    if (!(loss >= 0.0)) loss = 0.0;
+    return pow(loss + replay->config.epsilon, replay->config.alpha);
+}
+
+// Sets one leaf and recomputes its ancestors from their children, so sums never drift
+static void Replay_SetLeaf(TrainingReplay* replay, uint32_t slot, double priority) {
+    uint32_t node = replay->leaves + slot;
+    replay->sum_tree[node] = priority;
+    replay->min_tree[node] = priority;
+    for (node >>= 1; node >= 1; node >>= 1) {
+        double a = replay->min_tree[2 * node], b = replay->min_tree[2 * node + 1];
+        replay->sum_tree[node] = replay->sum_tree[2 * node] + replay->sum_tree[2 * node + 1];
+        replay->min_tree[node] = a < b ? a : b;
+    }
+}
+
+void TrainingReplay_GetDefaultConfig(TrainingReplayConfig* config) {
+    if (!config) return;
+    memset(config, 0, sizeof(TrainingReplayConfig));
+    config->capacity = TRAINING_REPLAY_DEFAULT_CAPACITY;
+    config->staging = TRAINING_REPLAY_DEFAULT_STAGING;
+    config->fraction = TRAINING_REPLAY_DEFAULT_FRACTION;
+    config->alpha = TRAINING_REPLAY_DEFAULT_ALPHA;
+    config->beta = TRAINING_REPLAY_DEFAULT_BETA;
+    config->beta_steps = TRAINING_REPLAY_DEFAULT_BETA_STEPS;
+    config->epsilon = TRAINING_REPLAY_DEFAULT_EPSILON;
+    config->seed = 0x5245504C4159ull;
+}
+
+NTSTATUS TrainingReplay_Initialize(TrainingReplay* replay, const TrainingReplayConfig* config,
+    size_t input_size, size_t target_size) {
+    if (!replay || !config || input_size == 0 || target_size == 0) return STATUS_INVALID_PARAMETER;
+    if (config->capacity == 0 || config->capacity > TRAINING_REPLAY_MAX_CAPACITY) return STATUS_INVALID_PARAMETER;
+    if (config->fraction < 0.0 || config->fraction > 1.0 || config->alpha < 0.0) return STATUS_INVALID_PARAMETER;
+    if (replay->initialized) return STATUS_INVALID_DEVICE_STATE;
+
+    memset(replay, 0, sizeof(TrainingReplay));
+    replay->config = *config;
+    // Staging is indexed by free-running counters, so a power of two keeps it correct across wrap
+    replay->config.staging = Replay_RoundUpPow2(config->staging ? config->staging : TRAINING_REPLAY_DEFAULT_STAGING);
+    if (replay->config.min_fill == 0) replay->config.min_fill = replay->config.staging;
+    if (replay->config.min_fill > replay->config.capacity) replay->config.min_fill = replay->config.capacity;
+    if (replay->config.epsilon <= 0.0) replay->config.epsilon = TRAINING_REPLAY_DEFAULT_EPSILON;
+    replay->input_size = input_size;
+    replay->target_size = target_size;
+    replay->leaves = Replay_RoundUpPow2(replay->config.capacity);
+
+    size_t stride = input_size + target_size;
+    replay->slab = (uint8_t*)malloc((size_t)(replay->config.capacity + replay->config.staging) * stride);
+    replay->staged_priority = (double*)malloc(replay->config.staging * sizeof(double));
+    replay->sum_tree = (double*)calloc(2 * (size_t)replay->leaves, sizeof(double));
+    replay->min_tree = (double*)malloc(2 * (size_t)replay->leaves * sizeof(double));
+    if (!replay->slab || !replay->staged_priority || !replay->sum_tree || !replay->min_tree) {
+        free(replay->slab);
+        free(replay->staged_priority);
+        free(replay->sum_tree);
+        free(replay->min_tree);
+        memset(replay, 0, sizeof(TrainingReplay));
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+    for (size_t i = 0; i < 2 * (size_t)replay->leaves; i++) replay->min_tree[i] = DBL_MAX;
+
+    EvolutionRng_Seed(&replay->rng, replay->config.seed);
+    replay->initialized = true;
+    return STATUS_SUCCESS;
+}
+
+void TrainingReplay_Shutdown(TrainingReplay* replay) {
+    if (!replay || !replay->initialized) return;
+    free(replay->slab);
+    free(replay->staged_priority);
+    free(replay->sum_tree);
+    free(replay->min_tree);
+    memset(replay, 0, sizeof(TrainingReplay));
+}
+
+NTSTATUS TrainingReplay_Push(TrainingReplay* replay, const uint8_t* input, const uint8_t* target, double loss) {
+    if (!replay || !replay->initialized || !input || !target) return STATUS_INVALID_PARAMETER;
+
+    uint32_t head = Replay_Load(&replay->staged_head);
+    uint32_t tail = Replay_Load(&replay->staged_tail);
+    if (head - tail >= replay->config.staging) {
+        replay->dropped++;
+        return STATUS_PENDING;
+    }
+
+    uint32_t index = head & (replay->config.staging - 1);
+    uint8_t* slot = Replay_StagingSlot(replay, index);
+    memcpy(slot, input, replay->input_size);
+    memcpy(slot + replay->input_size, target, replay->target_size);
+    replay->staged_priority[index] = Replay_Priority(replay, loss);
+    replay->pushed++;
+    // Publishes the slot: the consumer reads it only after seeing the new head
+    InterlockedExchange(&replay->staged_head, (LONG)(head + 1));
+    return STATUS_SUCCESS;
+}
+
+// Consumer: moves every published push into the ring, overwriting the oldest slots once full
+static void Replay_Fold(TrainingReplay* replay) {
+    uint32_t tail = Replay_Load(&replay->staged_tail);
+    uint32_t head = Replay_Load(&replay->staged_head);
+    if (head == tail) return;
+
+    size_t stride = replay->input_size + replay->target_size;
+    for (; tail != head; tail++) {
+        uint32_t index = tail & (replay->config.staging - 1);
+        uint32_t slot = replay->next_slot;
+        memcpy(Replay_Slot(replay, slot), Replay_StagingSlot(replay, index), stride);
+        Replay_SetLeaf(replay, slot, replay->staged_priority[index]);
+        replay->next_slot = (slot + 1) % replay->config.capacity;
+        if (replay->resident < replay->config.capacity) replay->resident++;
+    }
+    InterlockedExchange(&replay->staged_tail, (LONG)head);
+}
+
+bool TrainingReplay_Ready(TrainingReplay* replay) {
+    if (!replay || !replay->initialized) return false;
+    Replay_Fold(replay);
+    return replay->resident >= replay->config.min_fill;
+}
+
+NTSTATUS TrainingReplay_Draw(TrainingReplay* replay, uint8_t* input, uint8_t* target,
+    uint32_t* slot, double* weight) {
+    if (!replay || !replay->initialized || !input || !target) return STATUS_INVALID_PARAMETER;
+    Replay_Fold(replay);
+    double total = replay->sum_tree[1];
+    if (replay->resident == 0 || !(total > 0.0)) return STATUS_NOT_FOUND;
+
+    // Descend towards the leaf whose prefix-sum interval holds u; never step into an empty subtree
+    double u = EvolutionRng_NextDouble(&replay->rng) * total;
+    uint32_t node = 1;
+    while (node < replay->leaves) {
+        uint32_t left = 2 * node;
+        if (u < replay->sum_tree[left] || replay->sum_tree[left + 1] <= 0.0) {
+            node = left;
+        } else {
+            u -= replay->sum_tree[left];
+            node = left + 1;
+        }
+    }
+    uint32_t index = node - replay->leaves;
+    double priority = replay->sum_tree[node];
+
+    // w_i = (N * P(i))^-beta normalised by the largest weight, which belongs to the smallest priority
+    double progress = replay->config.beta_steps ? (double)replay->drawn / (double)replay->config.beta_steps : 1.0;
+    if (progress > 1.0) progress = 1.0;
+    double beta = replay->config.beta + (1.0 - replay->config.beta) * progress;
+    double w = pow(replay->min_tree[1] / priority, beta);
+
+    const uint8_t* src = Replay_Slot(replay, index);
+    memcpy(input, src, replay->input_size);
+    memcpy(target, src + replay->input_size, replay->target_size);
+    replay->drawn++;
+    replay->weight_sum += w;
+    if (slot) *slot = index;
+    if (weight) *weight = w;
+    return STATUS_SUCCESS;
+}
+
+void TrainingReplay_UpdatePriority(TrainingReplay* replay, uint32_t slot, double loss) {
+    if (!replay || !replay->initialized || slot >= replay->resident) return;
+    Replay_SetLeaf(replay, slot, Replay_Priority(replay, loss));
+    replay->priority_updates++;
+}
+
+void TrainingReplay_GetStats(const TrainingReplay* replay, TrainingReplayStats* out) {
+    if (!replay || !out) return;
+    memset(out, 0, sizeof(TrainingReplayStats));
+    if (!replay->initialized) return;
+    out->pushed = replay->pushed;
+    out->dropped = replay->dropped;
+    out->drawn = replay->drawn;
+    out->priority_updates = replay->priority_updates;
+    out->resident = replay->resident;
+    out->total_priority = replay->sum_tree[1];
+    out->mean_weight = replay->drawn ? replay->weight_sum / (double)replay->drawn : 0.0;
+}
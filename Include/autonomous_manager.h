@@ -8,6 +8,7 @@
 #include "neural_substrate.h"
 #include "screen_control.h"
 #include "ethics_system.h"
+#include "thread_pool.h"
 
 // Raijin Autonomous Operation Manager
 // Orchestrates all systems for self-directed operation
@@ -125,8 +126,8 @@ typedef struct {
     // Internal state
     CRITICAL_SECTION lock;
     bool initialized;
-    HANDLE operation_thread;
-    HANDLE monitoring_thread;
+    volatile LONG dispatch_scheduled;   // a dispatch job is queued or running on the shared pool
+    ThreadPoolGroup dispatch_group;
 } AutonomousManager;
 
 // Core API functions
@@ -137,6 +138,8 @@ NTSTATUS AutonomousManager_Initialize(AutonomousManager* manager,
 NTSTATUS AutonomousManager_Shutdown(AutonomousManager* manager);
 NTSTATUS AutonomousManager_StartOperation(AutonomousManager* manager);
 NTSTATUS AutonomousManager_StopOperation(AutonomousManager* manager);
+// Samples user presence and system health and queues upkeep tasks; call every few seconds
+NTSTATUS AutonomousManager_Monitor(AutonomousManager* manager);
 
 // Task management
 NTSTATUS AutonomousManager_QueueTask(AutonomousManager* manager, TaskType type,
@@ -20,7 +20,7 @@ typedef struct DominanceSnapshot {
     double fitness;
     double loss;
     float entropy;
-    float stress_robustness; /* -1 = not set; 0-1 from adversarial stress tests */
+    float stress_robustness; /* -1 = not set; 0-1, latest stress or adversarial run */
     uint64_t step_count;
     uint64_t generation;
     uint64_t timestamp_ms;
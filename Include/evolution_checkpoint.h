@@ -0,0 +1,59 @@
+#ifndef RAIJIN_EVOLUTION_CHECKPOINT_H
+#define RAIJIN_EVOLUTION_CHECKPOINT_H
+
+#include <windows.h>
+#include "raijin_ntstatus.h"
+#include "evolution_engine.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define EVOLUTION_CHECKPOINT_MAGIC 0x4B435645u   /* "EVCK" */
+#define EVOLUTION_CHECKPOINT_VERSION 1
+#define EVOLUTION_CHECKPOINT_DEFAULT_INTERVAL 10  /* generations between snapshots */
+
+/* Snapshot layout: a fixed header (own CRC) followed by one CRC-protected payload holding
+ * the engine RNG, id counter, statistics, per-individual records, all genomes as one bulk
+ * array, and the novelty archive and surrogate model when the engine has them.
+ * Snapshots are taken between generations; loading one into an engine configured with the
+ * same parameters continues the exact trajectory of the uninterrupted run, provided the
+ * fitness function is deterministic. */
+
+/* Periodic background writer. The caller's thread only copies engine state into the
+ * writer's buffer; CRC, file write and the atomic rename run on a worker thread.
+ * A snapshot that comes due while the previous write is still in flight is skipped. */
+typedef struct EvolutionCheckpointWriter {
+    char path[MAX_PATH];
+    char temp_path[MAX_PATH];
+    uint32_t interval;                   /* generations between snapshots */
+    uint32_t last_generation;            /* generation of the last snapshot taken */
+    uint8_t* buffer;                     /* serialized snapshot; owned by the worker while it runs */
+    size_t size;
+    size_t capacity;
+    HANDLE thread;                       /* in-flight write; NULL when idle */
+    volatile LONG last_status;           /* NTSTATUS of the last completed write */
+    uint64_t writes;
+    uint64_t skipped;
+    uint64_t last_serialize_us;          /* time the caller spent copying state */
+    uint64_t last_write_us;              /* time the worker spent on CRC, write and rename */
+    bool initialized;
+} EvolutionCheckpointWriter;
+
+NTSTATUS EvolutionCheckpoint_Save(const EvolutionEngine* engine, const char* path);
+
+/* Replaces the engine's population and evolution state. The engine must be initialized with
+ * the same population size, and novelty search / surrogate screening enabled with the same
+ * configuration as when the snapshot was taken. The engine is left untouched on failure. */
+NTSTATUS EvolutionCheckpoint_Load(EvolutionEngine* engine, const char* path);
+
+NTSTATUS EvolutionCheckpointWriter_Initialize(EvolutionCheckpointWriter* writer, const char* path,
+    uint32_t interval);
+void EvolutionCheckpointWriter_Shutdown(EvolutionCheckpointWriter* writer);
+
+/* Call once per generation, between generations; snapshots every `interval` generations. */
+NTSTATUS EvolutionCheckpointWriter_OnGeneration(EvolutionCheckpointWriter* writer, const EvolutionEngine* engine);
+
+/* Waits for the in-flight write and returns its status. */
+NTSTATUS EvolutionCheckpointWriter_Flush(EvolutionCheckpointWriter* writer);
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef RAIJIN_EVOLUTION_DIVERSITY_H
+#define RAIJIN_EVOLUTION_DIVERSITY_H
+
+#include "raijin_ntstatus.h"
+#include "evolution_engine.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define EVOLUTION_DIVERSITY_PROJECTIONS 32      /* Gaussian directions in the pairwise-distance sketch */
+#define EVOLUTION_DIVERSITY_MINHASH_BUCKETS 64  /* one-permutation MinHash signature length */
+
+#define EVOLUTION_DIVERSITY_MINHASH 0x1         /* also estimate (gene, value) Jaccard, for discrete genomes */
+
+/* O(n*d) over the whole population: per-gene variance and centroid distance are exact,
+ * mean pairwise distance is estimated from 1-D Gaussian projections (O(n log n) each).
+ * Genomes are read as doubles; the shortest genome bounds the gene count. */
+NTSTATUS EvolutionDiversity_Compute(const EvolutionaryIndividual* individuals, uint32_t count,
+    uint32_t flags, EvolutionDiversityStats* out);
+
+#endif
@@ -8,6 +8,8 @@
 #include "raijin_ntstatus.h"
 #include "neural_substrate.h"
 #include "ethics_system.h"
+#include "evolution_operators.h"
+#include "evolution_selection.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -128,6 +130,10 @@ typedef struct {
     uint32_t parallel_evaluations;   // Number of parallel fitness evaluations
     bool gpu_acceleration;           // Use GPU for fitness evaluation
     uint32_t population_size;       // Population size (0 = use engine default)
+    double mutation_sigma;           // Gaussian mutation step (0 = EVOLUTION_MUTATION_DEFAULT_SIGMA)
+    uint64_t rng_seed;               // Operator RNG seed (0 = seed from clock)
+    bool steady_state;               // Asynchronous steady-state replacement instead of generations
+    bool surrogate_screening;        // Pre-screen offspring with a learned fitness surrogate
 } EvolutionParameters;
 
 // Evolution statistics
@@ -141,17 +147,52 @@ typedef struct {
     double convergence_rate;         // Rate of fitness improvement
     bool target_reached;             // Whether target fitness was reached
     char* best_genome_description;   // Description of best solution
+    double worker_utilization;       // Steady-state: fraction of worker time spent breeding/evaluating
+    uint32_t steady_state_workers;   // Steady-state: pool jobs used by the last run
+    uint64_t surrogate_screened_out; // Offspring discarded on surrogate prediction alone
+    double surrogate_true_fraction;  // Fraction of bred offspring currently truly evaluated
+    double surrogate_rank_correlation; // Spearman of surrogate vs true fitness, last generation
+    double surrogate_mean_abs_error; // Smoothed absolute prediction error
 } EvolutionStatistics;
 
+// Full-population diversity (see evolution_diversity.h)
+typedef struct {
+    double mean_pairwise_distance;   // Random-projection estimate of mean Euclidean distance over all pairs
+    double mean_pairwise_sq_distance; // Exact mean squared distance over all pairs
+    double mean_centroid_distance;   // Mean Euclidean distance to the population centroid
+    double mean_gene_variance;       // Per-gene variance averaged over genes
+    double minhash_similarity;       // Mean pairwise Jaccard of (gene, value) sets; -1 when not computed
+    uint32_t individuals;            // Individuals measured
+    uint32_t genes;                  // Genes per individual measured
+} EvolutionDiversityStats;
+
+// Novelty search defaults
+#define EVOLUTION_NOVELTY_DEFAULT_DIM 16       // Floats per behavior descriptor
+#define EVOLUTION_NOVELTY_DEFAULT_K 15         // Nearest neighbors averaged for novelty
+#define EVOLUTION_NOVELTY_INSERT_TARGET 4      // Archive insertions per generation before threshold rises
+#define EVOLUTION_NOVELTY_STALL_GENERATIONS 5  // Generations without insertion before threshold falls
+
 // Novelty archive for novelty search
 typedef struct {
-    void** behaviors;                // Archive of novel behaviors
-    double* novelty_scores;          // Novelty scores for archive entries
+    float* descriptors;              // Behavior matrix, row-major [max_size x descriptor_dim]
+    double* novelty_scores;          // Novelty of each entry when it was archived
     uint32_t size;                   // Current archive size
     uint32_t max_size;               // Maximum archive size
     uint32_t k_neighbors;            // Number of neighbors for novelty calculation
+    uint32_t descriptor_dim;         // Floats per behavior descriptor
+    uint32_t next_slot;              // Ring cursor used once the archive is full
+    double insertion_threshold;      // Minimum novelty required for archival
+    uint32_t generations_without_insert; // Drives threshold relaxation
+    uint64_t total_insertions;       // Lifetime insertions
 } NoveltyArchive;
 
+// Speciation defaults
+#define EVOLUTION_SPECIES_MAX 64                   // Species slots allocated by EnableSpeciation
+#define EVOLUTION_SPECIES_DEFAULT_TARGET 8         // Target species count when none is given
+#define EVOLUTION_SPECIES_DEFAULT_THRESHOLD 0.3    // Initial compatibility threshold
+#define EVOLUTION_SPECIES_DEFAULT_STAGNATION 15    // Generations without improvement before culling
+#define EVOLUTION_SPECIES_ELITE_MIN_SIZE 5         // Species at least this large keep their champion
+
 // Species structure for speciation
 typedef struct {
     EvolutionaryIndividual** members; // Individuals in this species
@@ -161,8 +202,23 @@ typedef struct {
     uint32_t age;                    // Species age in generations
     uint32_t generations_no_improvement; // Generations without improvement
     void* representative;            // Representative genome
+    size_t representative_size;      // Size of representative genome in bytes
+    double best_fitness;             // Best raw fitness seen in this species
+    uint32_t offspring_allotment;    // Offspring assigned for the next generation
+    uint32_t id;                     // Stable species identifier
 } EvolutionarySpecies;
 
+// MAP-Elites archive (evolution_map_elites.h)
+struct MapElitesArchive;
+struct MapElitesConfig;
+
+// Fitness surrogate (evolution_surrogate.h)
+struct EvolutionSurrogate;
+struct EvolutionSurrogateConfig;
+
+// Periodic population snapshots (evolution_checkpoint.h)
+struct EvolutionCheckpointWriter;
+
 // Main evolution engine
 typedef struct {
     // Core components
@@ -173,7 +229,19 @@ typedef struct {
     // Advanced features
     EvolutionarySpecies* species;
     uint32_t species_count;
+    uint32_t species_capacity;       // Slots allocated in species
+    uint32_t next_species_id;        // Next identifier handed to a new species
     NoveltyArchive novelty_archive;
+    float* population_descriptors;   // Behavior descriptors aligned with population.individuals
+    double* population_novelty;      // Novelty of each individual from the last evaluation
+    uint32_t population_descriptor_capacity; // Rows allocated in population_descriptors
+    EvolutionRng rng;                // Stream for mutation, crossover and selection
+    EvolutionSelector selector;      // Parent sampler, prepared once per evaluated generation
+    EvolutionDiversityStats diversity; // Last CalculatePopulationDiversity result
+    struct MapElitesArchive* qd_archive; // MAP-Elites repertoire for EVOLUTION_TYPE_QUALITY_DIVERSITY
+    struct EvolutionSurrogate* surrogate; // Offspring pre-screening model (NULL = every child evaluated)
+    double* surrogate_predictions;   // Prediction per population slot; NaN when not screened
+    struct EvolutionCheckpointWriter* checkpoint; // Snapshot writer driven by NextGeneration (NULL = off)
 
     // Subsystem integration
     NeuralSubstrate* neural_system;
@@ -188,8 +256,15 @@ typedef struct {
     // Callbacks
     double (*fitness_function)(void* genome, size_t genome_size, void* context);
     void* fitness_context;
+    // Optional batched form of fitness_function; used for every multi-genome evaluation when set
+    NTSTATUS (*batch_fitness_function)(void* const* genomes, const size_t* genome_sizes,
+                                       uint32_t count, double* fitness, void* context);
+    void* batch_fitness_context;
     void (*genome_initializer)(void* genome, size_t genome_size, void* context);
     void* init_context;
+    void (*behavior_function)(const void* genome, size_t genome_size,
+                              float* descriptor, uint32_t descriptor_dim, void* context);
+    void* behavior_context;
 } EvolutionEngine;
 
 // Core API functions
@@ -218,20 +293,41 @@ NTSTATUS EvolutionEngine_MutateIndividual(EvolutionEngine* engine,
 
 // Evolution algorithms
 NTSTATUS EvolutionEngine_RunGeneticAlgorithm(EvolutionEngine* engine);
+NTSTATUS EvolutionEngine_NextGeneration(EvolutionEngine* engine);
+NTSTATUS EvolutionEngine_RunSteadyState(EvolutionEngine* engine, uint32_t worker_count);
 NTSTATUS EvolutionEngine_RunNEAT(EvolutionEngine* engine);
 NTSTATUS EvolutionEngine_RunEvolutionStrategies(EvolutionEngine* engine);
 NTSTATUS EvolutionEngine_RunQualityDiversity(EvolutionEngine* engine);
 
 // Advanced features
 NTSTATUS EvolutionEngine_EnableSpeciation(EvolutionEngine* engine, uint32_t species_count);
+NTSTATUS EvolutionEngine_Speciate(EvolutionEngine* engine);
+double EvolutionEngine_CompatibilityDistance(const void* genome1, size_t size1,
+                                           const void* genome2, size_t size2);
+NTSTATUS EvolutionEngine_EnableMapElites(EvolutionEngine* engine, const struct MapElitesConfig* config);
+NTSTATUS EvolutionEngine_EnableSurrogate(EvolutionEngine* engine, const struct EvolutionSurrogateConfig* config);
+NTSTATUS EvolutionEngine_EnableCheckpoint(EvolutionEngine* engine, const char* path, uint32_t interval_generations);
 NTSTATUS EvolutionEngine_EnableNoveltySearch(EvolutionEngine* engine, uint32_t archive_size);
 NTSTATUS EvolutionEngine_AddToNoveltyArchive(EvolutionEngine* engine, void* behavior);
 double EvolutionEngine_CalculateNovelty(EvolutionEngine* engine, void* behavior);
+NTSTATUS EvolutionEngine_CalculateNoveltyBatch(EvolutionEngine* engine,
+                                             const float* behaviors,
+                                             uint32_t count,
+                                             double* novelty_out);
+NTSTATUS EvolutionEngine_SetBehaviorFunction(EvolutionEngine* engine,
+                                           void (*behavior_func)(const void*, size_t, float*, uint32_t, void*),
+                                           void* context);
 
 // Fitness evaluation
 NTSTATUS EvolutionEngine_SetFitnessFunction(EvolutionEngine* engine,
                                           double (*fitness_func)(void*, size_t, void*),
                                           void* context);
+// Registers a batched form of the current fitness function. SetFitnessFunction clears it, so
+// call this after SetFitnessFunction. A batch that returns a failure status is re-scored per genome.
+NTSTATUS EvolutionEngine_SetBatchFitnessFunction(EvolutionEngine* engine,
+                                               NTSTATUS (*batch_func)(void* const*, const size_t*, uint32_t,
+                                                                      double*, void*),
+                                               void* context);
 NTSTATUS EvolutionEngine_EvaluateIndividual(EvolutionEngine* engine,
                                           EvolutionaryIndividual* individual);
 
@@ -268,6 +364,8 @@ NTSTATUS EvolutionEngine_SetParallelEvaluations(EvolutionEngine* engine,
 
 // Utility functions
 uint64_t EvolutionEngine_GenerateIndividualId();
+uint64_t EvolutionEngine_LastIndividualId();
+void EvolutionEngine_ReserveIndividualIds(uint64_t last_id); // Next id handed out is > last_id
 double EvolutionEngine_CalculatePopulationDiversity(EvolutionEngine* engine);
 bool EvolutionEngine_CheckTerminationCriteria(EvolutionEngine* engine);
 void EvolutionEngine_LogGeneration(EvolutionEngine* engine);
@@ -0,0 +1,88 @@
+#ifndef RAIJIN_EVOLUTION_ISLANDS_H
+#define RAIJIN_EVOLUTION_ISLANDS_H
+
+#include "raijin_ntstatus.h"
+#include "evolution_engine.h"
+#include "role_boundary.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define EVOLUTION_ISLANDS_MAX 64            /* bounded by MAXIMUM_WAIT_OBJECTS */
+#define EVOLUTION_ISLAND_MAILBOX_SLOTS 16   /* power of two */
+#define EVOLUTION_ISLAND_MAPPING_NAME_MAX 64
+
+typedef enum {
+    ISLAND_TOPOLOGY_RING = 0,            /* island i sends to i+1 */
+    ISLAND_TOPOLOGY_FULL = 1,            /* island i sends to every other island */
+    ISLAND_TOPOLOGY_RANDOM = 2           /* island i sends to one random island per exchange */
+} IslandTopology;
+
+typedef struct IslandModelConfig {
+    uint32_t island_count;
+    uint32_t population_per_island;
+    uint32_t generations;
+    uint32_t migration_interval;         /* generations between exchanges */
+    uint32_t migrants_per_exchange;
+    IslandTopology topology;
+    size_t genome_size;                  /* bytes; 0 = engine default */
+    uint64_t seed;
+    bool use_processes;                  /* islands as raijin.exe --island-worker over shared memory */
+} IslandModelConfig;
+
+typedef struct IslandStatus {
+    double best_fitness;
+    uint32_t generation;
+    uint32_t migrants_sent;
+    uint32_t migrants_received;
+    uint32_t migrants_dropped;           /* destination mailbox was full */
+    volatile LONG done;
+} IslandStatus;
+
+typedef struct EvolutionIsland {
+    EvolutionEngine engine;
+    NeuralSubstrate* neural;             /* replica of the model's substrate; NULL without one */
+    RoleBoundaryContext role_ctx;
+    uint32_t index;
+    struct EvolutionIslandModel* model;
+} EvolutionIsland;
+
+typedef struct EvolutionIslandModel {
+    IslandModelConfig config;
+    EvolutionParameters params;
+    EvolutionIsland* islands;            /* thread mode only */
+    uint8_t* shared;                     /* header, mailboxes and best genomes */
+    size_t shared_size;
+    HANDLE mapping;                      /* process mode only */
+    char mapping_name[EVOLUTION_ISLAND_MAPPING_NAME_MAX];
+    NeuralSubstrate* neural;
+    EthicsSystem* ethics;
+    double (*fitness_function)(void* genome, size_t genome_size, void* context);
+    void* fitness_context;
+    double best_fitness;
+    uint32_t best_island;
+    uint32_t role_violations;            /* folded from island contexts */
+    bool running;
+    bool initialized;
+} EvolutionIslandModel;
+
+NTSTATUS EvolutionIslands_Initialize(EvolutionIslandModel* model, const IslandModelConfig* config,
+    const EvolutionParameters* params, NeuralSubstrate* neural, EthicsSystem* ethics);
+void EvolutionIslands_Shutdown(EvolutionIslandModel* model);
+
+/* Thread mode only; process workers use the engine's default evaluator. */
+NTSTATUS EvolutionIslands_SetFitnessFunction(EvolutionIslandModel* model,
+    double (*fitness_func)(void*, size_t, void*), void* context);
+
+/* Blocks until every island finishes or Stop is called from another thread. */
+NTSTATUS EvolutionIslands_Run(EvolutionIslandModel* model);
+NTSTATUS EvolutionIslands_Stop(EvolutionIslandModel* model);
+
+NTSTATUS EvolutionIslands_GetStatus(const EvolutionIslandModel* model, uint32_t island, IslandStatus* out);
+NTSTATUS EvolutionIslands_GetBest(const EvolutionIslandModel* model, double* fitness,
+    void* genome_out, size_t genome_size);
+
+/* Entry point for raijin.exe --island-worker <mapping> <index>; returns process exit code. */
+int EvolutionIslands_WorkerMain(const char* mapping_name, uint32_t index);
+
+#endif
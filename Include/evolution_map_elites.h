@@ -0,0 +1,101 @@
+#ifndef RAIJIN_EVOLUTION_MAP_ELITES_H
+#define RAIJIN_EVOLUTION_MAP_ELITES_H
+
+#include <windows.h>
+#include "raijin_ntstatus.h"
+#include "evolution_operators.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define EVOLUTION_MAP_ELITES_MAX_DIM 16
+#define EVOLUTION_MAP_ELITES_MAX_CELLS (1u << 20)
+#define EVOLUTION_MAP_ELITES_DEFAULT_DIM 2
+#define EVOLUTION_MAP_ELITES_DEFAULT_BINS 32
+#define EVOLUTION_MAP_ELITES_DEFAULT_CVT_CELLS 1024
+#define EVOLUTION_MAP_ELITES_CVT_CANDIDATES_MAX 32   /* lookup cells with more candidates fall back to a full scan */
+
+typedef enum {
+    MAP_ELITES_GRID = 0,                 /* bins_per_dim^descriptor_dim regular cells */
+    MAP_ELITES_CVT = 1                   /* cvt_cells centroids from k-means over the descriptor box */
+} MapElitesArchiveType;
+
+typedef enum {
+    MAP_ELITES_REJECTED = 0,
+    MAP_ELITES_NEW_CELL = 1,
+    MAP_ELITES_IMPROVED = 2
+} MapElitesOutcome;
+
+typedef struct MapElitesConfig {
+    MapElitesArchiveType type;
+    uint32_t descriptor_dim;
+    uint32_t bins_per_dim;               /* grid only */
+    uint32_t cvt_cells;                  /* CVT only */
+    uint32_t cvt_iterations;             /* Lloyd iterations; 0 = 10 */
+    float descriptor_min;                /* descriptor box, same for every dimension */
+    float descriptor_max;
+    size_t genome_size;                  /* bytes per elite */
+    double fitness_offset;               /* subtracted from fitness in the QD-score */
+    uint64_t seed;                       /* CVT sampling */
+} MapElitesConfig;
+
+/* Writers serialize per cell on `busy`; readers copy under the `sequence` seqlock.
+ * fitness_key is the order-preserving integer encoding of the elite's fitness (0 = empty),
+ * so most rejections are a single atomic load. */
+typedef struct MapElitesCell {
+    volatile LONG64 fitness_key;
+    volatile LONG64 sequence;
+    volatile LONG busy;
+    uint32_t reserved;
+    uint64_t reserved2;
+} MapElitesCell;
+
+typedef struct MapElitesMetrics {
+    uint32_t cells;
+    uint32_t filled;
+    double coverage;                     /* filled / cells */
+    double qd_score;                     /* sum over filled cells of (fitness - fitness_offset) */
+    double best_fitness;
+    uint32_t best_cell;
+    uint64_t insertions;                 /* attempts */
+    uint64_t improvements;               /* accepted, including new cells */
+} MapElitesMetrics;
+
+typedef struct MapElitesArchive {
+    MapElitesConfig config;
+    uint32_t cell_count;
+    MapElitesCell* cells;
+    uint8_t* genomes;                    /* [cell_count x genome_size] */
+    float* descriptors;                  /* [cell_count x descriptor_dim] */
+    double* fitness;                     /* [cell_count] */
+    uint32_t* filled_cells;              /* append-only; UINT32_MAX until published */
+    volatile LONG filled_count;
+    volatile LONG64 insertions;
+    volatile LONG64 improvements;
+    /* CVT */
+    float* centroids;                    /* [cell_count x descriptor_dim] */
+    uint32_t lookup_resolution;          /* per-dimension; 0 = no lookup table */
+    uint32_t* lookup_offsets;            /* [lookup cells + 1]; empty range = scan all */
+    uint32_t* lookup_candidates;
+    bool initialized;
+} MapElitesArchive;
+
+NTSTATUS MapElites_Initialize(MapElitesArchive* archive, const MapElitesConfig* config);
+void MapElites_Shutdown(MapElitesArchive* archive);
+void MapElites_DefaultConfig(MapElitesConfig* config, size_t genome_size);
+
+uint32_t MapElites_CellIndex(const MapElitesArchive* archive, const float* descriptor);
+
+/* Safe to call from many threads at once. outcome (optional) gets a MapElitesOutcome per item;
+ * returns the number of accepted items. */
+uint32_t MapElites_InsertBatch(MapElitesArchive* archive, const void* const* genomes,
+    const float* descriptors, const double* fitness, uint32_t count, uint8_t* outcome);
+
+/* Consistent copy of one elite; STATUS_NOT_FOUND for an empty cell. */
+NTSTATUS MapElites_ReadElite(const MapElitesArchive* archive, uint32_t cell,
+    void* genome_out, double* fitness, float* descriptor_out);
+NTSTATUS MapElites_SampleCell(const MapElitesArchive* archive, EvolutionRng* rng, uint32_t* cell);
+
+void MapElites_GetMetrics(const MapElitesArchive* archive, MapElitesMetrics* out);
+
+#endif
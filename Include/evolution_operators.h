@@ -0,0 +1,46 @@
+#ifndef RAIJIN_EVOLUTION_OPERATORS_H
+#define RAIJIN_EVOLUTION_OPERATORS_H
+
+#include "raijin_ntstatus.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/* Step size matching the variance of the former uniform(-0.5, 0.5) mutation */
+#define EVOLUTION_MUTATION_DEFAULT_SIGMA 0.2886751345948129
+/* Below this rate mutation visits genes by geometric skipping instead of a dense mask */
+#define EVOLUTION_MUTATION_SPARSE_RATE 0.0625
+#define EVOLUTION_BLX_DEFAULT_ALPHA 0.5
+
+/* Two interleaved xorshift128+ streams, advanced two lanes at a time with SSE2 */
+typedef struct EvolutionRng {
+    uint64_t s0[2];
+    uint64_t s1[2];
+} EvolutionRng;
+
+void EvolutionRng_Seed(EvolutionRng* rng, uint64_t seed);
+uint64_t EvolutionRng_Next(EvolutionRng* rng);
+double EvolutionRng_NextDouble(EvolutionRng* rng);          /* [0, 1) */
+uint32_t EvolutionRng_NextBelow(EvolutionRng* rng, uint32_t bound);
+void EvolutionRng_FillUniform(EvolutionRng* rng, double* out, size_t count);   /* [0, 1) */
+void EvolutionRng_FillGaussian(EvolutionRng* rng, float* out, size_t count);   /* N(0, 1) */
+
+/* Operators work on genomes of `count` doubles; child may not alias a parent */
+void EvolutionOps_MutateGaussian(EvolutionRng* rng, double* genes, size_t count,
+    double rate, double sigma, double min_value, double max_value);
+void EvolutionOps_CrossoverSinglePoint(EvolutionRng* rng, const double* a, const double* b,
+    double* child, size_t count);
+void EvolutionOps_CrossoverTwoPoint(EvolutionRng* rng, const double* a, const double* b,
+    double* child, size_t count);
+void EvolutionOps_CrossoverUniform(EvolutionRng* rng, const double* a, const double* b,
+    double* child, size_t count);
+void EvolutionOps_CrossoverArithmetic(EvolutionRng* rng, const double* a, const double* b,
+    double* child, size_t count);
+void EvolutionOps_CrossoverBlxAlpha(EvolutionRng* rng, const double* a, const double* b,
+    double* child, size_t count, double alpha);
+
+/* Genes/sec of the vectorized operators against the former scalar rand() versions,
+ * genome lengths 100 to 1M. Prints a table; used by raijin.exe --bench-evolution-ops. */
+NTSTATUS EvolutionOps_RunBenchmark(void);
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef RAIJIN_EVOLUTION_REMOTE_H
+#define RAIJIN_EVOLUTION_REMOTE_H
+
+#include "raijin_ntstatus.h"
+#include "evolution_engine.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define EVOLUTION_REMOTE_MAX_WORKERS 64         /* one select() set */
+#define EVOLUTION_REMOTE_MAX_PIPELINE 8
+#define EVOLUTION_REMOTE_DEFAULT_PIPELINE 2     /* tasks in flight per worker */
+#define EVOLUTION_REMOTE_DEFAULT_CONNECT_TIMEOUT_MS 10000
+#define EVOLUTION_REMOTE_DEFAULT_TASK_TIMEOUT_MS 30000
+#define EVOLUTION_REMOTE_DEFAULT_RESPAWNS 8
+#define EVOLUTION_REMOTE_DEFAULT_PORT 47321     /* --remote-eval --external */
+#define EVOLUTION_REMOTE_MAX_FRAME (64u * 1024 * 1024)
+#define EVOLUTION_REMOTE_PATH_MAX 260
+
+/*
+ * Wire format, host byte order (both ends are the same binary on the same box).
+ * Every frame is a 20-byte EvolutionRemoteFrameHeader followed by `length` payload bytes:
+ *   HELLO    worker -> pool   task = worker index; {version, pid, token}
+ *   CONFIG   pool -> worker   {use_neural, params_size, EvolutionParameters, substrate_path}
+ *   READY    worker -> pool   task = NTSTATUS of the worker's engine setup
+ *   EVAL     pool -> worker   {count, reserved, uint32 size[count], genomes}; the first genome and
+ *                             each following one start on an 8-byte boundary of the payload
+ *   RESULT   worker -> pool   {count, reserved, double fitness[count]}
+ *   CANCEL   pool -> worker   drop `task` if it has not started yet
+ *   CANCELLED worker -> pool  `task` was dropped unstarted; every EVAL is answered by exactly one
+ *                             RESULT or CANCELLED
+ *   SHUTDOWN pool -> worker   exit after the current task
+ */
+#define EVOLUTION_REMOTE_MAGIC 0x4C564552u  /* "REVL" */
+#define EVOLUTION_REMOTE_VERSION 1
+
+typedef enum {
+    EVOLUTION_REMOTE_HELLO = 1,
+    EVOLUTION_REMOTE_CONFIG = 2,
+    EVOLUTION_REMOTE_READY = 3,
+    EVOLUTION_REMOTE_EVAL = 4,
+    EVOLUTION_REMOTE_RESULT = 5,
+    EVOLUTION_REMOTE_CANCEL = 6,
+    EVOLUTION_REMOTE_SHUTDOWN = 7,
+    EVOLUTION_REMOTE_CANCELLED = 8
+} EvolutionRemoteFrameType;
+
+typedef struct EvolutionRemoteFrameHeader {
+    uint32_t magic;
+    uint16_t type;
+    uint16_t reserved;
+    uint32_t batch;                      /* results from an earlier batch are discarded */
+    uint32_t task;
+    uint32_t length;
+} EvolutionRemoteFrameHeader;
+
+typedef struct EvolutionRemoteConfig {
+    uint32_t worker_count;
+    uint32_t pipeline_depth;             /* tasks in flight per worker, <= EVOLUTION_REMOTE_MAX_PIPELINE */
+    uint32_t task_genomes;               /* genomes per task; 0 = spread each batch over ~2x the pipeline slots */
+    uint32_t connect_timeout_ms;         /* workers must finish the handshake within this */
+    uint32_t task_timeout_ms;            /* a worker silent this long with work outstanding is declared dead */
+    uint32_t max_respawns;               /* spawned workers restarted over the pool's lifetime */
+    uint16_t port;                       /* loopback port; 0 = ephemeral */
+    uint64_t token;                      /* HELLO secret; 0 = random (external workers need it up front) */
+    bool spawn_workers;                  /* false: wait for external raijin.exe --eval-worker processes */
+    bool use_neural;                     /* workers evaluate through their own substrate */
+    char substrate_path[EVOLUTION_REMOTE_PATH_MAX];  /* optional NeuralSubstrate_SaveState snapshot workers load */
+} EvolutionRemoteConfig;
+
+typedef struct EvolutionRemoteStats {
+    uint64_t batches;
+    uint64_t tasks_sent;
+    uint64_t genomes_evaluated;
+    uint64_t tasks_stolen;               /* re-issued from a busy worker's pipeline to an idle one */
+    uint64_t tasks_backed_up;            /* second copy of a running task on an idle worker */
+    uint64_t tasks_resubmitted;          /* recovered from a worker that died or timed out */
+    uint64_t results_discarded;          /* duplicate or stale results */
+    uint64_t worker_deaths;
+    uint64_t workers_respawned;
+    uint64_t bytes_sent;
+    uint64_t bytes_received;
+    double last_batch_ms;
+} EvolutionRemoteStats;
+
+typedef struct EvolutionRemoteWorker {
+    uintptr_t socket;                    /* SOCKET; INVALID_SOCKET when not connected */
+    HANDLE process;                      /* spawned workers only */
+    uint32_t pid;
+    uint32_t inflight[EVOLUTION_REMOTE_MAX_PIPELINE];  /* owned task ids in send order; [0] is running */
+    uint32_t inflight_count;
+    uint32_t outstanding;                /* EVAL frames not yet answered; the worker is idle at 0 */
+    uint64_t last_activity_ms;
+    uint64_t tasks_completed;
+    bool alive;
+} EvolutionRemoteWorker;
+
+struct EvolutionRemoteTask;
+
+typedef struct EvolutionRemotePool {
+    EvolutionRemoteConfig config;
+    EvolutionParameters params;
+    EvolutionRemoteWorker workers[EVOLUTION_REMOTE_MAX_WORKERS];
+    uintptr_t listener;                  /* SOCKET bound to 127.0.0.1 */
+    uint16_t port;                       /* bound port */
+    uint64_t token;                      /* shared secret a worker presents in HELLO */
+    uint32_t batch;
+    uint32_t respawns;
+    struct EvolutionRemoteTask* tasks;   /* per-batch task table */
+    uint32_t* queue;                     /* [task_capacity] ring of queued task ids */
+    uint32_t queue_head;
+    uint32_t queue_count;
+    uint32_t task_count;                 /* tasks in the current batch */
+    uint32_t task_capacity;
+    uint8_t* buffer;                     /* frame scratch */
+    size_t buffer_capacity;
+    EvolutionRemoteStats stats;
+    bool wsa_started;
+    bool initialized;
+} EvolutionRemotePool;
+
+void EvolutionRemote_GetDefaultConfig(EvolutionRemoteConfig* config);
+
+/* Binds the loopback listener, then spawns (or waits for) config.worker_count workers and
+ * completes the handshake with each. Succeeds if at least one worker is ready. */
+NTSTATUS EvolutionRemote_Initialize(EvolutionRemotePool* pool, const EvolutionRemoteConfig* config,
+    const EvolutionParameters* params);
+void EvolutionRemote_Shutdown(EvolutionRemotePool* pool);
+
+/* batch_fitness_function form; context is the pool. Fails only when no worker is left,
+ * in which case the engine falls back to its local evaluator. */
+NTSTATUS EvolutionRemote_EvaluateBatch(void* const* genomes, const size_t* genome_sizes,
+    uint32_t count, double* fitness, void* context);
+
+/* Routes the engine's batched evaluation through the pool. */
+NTSTATUS EvolutionRemote_Attach(EvolutionRemotePool* pool, EvolutionEngine* engine);
+
+uint32_t EvolutionRemote_LiveWorkers(const EvolutionRemotePool* pool);
+NTSTATUS EvolutionRemote_GetStats(const EvolutionRemotePool* pool, EvolutionRemoteStats* out);
+
+/* Entry point for raijin.exe --eval-worker <port> <index> <token>; returns process exit code. */
+int EvolutionRemote_WorkerMain(uint16_t port, uint32_t index, uint64_t token);
+
+#endif
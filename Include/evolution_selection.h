@@ -0,0 +1,65 @@
+#ifndef RAIJIN_EVOLUTION_SELECTION_H
+#define RAIJIN_EVOLUTION_SELECTION_H
+
+#include "raijin_ntstatus.h"
+#include "evolution_operators.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define EVOLUTION_SELECTION_DEFAULT_TOURNAMENT 3
+#define EVOLUTION_SELECTION_DEFAULT_TRUNCATION 0.5   /* fraction of the population kept as parents */
+#define EVOLUTION_SELECTION_DEFAULT_PRESSURE 1.5     /* linear ranking: best gets pressure x the mean weight */
+
+typedef enum {
+    EVOLUTION_SELECT_TOURNAMENT = 0,     /* best of `tournament_size` uniform draws */
+    EVOLUTION_SELECT_ROULETTE = 1,       /* fitness-proportional, shifted so the worst keeps a small share */
+    EVOLUTION_SELECT_RANK = 2,           /* linear ranking with `pressure` in [1, 2] */
+    EVOLUTION_SELECT_TRUNCATION = 3      /* uniform over the top `truncation` fraction */
+} EvolutionSelectionMode;
+
+/* Walker/Vose alias table: O(n) build, O(1) per sample. */
+typedef struct EvolutionAliasTable {
+    double* probability;                 /* [count] acceptance threshold of each column */
+    uint32_t* alias;                     /* [count] fallback index of each column */
+    uint32_t* work;                      /* [count] small/large stacks during the build */
+    uint32_t count;
+    uint32_t capacity;
+} EvolutionAliasTable;
+
+/* Per-generation sampler. Prepare copies the fitness once and builds whatever the mode needs
+ * (alias table, truncation partition); Draw then fills any number of parent indices. */
+typedef struct EvolutionSelector {
+    EvolutionSelectionMode mode;
+    uint32_t tournament_size;
+    double truncation;
+    double pressure;
+    double* fitness;                     /* [capacity] copy taken by Prepare */
+    uint32_t* order;                     /* [capacity] index scratch; truncation keeps its parents in front */
+    uint64_t* keys;                      /* [2 x capacity] radix-sort scratch for rank selection */
+    uint32_t* order_tmp;                 /* [capacity] */
+    EvolutionAliasTable alias;
+    uint32_t count;                      /* individuals covered by the last Prepare */
+    uint32_t parent_pool;                /* truncation: parents kept in order[0..parent_pool) */
+    uint32_t capacity;
+    bool ready;                          /* Prepare ran since the fitness last changed */
+    bool initialized;
+} EvolutionSelector;
+
+NTSTATUS EvolutionAlias_Build(EvolutionAliasTable* table, const double* weights, uint32_t count);
+uint32_t EvolutionAlias_Sample(const EvolutionAliasTable* table, EvolutionRng* rng);
+void EvolutionAlias_Free(EvolutionAliasTable* table);
+
+/* Moves the indices of the k largest fitness values to indices[0..k), best first, by
+ * introselect partitioning; indices[k..count) hold the rest in no particular order.
+ * Expected O(count + k log k). */
+void EvolutionSelection_TopK(const double* fitness, uint32_t count, uint32_t k, uint32_t* indices);
+
+NTSTATUS EvolutionSelector_Initialize(EvolutionSelector* selector, uint32_t capacity);
+void EvolutionSelector_Shutdown(EvolutionSelector* selector);
+/* fitness may be selector->fitness, filled in place by the caller. */
+NTSTATUS EvolutionSelector_Prepare(EvolutionSelector* selector, EvolutionSelectionMode mode,
+    const double* fitness, uint32_t count);
+void EvolutionSelector_Draw(EvolutionSelector* selector, EvolutionRng* rng, uint32_t* indices, uint32_t n);
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef RAIJIN_EVOLUTION_SURROGATE_H
+#define RAIJIN_EVOLUTION_SURROGATE_H
+
+#include "raijin_ntstatus.h"
+#include "evolution_operators.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define EVOLUTION_SURROGATE_DEFAULT_FEATURES 256
+#define EVOLUTION_SURROGATE_MAX_FEATURES 1024
+#define EVOLUTION_SURROGATE_MAX_OVERSAMPLE 8     /* candidates bred per offspring slot at most */
+
+/* Ridge regression on random features, trained online with exponential forgetting.
+ * Half the features are linear random projections (local gradient), half are random
+ * Fourier features (curvature); a constant feature carries the mean. */
+typedef struct EvolutionSurrogateConfig {
+    uint32_t features;                   /* random features; 0 = default */
+    double ridge_lambda;                 /* relative to the mean diagonal; 0 = 1e-3 */
+    double forgetting;                   /* per Observe batch; 0 = 0.9 */
+    double min_fraction;                 /* smallest truly-evaluated fraction; 0 = 0.2 */
+    double max_fraction;                 /* 0 = 1.0 (no pre-screening) */
+    uint32_t warmup_samples;             /* observations before screening starts; 0 = features */
+    uint64_t seed;
+} EvolutionSurrogateConfig;
+
+typedef struct EvolutionSurrogate {
+    EvolutionSurrogateConfig config;
+    uint32_t genes;
+    uint32_t dim;                        /* features + 1 (constant) */
+    float* projection;                   /* [features x genes] */
+    float* phase;                        /* [features / 2] Fourier offsets */
+    double* gram;                        /* [dim x dim] decayed Phi^T Phi */
+    double* moment;                      /* [dim] decayed Phi^T y */
+    double* weights;                     /* [dim] current solution */
+    double* factor;                      /* [dim x dim] Cholesky scratch */
+    double* scratch;                     /* [dim] feature row */
+    float* genome_f;                     /* [genes] genome converted for the projection */
+    double lengthscale;                  /* Fourier bandwidth; follows the observed batch spread */
+    uint64_t samples;
+    bool dirty;                          /* observations since the last solve */
+    bool trained;
+
+    /* Screening quality */
+    double true_fraction;                /* fraction of bred candidates that are truly evaluated */
+    double rank_correlation;             /* Spearman of predicted vs true on the last checked batch */
+    double mean_abs_error;               /* EMA over checked predictions */
+    uint64_t predictions;
+    uint64_t screened_out;               /* candidates discarded on prediction alone */
+    bool initialized;
+} EvolutionSurrogate;
+
+/* Not thread-safe; the engine calls it from its breeding thread only. */
+NTSTATUS EvolutionSurrogate_Initialize(EvolutionSurrogate* surrogate, const EvolutionSurrogateConfig* config,
+    uint32_t genes);
+void EvolutionSurrogate_Shutdown(EvolutionSurrogate* surrogate);
+
+/* Adds truly evaluated genomes (genes doubles each) and refits lazily on the next Predict. */
+NTSTATUS EvolutionSurrogate_Observe(EvolutionSurrogate* surrogate, const double* const* genomes,
+    const double* fitness, uint32_t count);
+NTSTATUS EvolutionSurrogate_PredictBatch(EvolutionSurrogate* surrogate, const double* const* genomes,
+    uint32_t count, double* predicted);
+
+/* Compares predictions with true fitness for the same genomes and moves true_fraction:
+ * strong rank agreement lowers it towards min_fraction, none raises it to max_fraction. */
+void EvolutionSurrogate_RecordOutcome(EvolutionSurrogate* surrogate, const double* predicted,
+    const double* actual, uint32_t count);
+
+#endif
@@ -115,15 +115,46 @@ typedef struct {
     bool initialized;
     HANDLE memory_handle;  // For large memory allocations
     CRITICAL_SECTION lock; // Per-instance thread safety lock
+    void* replica_slab;    // Replicas only: one allocation holding neurons, ids, weights and activations
 } NeuralSubstrate;
 
 // Core API functions
 NTSTATUS NeuralSubstrate_Initialize(NeuralSubstrate* substrate);
 NTSTATUS NeuralSubstrate_Shutdown(NeuralSubstrate* substrate);
 NTSTATUS NeuralSubstrate_Process(NeuralSubstrate* substrate, const void* input, size_t input_size, void* output, size_t output_size);
+// Forward pass for `count` samples laid out back to back (input_size / output_size bytes each),
+// streaming each neuron's weights once per block of samples instead of once per sample.
+// Every sample sees the state the previous call left; afterwards the fabric holds the last
+// sample's state, as if the samples had gone through NeuralSubstrate_Process in order.
+NTSTATUS NeuralSubstrate_ProcessBatch(NeuralSubstrate* substrate, const void* inputs, size_t input_size,
+                                      void* outputs, size_t output_size, uint32_t count);
 NTSTATUS NeuralSubstrate_Learn(NeuralSubstrate* substrate, const void* target, size_t target_size);
+NTSTATUS NeuralSubstrate_LearnWithRate(NeuralSubstrate* substrate, const void* target, size_t target_size,
+                                       float learning_rate);
 NTSTATUS NeuralSubstrate_Evolve(NeuralSubstrate* substrate);
+
+// Replicas for parallel training. A replica is a private copy of the source's fabric (without
+// the knowledge base) in a single slab, so creating one is one allocation, and refreshing it
+// from another substrate of the same topology is a straight copy into existing memory.
+// `replica` must be zeroed; release it with NeuralSubstrate_Shutdown.
+NTSTATUS NeuralSubstrate_CreateReplica(NeuralSubstrate* replica, NeuralSubstrate* source);
+// Copies weights, connections and neuron state from src into dst. Both must have the same
+// neuron count and per-neuron connection counts; nothing is copied otherwise.
+NTSTATUS NeuralSubstrate_CopyWeights(NeuralSubstrate* dst, NeuralSubstrate* src);
 float NeuralSubstrate_GetEntropy(const NeuralSubstrate* substrate);
+
+// Split form of Learn for data-parallel training. The gradient is one float per connection,
+// neurons in order; AccumulateGradient adds the step Learn would take for the last Process
+// call (without touching the weights), ApplyGradient then moves every weight by
+// learning_rate * gradient * plasticity exactly as Learn does.
+uint64_t NeuralSubstrate_GetParameterCount(const NeuralSubstrate* substrate);
+NTSTATUS NeuralSubstrate_AccumulateGradient(NeuralSubstrate* substrate, const void* target, size_t target_size,
+                                            float* gradient, uint64_t count);
+NTSTATUS NeuralSubstrate_ApplyGradient(NeuralSubstrate* substrate, const float* gradient, uint64_t count,
+                                       float learning_rate);
+// Recurrent state carried between Process calls, one float per neuron
+NTSTATUS NeuralSubstrate_GetActivations(NeuralSubstrate* substrate, float* state, uint64_t count);
+NTSTATUS NeuralSubstrate_SetActivations(NeuralSubstrate* substrate, const float* state, uint64_t count);
 NTSTATUS NeuralSubstrate_SaveState(const NeuralSubstrate* substrate, const char* filename);
 NTSTATUS NeuralSubstrate_LoadState(NeuralSubstrate* substrate, const char* filename);
 
@@ -133,6 +164,7 @@ void FreeNeuralMemory(void* buffer);
 
 // Chaotic computation primitives
 float GenerateChaos(float seed, float entropy);
+void ReseedChaos(uint64_t seed);   // Restarts the calling thread's chaos stream from `seed`
 void EntropicActivation(float* values, size_t count, float chaos_level);
 float ComputeEmbeddingSimilarity(const HyperEmbedding* a, const HyperEmbedding* b);
 
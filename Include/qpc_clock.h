@@ -0,0 +1,13 @@
+#ifndef RAIJIN_QPC_CLOCK_H
+#define RAIJIN_QPC_CLOCK_H
+
+#include <stdint.h>
+
+/* QueryPerformanceCounter ticks, an instant or a difference, in microseconds. Split as
+ * (t / f) * 1e6 + (t % f) * 1e6 / f, since t * 1e6 overflows after days of uptime. */
+uint64_t QpcClock_TicksToUs(uint64_t ticks, uint64_t frequency);
+
+/* Monotonic microseconds since boot; the clock the scheduler and every module time themselves with. */
+uint64_t QpcClock_NowUs(void);
+
+#endif
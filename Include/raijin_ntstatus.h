@@ -47,6 +47,18 @@ typedef LONG NTSTATUS;
 #define STATUS_NOT_FOUND ((LONG)0xC0000225)
 #endif
 
+#ifndef STATUS_DATA_ERROR
+#define STATUS_DATA_ERROR ((LONG)0xC000003E)
+#endif
+
+#ifndef STATUS_PENDING
+#define STATUS_PENDING ((LONG)0x00000103)
+#endif
+
+#ifndef STATUS_CANCELLED
+#define STATUS_CANCELLED ((LONG)0xC0000120)
+#endif
+
 #ifndef STATUS_ROLE_BOUNDARY_VIOLATION
 #define STATUS_ROLE_BOUNDARY_VIOLATION ((LONG)0xC0001020)
 #endif
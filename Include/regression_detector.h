@@ -9,6 +9,9 @@
 
 #define REGRESSION_WINDOW_MIN 16
 #define REGRESSION_DEGENERATION_THRESHOLD 0.15
+#define REGRESSION_ROBUSTNESS_SOURCES 4        /* independent robustness series (stress, adversarial, ...) */
+#define REGRESSION_ROBUSTNESS_HISTORY 32
+#define REGRESSION_ROBUSTNESS_WINDOW_MIN 8     /* robustness results arrive every few tens of seconds */
 
 typedef enum {
     REGRESSION_NONE = 0,
@@ -16,7 +19,8 @@ typedef enum {
     REGRESSION_LOSS_INCREASE = 2,
     REGRESSION_COHERENCE_DROP = 3,
     REGRESSION_DOMINANCE_DROP = 4,
-    DEGENERATION_SUSTAINED = 5
+    DEGENERATION_SUSTAINED = 5,
+    REGRESSION_ROBUSTNESS_DROP = 6
 } RegressionType;
 
 typedef struct RegressionEvent {
@@ -37,6 +41,10 @@ typedef struct RegressionDetector {
     double* dominance_history;
     uint32_t history_count;
     uint32_t history_capacity;
+    /* Per source, oldest first; fed by RecordRobustness, checked by the next Update */
+    double robustness_history[REGRESSION_ROBUSTNESS_SOURCES][REGRESSION_ROBUSTNESS_HISTORY];
+    uint32_t robustness_count[REGRESSION_ROBUSTNESS_SOURCES];
+    bool robustness_fresh;                /* a result arrived since the last Update */
     uint32_t consecutive_regressions;
     bool regression_detected;
     bool degeneration_detected;
@@ -47,6 +55,8 @@ NTSTATUS RegressionDetector_Initialize(RegressionDetector* rd, DominanceMetrics*
 NTSTATUS RegressionDetector_Shutdown(RegressionDetector* rd);
 
 NTSTATUS RegressionDetector_Update(RegressionDetector* rd);
+/* One robustness result (0-1) from evaluator `source` < REGRESSION_ROBUSTNESS_SOURCES. */
+NTSTATUS RegressionDetector_RecordRobustness(RegressionDetector* rd, uint32_t source, double robustness);
 
 bool RegressionDetector_IsRegressionDetected(const RegressionDetector* rd);
 bool RegressionDetector_IsDegenerationDetected(const RegressionDetector* rd);
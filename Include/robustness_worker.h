@@ -0,0 +1,96 @@
+#ifndef RAIJIN_ROBUSTNESS_WORKER_H
+#define RAIJIN_ROBUSTNESS_WORKER_H
+
+#include <windows.h>
+#include "raijin_ntstatus.h"
+#include "neural_substrate.h"
+#include "stress_test_framework.h"
+#include "adversarial_stress.h"
+#include "red_team.h"
+#include "thread_pool.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define ROBUSTNESS_DESCRIPTION_MAX 256
+
+typedef enum {
+    ROBUSTNESS_JOB_STRESS = 0,
+    ROBUSTNESS_JOB_ADVERSARIAL = 1,
+    ROBUSTNESS_JOB_RED_TEAM = 2,
+    ROBUSTNESS_JOB_COUNT = 3
+} RobustnessJobKind;
+
+typedef struct RobustnessOutcome {
+    RobustnessJobKind kind;
+    NTSTATUS status;
+    double robustness;                   /* 0-1 */
+    bool passed;                         /* stress test passed / red team induced no failure */
+    uint64_t duration_us;
+    char description[ROBUSTNESS_DESCRIPTION_MAX];
+} RobustnessOutcome;
+
+typedef struct RobustnessWorkerStats {
+    uint64_t submitted;
+    uint64_t completed;
+    uint64_t inline_runs;                /* ran on the caller: no snapshot */
+    uint64_t coalesced;                  /* requests for a kind that was already pending */
+    uint64_t snapshot_refreshes;
+    uint64_t snapshot_rebuilds;          /* topology changed since the last refresh */
+    uint64_t snapshot_us;                /* caller time spent copying weights */
+    uint64_t eval_us;                    /* worker time spent in the evaluators */
+} RobustnessWorkerStats;
+
+/*
+ * Runs the stress, adversarial and red-team evaluators away from the live substrate. The
+ * evaluators are bound to a replica that Poll refreshes from the live weights just before
+ * each job, on the thread that owns the live substrate; the job itself is a LOW pool task,
+ * so training never waits for one. One job is in flight at a time (the red team drives the
+ * other two evaluators); requests that arrive meanwhile are kept as one pending bit per kind.
+ * `notify` is called when a job finishes, so the owner can Poll for it: from the pool thread,
+ * or from Poll itself when the job ran inline and Poll already returned an earlier outcome.
+ */
+typedef struct RobustnessWorker {
+    NeuralSubstrate* live;
+    NeuralSubstrate snapshot;            /* the evaluators' substrate; address never changes */
+    StressTestFramework* stress;
+    AdversarialStressContext* adversarial;
+    RedTeam* red_team;
+    void (*notify)(void* context);
+    void* notify_context;
+    uint32_t pending;                    /* bit per RobustnessJobKind */
+    uint32_t next_kind;                  /* round-robin start for the next pick */
+    uint32_t stress_runs;
+    bool busy;                           /* a job is in flight; owner thread only */
+    volatile LONG done;                  /* set by the job once `outcome` is written */
+    RobustnessOutcome outcome;           /* owned by the job while busy and not done */
+    ThreadPoolGroup group;
+    RobustnessWorkerStats stats;
+    bool initialized;
+} RobustnessWorker;
+
+/* Creates the replica of `live`. Bind the evaluators to RobustnessWorker_GetSnapshot. */
+NTSTATUS RobustnessWorker_Initialize(RobustnessWorker* worker, NeuralSubstrate* live);
+/* Waits for a job in flight, then frees the replica; evaluators bound to it must not run again. */
+void RobustnessWorker_Shutdown(RobustnessWorker* worker);
+
+/* The substrate the evaluators should use: the replica, or `live` if it could not be built. */
+NeuralSubstrate* RobustnessWorker_GetSnapshot(RobustnessWorker* worker);
+/* Any evaluator may be NULL or uninitialised; requests for it are then dropped. */
+void RobustnessWorker_Attach(RobustnessWorker* worker, StressTestFramework* stress,
+    AdversarialStressContext* adversarial, RedTeam* red_team);
+/* Waits for a job in flight, so the previous callback is never called once this returns. */
+void RobustnessWorker_SetNotify(RobustnessWorker* worker, void (*notify)(void* context), void* context);
+
+/* Marks a job kind pending. Owner thread only; never runs anything. */
+NTSTATUS RobustnessWorker_Request(RobustnessWorker* worker, RobustnessJobKind kind);
+/*
+ * Owner thread. Collects a finished job into `out` and returns true; then, if nothing is in
+ * flight and something is pending, refreshes the replica and starts the next job.
+ */
+bool RobustnessWorker_Poll(RobustnessWorker* worker, RobustnessOutcome* out);
+
+void RobustnessWorker_GetStats(const RobustnessWorker* worker, RobustnessWorkerStats* out);
+const char* RobustnessWorker_KindName(RobustnessJobKind kind);
+
+#endif
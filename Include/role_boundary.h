@@ -40,4 +40,9 @@ void RoleBoundary_Reset(RoleBoundaryContext* ctx);
 
 RoleBoundaryContext* RoleBoundary_GetGlobal(void);
 
+/* Worker threads bind a private context; GetGlobal returns it on that thread. Pass NULL to unbind. */
+void RoleBoundary_BindThread(RoleBoundaryContext* ctx);
+/* The context bound on this thread, or NULL; lets code that runs foreign work restore it. */
+RoleBoundaryContext* RoleBoundary_GetBoundThread(void);
+
 #endif
@@ -1,6 +1,7 @@
 #ifndef RAIJIN_RUNTIME_CONFIG_H
 #define RAIJIN_RUNTIME_CONFIG_H
 
+#include "raijin_ntstatus.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -13,6 +14,8 @@
 #define RUNTIME_CONFIG_MAX_SELF_TEST_INTERVAL 2000
 #define RUNTIME_CONFIG_MIN_STRESS_INTERVAL 10
 #define RUNTIME_CONFIG_MAX_STRESS_INTERVAL 200
+#define RUNTIME_CONFIG_MAX_RATE_LIMITS 32
+#define RUNTIME_CONFIG_RATE_NAME_MAX 32        /* matches TASK_SCHEDULER_NAME_MAX */
 
 typedef struct RuntimeConfig {
     uint32_t evolution_interval;
@@ -27,7 +30,23 @@ typedef struct RuntimeConfig {
     bool initialized;
 } RuntimeConfig;
 
+/* Most runs per second allowed for one main-loop task, by scheduler task name; 0 = no limit. */
+typedef struct RuntimeRateLimit {
+    char task[RUNTIME_CONFIG_RATE_NAME_MAX];
+    double hz;
+} RuntimeRateLimit;
+
+typedef struct RuntimeRateLimits {
+    RuntimeRateLimit limits[RUNTIME_CONFIG_MAX_RATE_LIMITS];
+    uint32_t count;
+} RuntimeRateLimits;
+
 void RuntimeConfig_GetDefault(RuntimeConfig* cfg);
 void RuntimeConfig_Update(RuntimeConfig* cfg, double loss, double fitness, uint64_t step_count);
 
+/* One "task=hz" entry; a later entry for the same task replaces the earlier one. */
+NTSTATUS RuntimeConfig_ParseRateLimit(RuntimeRateLimits* limits, const char* spec);
+/* A file of "task = hz" lines; blank lines and lines starting with '#' are skipped. */
+NTSTATUS RuntimeConfig_LoadRateLimits(RuntimeRateLimits* limits, const char* path);
+
 #endif
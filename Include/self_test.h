@@ -8,6 +8,7 @@
 
 #define SELF_TEST_MAX_NAME 128
 #define SELF_TEST_MAX_MESSAGE 256
+#define SELF_TEST_MAX_TESTS 48             /* report capacity that holds every RunAll test */
 
 typedef struct SelfTestResult {
     char name[SELF_TEST_MAX_NAME];
@@ -30,7 +31,20 @@ void SelfTestReport_Shutdown(SelfTestReport* report);
 NTSTATUS SelfTestReport_Add(SelfTestReport* report, const char* name,
     bool passed, const char* message, uint64_t duration_ms);
 
+/* Position of a self-test sweep run in slices; zero-initialise to start at the first test. */
+typedef struct SelfTestSweep {
+    uint32_t next;                       /* index of the next test; 0 = a new sweep resets the report */
+    uint64_t slices;
+    uint64_t sweeps;                     /* completed */
+} SelfTestSweep;
+
 NTSTATUS SelfTest_RunAll(SelfTestReport* report);
+/*
+ * Runs the RunAll tests from where the sweep stopped until `budget_us` has been used (always
+ * at least one test), skipping the heavy ones that only RunAll runs. `complete` is set once
+ * the last test has run; the report then holds the whole sweep and the next call starts a new one.
+ */
+NTSTATUS SelfTest_RunSlice(SelfTestReport* report, SelfTestSweep* sweep, uint64_t budget_us, bool* complete);
 NTSTATUS SelfTest_RunOne(SelfTestReport* report, const char* test_name);
 bool SelfTest_AllPassed(const SelfTestReport* report);
 void SelfTest_PrintReport(const SelfTestReport* report);
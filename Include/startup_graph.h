@@ -0,0 +1,118 @@
+#ifndef RAIJIN_STARTUP_GRAPH_H
+#define RAIJIN_STARTUP_GRAPH_H
+
+#include <windows.h>
+#include "raijin_ntstatus.h"
+#include "thread_pool.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define STARTUP_GRAPH_MAX_NODES 48
+#define STARTUP_GRAPH_MAX_DEPS 8
+#define STARTUP_GRAPH_NAME_MAX 40
+#define STARTUP_GRAPH_INVALID_NODE 0xFFFFFFFFu
+
+/* Node flags */
+#define STARTUP_NODE_REQUIRED      0x1u  /* failure fails the startup and skips everything that depends on it */
+#define STARTUP_NODE_LAZY          0x2u  /* not run by Run; initialized by the first Ensure */
+#define STARTUP_NODE_CALLER_THREAD 0x4u  /* runs on the thread that called Run: thread-affine handles, CRT rand state */
+
+typedef NTSTATUS (*StartupNodeFn)(void* context);
+
+typedef enum {
+    STARTUP_NODE_PENDING = 0,            /* waiting for dependencies, or lazy and not yet used */
+    STARTUP_NODE_READY = 1,              /* dependencies done; queued on the pool or for the caller */
+    STARTUP_NODE_RUNNING = 2,
+    STARTUP_NODE_DONE = 3,
+    STARTUP_NODE_FAILED = 4,
+    STARTUP_NODE_SKIPPED = 5             /* a required dependency did not come up */
+} StartupNodeState;
+
+typedef struct StartupGraph StartupGraph;
+
+typedef struct StartupNode {
+    char name[STARTUP_GRAPH_NAME_MAX];
+    StartupNodeFn fn;
+    void* context;
+    uint32_t flags;
+    uint32_t deps[STARTUP_GRAPH_MAX_DEPS];
+    uint32_t dep_count;
+    uint32_t waiting;                    /* dependencies still to finish; Run only */
+    bool blocked;                        /* a required dependency failed or was skipped */
+    StartupNodeState state;
+    NTSTATUS status;
+    uint64_t ready_us;                   /* times are microseconds since Run started */
+    uint64_t start_us;
+    uint64_t end_us;
+    uint64_t path_us;                    /* run time of the longest dependency chain ending here */
+    uint32_t path_dep;                   /* previous node on that chain; INVALID for a root */
+    StartupGraph* graph;
+} StartupNode;
+
+typedef struct StartupGraphStats {
+    uint32_t nodes;
+    uint32_t succeeded;
+    uint32_t failed;
+    uint32_t skipped;
+    uint32_t lazy_pending;               /* lazy nodes nobody has used yet */
+    uint32_t lazy_run;
+    uint32_t workers;
+    uint64_t wall_us;                    /* Run, first start to last finish */
+    uint64_t serial_us;                  /* sum of eager node run times: the old sequential cost */
+    uint64_t critical_path_us;           /* longest dependency chain by run time: the floor on wall time */
+    uint32_t critical_path_end;
+} StartupGraphStats;
+
+/*
+ * Dependency-ordered startup. Each node is an initializer with the nodes it needs; a node can
+ * only depend on nodes added before it, so the graph is acyclic by construction. Run starts
+ * every eager node whose dependencies are done as a pool task (or on the calling thread, for
+ * CALLER_THREAD nodes) and returns once all of them have finished. A failed optional node is
+ * reported and its dependents still run, as they must cope with an uninitialised input anyway;
+ * a failed required node skips its dependents and fails the Run. Lazy nodes wait for Ensure.
+ */
+struct StartupGraph {
+    StartupNode nodes[STARTUP_GRAPH_MAX_NODES];
+    uint32_t node_count;
+    CRITICAL_SECTION lock;
+    CONDITION_VARIABLE changed;          /* a node finished or became ready for the caller */
+    ThreadPool* pool;
+    ThreadPoolGroup group;
+    uint32_t outstanding;                /* eager nodes not yet finished */
+    LARGE_INTEGER qpc_frequency;
+    uint64_t origin_us;
+    NTSTATUS first_failure;
+    bool ran;
+    StartupGraphStats stats;
+    bool initialized;
+};
+
+NTSTATUS StartupGraph_Initialize(StartupGraph* graph);
+/* Does not undo the initializers; the owner shuts its subsystems down itself. */
+void StartupGraph_Shutdown(StartupGraph* graph);
+
+/* `deps` are ids returned by earlier AddNode calls. An eager node may not depend on a lazy one. */
+NTSTATUS StartupGraph_AddNode(StartupGraph* graph, const char* name, StartupNodeFn fn, void* context,
+    uint32_t flags, const uint32_t* deps, uint32_t dep_count, uint32_t* id);
+
+/* Runs the eager nodes on `pool` (NULL = inline). Returns the first required failure, if any. */
+NTSTATUS StartupGraph_Run(StartupGraph* graph, ThreadPool* pool);
+
+/*
+ * After Run, from any thread: initializes a lazy node and its lazy dependencies on the caller
+ * the first time, and from then on returns the status it finished with. A node that failed is
+ * not retried. `ran` (optional) is set when this call is the one that ran the node; its times
+ * are final once Ensure returns.
+ */
+NTSTATUS StartupGraph_Ensure(StartupGraph* graph, uint32_t id, bool* ran);
+
+uint32_t StartupGraph_FindNode(const StartupGraph* graph, const char* name);
+void StartupGraph_GetStats(const StartupGraph* graph, StartupGraphStats* out);
+
+/* Per-node start, finish and wait times, then the critical path. */
+void StartupGraph_PrintReport(const StartupGraph* graph);
+void StartupGraph_WriteJson(const StartupGraph* graph, FILE* out);
+
+#endif
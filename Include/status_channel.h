@@ -0,0 +1,103 @@
+#ifndef RAIJIN_STATUS_CHANNEL_H
+#define RAIJIN_STATUS_CHANNEL_H
+
+#include <windows.h>
+#include "raijin_ntstatus.h"
+#include "thread_pool.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define STATUS_CHANNEL_MAGIC 0x5354534Au       /* "JSTS" */
+#define STATUS_CHANNEL_VERSION 1
+#define STATUS_CHANNEL_NAME_MAX 64
+#define STATUS_CHANNEL_PATH_MAX 260
+#define STATUS_CHANNEL_MESSAGE_MAX 128
+#define STATUS_CHANNEL_READ_RETRIES 64          /* a reader gives up after this many torn copies */
+
+typedef enum {
+    STATUS_STATE_STARTING = 0,
+    STATUS_STATE_RUNNING = 1,
+    STATUS_STATE_STOPPING = 2,
+    STATUS_STATE_STOPPED = 3
+} StatusState;
+
+typedef struct StatusSnapshot {
+    uint32_t state;                      /* StatusState */
+    uint32_t pool_workers;
+    uint64_t uptime_ms;
+    uint64_t cycles;
+    uint64_t steps;
+    uint64_t generation;
+    double loss;
+    double fitness;
+    double entropy;
+    double cycles_per_sec;
+    double steps_per_sec;
+    double throttle;
+    uint32_t degradation_mode;
+    uint32_t reserved;
+    uint64_t memory_mb;
+    uint64_t scheduler_dispatches;
+    uint64_t task_overruns;              /* summed over every main-loop task */
+    uint64_t pool_executed;
+    char message[STATUS_CHANNEL_MESSAGE_MAX];   /* last noteworthy event */
+} StatusSnapshot;
+
+/* Layout of the shared section. `sequence` is odd while the writer is copying. */
+typedef struct StatusChannelBlock {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t process_id;
+    uint32_t size;                       /* sizeof(StatusChannelBlock) */
+    volatile LONG64 sequence;
+    volatile LONG64 published;
+    StatusSnapshot snapshot;
+} StatusChannelBlock;
+
+typedef struct StatusChannelStats {
+    uint64_t published;
+    uint64_t file_writes;
+    uint64_t file_skips;                 /* publishes that found the previous file write still running */
+} StatusChannelStats;
+
+/*
+ * Status for a run nobody is watching on a console. Publish copies the snapshot into a named
+ * shared section under a sequence lock: the writer never waits for a reader, and a reader in
+ * another process (raijin --status <pid>) retries until it gets a copy no write overlapped.
+ * An optional JSON mirror is written by a pool task and renamed into place; while one write
+ * is still running later publishes skip the file instead of queueing behind it.
+ */
+typedef struct StatusChannel {
+    HANDLE mapping;
+    StatusChannelBlock* block;
+    char name[STATUS_CHANNEL_NAME_MAX];
+    char file_path[STATUS_CHANNEL_PATH_MAX];   /* empty = no file mirror */
+    StatusSnapshot file_snapshot;        /* owned by the file task while file_busy is set */
+    volatile LONG file_busy;
+    ThreadPoolGroup file_group;
+    volatile LONG64 file_writes;
+    uint64_t file_skips;
+    bool initialized;
+} StatusChannel;
+
+/* Default section name for a process; `name` needs STATUS_CHANNEL_NAME_MAX bytes. */
+void StatusChannel_FormatName(uint32_t process_id, char* name, size_t name_size);
+
+/* `name` NULL = the current process's default name; `file_path` NULL or "" = no file mirror. */
+NTSTATUS StatusChannel_Initialize(StatusChannel* channel, const char* name, const char* file_path);
+/* Waits for a file write in flight, then unmaps the section. */
+void StatusChannel_Shutdown(StatusChannel* channel);
+
+/* Never blocks. One publishing thread at a time. */
+void StatusChannel_Publish(StatusChannel* channel, const StatusSnapshot* snapshot);
+void StatusChannel_GetStats(const StatusChannel* channel, StatusChannelStats* out);
+
+/* Consistent copy of the block's snapshot; STATUS_UNSUCCESSFUL if every retry overlapped a write. */
+NTSTATUS StatusChannel_Read(const StatusChannelBlock* block, StatusSnapshot* out);
+/* Maps another process's section read-only and reads it once. */
+NTSTATUS StatusChannel_ReadByName(const char* name, StatusSnapshot* out);
+
+const char* StatusChannel_StateName(uint32_t state);
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef RAIJIN_TASK_SCHEDULER_H
+#define RAIJIN_TASK_SCHEDULER_H
+
+#include <windows.h>
+#include "raijin_ntstatus.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define TASK_SCHEDULER_MAX_TASKS 64
+#define TASK_SCHEDULER_NAME_MAX 32
+#define TASK_SCHEDULER_INVALID_TASK 0xFFFFFFFFu
+#define TASK_SCHEDULER_MS 1000ull             /* microseconds per millisecond */
+#define TASK_SCHEDULER_SECOND 1000000ull      /* microseconds per second */
+#define TASK_SCHEDULER_UNBOUNDED 0xFFFFFFFFFFFFFFFFull   /* TimeLeft with no budget or deadline */
+#define TASK_SCHEDULER_MAX_DEFERRALS 4        /* a task deferred this many dispatches in a row runs anyway */
+
+typedef enum {
+    SCHEDULED_PERIODIC = 0,              /* re-armed every period; period 0 = runs whenever nothing else is due */
+    SCHEDULED_TRIGGERED = 1              /* runs once per TaskScheduler_Trigger */
+} ScheduledTaskKind;
+
+/* Higher runs first among tasks that are due at the same time. */
+typedef enum {
+    SCHEDULED_PRIORITY_BACKGROUND = 0,
+    SCHEDULED_PRIORITY_LOW = 1,
+    SCHEDULED_PRIORITY_NORMAL = 2,
+    SCHEDULED_PRIORITY_HIGH = 3,
+    SCHEDULED_PRIORITY_CRITICAL = 4
+} ScheduledTaskPriority;
+
+typedef void (*TaskSchedulerFn)(void* context);
+/* `id` is TASK_SCHEDULER_INVALID_TASK when the dispatch as a whole missed its deadline. */
+typedef void (*TaskSchedulerOverrunFn)(void* context, uint32_t id, uint64_t elapsed_us, uint64_t budget_us);
+
+typedef struct TaskSchedulerTaskStats {
+    uint64_t runs;
+    uint64_t total_us;
+    uint64_t max_us;
+    uint64_t last_us;
+    uint64_t overruns;                   /* runs longer than the task's budget */
+    uint64_t max_late_us;                /* worst start delay past the deadline */
+    uint64_t skipped_periods;            /* periods dropped because the task fell a whole period behind */
+    uint64_t deferrals;                  /* dispatches that put the task off to stay inside their deadline */
+    uint64_t estimate_us;                /* cost the accountant currently expects */
+} TaskSchedulerTaskStats;
+
+typedef struct TaskSchedulerTask {
+    char name[TASK_SCHEDULER_NAME_MAX];
+    ScheduledTaskKind kind;
+    ScheduledTaskPriority priority;
+    TaskSchedulerFn fn;
+    void* context;
+    uint64_t period_us;
+    uint64_t budget_us;                  /* hard limit; 0 = unbounded */
+    uint64_t expected_us;                /* declared cost until the task has run; 0 = unknown */
+    uint64_t estimate_us;                /* moving average of run time, seeded from expected_us */
+    uint32_t deferred_in_row;
+    uint64_t deadline_us;                /* valid while queued */
+    uint64_t defer_until_us;             /* set by Defer while the task runs */
+    int32_t heap_index;                  /* -1 = not queued */
+    bool running;
+    bool trigger_pending;                /* Trigger arrived while the task was running */
+    TaskSchedulerTaskStats stats;
+} TaskSchedulerTask;
+
+typedef struct TaskSchedulerStats {
+    uint64_t dispatches;                 /* RunOnce calls that ran at least one task */
+    uint64_t waits;                      /* RunOnce calls that blocked for the next deadline */
+    uint64_t wait_us;
+    uint64_t wakeups;                    /* waits cut short by Trigger or Stop */
+    uint64_t deferrals;                  /* tasks put off to the next dispatch */
+    uint64_t dispatch_overruns;          /* dispatches that ran past the dispatch budget anyway */
+    uint64_t max_dispatch_us;
+} TaskSchedulerStats;
+
+/*
+ * Deadline scheduler for the main loop. Queued tasks sit in a min-heap keyed by their next
+ * deadline on the QPC clock; RunOnce takes every task that is due, runs them in priority
+ * order on the calling thread and re-arms the periodic ones. With nothing due it sleeps on a
+ * condition variable until the earliest deadline or a Trigger/Stop from another thread.
+ * Task bodies always run outside the lock and may call Trigger, Defer and SetPeriod.
+ *
+ * With a dispatch budget set, RunOnce also keeps each dispatch inside a deadline: before a
+ * task runs, its expected cost (declared, then learned from its own run times) is checked
+ * against the time the dispatch has left, and a task that would overrun it is put back in
+ * the queue, still due, for the next dispatch. The first task of a dispatch and CRITICAL
+ * tasks always run, and no task is put off more than TASK_SCHEDULER_MAX_DEFERRALS times in
+ * a row. Long work splits itself by checking TimeLeft and resuming on its next run.
+ */
+typedef struct TaskScheduler {
+    TaskSchedulerTask tasks[TASK_SCHEDULER_MAX_TASKS];
+    uint32_t task_count;
+    uint32_t heap[TASK_SCHEDULER_MAX_TASKS];   /* task ids, earliest deadline at heap[0] */
+    uint32_t heap_size;
+    CRITICAL_SECTION lock;
+    CONDITION_VARIABLE wake;
+    LARGE_INTEGER qpc_frequency;
+    volatile LONG stop;
+    uint64_t dispatch_budget_us;         /* 0 = dispatches are not deadline-bounded */
+    TaskSchedulerOverrunFn overrun_fn;
+    void* overrun_context;
+    /* RunOnce thread only: the task body being run and the deadlines TimeLeft measures against */
+    uint32_t current_task;
+    uint64_t current_start_us;
+    uint64_t dispatch_deadline_us;
+    TaskSchedulerStats stats;
+    bool initialized;
+} TaskScheduler;
+
+NTSTATUS TaskScheduler_Initialize(TaskScheduler* scheduler);
+void TaskScheduler_Shutdown(TaskScheduler* scheduler);
+
+/* Monotonic microseconds from QueryPerformanceCounter. */
+uint64_t TaskScheduler_Now(const TaskScheduler* scheduler);
+
+/* First run is `first_delay_us` from now. Returns the task id in `id`. */
+NTSTATUS TaskScheduler_AddPeriodic(TaskScheduler* scheduler, const char* name, TaskSchedulerFn fn, void* context,
+    uint64_t period_us, uint64_t first_delay_us, ScheduledTaskPriority priority, uint64_t budget_us, uint32_t* id);
+/* Not queued until triggered. */
+NTSTATUS TaskScheduler_AddTriggered(TaskScheduler* scheduler, const char* name, TaskSchedulerFn fn, void* context,
+    ScheduledTaskPriority priority, uint64_t budget_us, uint32_t* id);
+
+/* Thread-safe. Queues the task `delay_us` from now, or pulls an already queued deadline earlier. */
+NTSTATUS TaskScheduler_Trigger(TaskScheduler* scheduler, uint32_t id, uint64_t delay_us);
+/* Pushes the task's next run to at least `delay_us` from now (e.g. a throttled task backing off). */
+NTSTATUS TaskScheduler_Defer(TaskScheduler* scheduler, uint32_t id, uint64_t delay_us);
+/* Takes effect from the next re-arm. */
+NTSTATUS TaskScheduler_SetPeriod(TaskScheduler* scheduler, uint32_t id, uint64_t period_us);
+/* The task's typical run time, used by the dispatch deadline until it has run itself. */
+NTSTATUS TaskScheduler_SetExpectedCost(TaskScheduler* scheduler, uint32_t id, uint64_t expected_us);
+/* Deadline for the tasks one RunOnce runs together; 0 = none. Call before the loop starts. */
+void TaskScheduler_SetDispatchBudget(TaskScheduler* scheduler, uint64_t budget_us);
+/* Called on the RunOnce thread, outside the lock, after a task or a dispatch overran. */
+void TaskScheduler_SetOverrunHandler(TaskScheduler* scheduler, TaskSchedulerOverrunFn fn, void* context);
+
+/*
+ * From inside a task body: microseconds until the running task reaches its budget or the
+ * dispatch its deadline, whichever is first; 0 once past. TASK_SCHEDULER_UNBOUNDED outside a
+ * task or with neither limit set.
+ */
+uint64_t TaskScheduler_TimeLeft(const TaskScheduler* scheduler);
+
+/*
+ * Runs every task that is due. If none is, waits up to `max_wait_us` for the next deadline or
+ * a wake-up and returns without running anything. Returns STATUS_CANCELLED once stopped.
+ */
+NTSTATUS TaskScheduler_RunOnce(TaskScheduler* scheduler, uint64_t max_wait_us);
+/* Thread-safe; wakes a waiting RunOnce. */
+void TaskScheduler_Stop(TaskScheduler* scheduler);
+
+/* TASK_SCHEDULER_INVALID_TASK if no task has that name. */
+uint32_t TaskScheduler_FindTask(TaskScheduler* scheduler, const char* name);
+NTSTATUS TaskScheduler_GetTaskStats(TaskScheduler* scheduler, uint32_t id, TaskSchedulerTaskStats* out);
+void TaskScheduler_GetStats(TaskScheduler* scheduler, TaskSchedulerStats* out);
+
+#endif
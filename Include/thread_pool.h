@@ -0,0 +1,144 @@
+#ifndef RAIJIN_THREAD_POOL_H
+#define RAIJIN_THREAD_POOL_H
+
+#include <windows.h>
+#include "raijin_ntstatus.h"
+#include "role_boundary.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define THREAD_POOL_MAX_WORKERS 64            /* bounded by MAXIMUM_WAIT_OBJECTS */
+#define THREAD_POOL_QUEUE_CAPACITY 256        /* tasks per priority per queue; power of two */
+#define THREAD_POOL_IDLE_WAIT_MS 50           /* safety timeout on an idle worker's sleep */
+#define THREAD_POOL_JOIN_WAIT_MS 1            /* a joining thread re-checks for work this often */
+#define THREAD_POOL_AUTO_GRAIN 0              /* ParallelFor: about four chunks per worker */
+
+/* Higher runs first. A thread joining a group runs anything in its own queue but takes only
+ * NORMAL and HIGH work from elsewhere, so a join never ends up inside someone's long LOW job. */
+typedef enum {
+    THREAD_POOL_PRIORITY_LOW = 0,
+    THREAD_POOL_PRIORITY_NORMAL = 1,
+    THREAD_POOL_PRIORITY_HIGH = 2,
+    THREAD_POOL_PRIORITY_COUNT = 3
+} ThreadPoolPriority;
+
+typedef void (*ThreadPoolTaskFn)(void* context);
+/* Processes [begin, end) of a ParallelFor range. */
+typedef void (*ThreadPoolRangeFn)(uint64_t begin, uint64_t end, void* context);
+
+/* Zero-initialise before the first submit; joined with ThreadPool_Wait. */
+typedef struct ThreadPoolGroup {
+    volatile LONG pending;
+} ThreadPoolGroup;
+
+typedef struct ThreadPoolTask {
+    ThreadPoolTaskFn fn;                 /* single task, or NULL for a range */
+    ThreadPoolRangeFn range_fn;          /* split in halves while wider than grain */
+    void* context;
+    uint64_t begin;
+    uint64_t end;
+    uint64_t grain;
+    ThreadPoolGroup* group;              /* may be NULL */
+    ThreadPoolPriority priority;
+} ThreadPoolTask;
+
+/* One ring per priority under one lock. The owner pushes and pops at the tail (newest first,
+ * still warm in its cache); thieves and the injection queue's consumers take from the head. */
+typedef struct ThreadPoolQueue {
+    ThreadPoolTask* slots[THREAD_POOL_PRIORITY_COUNT];
+    uint32_t head[THREAD_POOL_PRIORITY_COUNT];
+    uint32_t tail[THREAD_POOL_PRIORITY_COUNT];
+    volatile LONG count;                 /* tasks across all priorities; read without the lock */
+    CRITICAL_SECTION lock;
+} ThreadPoolQueue;
+
+typedef struct ThreadPoolWorkerStats {
+    uint64_t executed;
+    uint64_t stolen;                     /* tasks taken from another worker's queue */
+    uint64_t splits;                     /* ParallelFor halves pushed for others to steal */
+    uint64_t sleeps;
+} ThreadPoolWorkerStats;
+
+typedef struct ThreadPool ThreadPool;
+
+typedef struct ThreadPoolWorker {
+    ThreadPool* pool;
+    ThreadPoolQueue queue;
+    HANDLE thread;
+    uint32_t index;
+    uint64_t victim_seed;
+    RoleBoundaryContext role_ctx;
+    ThreadPoolWorkerStats stats;         /* written only by the worker */
+} ThreadPoolWorker;
+
+typedef struct ThreadPoolStats {
+    uint32_t workers;
+    uint64_t executed;                   /* by workers and by joining threads */
+    uint64_t stolen;
+    uint64_t splits;
+    uint64_t sleeps;
+    uint64_t inline_runs;                /* ran on the submitter: queue full or no pool */
+    uint32_t queued;
+} ThreadPoolStats;
+
+/*
+ * Process-wide work-stealing pool, one worker per core. A worker takes work from its own
+ * queue first, then the injection queue fed by non-worker threads, then steals from the
+ * other workers, always highest priority first; with nothing anywhere it sleeps on a
+ * condition variable until a submit wakes it. Tasks are stored by value, so submitting
+ * never allocates. A task run by a worker has the worker's "raijin.pool" role bound; one run
+ * on any other thread (full queue, no pool, or picked up while that thread joins in Wait or
+ * ParallelFor) has whatever that thread had bound. Either way the thread's binding is
+ * restored after the task, so tasks may bind their own context.
+ */
+struct ThreadPool {
+    ThreadPoolWorker* workers;
+    uint32_t worker_count;
+    ThreadPoolQueue inject;
+    CRITICAL_SECTION sleep_lock;
+    CONDITION_VARIABLE wake;             /* idle workers */
+    CONDITION_VARIABLE joined;           /* threads in ThreadPool_Wait */
+    volatile LONG queued;                /* tasks in every queue */
+    volatile LONG sleepers;
+    volatile LONG stop;
+    volatile LONG64 external_executed;   /* tasks run by joining non-worker threads */
+    volatile LONG64 inline_runs;
+    bool initialized;
+};
+
+/* `workers` 0 = one per logical processor. */
+NTSTATUS ThreadPool_Initialize(ThreadPool* pool, uint32_t workers);
+/* Runs whatever is still queued, then joins the workers. */
+void ThreadPool_Shutdown(ThreadPool* pool);
+
+/*
+ * The shared pool. Started on first use with one worker per processor unless
+ * InitializeGlobal chose a size first; NULL after ShutdownGlobal or if it could not start.
+ * Every call below accepts a NULL pool and then runs the work inline on the caller.
+ */
+NTSTATUS ThreadPool_InitializeGlobal(uint32_t workers);
+ThreadPool* ThreadPool_GetGlobal(void);
+void ThreadPool_ShutdownGlobal(void);
+
+/* Queues fn(context); `group` may be NULL. A full queue runs the task on the caller. */
+NTSTATUS ThreadPool_Submit(ThreadPool* pool, ThreadPoolTaskFn fn, void* context,
+    ThreadPoolPriority priority, ThreadPoolGroup* group);
+/* Returns once every task submitted to `group` has finished, running pool work meanwhile. */
+void ThreadPool_Wait(ThreadPool* pool, ThreadPoolGroup* group);
+
+/*
+ * Calls fn over disjoint sub-ranges covering [begin, end) and returns when all are done.
+ * Ranges wider than `grain` are halved and the halves offered for stealing, so idle
+ * workers pick up the big pieces first. THREAD_POOL_AUTO_GRAIN picks about four chunks
+ * per worker; pass a larger grain when an element is cheap.
+ */
+NTSTATUS ThreadPool_ParallelFor(ThreadPool* pool, uint64_t begin, uint64_t end, uint64_t grain,
+    ThreadPoolRangeFn fn, void* context, ThreadPoolPriority priority);
+
+/* 1 when there is no pool. */
+uint32_t ThreadPool_GetWorkerCount(const ThreadPool* pool);
+/* Counters are read without synchronisation and may lag by a few tasks. */
+void ThreadPool_GetStats(const ThreadPool* pool, ThreadPoolStats* out);
+
+#endif
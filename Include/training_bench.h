@@ -0,0 +1,59 @@
+#ifndef RAIJIN_TRAINING_BENCH_H
+#define RAIJIN_TRAINING_BENCH_H
+
+#include <windows.h>
+#include "raijin_ntstatus.h"
+#include "neural_substrate.h"
+#include "training_pipeline.h"
+#include "training_corpus.h"
+#include "role_boundary.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRAINING_BENCH_MAX_THREADS 64            /* bounded by MAXIMUM_WAIT_OBJECTS, as in PBT */
+#define TRAINING_BENCH_DEFAULT_WARMUP 20
+#define TRAINING_BENCH_DEFAULT_STEPS 200
+#define TRAINING_BENCH_DEFAULT_BATCH 1
+
+typedef struct TrainingBenchConfig {
+    uint32_t warmup_steps;               /* run but not recorded */
+    uint32_t measured_steps;
+    uint32_t batch_size;                 /* samples (TrainSteps) per benchmark step, split across threads */
+    uint32_t threads;                    /* each trains its own substrate replica */
+    uint32_t prefetch_depth;             /* 0 = batches generated inline */
+    double replay_fraction;              /* share of TrainSteps drawn from prioritized replay; 0 = off */
+    const char* corpus_path;             /* NULL = synthetic batches */
+} TrainingBenchConfig;
+
+typedef struct TrainingBenchReport {
+    TrainingBenchConfig config;
+    uint64_t samples;                    /* measured samples across all threads */
+    double elapsed_ms;                   /* measured phase wall time */
+    double samples_per_sec;
+    double step_mean_us;
+    double step_p50_us;
+    double step_p90_us;
+    double step_p99_us;
+    double step_max_us;
+    double final_loss;                   /* thread 0's last step */
+    int64_t alloc_bytes_per_step;        /* CRT heap bytes allocated per step; -1 = not tracked (release CRT) */
+    int64_t commit_growth_per_step;      /* private commit growth over the measured phase, per step */
+    uint64_t peak_rss_bytes;             /* peak working set of the process */
+    uint64_t data_wait_us;               /* measured-phase time blocked on prefetch, all threads */
+} TrainingBenchReport;
+
+void TrainingBench_GetDefaultConfig(TrainingBenchConfig* config);
+
+/*
+ * Times warmup + measured steps of the training pipeline against replicas of `source` (the
+ * source itself is not trained). A step is batch_size TrainSteps shared out over the threads;
+ * its latency is from handing out the shares to the last thread finishing. No evolution
+ * engine is attached, so the numbers are the pipeline and substrate alone.
+ */
+NTSTATUS TrainingBench_Run(const TrainingBenchConfig* config, NeuralSubstrate* source, TrainingBenchReport* report);
+
+/* One JSON object, keys stable for scripts that diff runs. */
+void TrainingBench_WriteJson(const TrainingBenchReport* report, FILE* out);
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef RAIJIN_TRAINING_CORPUS_H
+#define RAIJIN_TRAINING_CORPUS_H
+
+#include "raijin_ntstatus.h"
+#include <windows.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define TRAINING_CORPUS_MAGIC 0x50524352u       /* "RCRP" */
+#define TRAINING_CORPUS_VERSION 1
+#define TRAINING_CORPUS_PATH_MAX 260
+#define TRAINING_CORPUS_DEFAULT_BLOCK_BYTES (1u << 20)
+#define TRAINING_CORPUS_DEFAULT_SHUFFLE_BLOCKS 16
+#define TRAINING_CORPUS_MAX_SHUFFLE_BLOCKS 1024
+
+/*
+ * Shard layout: a TrainingCorpusHeader, then `data_bytes` of concatenated file contents, each
+ * file followed by one '\n'. The header's magic is written last, so an interrupted build
+ * never opens as a valid shard.
+ */
+typedef struct TrainingCorpusHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t file_count;
+    uint64_t data_offset;
+    uint64_t data_bytes;
+} TrainingCorpusHeader;
+
+typedef struct TrainingCorpusBuildStats {
+    uint64_t files_packed;
+    uint64_t files_skipped;              /* binary (NUL in the first 4 KB), unreadable, or filtered */
+    uint64_t bytes_packed;
+} TrainingCorpusBuildStats;
+
+/* Packs every text file under `directory` into one shard. `extensions` is a comma-separated
+ * list such as ".c,.h,.py" (NULL or "" = all files). */
+NTSTATUS TrainingCorpus_BuildShard(const char* directory, const char* shard_path,
+    const char* extensions, TrainingCorpusBuildStats* stats);
+
+typedef struct TrainingCorpusConfig {
+    uint32_t block_bytes;                /* shuffle and read-ahead granularity */
+    uint32_t shuffle_blocks;             /* blocks resident in the shuffle buffer; 1 = block order only */
+    uint64_t seed;
+} TrainingCorpusConfig;
+
+typedef struct TrainingCorpusStats {
+    uint64_t samples;
+    uint64_t bytes;                      /* input + target bytes handed out */
+    uint64_t blocks_loaded;
+    uint64_t epochs;                     /* completed passes over the shard */
+    uint64_t elapsed_us;                 /* since the first sample */
+    double samples_per_sec;
+} TrainingCorpusStats;
+
+/*
+ * Streams fixed-size samples from a mapped shard: sample k is the window at k * input_size,
+ * its target the same window shifted one byte (next-byte prediction). Each epoch visits
+ * the blocks in a fresh random order; samples are drawn at random from a bounded buffer of
+ * `shuffle_blocks` blocks, refilled one block at a time with a read-ahead hint.
+ * One reader thread at a time (the prefetch producer or the training thread).
+ */
+typedef struct TrainingCorpus {
+    char path[TRAINING_CORPUS_PATH_MAX];
+    HANDLE file;
+    HANDLE mapping;
+    const uint8_t* view;
+    const uint8_t* data;
+    uint64_t data_bytes;
+    uint64_t file_count;
+    size_t input_size;
+    size_t target_size;
+    uint64_t sample_count;
+    uint32_t samples_per_block;
+    uint32_t block_count;
+    uint32_t* block_order;               /* [block_count] permutation for the current epoch */
+    uint32_t next_block;                 /* index into block_order */
+    uint64_t* buffer;                    /* shuffle buffer of sample indices */
+    uint32_t buffer_count;
+    uint32_t buffer_capacity;
+    uint32_t low_water;                  /* refill below this so every draw picks from >= 1 block of choice */
+    uint64_t rng;
+    TrainingCorpusConfig config;
+    TrainingCorpusStats stats;
+    LARGE_INTEGER start_qpc;
+    bool initialized;
+} TrainingCorpus;
+
+void TrainingCorpus_GetDefaultConfig(TrainingCorpusConfig* config);
+NTSTATUS TrainingCorpus_Open(TrainingCorpus* corpus, const char* shard_path, size_t input_size,
+    size_t target_size, const TrainingCorpusConfig* config);
+void TrainingCorpus_Close(TrainingCorpus* corpus);
+
+NTSTATUS TrainingCorpus_NextSample(TrainingCorpus* corpus, uint8_t* input, uint8_t* target);
+
+/* TrainingBatchSource form; context is the corpus, sequence is ignored. */
+NTSTATUS TrainingCorpus_BatchSource(void* context, uint64_t sequence, uint8_t* input, size_t input_size,
+    uint8_t* target, size_t target_size);
+
+void TrainingCorpus_GetStats(const TrainingCorpus* corpus, TrainingCorpusStats* out);
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef RAIJIN_TRAINING_DATAPARALLEL_H
+#define RAIJIN_TRAINING_DATAPARALLEL_H
+
+#include <windows.h>
+#include "raijin_ntstatus.h"
+#include "neural_substrate.h"
+#include "role_boundary.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define TRAINING_DP_MAX_WORKERS 64           /* bounded by MAXIMUM_WAIT_OBJECTS */
+#define TRAINING_DP_DEFAULT_BATCH 32
+#define TRAINING_DP_DEFAULT_STEPS 20
+#define TRAINING_DP_MAPPING_NAME_MAX 64
+#define TRAINING_DP_BARRIER_TIMEOUT_MS 100   /* waits re-check the abort flag this often */
+#define TRAINING_DP_VERIFY_TOLERANCE 1e-4    /* max |w| difference accepted between worker counts */
+
+typedef struct TrainingDataParallelConfig {
+    uint32_t workers;                    /* replicas, each on its own thread or process */
+    uint32_t steps;
+    uint32_t batch;                      /* samples per step across all workers; split round-robin */
+    float learning_rate;                 /* 0 = PLASTICITY_RATE */
+    uint64_t seed;                       /* sample k of the run is synthetic batch seed + k */
+    bool use_processes;                  /* workers as raijin.exe --dp-worker over shared memory */
+} TrainingDataParallelConfig;
+
+typedef struct TrainingDataParallelStats {
+    uint64_t samples;
+    double elapsed_ms;
+    double samples_per_sec;
+    double final_loss;                   /* mean loss over the last step's batch */
+    uint64_t compute_us;                 /* rank 0: forward + gradient */
+    uint64_t allreduce_us;               /* rank 0: ring allreduce including barrier waits */
+    uint64_t parameters;                 /* floats reduced per step */
+} TrainingDataParallelStats;
+
+/*
+ * Synchronous data-parallel training of one substrate. Each worker holds a replica, computes
+ * the summed gradient of its share of every batch and the workers average them through a
+ * ring allreduce over one shared segment: K-1 reduce-scatter rounds, then K-1 all-gather
+ * rounds, each ending at a barrier. Every chunk is always summed along the same ring path, so
+ * a run is bit-for-bit repeatable for a given worker count, and every replica applies the
+ * identical averaged step, so the replicas never diverge.
+ *
+ * Each sample starts from the substrate's recurrent state at the start of the run and
+ * reseeds the chaos stream from its sample index, so its gradient does not depend on which
+ * worker computes it. Runs with different worker counts differ only in float summation order.
+ */
+void TrainingDataParallel_GetDefaultConfig(TrainingDataParallelConfig* config);
+
+/* Trains `substrate` in place; on success it holds the replicas' final weights. */
+NTSTATUS TrainingDataParallel_Run(const TrainingDataParallelConfig* config, NeuralSubstrate* substrate,
+    TrainingDataParallelStats* stats);
+
+/* Largest absolute weight difference between two substrates of the same topology. */
+NTSTATUS TrainingDataParallel_CompareWeights(const NeuralSubstrate* a, const NeuralSubstrate* b, double* max_diff);
+
+/* Entry point for raijin.exe --dp-worker <mapping> <rank>; returns process exit code. */
+int TrainingDataParallel_WorkerMain(const char* mapping_name, uint32_t rank);
+
+#endif
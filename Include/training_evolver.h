@@ -0,0 +1,68 @@
+#ifndef RAIJIN_TRAINING_EVOLVER_H
+#define RAIJIN_TRAINING_EVOLVER_H
+
+#include "raijin_ntstatus.h"
+#include "neural_substrate.h"
+#include "evolution_engine.h"
+#include "role_boundary.h"
+#include <windows.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRAINING_EVOLVER_SUBSTRATE_EVOLVE_INTERVAL 50   /* generations between live-substrate Evolve calls */
+
+typedef struct TrainingEvolverStats {
+    uint64_t generations;
+    uint64_t exchanges;
+    uint64_t snapshot_refreshes;         /* live weights copied into the snapshot */
+    uint64_t snapshot_rebuilds;          /* topology changed; snapshot re-created */
+    uint64_t substrate_evolves;          /* NeuralSubstrate_Evolve applied to the live substrate */
+    uint64_t generation_us;              /* worker time inside generations */
+    uint64_t exchange_wait_us;           /* trainer time blocked waiting for a generation */
+    uint64_t snapshot_us;                /* trainer time refreshing the snapshot */
+} TrainingEvolverStats;
+
+/*
+ * Runs evolution generations on a worker thread while the trainer keeps stepping the live
+ * substrate. The engine evaluates fitness against `snapshot`, a replica of the live weights,
+ * so the two threads never share mutable state. From Post until Exchange the worker owns the
+ * engine and the snapshot, even after Poll reports the generation in; everywhere else the
+ * trainer thread does. Exchange is the only sync point: it waits for the posted generation,
+ * refreshes the snapshot from the live weights and applies the periodic substrate Evolve that
+ * used to run inline in EvolutionStep. A trainer that polls first and keeps stepping until the
+ * generation is in never waits at all.
+ */
+typedef struct TrainingEvolver {
+    EvolutionEngine* engine;
+    NeuralSubstrate* live;
+    NeuralSubstrate* engine_substrate;   /* engine->neural_system before Start; restored by Stop */
+    NeuralSubstrate snapshot;
+    HANDLE thread;
+    HANDLE go;                           /* auto-reset: one posted generation */
+    HANDLE done;                         /* auto-reset: the posted generation finished */
+    volatile LONG stop;
+    bool posted;                         /* trainer only */
+    bool finished;                       /* trainer only: Poll consumed `done` for the posted generation */
+    NTSTATUS generation_status;          /* written by the worker before `done` */
+    uint32_t evolved_generation;         /* generation of the last live-substrate Evolve */
+    RoleBoundaryContext role_ctx;
+    TrainingEvolverStats stats;
+    bool initialized;
+} TrainingEvolver;
+
+NTSTATUS TrainingEvolver_Start(TrainingEvolver* evolver, EvolutionEngine* engine, NeuralSubstrate* live);
+/* Finishes any posted generation, joins the worker and points the engine back at the live substrate. */
+void TrainingEvolver_Stop(TrainingEvolver* evolver);
+
+/* Hands one generation to the worker and returns at once. STATUS_PENDING if one is already out. */
+NTSTATUS TrainingEvolver_Post(TrainingEvolver* evolver);
+/* Never blocks: STATUS_PENDING while the posted generation is still running, STATUS_SUCCESS
+ * once it has finished (Exchange then returns without waiting) or when nothing is posted. */
+NTSTATUS TrainingEvolver_Poll(TrainingEvolver* evolver);
+/* Waits for the posted generation (if any), then syncs the snapshot and live substrate.
+ * Returns the generation's status, or STATUS_SUCCESS when nothing was posted. */
+NTSTATUS TrainingEvolver_Exchange(TrainingEvolver* evolver);
+
+void TrainingEvolver_GetStats(const TrainingEvolver* evolver, TrainingEvolverStats* out);
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef RAIJIN_TRAINING_PBT_H
+#define RAIJIN_TRAINING_PBT_H
+
+#include <windows.h>
+#include "raijin_ntstatus.h"
+#include "neural_substrate.h"
+#include "training_pipeline.h"
+#include "evolution_operators.h"
+#include "role_boundary.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define TRAINING_PBT_MAX_REPLICAS 64         /* bounded by MAXIMUM_WAIT_OBJECTS */
+#define TRAINING_PBT_DEFAULT_REPLICAS 4
+#define TRAINING_PBT_DEFAULT_INTERVAL 20     /* train steps between exploit/explore rounds */
+#define TRAINING_PBT_DEFAULT_QUANTILE 0.25   /* bottom fraction that copies from the top fraction */
+#define TRAINING_PBT_PERTURB 1.25            /* explore multiplies or divides each hyperparameter by this */
+
+typedef struct TrainingPbtHyperparams {
+    float learning_rate;                 /* NeuralSubstrate_LearnWithRate step */
+    float mutation_rate;                 /* chance per weight of a random nudge after each interval */
+    float sparsity;                      /* weights below this magnitude are zeroed after each interval */
+} TrainingPbtHyperparams;
+
+typedef struct TrainingPbtConfig {
+    uint32_t replicas;
+    uint32_t interval_steps;
+    double quantile;
+    uint64_t seed;
+    TrainingPbtHyperparams min;          /* search bounds; replicas start log-uniform between them */
+    TrainingPbtHyperparams max;
+} TrainingPbtConfig;
+
+typedef struct TrainingPbtReplica {
+    NeuralSubstrate substrate;           /* private copy of the source substrate */
+    TrainingPipeline pipeline;           /* synthetic batches and loss for this replica */
+    TrainingPbtHyperparams hyper;
+    EvolutionRng rng;                    /* explore draws and weight nudges */
+    double score;                        /* mean loss over the last interval; lower is better */
+    double loss_sum;
+    uint32_t loss_count;
+    uint64_t steps;
+    uint64_t run_steps;                  /* steps taken in the current Run */
+    uint32_t exploits;                   /* times this replica took another replica's weights */
+    int32_t last_parent;                 /* replica copied at the last exploit; -1 = none */
+    bool scored;                         /* has finished at least one interval */
+    RoleBoundaryContext role_ctx;
+    uint32_t index;
+    struct TrainingPbt* pbt;
+} TrainingPbtReplica;
+
+/* Population-based training: every replica trains as its own pool job with its own
+ * hyperparameters. After each interval a replica in the bottom quantile copies the weights
+ * of a random top-quantile replica (exploit) and perturbs the copied hyperparameters
+ * (explore); the others keep training undisturbed. */
+typedef struct TrainingPbt {
+    TrainingPbtConfig config;
+    TrainingPbtReplica* replicas;
+    CRITICAL_SECTION lock;               /* scores and exploit decisions */
+    uint64_t run_target;                 /* steps per replica for the current Run */
+    volatile LONG stop;
+    uint64_t exploit_count;
+    uint64_t copy_us;                    /* total time spent copying weights */
+    uint32_t role_violations;            /* folded from replica contexts */
+    bool initialized;
+} TrainingPbt;
+
+void TrainingPbt_GetDefaultConfig(TrainingPbtConfig* config);
+
+/* Creates config->replicas replicas of `source`; the source itself is not modified.
+ * Replicas must train side by side for exploit to compare like with like, so the count is
+ * clamped to the global pool's worker count, but not below ceil(1 / quantile) (4 at the
+ * default quantile) so the bottom quantile is never empty; on a pool smaller than that the
+ * extra replicas take turns. pbt->config.replicas holds the count actually created. */
+NTSTATUS TrainingPbt_Initialize(TrainingPbt* pbt, const TrainingPbtConfig* config, NeuralSubstrate* source);
+void TrainingPbt_Shutdown(TrainingPbt* pbt);
+
+/* Trains every replica `steps` more steps; blocks until all finish or Stop is called. */
+NTSTATUS TrainingPbt_Run(TrainingPbt* pbt, uint64_t steps);
+NTSTATUS TrainingPbt_Stop(TrainingPbt* pbt);
+
+/* Replica with the lowest last-interval loss. Any output pointer may be NULL. */
+NTSTATUS TrainingPbt_GetBest(TrainingPbt* pbt, uint32_t* index, TrainingPbtHyperparams* hyper, double* score);
+
+/* Copies the best replica's weights into dst, which must share the source's topology. */
+NTSTATUS TrainingPbt_ExportBest(TrainingPbt* pbt, NeuralSubstrate* dst);
+
+#endif
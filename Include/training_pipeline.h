@@ -5,6 +5,9 @@
 #include "neural_substrate.h"
 #include "evolution_engine.h"
 #include "curriculum.h"
+#include "training_prefetch.h"
+#include "training_evolver.h"
+#include "training_replay.h"
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
@@ -20,6 +23,8 @@ typedef struct TrainingMetrics {
     uint64_t step_count;
     uint64_t generation;
     uint64_t batch_time_ms;
+    uint64_t data_wait_us;          /* time this step blocked on the prefetch producer */
+    double replay_weight;           /* IS weight of a replayed step; 0 = fresh sample */
 } TrainingMetrics;
 
 typedef struct TrainingPipeline {
@@ -32,8 +37,16 @@ typedef struct TrainingPipeline {
     uint64_t total_steps;
     bool run_evolution_this_step;
     uint32_t evolution_interval;
+    float learning_rate;            /* 0 = substrate default (PLASTICITY_RATE) */
     CurriculumTask curriculum_task;
     bool curriculum_task_valid;
+    TrainingBatchSource data_source; /* NULL = synthetic pattern/code-like batches */
+    void* data_context;
+    TrainingPrefetcher* prefetch;   /* NULL = batches generated inline on the training thread */
+    uint64_t prefetch_base_step;    /* total_steps when prefetch started; seeds the producer */
+    TrainingEvolver* evolver;       /* NULL = EvolutionStep runs inline on the training thread */
+    TrainingReplay* replay;         /* NULL = every step trains on a fresh sample */
+    double replay_credit;           /* accumulates config.fraction; a replayed step spends 1 */
 } TrainingPipeline;
 
 NTSTATUS TrainingPipeline_Initialize(TrainingPipeline* pipeline,
@@ -48,6 +61,35 @@ void TrainingPipeline_ClearCurriculumTask(TrainingPipeline* pipeline);
 NTSTATUS TrainingPipeline_TrainStep(TrainingPipeline* pipeline);
 NTSTATUS TrainingPipeline_EvolutionStep(TrainingPipeline* pipeline);
 
+/* Moves synthetic batch generation onto a producer thread `depth` batches ahead of TrainStep
+ * (0 = TRAINING_PREFETCH_DEFAULT_DEPTH). Curriculum-seeded steps still generate inline. */
+NTSTATUS TrainingPipeline_EnablePrefetch(TrainingPipeline* pipeline, uint32_t depth);
+void TrainingPipeline_DisablePrefetch(TrainingPipeline* pipeline);
+/* Replaces the synthetic generator (e.g. TrainingCorpus_BatchSource); NULL restores it.
+ * Set before EnablePrefetch: the source then runs on the producer thread. */
+NTSTATUS TrainingPipeline_SetDataSource(TrainingPipeline* pipeline, TrainingBatchSource source, void* context);
+
+/* Moves evolution generations onto a worker that evaluates against a snapshot of the substrate.
+ * Begin/EndEvolutionStep bracket any number of TrainSteps so the two run concurrently; the
+ * engine is the worker's from Begin until End, the exchange point (EvolutionStep calls End on
+ * an outstanding generation before evolving). Begin fails when async evolution is off, and
+ * callers then use EvolutionStep.
+ * PollEvolutionStep returns STATUS_PENDING until the generation from Begin is in, so a caller
+ * can keep training and only call End once it would not block. */
+NTSTATUS TrainingPipeline_EnableAsyncEvolution(TrainingPipeline* pipeline);
+void TrainingPipeline_DisableAsyncEvolution(TrainingPipeline* pipeline);
+NTSTATUS TrainingPipeline_BeginEvolutionStep(TrainingPipeline* pipeline);
+NTSTATUS TrainingPipeline_PollEvolutionStep(TrainingPipeline* pipeline);
+NTSTATUS TrainingPipeline_EndEvolutionStep(TrainingPipeline* pipeline);
+NTSTATUS TrainingPipeline_GetPrefetchStats(const TrainingPipeline* pipeline, TrainingPrefetchStats* out);
+
+/* Keeps trained samples in a prioritized replay buffer and draws config->fraction of steps
+ * from it (NULL = defaults). Fresh samples enter with their loss as priority; replayed ones
+ * are re-scored and their learning rate scaled by the importance-sampling weight. */
+NTSTATUS TrainingPipeline_EnableReplay(TrainingPipeline* pipeline, const TrainingReplayConfig* config);
+void TrainingPipeline_DisableReplay(TrainingPipeline* pipeline);
+NTSTATUS TrainingPipeline_GetReplayStats(const TrainingPipeline* pipeline, TrainingReplayStats* out);
+
 void TrainingPipeline_GetMetrics(const TrainingPipeline* pipeline,
     TrainingMetrics* out);
 
@@ -0,0 +1,67 @@
+#ifndef RAIJIN_TRAINING_PREFETCH_H
+#define RAIJIN_TRAINING_PREFETCH_H
+
+#include "raijin_ntstatus.h"
+#include <windows.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define TRAINING_PREFETCH_DEFAULT_DEPTH 4
+#define TRAINING_PREFETCH_MAX_DEPTH 64
+
+/* Fills one batch; runs on the producer thread. `sequence` counts batches from Start. */
+typedef NTSTATUS (*TrainingBatchSource)(void* context, uint64_t sequence, uint8_t* input, size_t input_size,
+    uint8_t* target, size_t target_size);
+
+typedef struct TrainingPrefetchSlot {
+    uint8_t* input;
+    uint8_t* target;
+    uint64_t sequence;
+    NTSTATUS status;                     /* what the source returned for this batch */
+} TrainingPrefetchSlot;
+
+typedef struct TrainingPrefetchStats {
+    uint64_t produced;
+    uint64_t consumed;
+    uint64_t stalls;                     /* Acquire calls that found no batch ready */
+    uint64_t wait_us;                    /* consumer time blocked on the producer */
+    uint64_t max_wait_us;
+    uint64_t last_wait_us;               /* wait of the most recent Acquire */
+    uint64_t produce_us;                 /* producer time spent inside the source */
+} TrainingPrefetchStats;
+
+/* Single-producer single-consumer ring of pre-allocated batches. The producer owns `tail`,
+ * the consumer owns `head`; the two semaphores carry the slot hand-off in both directions. */
+typedef struct TrainingPrefetcher {
+    TrainingPrefetchSlot slots[TRAINING_PREFETCH_MAX_DEPTH];
+    uint8_t* slab;                       /* every slot's input and target */
+    size_t input_size;
+    size_t target_size;
+    uint32_t depth;
+    uint32_t head;
+    uint32_t tail;
+    uint64_t next_sequence;              /* producer only */
+    HANDLE free_slots;                   /* semaphore: slots the producer may fill */
+    HANDLE ready_slots;                  /* semaphore: filled slots the consumer may take */
+    HANDLE thread;
+    TrainingBatchSource source;
+    void* source_context;
+    volatile LONG stop;
+    bool holding;                        /* consumer holds slots[head] between Acquire and Release */
+    TrainingPrefetchStats stats;         /* produced/produce_us written by the producer only */
+    bool initialized;
+} TrainingPrefetcher;
+
+NTSTATUS TrainingPrefetch_Start(TrainingPrefetcher* prefetcher, uint32_t depth, size_t input_size,
+    size_t target_size, TrainingBatchSource source, void* context);
+/* Wakes and joins the producer; batches still in the ring are dropped. */
+void TrainingPrefetch_Stop(TrainingPrefetcher* prefetcher);
+
+/* Blocks until the next batch is ready. The slot stays valid until Release. */
+NTSTATUS TrainingPrefetch_Acquire(TrainingPrefetcher* prefetcher, const TrainingPrefetchSlot** slot);
+void TrainingPrefetch_Release(TrainingPrefetcher* prefetcher);
+
+void TrainingPrefetch_GetStats(const TrainingPrefetcher* prefetcher, TrainingPrefetchStats* out);
+
+#endif
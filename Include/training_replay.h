@@ -0,0 +1,93 @@
+#ifndef RAIJIN_TRAINING_REPLAY_H
+#define RAIJIN_TRAINING_REPLAY_H
+
+#include "raijin_ntstatus.h"
+#include "evolution_operators.h"
+#include <windows.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define TRAINING_REPLAY_DEFAULT_CAPACITY 1024
+#define TRAINING_REPLAY_DEFAULT_STAGING 64
+#define TRAINING_REPLAY_MAX_CAPACITY (1u << 20)
+#define TRAINING_REPLAY_DEFAULT_FRACTION 0.25   /* share of TrainSteps drawn from the buffer */
+#define TRAINING_REPLAY_DEFAULT_ALPHA 0.6       /* 0 = uniform sampling, 1 = fully proportional to loss */
+#define TRAINING_REPLAY_DEFAULT_BETA 0.4        /* IS correction at start; annealed to 1 */
+#define TRAINING_REPLAY_DEFAULT_BETA_STEPS 100000
+#define TRAINING_REPLAY_DEFAULT_EPSILON 1e-4    /* keeps zero-loss samples drawable */
+
+typedef struct TrainingReplayConfig {
+    uint32_t capacity;                   /* resident samples; oldest overwritten first */
+    uint32_t staging;                    /* pushes in flight between producer and consumer */
+    uint32_t min_fill;                   /* no draws until this many samples are resident (0 = staging) */
+    double fraction;
+    double alpha;
+    double beta;
+    uint64_t beta_steps;                 /* draws over which beta rises linearly to 1 */
+    double epsilon;
+    uint64_t seed;
+} TrainingReplayConfig;
+
+typedef struct TrainingReplayStats {
+    uint64_t pushed;
+    uint64_t dropped;                    /* pushes refused because staging was full */
+    uint64_t drawn;
+    uint64_t priority_updates;
+    uint32_t resident;
+    double total_priority;
+    double mean_weight;                  /* mean IS weight over all draws */
+} TrainingReplayStats;
+
+/*
+ * Prioritized replay: a ring of `capacity` sample slots with a sum-tree over their priorities
+ * (loss + epsilon)^alpha, so a proportional draw and a priority update are both O(log n).
+ * A min-tree alongside it gives the largest importance-sampling weight for normalisation.
+ *
+ * Push is the producer side and Draw/UpdatePriority the consumer side. Pushes land in a
+ * staging ring that the consumer folds into the slots and trees at its next Draw; `staged_head`
+ * is written only by the producer and `staged_tail` only by the consumer, so one producer and
+ * one consumer never lock. The slots and trees belong to the consumer alone.
+ */
+typedef struct TrainingReplay {
+    TrainingReplayConfig config;
+    size_t input_size;
+    size_t target_size;
+    uint8_t* slab;                       /* capacity slots, then staging slots; input + target each */
+    double* staged_priority;             /* [staging] */
+    volatile LONG staged_head;           /* producer: pushes published */
+    volatile LONG staged_tail;           /* consumer: pushes folded in */
+    uint32_t leaves;                     /* capacity rounded up to a power of two */
+    double* sum_tree;                    /* [2 * leaves]; node 1 is the root, leaf i at leaves + i */
+    double* min_tree;                    /* same shape; empty leaves hold DBL_MAX */
+    uint32_t next_slot;                  /* ring position of the next folded sample */
+    uint32_t resident;
+    EvolutionRng rng;
+    uint64_t pushed;                     /* producer only */
+    uint64_t dropped;                    /* producer only */
+    uint64_t drawn;
+    uint64_t priority_updates;
+    double weight_sum;
+    bool initialized;
+} TrainingReplay;
+
+void TrainingReplay_GetDefaultConfig(TrainingReplayConfig* config);
+NTSTATUS TrainingReplay_Initialize(TrainingReplay* replay, const TrainingReplayConfig* config,
+    size_t input_size, size_t target_size);
+void TrainingReplay_Shutdown(TrainingReplay* replay);
+
+/* Producer. `loss` sets the initial priority. STATUS_PENDING (sample dropped) when staging is full. */
+NTSTATUS TrainingReplay_Push(TrainingReplay* replay, const uint8_t* input, const uint8_t* target, double loss);
+
+/* Consumer. True once min_fill samples are resident (folds pending pushes first). */
+bool TrainingReplay_Ready(TrainingReplay* replay);
+/* Consumer. Copies a sample drawn in proportion to its priority; `weight` is its normalised
+ * importance-sampling weight in (0, 1]. STATUS_NOT_FOUND while the buffer is empty. */
+NTSTATUS TrainingReplay_Draw(TrainingReplay* replay, uint8_t* input, uint8_t* target,
+    uint32_t* slot, double* weight);
+/* Consumer. Re-prioritises a drawn slot with the loss it produced this time. */
+void TrainingReplay_UpdatePriority(TrainingReplay* replay, uint32_t slot, double loss);
+
+void TrainingReplay_GetStats(const TrainingReplay* replay, TrainingReplayStats* out);
+
+#endif
@@ -76,6 +76,34 @@ def compile_sources(compiler):
 
         # Evolution Engine
         ('Core/Evolution/evolution_engine.cpp', 'evolution_engine.obj'),
+        ('Core/Evolution/evolution_islands.cpp', 'evolution_islands.obj'),
+        ('Core/Evolution/evolution_remote.cpp', 'evolution_remote.obj'),
+        ('Core/Evolution/evolution_operators.cpp', 'evolution_operators.obj'),
+        ('Core/Evolution/evolution_diversity.cpp', 'evolution_diversity.obj'),
+        ('Core/Evolution/evolution_map_elites.cpp', 'evolution_map_elites.obj'),
+        ('Core/Evolution/evolution_surrogate.cpp', 'evolution_surrogate.obj'),
+        ('Core/Evolution/evolution_checkpoint.cpp', 'evolution_checkpoint.obj'),
+        ('Core/Evolution/evolution_selection.cpp', 'evolution_selection.obj'),
+
+        # Training
+        ('Core/Training/training_pipeline.cpp', 'training_pipeline.obj'),
+        ('Core/Training/training_pbt.cpp', 'training_pbt.obj'),
+        ('Core/Training/training_prefetch.cpp', 'training_prefetch.obj'),
+        ('Core/Training/training_corpus.cpp', 'training_corpus.obj'),
+        ('Core/Training/training_evolver.cpp', 'training_evolver.obj'),
+        ('Core/Training/training_bench.cpp', 'training_bench.obj'),
+        ('Core/Training/training_replay.cpp', 'training_replay.obj'),
+        ('Core/Training/training_dataparallel.cpp', 'training_dataparallel.obj'),
+
+        # Scheduler
+        ('Core/Scheduler/qpc_clock.cpp', 'qpc_clock.obj'),
+        ('Core/Scheduler/task_scheduler.cpp', 'task_scheduler.obj'),
+        ('Core/Scheduler/thread_pool.cpp', 'thread_pool.obj'),
+        ('Core/Scheduler/startup_graph.cpp', 'startup_graph.obj'),
+
+        # Status channel and background robustness worker
+        ('Core/Telemetry/status_channel.cpp', 'status_channel.obj'),
+        ('Core/StressTest/robustness_worker.cpp', 'robustness_worker.obj'),
 
         # Main
         ('Core/Main/raijin_main.cpp', 'raijin_main.obj'),
@@ -85,7 +113,8 @@ def compile_sources(compiler):
     objects = []
     include_dirs = ['Include', 'Core/HAL', 'Core/Hypervisor', 'Core/Neural',
                    'Core/Ethics', 'Core/ScreenControl', 'Core/InternetAcquisition',
-                   'Core/ProgrammingDomination', 'Core/Autonomous', 'Core/Evolution']
+                   'Core/ProgrammingDomination', 'Core/Autonomous', 'Core/Evolution',
+                   'Core/Training', 'Core/Scheduler']
 
     for source, obj in sources:
         obj_path = f'obj/{obj}'
@@ -75,10 +75,40 @@ g++.exe %CXXFLAGS% Core/Autonomous/autonomous_manager.cpp -o obj/autonomous_mana
 if errorlevel 1 goto :build_error
 g++.exe %CXXFLAGS% Core/Evolution/evolution_engine.cpp -o obj/evolution_engine.o
 if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Evolution/evolution_islands.cpp -o obj/evolution_islands.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Evolution/evolution_remote.cpp -o obj/evolution_remote.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Evolution/evolution_operators.cpp -o obj/evolution_operators.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Evolution/evolution_diversity.cpp -o obj/evolution_diversity.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Evolution/evolution_map_elites.cpp -o obj/evolution_map_elites.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Evolution/evolution_surrogate.cpp -o obj/evolution_surrogate.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Evolution/evolution_checkpoint.cpp -o obj/evolution_checkpoint.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Evolution/evolution_selection.cpp -o obj/evolution_selection.o
+if errorlevel 1 goto :build_error
 
 echo [9/12] Compiling Training, Telemetry, Memory, SelfTest...
 g++.exe %CXXFLAGS% Core/Training/training_pipeline.cpp -o obj/training_pipeline.o
 if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Training/training_pbt.cpp -o obj/training_pbt.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Training/training_prefetch.cpp -o obj/training_prefetch.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Training/training_corpus.cpp -o obj/training_corpus.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Training/training_evolver.cpp -o obj/training_evolver.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Training/training_bench.cpp -o obj/training_bench.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Training/training_replay.cpp -o obj/training_replay.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Training/training_dataparallel.cpp -o obj/training_dataparallel.o
+if errorlevel 1 goto :build_error
 g++.exe %CXXFLAGS% Core/Telemetry/telemetry.cpp -o obj/telemetry.o
 if errorlevel 1 goto :build_error
 g++.exe %CXXFLAGS% Core/Memory/long_term_memory.cpp -o obj/long_term_memory.o
@@ -119,6 +149,18 @@ g++.exe %CXXFLAGS% Core/TaskOracle/task_oracle.cpp -o obj/task_oracle.o
 if errorlevel 1 goto :build_error
 g++.exe %CXXFLAGS% Core/Main/runtime_config.cpp -o obj/runtime_config.o
 if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Scheduler/qpc_clock.cpp -o obj/qpc_clock.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Scheduler/task_scheduler.cpp -o obj/task_scheduler.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Scheduler/thread_pool.cpp -o obj/thread_pool.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Telemetry/status_channel.cpp -o obj/status_channel.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/StressTest/robustness_worker.cpp -o obj/robustness_worker.o
+if errorlevel 1 goto :build_error
+g++.exe %CXXFLAGS% Core/Scheduler/startup_graph.cpp -o obj/startup_graph.o
+if errorlevel 1 goto :build_error
 g++.exe %CXXFLAGS% Core/FitnessLedger/fitness_ledger.cpp -o obj/fitness_ledger.o
 if errorlevel 1 goto :build_error
 g++.exe %CXXFLAGS% Core/RegressionReplay/regression_replay.cpp -o obj/regression_replay.o
@@ -134,11 +176,11 @@ if errorlevel 1 goto :build_error
 
 echo.
 echo Linking raijin.exe...
-g++.exe obj/hal_13700k.o obj/hypervisor_layer.o obj/neural_substrate.o obj/role_boundary.o obj/ethics_system.o obj/screen_control.o obj/internet_acquisition.o obj/http_client.o obj/programming_domination.o obj/autonomous_manager.o obj/evolution_engine.o obj/training_pipeline.o obj/telemetry.o obj/long_term_memory.o obj/self_test.o obj/dominance_metrics.o obj/regression_detector.o obj/anomaly_detector.o obj/lineage_tracker.o obj/versioning_rollback.o obj/self_healing.o obj/fitness_ledger.o obj/regression_replay.o obj/introspection_system.o obj/stress_test_framework.o obj/adversarial_stress.o obj/resource_governor.o obj/world_model.o obj/episodic_memory.o obj/provenance.o obj/curriculum.o obj/task_oracle.o obj/red_team.o obj/runtime_config.o obj/raijin_main.o -o Bin/raijin.exe %LDFLAGS_BASE% -lpsapi
+g++.exe obj/hal_13700k.o obj/hypervisor_layer.o obj/neural_substrate.o obj/role_boundary.o obj/ethics_system.o obj/screen_control.o obj/internet_acquisition.o obj/http_client.o obj/programming_domination.o obj/autonomous_manager.o obj/evolution_engine.o obj/evolution_islands.o obj/evolution_remote.o obj/evolution_operators.o obj/evolution_diversity.o obj/evolution_map_elites.o obj/evolution_surrogate.o obj/evolution_checkpoint.o obj/evolution_selection.o obj/training_pipeline.o obj/training_pbt.o obj/training_prefetch.o obj/training_corpus.o obj/training_evolver.o obj/training_bench.o obj/training_replay.o obj/training_dataparallel.o obj/telemetry.o obj/long_term_memory.o obj/self_test.o obj/dominance_metrics.o obj/regression_detector.o obj/anomaly_detector.o obj/lineage_tracker.o obj/versioning_rollback.o obj/self_healing.o obj/fitness_ledger.o obj/regression_replay.o obj/introspection_system.o obj/stress_test_framework.o obj/adversarial_stress.o obj/resource_governor.o obj/world_model.o obj/episodic_memory.o obj/provenance.o obj/curriculum.o obj/task_oracle.o obj/red_team.o obj/runtime_config.o obj/task_scheduler.o obj/qpc_clock.o obj/thread_pool.o obj/status_channel.o obj/robustness_worker.o obj/startup_graph.o obj/raijin_main.o -o Bin/raijin.exe %LDFLAGS_BASE% -lpsapi
 if errorlevel 1 goto :build_error
 
 echo Linking raijin-dominate.exe...
-g++.exe obj/hal_13700k.o obj/hypervisor_layer.o obj/neural_substrate.o obj/role_boundary.o obj/ethics_system.o obj/screen_control.o obj/internet_acquisition.o obj/http_client.o obj/programming_domination.o obj/autonomous_manager.o obj/evolution_engine.o obj/dominate_main.o -o Bin/raijin-dominate.exe %LDFLAGS_BASE%
+g++.exe obj/hal_13700k.o obj/hypervisor_layer.o obj/neural_substrate.o obj/role_boundary.o obj/ethics_system.o obj/screen_control.o obj/internet_acquisition.o obj/http_client.o obj/programming_domination.o obj/autonomous_manager.o obj/evolution_engine.o obj/evolution_operators.o obj/evolution_diversity.o obj/evolution_map_elites.o obj/evolution_surrogate.o obj/evolution_checkpoint.o obj/evolution_selection.o obj/qpc_clock.o obj/thread_pool.o obj/dominate_main.o -o Bin/raijin-dominate.exe %LDFLAGS_BASE%
 if errorlevel 1 goto :build_error
 
 echo.
@@ -56,6 +56,20 @@ if errorlevel 1 goto :build_error
 echo [7/10] Compiling Training Pipeline...
 cl.exe %CXXFLAGS% Core\Training\training_pipeline.cpp /Fo:obj\training_pipeline.obj
 if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Training\training_pbt.cpp /Fo:obj\training_pbt.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Training\training_prefetch.cpp /Fo:obj\training_prefetch.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Training\training_corpus.cpp /Fo:obj\training_corpus.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Training\training_evolver.cpp /Fo:obj\training_evolver.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Training\training_bench.cpp /Fo:obj\training_bench.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Training\training_replay.cpp /Fo:obj\training_replay.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Training\training_dataparallel.cpp /Fo:obj\training_dataparallel.obj
+if errorlevel 1 goto :build_error
 
 echo [8/10] Compiling Programming Domination...
 cl.exe %CXXFLAGS% Core\ProgrammingDomination\programming_domination.cpp /Fo:obj\programming_domination.obj
@@ -66,6 +80,22 @@ cl.exe %CXXFLAGS% Core\Autonomous\autonomous_manager.cpp /Fo:obj\autonomous_mana
 if errorlevel 1 goto :build_error
 cl.exe %CXXFLAGS% Core\Evolution\evolution_engine.cpp /Fo:obj\evolution_engine.obj
 if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Evolution\evolution_islands.cpp /Fo:obj\evolution_islands.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Evolution\evolution_remote.cpp /Fo:obj\evolution_remote.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Evolution\evolution_operators.cpp /Fo:obj\evolution_operators.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Evolution\evolution_diversity.cpp /Fo:obj\evolution_diversity.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Evolution\evolution_map_elites.cpp /Fo:obj\evolution_map_elites.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Evolution\evolution_surrogate.cpp /Fo:obj\evolution_surrogate.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Evolution\evolution_checkpoint.cpp /Fo:obj\evolution_checkpoint.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Evolution\evolution_selection.cpp /Fo:obj\evolution_selection.obj
+if errorlevel 1 goto :build_error
 
 echo [9/12] Compiling Training, Telemetry, Memory, SelfTest...
 cl.exe %CXXFLAGS% Core\Training\training_pipeline.cpp /Fo:obj\training_pipeline.obj
@@ -126,6 +156,18 @@ if errorlevel 1 goto :build_error
 echo [14/22] Compiling Main and Runtime Config...
 cl.exe %CXXFLAGS% Core\Main\runtime_config.cpp /Fo:obj\runtime_config.obj
 if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Scheduler\qpc_clock.cpp /Fo:obj\qpc_clock.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Scheduler\task_scheduler.cpp /Fo:obj\task_scheduler.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Scheduler\thread_pool.cpp /Fo:obj\thread_pool.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Telemetry\status_channel.cpp /Fo:obj\status_channel.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\StressTest\robustness_worker.cpp /Fo:obj\robustness_worker.obj
+if errorlevel 1 goto :build_error
+cl.exe %CXXFLAGS% Core\Scheduler\startup_graph.cpp /Fo:obj\startup_graph.obj
+if errorlevel 1 goto :build_error
 cl.exe %CXXFLAGS% Core\Main\raijin_main.cpp /Fo:obj\raijin_main.obj
 if errorlevel 1 goto :build_error
 cl.exe %CXXFLAGS% Core\Main\dominate_main.cpp /Fo:obj\dominate_main.obj
@@ -133,11 +175,11 @@ if errorlevel 1 goto :build_error
 
 echo.
 echo Linking raijin.exe...
-link.exe obj\hal_13700k.obj obj\hypervisor_layer.obj obj\neural_substrate.obj obj\ethics_system.obj obj\screen_control.obj obj\internet_acquisition.obj obj\http_client.obj obj\programming_domination.obj obj\autonomous_manager.obj obj\evolution_engine.obj obj\training_pipeline.obj obj\telemetry.obj obj\long_term_memory.obj obj\self_test.obj obj\dominance_metrics.obj obj\regression_detector.obj obj\anomaly_detector.obj obj\lineage_tracker.obj obj\versioning_rollback.obj obj\self_healing.obj obj\fitness_ledger.obj obj\regression_replay.obj obj\world_model.obj obj\episodic_memory.obj obj\provenance.obj obj\curriculum.obj obj\red_team.obj obj\resource_governor.obj obj\role_boundary.obj obj\task_oracle.obj obj\introspection_system.obj obj\stress_test_framework.obj obj\adversarial_stress.obj obj\runtime_config.obj obj\raijin_main.obj /OUT:Bin\raijin.exe /SUBSYSTEM:CONSOLE /MACHINE:X64 kernel32.lib user32.lib advapi32.lib ws2_32.lib psapi.lib
+link.exe obj\hal_13700k.obj obj\hypervisor_layer.obj obj\neural_substrate.obj obj\ethics_system.obj obj\screen_control.obj obj\internet_acquisition.obj obj\http_client.obj obj\programming_domination.obj obj\autonomous_manager.obj obj\evolution_engine.obj obj\evolution_islands.obj obj\evolution_remote.obj obj\evolution_operators.obj obj\evolution_diversity.obj obj\evolution_map_elites.obj obj\evolution_surrogate.obj obj\evolution_checkpoint.obj obj\evolution_selection.obj obj\training_pipeline.obj obj\training_pbt.obj obj\training_prefetch.obj obj\training_corpus.obj obj\training_evolver.obj obj\training_bench.obj obj\training_replay.obj obj\training_dataparallel.obj obj\telemetry.obj obj\long_term_memory.obj obj\self_test.obj obj\dominance_metrics.obj obj\regression_detector.obj obj\anomaly_detector.obj obj\lineage_tracker.obj obj\versioning_rollback.obj obj\self_healing.obj obj\fitness_ledger.obj obj\regression_replay.obj obj\world_model.obj obj\episodic_memory.obj obj\provenance.obj obj\curriculum.obj obj\red_team.obj obj\resource_governor.obj obj\role_boundary.obj obj\task_oracle.obj obj\introspection_system.obj obj\stress_test_framework.obj obj\adversarial_stress.obj obj\runtime_config.obj obj\task_scheduler.obj obj\qpc_clock.obj obj\thread_pool.obj obj\status_channel.obj obj\robustness_worker.obj obj\startup_graph.obj obj\raijin_main.obj /OUT:Bin\raijin.exe /SUBSYSTEM:CONSOLE /MACHINE:X64 kernel32.lib user32.lib advapi32.lib ws2_32.lib psapi.lib
 if errorlevel 1 goto :build_error
 
 echo Linking raijin-dominate.exe...
-link.exe obj\hal_13700k.obj obj\hypervisor_layer.obj obj\neural_substrate.obj obj\ethics_system.obj obj\screen_control.obj obj\internet_acquisition.obj obj\http_client.obj obj\training_pipeline.obj obj\programming_domination.obj obj\autonomous_manager.obj obj\evolution_engine.obj obj\dominance_metrics.obj obj\regression_detector.obj obj\anomaly_detector.obj obj\lineage_tracker.obj obj\versioning_rollback.obj obj\self_healing.obj obj\introspection_system.obj obj\stress_test_framework.obj obj\dominate_main.obj /OUT:Bin\raijin-dominate.exe /SUBSYSTEM:CONSOLE /MACHINE:X64 kernel32.lib user32.lib advapi32.lib ws2_32.lib
+link.exe obj\hal_13700k.obj obj\hypervisor_layer.obj obj\neural_substrate.obj obj\ethics_system.obj obj\screen_control.obj obj\internet_acquisition.obj obj\http_client.obj obj\training_pipeline.obj obj\training_pbt.obj obj\training_prefetch.obj obj\training_corpus.obj obj\training_evolver.obj obj\training_bench.obj obj\training_replay.obj obj\training_dataparallel.obj obj\programming_domination.obj obj\autonomous_manager.obj obj\evolution_engine.obj obj\evolution_operators.obj obj\evolution_diversity.obj obj\evolution_map_elites.obj obj\evolution_surrogate.obj obj\evolution_checkpoint.obj obj\evolution_selection.obj obj\dominance_metrics.obj obj\regression_detector.obj obj\anomaly_detector.obj obj\lineage_tracker.obj obj\versioning_rollback.obj obj\self_healing.obj obj\introspection_system.obj obj\stress_test_framework.obj obj\role_boundary.obj obj\resource_governor.obj obj\qpc_clock.obj obj\thread_pool.obj obj\dominate_main.obj /OUT:Bin\raijin-dominate.exe /SUBSYSTEM:CONSOLE /MACHINE:X64 kernel32.lib user32.lib advapi32.lib ws2_32.lib
 if errorlevel 1 goto :build_error
 
 echo.